@@ -0,0 +1,73 @@
+-- Times the mathv functions that have vectorized kernels, with the
+-- kernels enabled and disabled (see mathv.simd), on dense and strided
+-- views of each float type, and prints the throughput in millions of
+-- components per second.
+
+local n = 1000000
+local reps = 20
+
+local binary_ops = {"add", "sub", "vec_mul", "div", "min", "max"}
+local unary_ops = {"abs", "floor", "ceil", "sin", "cos"}
+
+local types = {
+    {name = "float", components = 1},
+    {name = "vec2",  components = 2},
+    {name = "vec3",  components = 3},
+    {name = "vec4",  components = 4},
+}
+
+local
+function make_views(t)
+    local dense_x = mathv.random("float", n * t.components, -100, 100)
+        .buffer:view(t.name)
+    local dense_y = mathv.random("float", n * t.components, 1, 100)
+        .buffer:view(t.name)
+    -- interleave with a dummy attribute so the views aren't tightly packed
+    local arr = am.struct_array(n, {"x", t.name, "pad", "float", "y", t.name})
+    arr.x:set(dense_x)
+    arr.y:set(dense_y)
+    return {
+        dense = {x = dense_x, y = dense_y, out = am.buffer(n * t.components * 4):view(t.name)},
+        strided = {x = arr.x, y = arr.y, out = am.struct_array(n, {"out", t.name, "pad", "float"}).out},
+    }
+end
+
+local
+function time_op(op, x, y, out)
+    local f = out[op]
+    local t0 = am.current_time()
+    for i = 1, reps do
+        if y then
+            f(out, x, y)
+        else
+            f(out, x)
+        end
+    end
+    return am.current_time() - t0
+end
+
+local isa = mathv.simd()
+print(string.format("%-7s %-6s %-8s %12s %12s %8s", "op", "type", "layout", "scalar", isa, "speedup"))
+for _, t in ipairs(types) do
+    local views = make_views(t)
+    for _, layout in ipairs{"dense", "strided"} do
+        local v = views[layout]
+        local
+        function report(op, binary)
+            local y = binary and v.y or nil
+            mathv.simd(false)
+            local scalar_time = time_op(op, v.x, y, v.out)
+            mathv.simd(true)
+            local simd_time = time_op(op, v.x, y, v.out)
+            local comps = n * t.components * reps / 1e6
+            print(string.format("%-7s %-6s %-8s %9.1fM/s %9.1fM/s %7.2fx",
+                op, t.name, layout, comps / scalar_time, comps / simd_time, scalar_time / simd_time))
+        end
+        for _, op in ipairs(binary_ops) do
+            report(op, true)
+        end
+        for _, op in ipairs(unary_ops) do
+            report(op, false)
+        end
+    end
+end
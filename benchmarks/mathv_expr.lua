@@ -0,0 +1,36 @@
+-- Times some typical particle updates written as chains of mathv
+-- calls and as fused mathv.expr expressions, and prints the average
+-- time per update.
+
+local n = 1000000
+local reps = 20
+
+local pos = mathv.random("float", n * 2, -100, 100).buffer:view("vec2")
+local vel = mathv.random("float", n * 2, -1, 1).buffer:view("vec2")
+local acc = mathv.random("float", n * 2, -1, 1).buffer:view("vec2")
+local out = am.buffer(n * 8):view("vec2")
+local dt = 1 / 60
+
+local
+function time(label, f)
+    local t0 = am.current_time()
+    for i = 1, reps do
+        f()
+    end
+    print(string.format("%-14s %8.2fms", label, (am.current_time() - t0) / reps * 1000))
+end
+
+local integrate = mathv.expr(function(p, v, a, dt) return p + (v + a * dt) * dt end)
+time("integrate", function() local r = pos + (vel + acc * dt) * dt end)
+time("  into", function()
+    out:vec_mul(acc, dt)
+    out:add(out, vel)
+    out:vec_mul(out, dt)
+    out:add(out, pos)
+end)
+time("  fused", function() local r = integrate(pos, vel, acc, dt) end)
+time("  fused into", function() integrate:into(out, pos, vel, acc, dt) end)
+
+local wave = mathv.expr(function(p, t) return (p * 0.1 + t):sin() * 0.5 + 0.5 end)
+time("wave", function() local r = mathv.sin(pos * 0.1 + 2) * 0.5 + 0.5 end)
+time("  fused into", function() wave:into(out, pos, 2) end)
@@ -0,0 +1,43 @@
+-- Times adding and removing quads at random from a set of 20000, as
+-- happens with bullets or particles, and prints the average time per
+-- 1000 removals plus additions.
+
+local n = 20000
+local churn = 1000
+local reps = 20
+local spec = {"vert", "vec2", "color", "vec4"}
+local verts = {vec2(0, 1), vec2(0, 0), vec2(1, 0), vec2(1, 1)}
+local color = vec4(1)
+
+local
+function time(label, f)
+    local t0 = am.current_time()
+    for i = 1, reps do
+        f()
+    end
+    print(string.format("%-12s %8.2fms", label, (am.current_time() - t0) / reps * 1000))
+end
+
+local quads = am.quads(n, spec)
+for i = 1, n do
+    quads:add_quad{vert = verts, color = color}
+end
+time("quads", function()
+    for i = 1, churn do
+        quads:remove_quad(math.random(quads.num_quads))
+        quads:add_quad{vert = verts, color = color}
+    end
+end)
+
+local batch = am.quad_batch(n, spec)
+local handles = {}
+for i = 1, n do
+    handles[i] = batch:add_quad{vert = verts, color = color}
+end
+time("quad_batch", function()
+    for i = 1, churn do
+        local j = math.random(n)
+        batch:remove_quad(handles[j])
+        handles[j] = batch:add_quad{vert = verts, color = color}
+    end
+end)
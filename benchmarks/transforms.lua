@@ -0,0 +1,52 @@
+-- Traverses a scene with lots of nested transform nodes and logs the
+-- average time spent drawing a frame. The chains end in empty groups,
+-- so nothing is drawn and the time is all transform node traversal and
+-- matrix multiplies. The draw time is only measured to the millisecond,
+-- so there are enough nodes to take several milliseconds, and the
+-- slowest tenth of the frames (garbage collection pauses and so on) are
+-- left out of the average.
+
+am.enable_perf_timings()
+
+local win = am.window{width = 800, height = 600}
+
+local frames = 300
+local n = 20000
+local depth = 9
+
+local scene = am.group()
+for i = 1, n do
+    local chain = am.group()
+    for d = 1, depth do
+        if d % 3 == 0 then
+            chain = am.scale(1.01) ^ chain
+        elseif d % 3 == 1 then
+            chain = am.rotate(i + d) ^ chain
+        else
+            chain = am.translate(1, d) ^ chain
+        end
+    end
+    scene:append(chain)
+end
+win.scene = scene
+
+local times = {}
+local frame = 0
+
+scene:action(function()
+    frame = frame + 1
+    if frame > 10 then
+        -- skip the first few frames while things warm up
+        table.insert(times, am.last_frame_draw_time())
+    end
+    if frame == frames + 10 then
+        table.sort(times)
+        local count = math.floor(#times * 0.9)
+        local total = 0
+        for i = 1, count do
+            total = total + times[i]
+        end
+        log("%0.3fms per frame", total / count * 1000)
+        win:close()
+    end
+end)
@@ -0,0 +1,226 @@
+/* This is a generated file. DO NOT EDIT! */
+
+LJ_DATADEF const uint16_t lj_bc_ofs[] = {
+0,
+72,
+144,
+216,
+288,
+427,
+569,
+632,
+695,
+764,
+833,
+886,
+938,
+989,
+1040,
+1081,
+1122,
+1148,
+1180,
+1240,
+1314,
+1368,
+1422,
+1476,
+1530,
+1589,
+1643,
+1697,
+1751,
+1805,
+1841,
+1908,
+1975,
+2042,
+2109,
+2158,
+2230,
+2306,
+2342,
+2378,
+2408,
+2437,
+2462,
+2505,
+2541,
+2628,
+2710,
+2748,
+2782,
+2833,
+2897,
+3006,
+3099,
+3117,
+3135,
+3283,
+3407,
+3506,
+3679,
+3908,
+4032,
+4174,
+4220,
+4262,
+4266,
+4414,
+4482,
+4647,
+4838,
+4926,
+4930,
+5066,
+5158,
+5263,
+5360,
+5465,
+5485,
+5555,
+5622,
+5642,
+5686,
+5725,
+5745,
+5763,
+5810,
+5835,
+5855,
+5918,
+5972,
+5972,
+6097,
+6098,
+6177,
+7841,
+7908,
+8419,
+8522,
+8579,
+8710,
+7974,
+8136,
+8228,
+8280,
+8311,
+8768,
+8809,
+9417,
+8864,
+9167,
+9469,
+9596,
+9620,
+9647,
+9711,
+9744,
+9778,
+9809,
+9840,
+9873,
+9914,
+9957,
+9990,
+10030,
+10070,
+10245,
+10393,
+10110,
+10110,
+9678,
+10149,
+10549,
+10492,
+10196,
+10603,
+10662,
+11596,
+11994,
+11941,
+12063,
+12142,
+12224,
+12306,
+12388,
+11650,
+11747,
+11844,
+10721,
+10752,
+10799,
+10921,
+11090,
+11217,
+11327,
+11442,
+11557
+};
+
+LJ_DATADEF const uint16_t lj_bc_mode[] = {
+BCDEF(BCMODE)
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF,
+BCMODE_FF
+};
+
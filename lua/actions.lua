@@ -23,6 +23,27 @@ function am.step_action(f, node)
 end
 
 local do_action = am.step_action
+local profile_begin_node = am._profile_begin_node
+local profile_end = am._profile_end
+
+local
+function do_profiled_action(f, node)
+    if profile_begin_node(node) then
+        -- if the action raises an error the zone is closed at the
+        -- start of the next frame
+        local done = do_action(f, node)
+        profile_end()
+        return done
+    end
+    return do_action(f, node)
+end
+
+-- the profiler only wraps actions while node profiling is on
+local do_node_action = do_action
+
+am._register_pre_frame_func(function()
+    do_node_action = am._profiling_nodes() and do_profiled_action or do_action
+end)
 
 function am._execute_actions(actions, from, to)
     local t = am.frame_time
@@ -37,7 +58,7 @@ function am._execute_actions(actions, from, to)
                     actions[i] = false
                     if action.seq ~= seq then
                         action.seq = seq
-                        if do_action(action.func, action.node) then
+                        if do_node_action(action.func, action.node) then
                             -- remove action
                             local node_actions = action.node._actions
                             for j = 1, #node_actions do
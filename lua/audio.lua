@@ -8,6 +8,21 @@ function am.schedule_audio(audio_node)
     root:add(audio_node)
 end
 
+local audio_loader_mt = _metatable_registry.audio_loader
+
+-- Yields until loading has finished when called from a coroutine,
+-- otherwise blocks.
+function audio_loader_mt.wait(loader)
+    if coroutine.running() then
+        while not loader.done do
+            coroutine.yield()
+        end
+    else
+        loader:_block()
+    end
+    return loader.buffers, loader.errors
+end
+
 local buffer_cache = {}
 
 local
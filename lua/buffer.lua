@@ -369,7 +369,156 @@ function mathv.struct_of_arrays(capacity, spec)
     return mathv.view_group(create_struct_of_arrays(capacity, spec))
 end
 
+-- mathv.expr(f) calls f with placeholder values for its arguments and
+-- records the operations f applies to them. The result can then be
+-- called with views (and numbers or vectors) to evaluate all the
+-- operations in a single pass, without creating intermediate views.
+-- expr:into(target, ...) writes the result into an existing view.
+-- Note that * is always component-wise.
+
+local max_expr_args = 16
+
+local expr_node_mt = {}
+expr_node_mt.__index = expr_node_mt
+
+local
+function expr_node(op, ...)
+    return setmetatable({op = op, ...}, expr_node_mt)
+end
+
+for _, op in ipairs{"add", "sub", "mul", "div", "mod", "pow"} do
+    expr_node_mt["__"..op] = function(a, b)
+        return expr_node(op, a, b)
+    end
+end
+expr_node_mt.__unm = function(a)
+    return expr_node("unm", a)
+end
+for _, op in ipairs{"abs", "acos", "asin", "atan", "ceil", "cos", "floor", "fract", "log", "sign", "sin", "tan"} do
+    expr_node_mt[op] = function(a)
+        return expr_node(op, a)
+    end
+end
+for _, op in ipairs{"atan2", "max", "min", "mod", "pow", "lt", "lte", "gt", "gte"} do
+    expr_node_mt[op] = function(a, b)
+        return expr_node(op, a, b)
+    end
+end
+for _, op in ipairs{"clamp", "mix"} do
+    expr_node_mt[op] = function(a, b, c)
+        return expr_node(op, a, b, c)
+    end
+end
+
+function mathv.expr(f)
+    local args = {}
+    for i = 1, max_expr_args do
+        args[i] = expr_node("param", i)
+    end
+    local result = f(unpack(args))
+    if getmetatable(result) ~= expr_node_mt then
+        error("the mathv.expr function must return an expression of its arguments", 2)
+    end
+    -- flatten the expression into a list of values, each of which only
+    -- refers to values before it
+    local values = {}
+    local positions = {}
+    local
+    function flatten(node)
+        if getmetatable(node) ~= expr_node_mt then
+            table.insert(values, {"const", node})
+            return #values
+        end
+        if not positions[node] then
+            local value = {node.op}
+            if node.op == "param" then
+                value[2] = node[1]
+            else
+                for i = 1, #node do
+                    value[i + 1] = flatten(node[i])
+                end
+            end
+            table.insert(values, value)
+            positions[node] = #values
+        end
+        return positions[node]
+    end
+    flatten(result)
+    return mathv._compile_expr(values)
+end
+
 -- legacy function (keep for backwards compatibility)
 function am.struct_array(capacity, spec)
     return create_array_of_structs(capacity, spec)
 end
+
+-- On LuaJIT, setting a tightly packed float view from a table of numbers
+-- uses loops that the JIT compiles to write straight to the buffer's
+-- dataptr, instead of reading the table through the Lua API. Everything
+-- else goes to the native view:set. It also reports any errors, so the
+-- loops just stop at the first element that isn't all numbers.
+if jit and ffi then
+    local f32_view_mt = _metatable_registry.F32_view
+    local native_set = f32_view_mt.set
+    local view_layout = am._view_layout
+    local float_ptr = ffi.typeof("float*")
+
+    f32_view_mt.set = function(view, values, ...)
+        if select("#", ...) > 0 or type(values) ~= "table" or type(values[1]) ~= "number" then
+            return native_set(view, values, ...)
+        end
+        local offset, stride, size, components = view_layout(view)
+        if components > 4 or stride ~= components * 4 or offset % 4 ~= 0 then
+            return native_set(view, values)
+        end
+        local buf = view.buffer
+        local dst = ffi.cast(float_ptr, buf.dataptr) + offset / 4
+        local len = 0
+        if components == 1 then
+            for i = 1, size do
+                local x = values[i]
+                if type(x) ~= "number" then
+                    break
+                end
+                dst[i - 1] = x
+                len = i
+            end
+        elseif components == 2 then
+            for e = 1, size do
+                local k = e * 2
+                local x, y = values[k - 1], values[k]
+                if type(x) ~= "number" or type(y) ~= "number" then
+                    break
+                end
+                dst[k - 2], dst[k - 1] = x, y
+                len = e
+            end
+        elseif components == 3 then
+            for e = 1, size do
+                local k = e * 3
+                local x, y, z = values[k - 2], values[k - 1], values[k]
+                if type(x) ~= "number" or type(y) ~= "number" or type(z) ~= "number" then
+                    break
+                end
+                dst[k - 3], dst[k - 2], dst[k - 1] = x, y, z
+                len = e
+            end
+        else
+            for e = 1, size do
+                local k = e * 4
+                local x, y, z, w = values[k - 3], values[k - 2], values[k - 1], values[k]
+                if type(x) ~= "number" or type(y) ~= "number" or type(z) ~= "number" or type(w) ~= "number" then
+                    break
+                end
+                dst[k - 4], dst[k - 3], dst[k - 2], dst[k - 1] = x, y, z, w
+                len = e
+            end
+        end
+        if len < size and values[len * components + 1] ~= nil then
+            return native_set(view, values)
+        end
+        if len > 0 then
+            buf:mark_dirty(offset, offset + len * stride)
+        end
+    end
+end
@@ -66,6 +66,308 @@ function get_particles2d_shader_tex()
     return particles2d_shader_tex
 end
 
+-- GPU mode: the particle state is kept in two float textures, which
+-- are updated each frame by rendering into a second pair of textures
+-- and then swapping them. Texture A holds the position and velocity and
+-- texture B holds the time-to-live, the total life and a random seed
+-- from which the vertex shader derives each particle's size and color.
+-- A particle is dead if its time-to-live is zero or less.
+
+local gpu_hash_func = [[
+    float hash(vec2 p) {
+        vec3 p3 = fract(vec3(p.xyx) * 0.1031);
+        p3 += dot(p3, p3.yzx + 33.33);
+        return fract((p3.x + p3.y) * p3.z);
+    }
+]]
+
+local particles2d_gpu_update_shaders = {}
+
+local
+function get_particles2d_gpu_update_shader(output)
+    if particles2d_gpu_update_shaders[output] then
+        return particles2d_gpu_update_shaders[output]
+    end
+    local v = [[
+        precision highp float;
+        attribute vec2 vert;
+        void main() {
+            gl_Position = vec4(vert, 0.0, 1.0);
+        }
+    ]]
+    local f = [[
+        precision highp float;
+        uniform sampler2D state_a;
+        uniform sampler2D state_b;
+        uniform vec2 state_size;
+        uniform float max_particles;
+        uniform float dt;
+        uniform float seed;
+        uniform float spawn_start;
+        uniform float spawn_count;
+        uniform vec2 source_pos;
+        uniform vec2 source_pos_var;
+        uniform float angle;
+        uniform float angle_var;
+        uniform float speed;
+        uniform float speed_var;
+        uniform float life;
+        uniform float life_var;
+        uniform vec2 gravity;
+        uniform float damping;
+    ]]..gpu_hash_func..[[
+        float rand_var(float k) {
+            return hash(gl_FragCoord.xy + vec2(seed, k * 17.0)) * 2.0 - 1.0;
+        }
+        void main() {
+            vec2 uv = gl_FragCoord.xy / state_size;
+            vec4 a = texture2D(state_a, uv);
+            vec4 b = texture2D(state_b, uv);
+            float index = floor(gl_FragCoord.y) * state_size.x + floor(gl_FragCoord.x);
+            // new particles go into the dead slots in the range
+            // [spawn_start, spawn_start + spawn_count), wrapping around
+            float ring_pos = mod(index - spawn_start + max_particles, max_particles);
+            if (b.x <= 0.0 && ring_pos < spawn_count) {
+                float ttl = life + rand_var(0.0) * life_var;
+                float s = speed + rand_var(3.0) * speed_var;
+                float ang = angle + rand_var(4.0) * angle_var;
+                a.xy = source_pos + vec2(rand_var(1.0), rand_var(2.0)) * source_pos_var;
+                a.zw = vec2(cos(ang), sin(ang)) * s;
+                b = vec4(ttl, ttl, rand_var(5.0) * 0.5 + 0.5, 0.0);
+            } else if (b.x > 0.0) {
+                vec2 g = gravity * dt;
+                b.x -= dt;
+                a.xy += dt * (a.zw + g * 0.5);
+                a.zw = (a.zw + g) * (1.0 - damping * dt);
+            }
+            gl_FragColor = ]]..output..[[;
+        }
+    ]]
+    particles2d_gpu_update_shaders[output] = am.program(v, f)
+    return particles2d_gpu_update_shaders[output]
+end
+
+local particles2d_gpu_shaders = {}
+
+local
+function get_particles2d_gpu_shader(textured)
+    if particles2d_gpu_shaders[textured] then
+        return particles2d_gpu_shaders[textured]
+    end
+    local v = [[
+        precision highp float;
+        uniform mat4 P;
+        uniform mat4 MV;
+        uniform sampler2D state_a;
+        uniform sampler2D state_b;
+        uniform vec2 state_size;
+        uniform float start_size;
+        uniform float start_size_var;
+        uniform float end_size;
+        uniform float end_size_var;
+        uniform float size_changes;
+        uniform vec4 start_color;
+        uniform vec4 start_color_var;
+        uniform vec4 end_color;
+        uniform vec4 end_color_var;
+        uniform float color_changes;
+        uniform vec2 uv_offset;
+        uniform vec2 uv_scale;
+        attribute float particle;
+        attribute vec2 offset;
+        varying vec4 v_color;
+        varying vec2 v_uv;
+    ]]..gpu_hash_func..[[
+        float rand_var(float seed, float k) {
+            return hash(vec2(seed * 4096.0, k * 17.0)) * 2.0 - 1.0;
+        }
+        vec4 rand_var4(float seed, float k) {
+            return vec4(rand_var(seed, k), rand_var(seed, k + 1.0),
+                rand_var(seed, k + 2.0), rand_var(seed, k + 3.0));
+        }
+        void main() {
+            float row = floor((particle + 0.5) / state_size.x);
+            vec2 uv = (vec2(particle - row * state_size.x, row) + 0.5) / state_size;
+            vec4 a = texture2D(state_a, uv);
+            vec4 b = texture2D(state_b, uv);
+            float seed = b.z;
+            float t = clamp(1.0 - b.x / max(b.y, 0.0001), 0.0, 1.0);
+            float size0 = start_size + rand_var(seed, 0.0) * start_size_var;
+            float size1 = mix(size0, end_size + rand_var(seed, 1.0) * end_size_var, size_changes);
+            vec4 color0 = start_color + rand_var4(seed, 2.0) * start_color_var;
+            vec4 color1 = mix(color0, end_color + rand_var4(seed, 6.0) * end_color_var, color_changes);
+            float size = b.x <= 0.0 ? 0.0 : mix(size0, size1, t);
+            v_color = mix(color0, color1, t);
+            v_uv = uv_scale * (offset * 0.5 + 0.5) + uv_offset;
+            gl_Position = P * MV * vec4(a.xy + offset * size, 0.0, 1.0);
+        }
+    ]]
+    local f
+    if textured then
+        f = [[
+            precision mediump float;
+            uniform sampler2D tex;
+            varying vec4 v_color;
+            varying vec2 v_uv;
+            void main() {
+                gl_FragColor = clamp(texture2D(tex, v_uv) * v_color, 0.0, 1.0);
+            }
+        ]]
+    else
+        f = [[
+            precision mediump float;
+            varying vec4 v_color;
+            varying vec2 v_uv;
+            void main() {
+                gl_FragColor = clamp(v_color, 0.0, 1.0);
+            }
+        ]]
+    end
+    particles2d_gpu_shaders[textured] = am.program(v, f)
+    return particles2d_gpu_shaders[textured]
+end
+
+-- Returns an object with the same settings fields and update/reset
+-- methods as the native particle state, or nil if the device can't
+-- render to float textures.
+local
+function create_gpu_particles2d(max_particles, seed)
+    if not am._gpu_particles2d_supported() then
+        return nil
+    end
+    local width = math.min(max_particles, 1024)
+    local height = math.ceil(max_particles / width)
+    local states = {}
+    for i = 1, 2 do
+        local state = {
+            tex_a = am.texture2d(width, height, "float"),
+            tex_b = am.texture2d(width, height, "float"),
+        }
+        local ok_a, fb_a = pcall(am.framebuffer, state.tex_a)
+        local ok_b, fb_b = pcall(am.framebuffer, state.tex_b)
+        if not (ok_a and ok_b) then
+            return nil
+        end
+        state.fb_a = fb_a
+        state.fb_b = fb_b
+        states[i] = state
+    end
+    local curr = 1
+    local next_slot = 0
+    local emit_counter = 0
+    -- the same generator as the native simulation, seeded the same way
+    local rnd = am.rand(seed)
+
+    -- the values of the uniforms other than vert, state_size and
+    -- max_particles are set before each update (see step)
+    local update_bind = am.bind{
+        vert = am.rect_verts_2d(-1, -1, 1, 1),
+        state_size = vec2(width, height),
+        max_particles = max_particles,
+        state_a = states[1].tex_a,
+        state_b = states[1].tex_b,
+        dt = 0,
+        seed = 0,
+        spawn_start = 0,
+        spawn_count = 0,
+        source_pos = vec2(0),
+        source_pos_var = vec2(0),
+        angle = 0,
+        angle_var = 0,
+        speed = 0,
+        speed_var = 0,
+        life = 0,
+        life_var = 0,
+        gravity = vec2(0),
+        damping = 0,
+    } ^ am.draw("triangles", am.rect_indices())
+    local update_a = am.blend("off")
+        ^ am.use_program(get_particles2d_gpu_update_shader("a"))
+        ^ update_bind
+    local update_b = am.blend("off")
+        ^ am.use_program(get_particles2d_gpu_update_shader("b"))
+        ^ update_bind
+
+    local sys = {
+        max_particles = max_particles,
+        state_size = vec2(width, height),
+        state_a = states[1].tex_a,
+        state_b = states[1].tex_b,
+    }
+
+    local
+    function step(dt, n)
+        local src = states[curr]
+        local dst = states[3 - curr]
+        update_bind.state_a = src.tex_a
+        update_bind.state_b = src.tex_b
+        update_bind.dt = dt
+        update_bind.seed = rnd() * 1000
+        update_bind.spawn_start = next_slot
+        update_bind.spawn_count = n
+        update_bind.source_pos = sys.source_pos
+        update_bind.source_pos_var = sys.source_pos_var
+        update_bind.angle = sys.angle
+        update_bind.angle_var = sys.angle_var
+        update_bind.speed = sys.speed
+        update_bind.speed_var = sys.speed_var
+        update_bind.life = sys.life
+        update_bind.life_var = sys.life_var
+        update_bind.gravity = sys.gravity
+        update_bind.damping = sys.damping
+        dst.fb_a:render(update_a)
+        dst.fb_b:render(update_b)
+        next_slot = (next_slot + n) % max_particles
+        curr = 3 - curr
+        sys.state_a = dst.tex_a
+        sys.state_b = dst.tex_b
+    end
+
+    function sys:update(dt)
+        local n = 0
+        if sys.emission_rate > 0 then
+            local delay = 1 / sys.emission_rate
+            emit_counter = emit_counter + dt
+            n = math.floor(emit_counter / delay)
+            emit_counter = emit_counter - n * delay
+            n = math.min(n, max_particles)
+        end
+        step(dt, n)
+        return max_particles
+    end
+
+    function sys:reset(n)
+        for _, state in ipairs(states) do
+            state.fb_a:clear()
+            state.fb_b:clear()
+        end
+        curr = 1
+        next_slot = 0
+        emit_counter = 0
+        step(0, n)
+        return max_particles
+    end
+
+    -- copies the settings used by the vertex shader to the bind node
+    -- (or table of bindings) that draws the particles
+    function sys:bind_uniforms(bind)
+        bind.state_a = sys.state_a
+        bind.state_b = sys.state_b
+        bind.start_size = sys.start_size
+        bind.start_size_var = sys.start_size_var
+        bind.end_size = sys.end_size or sys.start_size
+        bind.end_size_var = sys.end_size_var
+        bind.size_changes = sys.end_size and 1 or 0
+        bind.start_color = sys.start_color
+        bind.start_color_var = sys.start_color_var
+        bind.end_color = sys.end_color or sys.start_color
+        bind.end_color_var = sys.end_color_var
+        bind.color_changes = sys.end_color and 1 or 0
+    end
+
+    return sys
+end
+
 -- settings:
 --      source_pos
 --      source_pos_var
@@ -90,77 +392,26 @@ end
 --      sprite_source
 --      warmup_time
 --      damping
+--      gpu
+--      seed
 function am.particles2d(opts)
     local max_particles = opts.max_particles or 100
     local start_particles = opts.start_particles or 0
     if start_particles > max_particles then
         error("start_particles is larger than max_particles", 2)
     end
-    local source_pos_x = opts.source_pos and opts.source_pos.x or 0
-    local source_pos_y = opts.source_pos and opts.source_pos.y or 0
-    local source_pos_x_var = opts.source_pos_var and opts.source_pos_var.x or 0
-    local source_pos_y_var = opts.source_pos_var and opts.source_pos_var.y or 0
-    local start_size = (opts.start_size or 20) / 2
-    local start_size_var = (opts.start_size_var or 0) / 2
-    local size_changes = not not opts.end_size
-    local end_size = opts.end_size and opts.end_size / 2
-    local end_size_var = (opts.end_size_var or 0) / 2
-    local angle = opts.angle or 0
-    local angle_var = opts.angle_var or 0
-    local speed = opts.speed or 100
-    local speed_var = opts.speed_var or 0
     local life = opts.life or 1
     local life_var = opts.life_var or 0
     if life_var >= life then
         life_var = life - 0.001 -- prevent zero time-to-live
     end
-    local start_r = opts.start_color and opts.start_color.r or 1
-    local start_g = opts.start_color and opts.start_color.g or 1
-    local start_b = opts.start_color and opts.start_color.b or 1
-    local start_a = opts.start_color and opts.start_color.a or 1
-    local start_r_var = opts.start_color_var and opts.start_color_var.r or 0
-    local start_g_var = opts.start_color_var and opts.start_color_var.g or 0
-    local start_b_var = opts.start_color_var and opts.start_color_var.b or 0
-    local start_a_var = opts.start_color_var and opts.start_color_var.a or 0
-    local color_changes = not not opts.end_color
-    local end_r = opts.end_color and opts.end_color.r
-    local end_g = opts.end_color and opts.end_color.g
-    local end_b = opts.end_color and opts.end_color.b
-    local end_a = opts.end_color and opts.end_color.a
-    local end_r_var = opts.end_color_var and opts.end_color_var.r or 0
-    local end_g_var = opts.end_color_var and opts.end_color_var.g or 0
-    local end_b_var = opts.end_color_var and opts.end_color_var.b or 0
-    local end_a_var = opts.end_color_var and opts.end_color_var.a or 0
-    local emission_rate = opts.emission_rate or 50
-    local gravity_x = opts.gravity and opts.gravity.x or 0
-    local gravity_y = opts.gravity and opts.gravity.y or 0
-    local gravity_x_2 = gravity_x / 2
-    local gravity_y_2 = gravity_y / 2
-    local damping = opts.damping or 0
+    -- unless a seed is given it comes from math.random, so seeding that
+    -- with math.randomseed makes particle systems repeatable
+    local seed = opts.seed or math.floor(math.random() * 2 ^ 31)
     local sprite
     if opts.sprite_source then
         sprite = am._convert_sprite_source(opts.sprite_source)
     end
-    local warmup_time = opts.warmup_time or 0
-
-    local n = 0  -- num active particles
-    local emit_counter = 0
-
-    local x = {}
-    local y = {}
-    local z = {} -- size
-    local dz = {}
-    local r = {}
-    local g = {}
-    local b = {}
-    local a = {}
-    local dr = {}
-    local dg = {}
-    local db = {}
-    local da = {}
-    local time_to_live = {}
-    local speed_x = {}
-    local speed_y = {}
 
     local i = 0
     local k = 0
@@ -202,167 +453,115 @@ function am.particles2d(opts)
         uv_scale = vec2(sprite.s2 - sprite.s1, sprite.t2 - sprite.t1)
     end
 
-    local num_verts = max_particles * 4
-    local stride = 12 + 16
-    local vertbuf = am.buffer(num_verts * stride)
-    vertbuf.usage = "dynamic"
-    local vertview = vertbuf:view("vec3", 0, stride)
-    local x1_view  = vertbuf:view("float", 0, stride * 4)
-    local y1_view  = vertbuf:view("float", 4, stride * 4)
-    local z1_view = vertbuf:view("float", 8, stride * 4) -- z stores size
-    local xyz1_view = vertbuf:view("vec3", 0,  stride * 4)
-    local xyz2_view = vertbuf:view("vec3", 1*stride,  stride * 4)
-    local xyz3_view = vertbuf:view("vec3", 2*stride, stride * 4)
-    local xyz4_view = vertbuf:view("vec3", 3*stride, stride * 4)
-    local r1_view = vertbuf:view("float", 12, stride * 4)
-    local g1_view = vertbuf:view("float", 16, stride * 4)
-    local b1_view = vertbuf:view("float", 20, stride * 4)
-    local a1_view = vertbuf:view("float", 24, stride * 4)
-    local rgba1_view = vertbuf:view("vec4", 12, stride * 4)
-    local rgba2_view = vertbuf:view("vec4", 12+stride*1, stride * 4)
-    local rgba3_view = vertbuf:view("vec4", 12+stride*2, stride * 4)
-    local rgba4_view = vertbuf:view("vec4", 12+stride*3, stride * 4)
-    local colorview = vertbuf:view("vec4", 12, stride)
+    local sys
+    local vertview
+    local colorview
+    local particleview
+    if opts.gpu then
+        sys = create_gpu_particles2d(max_particles, seed)
+    end
+    if sys then
+        local particles = {}
+        for j = 0, max_particles * 4 - 1 do
+            particles[j + 1] = math.floor(j / 4)
+        end
+        particleview = am.float_array(particles)
+    else
+        -- the particles are simulated natively and written straight
+        -- into vertbuf (see am_particles.cpp)
+        local num_verts = max_particles * 4
+        local stride = 12 + 16
+        local vertbuf = am.buffer(num_verts * stride)
+        vertbuf.usage = "dynamic"
+        vertview = vertbuf:view("vec3", 0, stride)
+        colorview = vertbuf:view("vec4", 12, stride)
+        sys = am._particles2d(max_particles, vertbuf, seed)
+    end
+    local gpu = particleview ~= nil
+    local
+    function vec2_opt(v, default)
+        return v and vec2(v.x, v.y) or vec2(default)
+    end
+    local
+    function vec4_opt(v, default)
+        return v and vec4(v.r, v.g, v.b, v.a) or vec4(default)
+    end
+    sys.source_pos = vec2_opt(opts.source_pos, 0)
+    sys.source_pos_var = vec2_opt(opts.source_pos_var, 0)
+    sys.start_size = (opts.start_size or 20) / 2
+    sys.start_size_var = (opts.start_size_var or 0) / 2
+    if opts.end_size then
+        sys.end_size = opts.end_size / 2
+    end
+    sys.end_size_var = (opts.end_size_var or 0) / 2
+    sys.angle = opts.angle or 0
+    sys.angle_var = opts.angle_var or 0
+    sys.speed = opts.speed or 100
+    sys.speed_var = opts.speed_var or 0
+    sys.life = life
+    sys.life_var = life_var
+    sys.start_color = vec4_opt(opts.start_color, 1)
+    sys.start_color_var = vec4_opt(opts.start_color_var, 0)
+    if opts.end_color then
+        sys.end_color = vec4_opt(opts.end_color)
+    end
+    sys.end_color_var = vec4_opt(opts.end_color_var, 0)
+    sys.emission_rate = opts.emission_rate or 50
+    sys.gravity = vec2_opt(opts.gravity, 0)
+    sys.damping = opts.damping or 0
 
     local shader
     local node
-    if sprite then
+    if gpu then
+        shader = get_particles2d_gpu_shader(sprite ~= nil)
+    elseif sprite then
         shader = get_particles2d_shader_tex()
     else
         shader = get_particles2d_shader()
     end
 
+    local bindings = {
+        offset = offsetview,
+        tex = sprite and sprite.texture or nil,
+        uv_offset = uv_offset,
+        uv_scale = uv_scale,
+    }
+    if gpu then
+        bindings.particle = particleview
+        bindings.state_size = sys.state_size
+        bindings.uv_offset = uv_offset or vec2(0)
+        bindings.uv_scale = uv_scale or vec2(1)
+        sys:bind_uniforms(bindings)
+    else
+        bindings.vert = vertview
+        bindings.color = colorview
+    end
+
     local node = am.use_program(shader)
-        ^ am.bind{
-            vert = vertview,
-            offset = offsetview,
-            color = colorview,
-            tex = sprite and sprite.texture or nil,
-            uv_offset = uv_offset,
-            uv_scale = uv_scale,
-        }
+        ^ am.bind(bindings)
         ^ am.draw("triangles", elemsview)
-
-    local
-    function set_verts()
-        x1_view:set(x, 1, n)
-        y1_view:set(y, 1, n)
-        z1_view:set(z, 1, n)
-        xyz2_view:set(xyz1_view, 1, n)
-        xyz3_view:set(xyz1_view, 1, n)
-        xyz4_view:set(xyz1_view, 1, n)
-        r1_view:set(r, 1, n)
-        g1_view:set(g, 1, n)
-        b1_view:set(b, 1, n)
-        a1_view:set(a, 1, n)
-        rgba2_view:set(rgba1_view, 1, n)
-        rgba3_view:set(rgba1_view, 1, n)
-        rgba4_view:set(rgba1_view, 1, n)
-        node"draw".count = n * 6
-    end
-
-    local rnd = math.random
-    local cos = math.cos
-    local sin = math.sin
-
-    local
-    function add_particle()
-        n = n + 1
-        time_to_live[n] = life + (rnd() * 2 - 1) * life_var
-        x[n] = source_pos_x + (rnd() * 2 - 1) * source_pos_x_var
-        y[n] = source_pos_y + (rnd() * 2 - 1) * source_pos_y_var
-        z[n] = start_size + (rnd() * 2 - 1) * start_size_var
-        if size_changes then
-            dz[n] = (end_size + (rnd() * 2 - 1) * end_size_var - z[n]) / time_to_live[n]
-        else
-            dz[n] = 0
-        end
-        r[n] = start_r + (rnd() * 2 - 1) * start_r_var
-        g[n] = start_g + (rnd() * 2 - 1) * start_g_var
-        b[n] = start_b + (rnd() * 2 - 1) * start_b_var
-        a[n] = start_a + (rnd() * 2 - 1) * start_a_var
-        if color_changes then
-            dr[n] = (end_r + (rnd() * 2 - 1) * end_r_var - r[n]) / time_to_live[n]
-            dg[n] = (end_g + (rnd() * 2 - 1) * end_g_var - g[n]) / time_to_live[n]
-            db[n] = (end_b + (rnd() * 2 - 1) * end_b_var - b[n]) / time_to_live[n]
-            da[n] = (end_a + (rnd() * 2 - 1) * end_a_var - a[n]) / time_to_live[n]
-        else
-            dr[n] = 0
-            dg[n] = 0
-            db[n] = 0
-            da[n] = 0
-        end
-        local speed = speed + (rnd() * 2 - 1) * speed_var
-        local angle = angle + (rnd() * 2 - 1) * angle_var
-        speed_x[n] = cos(angle) * speed
-        speed_y[n] = sin(angle) * speed
-    end
+    local bind = node"bind"
+    local draw = node"draw"
 
     local
     function update(dt)
-        -- update existing particles
-        local i = 1
-        local damp_factor = (1 - damping * dt)
-        while i <= n do
-            time_to_live[i] = time_to_live[i] - dt
-            if time_to_live[i] >= 0 then
-                x[i] = x[i] + dt * (speed_x[i] + dt * gravity_x_2)
-                y[i] = y[i] + dt * (speed_y[i] + dt * gravity_y_2)
-                speed_x[i] = (speed_x[i] + gravity_x * dt) * damp_factor
-                speed_y[i] = (speed_y[i] + gravity_y * dt) * damp_factor
-                z[i] = z[i] + dz[i] * dt
-                r[i] = r[i] + dr[i] * dt
-                g[i] = g[i] + dg[i] * dt
-                b[i] = b[i] + db[i] * dt
-                a[i] = a[i] + da[i] * dt
-                i = i + 1
-            else
-                if i ~= n then
-                    x[i] = x[n];
-                    y[i] = y[n];
-                    z[i] = z[n];
-                    dz[i] = dz[n];
-                    r[i] = r[n];
-                    g[i] = g[n];
-                    b[i] = b[n];
-                    a[i] = a[n];
-                    dr[i] = dr[n];
-                    dg[i] = dg[n];
-                    db[i] = db[n];
-                    da[i] = da[n];
-                    time_to_live[i] = time_to_live[n];
-                    speed_x[i] = speed_x[n];
-                    speed_y[i] = speed_y[n];
-                end
-                n = n - 1
-            end
+        draw.count = sys:update(dt) * 6
+        if gpu then
+            sys:bind_uniforms(bind)
         end
-
-        -- generate new particles
-        if emission_rate > 0 then
-            local delay = 1 / emission_rate
-            emit_counter = emit_counter + dt
-            while n < max_particles and emit_counter >= delay do
-                add_particle()
-                emit_counter = emit_counter - delay
-            end
-        end
-
-        set_verts()
     end
     
     node:action(function() update(am.delta_time) end)
 
     local
     function init()
-        n = 0
-        for i = 1, start_particles do
-            add_particle()
+        draw.count = sys:reset(start_particles) * 6
+        if gpu then
+            sys:bind_uniforms(bind)
         end
-        set_verts()
 
         local dt = 1/60
-        warmup_time = opts.warmup_time or 0
+        local warmup_time = opts.warmup_time or 0
         while warmup_time > 0 do
             update(dt)
             warmup_time = warmup_time - dt
@@ -372,122 +571,106 @@ function am.particles2d(opts)
     init()
 
     function node:get_source_pos()
-        return vec2(source_pos_x, source_pos_y)
+        return sys.source_pos
     end
     function node:set_source_pos(p)
-        source_pos_x = p.x
-        source_pos_y = p.y
+        sys.source_pos = vec2(p.x, p.y)
     end
     function node:get_source_pos_var()
-        return vec2(source_pos_x_var, source_pos_y_var)
+        return sys.source_pos_var
     end
     function node:set_source_pos_var(v)
-        source_pos_x_var = v.x
-        source_pos_y_var = v.y
+        sys.source_pos_var = vec2(v.x, v.y)
     end
     function node:get_start_size()
-        return start_size
+        return sys.start_size
     end
     function node:set_start_size(v)
-        start_size = v
+        sys.start_size = v
     end
     function node:get_start_size_var()
-        return start_size_var
+        return sys.start_size_var
     end
     function node:set_start_size_var(v)
-        start_size_var = v
+        sys.start_size_var = v
     end
     function node:get_end_size()
-        return end_size
+        return sys.end_size
     end
     function node:set_end_size(v)
-        size_changes = true
-        end_size = v
+        sys.end_size = v
     end
     function node:get_end_size_var()
-        return end_size_var
+        return sys.end_size_var
     end
     function node:set_end_size_var(v)
-        end_size_var = v
+        sys.end_size_var = v
     end
     function node:get_angle()
-        return angle
+        return sys.angle
     end
     function node:set_angle(v)
-        angle = v
+        sys.angle = v
     end
     function node:get_angle_var()
-        return angle_var
+        return sys.angle_var
     end
     function node:set_angle_var(v)
-        angle_var = v
+        sys.angle_var = v
     end
     function node:get_speed()
-        return speed
+        return sys.speed
     end
     function node:set_speed(v)
-        speed = v
+        sys.speed = v
     end
     function node:get_speed_var()
-        return speed_var
+        return sys.speed_var
     end
     function node:set_speed_var(v)
-        speed_var = v
+        sys.speed_var = v
     end
     function node:get_life()
-        return life
+        return sys.life
     end
     function node:set_life(v)
-        life = v
+        sys.life = v
     end
     function node:get_life_var()
-        return life_var
+        return sys.life_var
     end
     function node:set_life_var(v)
-        life_var = v
+        sys.life_var = v
     end
     function node:get_start_color()
-        return vec4(start_r, start_g, start_b, start_a)
+        return sys.start_color
     end
     function node:set_start_color(v)
-        start_r = v.r
-        start_g = v.g
-        start_b = v.b
-        start_a = v.a
+        sys.start_color = vec4(v.r, v.g, v.b, v.a)
     end
     function node:get_start_color_var()
-        return vec4(start_r_var, start_g_var, start_b_var, start_a_var)
+        return sys.start_color_var
     end
     function node:set_start_color_var(v)
-        start_r_var = v.r
-        start_g_var = v.g
-        start_b_var = v.b
-        start_a_var = v.a
+        sys.start_color_var = vec4(v.r, v.g, v.b, v.a)
     end
     function node:get_end_color()
-        return vec4(end_r, end_g, end_b, end_a)
+        return sys.end_color
     end
     function node:set_end_color(v)
-        color_changes = true
-        end_r = v.r
-        end_g = v.g
-        end_b = v.b
-        end_a = v.a
+        sys.end_color = vec4(v.r, v.g, v.b, v.a)
     end
     function node:get_end_color_var()
-        return vec4(end_r_var, end_g_var, end_b_var, end_a_var)
+        return sys.end_color_var
     end
     function node:set_end_color_var(v)
-        end_r_var = v.r
-        end_g_var = v.g
-        end_b_var = v.b
-        end_a_var = v.a
+        sys.end_color_var = vec4(v.r, v.g, v.b, v.a)
     end
     function node:get_emission_rate()
-        return emission_rate
+        return sys.emission_rate
     end
     function node:set_emission_rate(v)
-        emission_rate = v
+        sys.emission_rate = v
     end
     function node:get_start_particles()
         return start_particles
@@ -496,19 +679,16 @@ function am.particles2d(opts)
         return max_particles
     end
     function node:get_gravity()
-        return vec2(gravity_x, gravity_y)
+        return sys.gravity
     end
     function node:set_gravity(v)
-        gravity_x = v.x
-        gravity_y = v.y
-        gravity_x_2 = gravity_x / 2
-        gravity_y_2 = gravity_y / 2
+        sys.gravity = vec2(v.x, v.y)
     end
     function node:get_damping()
-        return damping
+        return sys.damping
     end
     function node:set_damping(v)
-        damping = v
+        sys.damping = v
     end
     function node:get_sprite()
         return sprite
@@ -525,7 +705,10 @@ function am.particles2d(opts)
         node"bind".uv_scale = uv_scale
     end
     function node:get_active_particles()
-        return n
+        return sys.active_particles
+    end
+    function node:get_gpu()
+        return gpu
     end
     function node:reset()
         init()
@@ -138,6 +138,7 @@ setmetatable(am.shaders, {
                 return nil
             end
             prog = am.program(sources[name][1], sources[name][2])
+            am._allow_batch_pretransform(prog)
             rawset(shaders, name, prog)
         end
         return prog
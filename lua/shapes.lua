@@ -29,93 +29,178 @@ function am.quad_indices(n)
     end
 end
 
-function am.quads(capacity, spec, usage)
+local shared_quad_indices_cache = setmetatable({}, {__mode = "v"})
+
+-- Returns indices for at least n quads. Quads nodes only draw as many
+-- indices as they have quads, so the same indices can be shared by all
+-- nodes whose capacity rounds up to the same power of 2.
+local
+function shared_quad_indices(n)
+    local capacity = 1
+    while capacity < n do
+        capacity = capacity * 2
+    end
+    local elements = shared_quad_indices_cache[capacity]
+    if not elements then
+        elements = am.quad_indices(capacity)
+        shared_quad_indices_cache[capacity] = elements
+    end
+    return elements
+end
+
+-- Creates the bind and draw nodes for am.quads and am.quad_batch. The
+-- quads are stored by a native quad batch (see am_quads.cpp), which
+-- keeps them contiguous at the start of the attribute buffer.
+local
+function create_quads_node(capacity, spec, usage)
     usage = usage or "static"
     capacity = math.max(1, capacity)
-    local n = 0
     local bindings
-    local attrs
-    local views
     local
     function create_bindings()
         bindings = am.struct_array(capacity * 4, spec)
-        attrs = {}
-        views = {}
-        for attr, view in pairs(bindings) do
-            view.buffer.usage = usage
-            table.insert(attrs, attr)
-            table.insert(views, view)
-        end
+        local _, view = next(bindings)
+        view.buffer.usage = usage
+        return view.buffer
     end
-    create_bindings()
-    local num_attrs = #attrs
-    local elements = am.quad_indices(capacity)
-    local draw_node = am.draw("triangles", elements, 1, 0)
+    local batch = am._quad_batch(create_bindings(), capacity)
+    local draw_node = am.draw("triangles", shared_quad_indices(capacity), 1, 0)
     local bind_node = am.bind(bindings) ^ draw_node
-    local
-    function expand(min_capacity)
-        local old_capacity = capacity
-        while capacity < min_capacity do
+    local quads = {
+        batch = batch,
+    }
+    -- makes room for at least n quads, doubling the capacity as needed
+    function quads.reserve(n)
+        if n <= capacity then
+            return
+        end
+        while capacity < n do
             capacity = capacity * 2
         end
-        local old_bindings = bindings
-        create_bindings()
+        batch:set_buffer(create_bindings(), capacity)
         for attr, view in pairs(bindings) do
             bind_node[attr] = view
-            view:set(old_bindings[attr])
         end
-        elements = am.quad_indices(capacity)
-        draw_node.elements = elements
+        draw_node.elements = shared_quad_indices(capacity)
     end
-    for attr, view in pairs(bindings) do
+    function quads.add()
+        quads.reserve(batch.num_quads + 1)
+        local handle, q = batch:add()
+        draw_node.count = batch.num_quads * 6
+        return handle, q
+    end
+    function quads.set(q, data)
+        local i = (q - 1) * 4 + 1
+        for attr, vals in pairs(data) do
+            bindings[attr]:set(vals, i, 4)
+        end
+    end
+    function quads.set_attr(q, attr, vals)
+        bindings[attr]:set(vals, (q - 1) * 4 + 1, 4)
+    end
+    function quads.update_count()
+        draw_node.count = batch.num_quads * 6
+    end
+    function quads.bindings()
+        return bindings
+    end
+    return bind_node, quads
+end
+
+function am.quads(capacity, spec, usage)
+    local bind_node, quads = create_quads_node(capacity, spec, usage)
+    local batch = quads.batch
+    for attr, view in pairs(quads.bindings()) do
         bind_node["quad_"..attr] = function(bind_node, q, vals)
-            if q > capacity then
-                expand(q)
-            end
-            bindings[attr]:set(vals, (q - 1) * 4 + 1, 4)
-            if q > n then
-                n = q
-                draw_node.count = n * 6
+            if q > batch.num_quads then
+                quads.reserve(q)
+                while batch.num_quads < q do
+                    quads.add()
+                end
             end
+            quads.set_attr(q, attr, vals)
         end
     end
     function bind_node:add_quad(quad)
-        n = n + 1
-        if n > capacity then
-            expand(n)
-        end
-        local i = (n - 1) * 4 + 1
-        for attr, vals in pairs(quad) do
-            bindings[attr]:set(vals, i, 4)
-        end
-        draw_node.count = n * 6
-        return n
+        local _, q = quads.add()
+        quads.set(q, quad)
+        return q
     end
     function bind_node:remove_quad(q, m)
         m = m or 1
-        if q + m - 1 < n then
-            local j = (q - 1) * 4 + 1 
-            for i = 1, num_attrs do
-                local view = views[i]
-                view:set(view:slice(j + m * 4), j)
-            end
-        elseif q + m - 1 > n then
+        if q + m - 1 > batch.num_quads then
             error("cannot remove quad "..(q + m - 1)..", because it doesn't exist", 2)
         end
-        n = n - m
-        draw_node.count = n * 6
+        batch:remove_range(q, m)
+        quads.update_count()
     end
     function bind_node:get_num_quads()
-        return n
+        return batch.num_quads
     end
     function bind_node:clear()
-        n = 0
-        draw_node.count = 0
+        batch:clear()
+        quads.update_count()
     end
     bind_node:tag"quads"
     return bind_node
 end
 
+function am.quad_batch(capacity, spec, usage)
+    local bind_node, quads = create_quads_node(capacity, spec, usage)
+    local batch = quads.batch
+    local types = {}
+    for i = 1, #spec, 2 do
+        types[spec[i]] = spec[i + 1]
+    end
+    for attr, view in pairs(quads.bindings()) do
+        bind_node["quad_"..attr] = function(bind_node, handle, vals)
+            quads.set_attr(batch:quad_number(handle), attr, vals)
+        end
+    end
+    function bind_node:add_quad(quad)
+        local handle, q = quads.add()
+        if quad then
+            quads.set(q, quad)
+        end
+        return handle
+    end
+    function bind_node:set_quad(handle, quad)
+        quads.set(batch:quad_number(handle), quad)
+    end
+    function bind_node:remove_quad(handle)
+        batch:remove(handle)
+        quads.update_count()
+    end
+    function bind_node:set_quads(data)
+        local bindings = quads.bindings()
+        for attr, vals in pairs(data) do
+            local view = bindings[attr]
+            if not view then
+                error("no such attribute: "..tostring(attr), 2)
+            end
+            if type(vals) == "table" then
+                vals = mathv.array(types[attr], vals)
+            end
+            batch:set_attr(view, vals)
+        end
+    end
+    function bind_node:quad_number(handle)
+        return batch:quad_number(handle)
+    end
+    function bind_node:get_num_quads()
+        return batch.num_quads
+    end
+    function bind_node:get_capacity()
+        return batch.capacity
+    end
+    function bind_node:clear()
+        batch:clear()
+        quads.update_count()
+    end
+    bind_node:tag"quad_batch"
+    return bind_node
+end
+
 function am.rect_verts_2d(x1, y1, x2, y2)
     return am.vec2_array{x1, y2, x1, y1, x2, y1, x2, y2}
 end
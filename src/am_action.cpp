@@ -3,13 +3,170 @@
 static int num_actions = 0;
 static unsigned int g_action_seq = 1;
 
-static void add_actions_2(lua_State *L, am_scene_node *node, int actions_tbl) {
+// The nodes with actions under a root, in the order their actions
+// should be added. This is rebuilt only when the structure of the
+// tree under the root changes, so the per-frame cost depends
+// on the number of nodes with actions, not the size of the scene.
+//
+// When the list is rebuilt only the subtrees whose structure changed are
+// walked again. Every subtree visited by the last build has a span that
+// records where its nodes are in the list, and the nodes of unchanged
+// subtrees are copied from there.
+struct am_action_span {
+    am_scene_node *node;
+    int nodes_start;
+    int nodes_end;
+    int spans_end; // the spans of the subtree's descendants come before this
+};
+
+struct am_action_node_buf {
+    am_scene_node **nodes;
+    int size;
+    int capacity;
+    am_action_span *spans;
+    int num_spans;
+    int spans_capacity;
+};
+
+struct am_action_node_list {
+    am_scene_node *root;
+    uint32_t gen;
+    am_action_node_buf bufs[2];
+    int current; // index into bufs
+};
+
+#define AM_MAX_ACTION_NODE_LISTS 8
+
+static am_action_node_list action_node_lists[AM_MAX_ACTION_NODE_LISTS];
+static int next_action_node_list = 0;
+
+static void reserve_nodes(am_action_node_buf *buf, int n) {
+    if (buf->size + n > buf->capacity) {
+        while (buf->size + n > buf->capacity) {
+            buf->capacity = buf->capacity == 0 ? 16 : buf->capacity * 2;
+        }
+        buf->nodes = (am_scene_node**)realloc(buf->nodes, sizeof(am_scene_node*) * buf->capacity);
+    }
+}
+
+static void reserve_spans(am_action_node_buf *buf, int n) {
+    if (buf->num_spans + n > buf->spans_capacity) {
+        while (buf->num_spans + n > buf->spans_capacity) {
+            buf->spans_capacity = buf->spans_capacity == 0 ? 64 : buf->spans_capacity * 2;
+        }
+        buf->spans = (am_action_span*)realloc(buf->spans, sizeof(am_action_span) * buf->spans_capacity);
+    }
+}
+
+// Copies the subtree with span old_span in old to the end of buf.
+static void copy_subtree(am_action_node_buf *old, int old_span, am_action_node_buf *buf) {
+    am_action_span *span = &old->spans[old_span];
+    int num_nodes = span->nodes_end - span->nodes_start;
+    int num_spans = span->spans_end - old_span;
+    int node_offset = buf->size - span->nodes_start;
+    int span_offset = buf->num_spans - old_span;
+    reserve_nodes(buf, num_nodes);
+    memcpy(&buf->nodes[buf->size], &old->nodes[span->nodes_start], sizeof(am_scene_node*) * num_nodes);
+    buf->size += num_nodes;
+    reserve_spans(buf, num_spans);
+    for (int i = 0; i < num_spans; i++) {
+        am_action_span s = old->spans[old_span + i];
+        s.nodes_start += node_offset;
+        s.nodes_end += node_offset;
+        s.spans_end += span_offset;
+        buf->spans[buf->num_spans++] = s;
+    }
+}
+
+// Returns the span of child among the children of the old span parent_span,
+// or -1. The search starts at *cursor, because children are usually in
+// the same order as last time.
+static int find_old_child(am_action_node_buf *old, int parent_span, int *cursor, am_scene_node *child) {
+    if (parent_span < 0) return -1;
+    int first = parent_span + 1;
+    int end = old->spans[parent_span].spans_end;
+    for (int pass = 0; pass < 2; pass++) {
+        int i = pass == 0 ? *cursor : first;
+        int stop = pass == 0 ? end : *cursor;
+        while (i < stop) {
+            if (old->spans[i].node == child) {
+                *cursor = old->spans[i].spans_end;
+                return i;
+            }
+            i = old->spans[i].spans_end;
+        }
+    }
+    return -1;
+}
+
+// old is the previous build of the list (or NULL) and old_span is
+// node's span in it (or -1).
+static void collect_action_nodes(am_scene_node *node, am_action_node_buf *buf,
+    am_action_node_buf *old, int old_span, uint32_t old_gen)
+{
     if (am_node_marked(node)) return;
     if (am_node_paused(node)) return;
     am_mark_node(node);
-    // XXX avoid adding the same action multiple times
-    // (it will only be run once, but adding actions is expensive)
-    if (node->action_seq != g_action_seq && node->actions_ref != LUA_NOREF) {
+    reserve_spans(buf, 1);
+    int span = buf->num_spans++;
+    buf->spans[span].node = node;
+    buf->spans[span].nodes_start = buf->size;
+    if (node->actions_ref != LUA_NOREF) {
+        reserve_nodes(buf, 1);
+        buf->nodes[buf->size++] = node;
+    }
+    int n = node->children.size;
+    int cursor = old_span + 1;
+    for (int i = 0; i < n; i++) {
+        am_scene_node *child = node->children.arr[i].child;
+        int old_child = find_old_child(old, old_span, &cursor, child);
+        if (old_child >= 0 && !am_structure_changed_since(child, old_gen)) {
+            copy_subtree(old, old_child, buf);
+        } else {
+            collect_action_nodes(child, buf, old, old_child, old_gen);
+        }
+    }
+    am_unmark_node(node);
+    buf->spans[span].nodes_end = buf->size;
+    buf->spans[span].spans_end = buf->num_spans;
+}
+
+static am_action_node_buf *get_action_node_list(am_scene_node *root) {
+    am_action_node_list *list = NULL;
+    for (int i = 0; i < AM_MAX_ACTION_NODE_LISTS; i++) {
+        if (action_node_lists[i].root == root) {
+            list = &action_node_lists[i];
+            if (!am_structure_changed_since(root, list->gen)) {
+                return &list->bufs[list->current];
+            }
+            break;
+        }
+    }
+    am_action_node_buf *old = NULL;
+    if (list == NULL) {
+        list = &action_node_lists[next_action_node_list];
+        next_action_node_list = (next_action_node_list + 1) % AM_MAX_ACTION_NODE_LISTS;
+        list->root = root;
+    } else {
+        old = &list->bufs[list->current];
+        list->current = 1 - list->current;
+    }
+    uint32_t old_gen = list->gen;
+    am_action_node_buf *buf = &list->bufs[list->current];
+    buf->size = 0;
+    buf->num_spans = 0;
+    list->gen = am_begin_scene_generation();
+    collect_action_nodes(root, buf, old, old != NULL && old->num_spans > 0 ? 0 : -1, old_gen);
+    return buf;
+}
+
+static void add_actions(lua_State *L, am_scene_node *root, int actions_tbl) {
+    am_action_node_buf *list = get_action_node_list(root);
+    for (int j = 0; j < list->size; j++) {
+        am_scene_node *node = list->nodes[j];
+        // XXX avoid adding the same action multiple times
+        // (it will only be run once, but adding actions is expensive)
+        if (node->action_seq == g_action_seq) continue;
         node->action_seq = g_action_seq;
         node->pushref(L, node->actions_ref);
         assert(lua_istable(L, -1));
@@ -27,15 +184,6 @@ static void add_actions_2(lua_State *L, am_scene_node *node, int actions_tbl) {
         }
         lua_pop(L, 1); // action list
     }
-    int n = node->children.size;
-    for (int i = 0; i < n; i++) {
-        add_actions_2(L, node->children.arr[i].child, actions_tbl);
-    }
-    am_unmark_node(node);
-}
-
-static void add_actions(lua_State *L, am_scene_node *node, int actions_tbl) {
-    add_actions_2(L, node, actions_tbl);
     g_action_seq++;
 }
 
@@ -51,6 +199,7 @@ void am_post_frame(lua_State *L) {
 }
 
 bool am_execute_node_actions(lua_State *L, am_scene_node *node) {
+    AM_PROFILE_ZONE("actions");
     lua_rawgeti(L, LUA_REGISTRYINDEX, AM_ACTION_TABLE);
     int actions_tbl = am_absindex(L, -1);
     int from = num_actions + 1;
@@ -3,7 +3,6 @@
 #define AM_AUDIO_NODE_FLAG_MARK             ((uint32_t)1)
 #define AM_AUDIO_NODE_FLAG_CHILDREN_DIRTY   ((uint32_t)2)
 #define AM_AUDIO_NODE_FLAG_PENDING_PAUSE    ((uint32_t)4)
-#define AM_AUDIO_NODE_MASK_LIVE_PAUSE_STATE ((uint32_t)(8+16))
 
 #define node_marked(node)           (node->flags & AM_AUDIO_NODE_FLAG_MARK)
 #define mark_node(node)             node->flags |= AM_AUDIO_NODE_FLAG_MARK
@@ -13,18 +12,17 @@
 #define set_children_dirty(node)    node->flags |= AM_AUDIO_NODE_FLAG_CHILDREN_DIRTY
 #define clear_children_dirty(node)  node->flags &= ~AM_AUDIO_NODE_FLAG_CHILDREN_DIRTY
 
-#define LIVE_PAUSE_STATE_UNPAUSED   (0 << 3)
-#define LIVE_PAUSE_STATE_BEGIN      (1 << 3)
-#define LIVE_PAUSE_STATE_PAUSED     (2 << 3) 
-#define LIVE_PAUSE_STATE_END        (3 << 3)
-
-#define live_pause_state(node)      (node->flags & AM_AUDIO_NODE_MASK_LIVE_PAUSE_STATE)
-#define set_live_pause_state(node, state) {node->flags &= ~AM_AUDIO_NODE_MASK_LIVE_PAUSE_STATE; node->flags |= state;}
+#define PAUSE_STATE_UNPAUSED        0
+#define PAUSE_STATE_BEGIN           1
+#define PAUSE_STATE_PAUSED          2
+#define PAUSE_STATE_END             3
 
 #define pending_pause(node)         (node->flags & AM_AUDIO_NODE_FLAG_PENDING_PAUSE)
 #define set_pending_pause(node)     node->flags |= AM_AUDIO_NODE_FLAG_PENDING_PAUSE
 #define clear_pending_pause(node)   node->flags &= ~AM_AUDIO_NODE_FLAG_PENDING_PAUSE
 
+#define AM_SPECTRUM_SLOT_FRESH      4
+
 static am_audio_context audio_context;
 
 // Audio Bus
@@ -36,7 +34,11 @@ static std::vector<void*> buffer_pool;
 static int current_pool_bufsize = 0;
 static unsigned int bufpool_top = 0;
 
+// audio_time_accum is only touched by the audio thread. It's moved to
+// synced_audio_time when a sync is applied, where the lua thread can
+// read it once the sync is no longer pending.
 static double audio_time_accum = 0.0;
+static double synced_audio_time = 0.0;
 
 static void clear_buffer_pool() {
     for (unsigned int i = 0; i < buffer_pool.size(); i++) {
@@ -107,14 +109,24 @@ static float linear_incf(am_audio_param<float> param, int samples) {
 
 am_audio_node::am_audio_node() {
     pending_children.owner = this;
-    live_children.owner = this;
+    sync_children.owner = this;
+    child_lists[0].owner = this;
+    child_lists[1].owner = this;
+    live_children = &child_lists[0];
+    children_synced = false;
     last_sync = 0;
+    last_apply = 0;
     last_render = 0;
     flags = 0;
+    sync_pause_state = PAUSE_STATE_UNPAUSED;
+    pause_state = PAUSE_STATE_UNPAUSED;
     recursion_limit = 0;
 }
 
-void am_audio_node::sync_params() {
+void am_audio_node::sync_params(lua_State *L) {
+}
+
+void am_audio_node::apply_params() {
 }
 
 void am_audio_node::post_render(am_audio_context *context, int num_samples) {
@@ -174,20 +186,20 @@ static void apply_fadeout(am_audio_bus *bus) {
 void am_audio_node::render_children(am_audio_context *context, am_audio_bus *bus) {
     if (recursion_limit < 0) return;
     recursion_limit--;
-    for (int i = 0; i < live_children.size; i++) {
-        am_audio_node_child *child = &live_children.arr[i];
-        int pause_state = live_pause_state(child->child);
+    for (int i = 0; i < live_children->size; i++) {
+        am_audio_node_child *child = &live_children->arr[i];
+        int pause_state = child->child->pause_state;
         am_audio_node_child_state child_state = child->state;
         if (child_state == AM_AUDIO_NODE_CHILD_STATE_OLD
-            && pause_state == LIVE_PAUSE_STATE_UNPAUSED)
+            && pause_state == PAUSE_STATE_UNPAUSED)
         {
             child->child->render_audio(context, bus);
         } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_DONE
-            || pause_state == LIVE_PAUSE_STATE_PAUSED
+            || pause_state == PAUSE_STATE_PAUSED
             // also ignore if paused and added at same time...
-            || (pause_state == LIVE_PAUSE_STATE_BEGIN && child->state == AM_AUDIO_NODE_CHILD_STATE_NEW)
+            || (pause_state == PAUSE_STATE_BEGIN && child->state == AM_AUDIO_NODE_CHILD_STATE_NEW)
             // ...or if unpaused and removed at same time
-            || (pause_state == LIVE_PAUSE_STATE_END && child->state == AM_AUDIO_NODE_CHILD_STATE_REMOVED))
+            || (pause_state == PAUSE_STATE_END && child->state == AM_AUDIO_NODE_CHILD_STATE_REMOVED))
         {
             // ignore
         } else {
@@ -196,9 +208,9 @@ void am_audio_node::render_children(am_audio_context *context, am_audio_bus *bus
             // paused/unpaused.
             am_audio_bus tmp(bus);
             child->child->render_audio(context, &tmp);
-            if (child_state == AM_AUDIO_NODE_CHILD_STATE_NEW || pause_state == LIVE_PAUSE_STATE_END) {
+            if (child_state == AM_AUDIO_NODE_CHILD_STATE_NEW || pause_state == PAUSE_STATE_END) {
                 apply_fadein(&tmp);
-            } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_REMOVED || pause_state == LIVE_PAUSE_STATE_BEGIN) {
+            } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_REMOVED || pause_state == PAUSE_STATE_BEGIN) {
                 apply_fadeout(&tmp);
             } else {
                 assert(false);
@@ -215,7 +227,11 @@ am_gain_node::am_gain_node() : gain(0) {
     gain.pending_value = 1.0f;
 }
 
-void am_gain_node::sync_params() {
+void am_gain_node::sync_params(lua_State *L) {
+    gain.sync();
+}
+
+void am_gain_node::apply_params() {
     gain.update_target();
 }
 
@@ -376,7 +392,12 @@ void am_biquad_filter_node::set_normalized_coeffs(double b0, double b1, double b
 am_lowpass_filter_node::am_lowpass_filter_node() : cutoff(0), resonance(0) {
 }
 
-void am_lowpass_filter_node::sync_params() {
+void am_lowpass_filter_node::sync_params(lua_State *L) {
+    cutoff.sync();
+    resonance.sync();
+}
+
+void am_lowpass_filter_node::apply_params() {
     cutoff.update_target();
     resonance.update_target();
     if (cutoff.current_value != cutoff.target_value
@@ -391,7 +412,12 @@ void am_lowpass_filter_node::sync_params() {
 am_highpass_filter_node::am_highpass_filter_node() : cutoff(0), resonance(0) {
 }
 
-void am_highpass_filter_node::sync_params() {
+void am_highpass_filter_node::sync_params(lua_State *L) {
+    cutoff.sync();
+    resonance.sync();
+}
+
+void am_highpass_filter_node::apply_params() {
     cutoff.update_target();
     resonance.update_target();
     if (cutoff.current_value != cutoff.target_value
@@ -410,117 +436,157 @@ am_audio_track_node::am_audio_track_node()
 {
     audio_buffer = NULL;
     audio_buffer_ref = LUA_NOREF;
-    current_position = 0.0;
-    next_position = 0.0;
-    reset_position = 0.0;
+    current_position = 0;
+    next_position = 0;
+    reset_position = 0;
+    sync_reset_position = 0;
     loop = false;
     needs_reset = false;
+    sync_reset = false;
     done_server = false;
     done_client = false;
 }
 
-void am_audio_track_node::sync_params() {
-    playback_speed.update_target();
-    gain.update_target();
+void am_audio_track_node::sync_params(lua_State *L) {
+    playback_speed.sync();
+    gain.sync();
+    sync_reset = needs_reset;
     if (needs_reset) {
-        current_position = reset_position;
-        next_position = reset_position;
+        sync_reset_position = reset_position;
         needs_reset = false;
+        // done_server is cleared when the reset is applied
+        done_client = false;
+    } else {
+        done_client = done_server;
+    }
+}
+
+void am_audio_track_node::apply_params() {
+    playback_speed.update_target();
+    gain.update_target();
+    if (sync_reset) {
+        current_position = sync_reset_position;
+        next_position = sync_reset_position;
         done_server = false;
     }
-    done_client = done_server;
 }
 
-static bool track_resample_required(am_audio_track_node *node) {
-    return (node->audio_buffer->sample_rate != am_conf_audio_sample_rate)
-        || (node->playback_speed.current_value != node->playback_speed.target_value)
-        || (fabs(node->playback_speed.current_value - 1.0f) > 0.00001f);
+static bool resample_required(am_audio_buffer *buf, am_audio_param<float> *playback_speed) {
+    return (buf->sample_rate != am_conf_audio_sample_rate)
+        || (playback_speed->current_value != playback_speed->target_value)
+        || (fabs(playback_speed->current_value - 1.0f) > 0.00001f);
 }
 
 static bool is_too_slow(float playback_speed) {
     return playback_speed < 0.00001f;
 }
 
-void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
-    if (done_server) return;
-    if (is_too_slow(playback_speed.current_value)) return;
-    if (audio_buffer->buffer->data == NULL) return;
-    am_audio_bus tmp(bus);
-    int buf_num_channels = audio_buffer->num_channels;
-    int buf_num_samples = audio_buffer->buffer->size / (buf_num_channels * sizeof(float));
-    int bus_num_samples = tmp.num_samples;
-    int bus_num_channels = tmp.num_channels;
-    if (!track_resample_required(this)) {
+// source samples per output sample
+static am_resample_pos resample_step(float playback_speed, float sample_rate_ratio) {
+    return am_resample_pos_from_samples((double)am_max(playback_speed, 0.0f) * (double)sample_rate_ratio);
+}
+
+// number of output samples resampled at a time
+#define AM_RESAMPLE_BLOCK 256
+
+// Adds the samples of buf from position onwards to the bus, scaled by
+// gain, and sets next_position to where playback should continue from.
+// Extra bus channels repeat the buffer's last channel. Returns true if
+// the end of the buffer was reached and loop is false.
+static bool mix_audio_buffer(am_audio_bus *bus, am_audio_buffer *buf,
+    am_resample_pos position, am_resample_pos *next_position,
+    am_audio_param<float> *playback_speed, am_audio_param<float> *gain,
+    float sample_rate_ratio, bool loop)
+{
+    bool done = false;
+    int buf_num_channels = buf->num_channels;
+    int buf_num_samples = buf->buffer->size / (buf_num_channels * sizeof(float));
+    int bus_num_samples = bus->num_samples;
+    int bus_num_channels = bus->num_channels;
+    if (buf_num_samples == 0) return !loop;
+    am_resample_pos end = (am_resample_pos)buf_num_samples << AM_RESAMPLE_FRAC_BITS;
+    if (!resample_required(buf, playback_speed)) {
         // optimise common case where no resampling is required
         for (int c = 0; c < bus_num_channels; c++) {
-            float *bus_data = tmp.channel_data[c];
-            float *buf_data = ((float*)audio_buffer->buffer->data) + c * buf_num_samples;
-            if (c < buf_num_channels) {
-                int buf_pos = (int)floor(current_position);
-                assert(buf_pos < buf_num_samples);
-                for (int bus_pos = 0; bus_pos < bus_num_samples; bus_pos++) {
-                    bus_data[bus_pos] += buf_data[buf_pos++] * gain.interpolate_linear(bus_pos);
-                    if (buf_pos >= buf_num_samples) {
-                        if (loop) {
-                            buf_pos = 0;
-                        } else {
-                            done_server = true;
-                            break;
-                        }
+            float *bus_data = bus->channel_data[c];
+            float *buf_data = ((float*)buf->buffer->data) + am_min(c, buf_num_channels - 1) * buf_num_samples;
+            int buf_pos = (int)(position >> AM_RESAMPLE_FRAC_BITS);
+            assert(buf_pos < buf_num_samples);
+            for (int bus_pos = 0; bus_pos < bus_num_samples; bus_pos++) {
+                bus_data[bus_pos] += buf_data[buf_pos++] * gain->interpolate_linear(bus_pos);
+                if (buf_pos >= buf_num_samples) {
+                    if (loop) {
+                        buf_pos = 0;
+                    } else {
+                        done = true;
+                        break;
                     }
                 }
-            } else {
-                // less channels in buffer than bus, so duplicate previous channels
-                assert(c > 0);
-                memcpy(bus_data, tmp.channel_data[c-1], bus_num_samples * sizeof(float));
             }
         }
-        next_position = current_position + (double)bus_num_samples;
-        if (next_position >= (double)buf_num_samples) {
-            next_position = fmod(next_position, (double)buf_num_samples);
-        }
+        *next_position = (position + ((am_resample_pos)bus_num_samples << AM_RESAMPLE_FRAC_BITS)) % end;
     } else {
         // resample
-        for (int c = 0; c < bus_num_channels; c++) {
-            float *bus_data = tmp.channel_data[c];
-            float *buf_data = ((float*)audio_buffer->buffer->data) + c * buf_num_samples;
-            if (c < buf_num_channels) {
-                double pos = current_position;
-                for (int write_index = 0; write_index < bus_num_samples; write_index++) {
-                    int read_index1 = (int)floor(pos);
-                    int read_index2 = read_index1 + 1;
-                    if (read_index2 >= buf_num_samples) {
-                        if (loop) {
-                            read_index2 = 0;
-                        } else {
-                            done_server = true;
-                            break;
-                        }
-                    }
-                    double interpolation_factor = pos - (double)read_index1;
-                    float sample1 = buf_data[read_index1];
-                    float sample2 = buf_data[read_index2];
-                    float interpolated_sample = (1.0 - interpolation_factor) * sample1 + interpolation_factor * sample2;
-                    bus_data[write_index] += interpolated_sample * gain.interpolate_linear(write_index);
-                    pos += playback_speed.interpolate_linear(write_index) * sample_rate_ratio;
-                    if (pos >= (double)buf_num_samples) {
-                        if (loop) {
-                            pos = fmod(pos, (double)buf_num_samples);
-                        } else {
-                            done_server = true;
-                            break;
-                        }
-                    }
-                }
-                next_position = pos;
+        float tmp[AM_RESAMPLE_BLOCK];
+        am_resample_pos pos = position;
+        // the speed ramps over the first interpolate_samples samples
+        int ramp_samples = playback_speed->current_value != playback_speed->target_value
+            ? am_min(am_conf_audio_interpolate_samples, bus_num_samples) : 0;
+        int64_t ramp_delta = 0;
+        if (ramp_samples > 0) {
+            int64_t step_change = (int64_t)resample_step(playback_speed->target_value, sample_rate_ratio)
+                - (int64_t)resample_step(playback_speed->current_value, sample_rate_ratio);
+            ramp_delta = step_change / ramp_samples;
+        }
+        for (int start = 0; start < bus_num_samples && !done; ) {
+            int n = am_min(AM_RESAMPLE_BLOCK, bus_num_samples - start);
+            am_resample_pos step;
+            int64_t step_delta;
+            if (start < ramp_samples) {
+                n = am_min(n, ramp_samples - start);
+                step = resample_step(playback_speed->current_value, sample_rate_ratio) + (am_resample_pos)(ramp_delta * start);
+                step_delta = ramp_delta;
             } else {
-                // less channels in buffer than bus, so duplicate previous channels
-                assert(c > 0);
-                memcpy(bus_data, tmp.channel_data[c-1], bus_num_samples * sizeof(float));
+                step = resample_step(playback_speed->target_value, sample_rate_ratio);
+                step_delta = 0;
+            }
+            am_resample_pos next_pos = pos;
+            int written = 0;
+            int resampled_channel = -1;
+            for (int c = 0; c < bus_num_channels; c++) {
+                float *bus_data = bus->channel_data[c] + start;
+                int buf_c = am_min(c, buf_num_channels - 1);
+                if (buf_c != resampled_channel) {
+                    float *buf_data = ((float*)buf->buffer->data) + buf_c * buf_num_samples;
+                    next_pos = pos;
+                    written = am_resample(am_conf_audio_resample_quality, buf_data, buf_num_samples,
+                        loop, &next_pos, step, step_delta, tmp, n);
+                    resampled_channel = buf_c;
+                }
+                for (int i = 0; i < written; i++) {
+                    bus_data[i] += tmp[i] * gain->interpolate_linear(start + i);
+                }
+            }
+            pos = next_pos;
+            start += n;
+            if (written < n || (!loop && pos >= end)) {
+                done = true;
             }
         }
+        *next_position = pos;
+    }
+    return done;
+}
+
+void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
+    if (done_server) return;
+    if (is_too_slow(playback_speed.current_value)) return;
+    if (audio_buffer->buffer->data == NULL) return;
+    if (mix_audio_buffer(bus, audio_buffer, current_position, &next_position,
+            &playback_speed, &gain, sample_rate_ratio, loop))
+    {
+        done_server = true;
     }
-    mix_bus(bus, &tmp);
 }
 
 void am_audio_track_node::post_render(am_audio_context *context, int num_samples) {
@@ -549,46 +615,91 @@ am_audio_stream_node::am_audio_stream_node()
     done_client = false;
     current_position = 0.0;
     next_position = 0.0;
+    ring = NULL;
+    ring_channels = 0;
+    ring_capacity = 0;
+    write_pos = 0;
+    read_pos = 0;
+    end_of_stream = false;
+    underruns = 0;
+}
+
+#define AM_STREAM_DECODE_CHUNK 1024
+
+// Decodes up to AM_STREAM_DECODE_CHUNK frames into the ring, if there's
+// room. Returns false if there was nothing to do.
+bool am_audio_stream_node::decode_ahead() {
+    if (end_of_stream.load(std::memory_order_relaxed)) return false;
+    unsigned int wpos = write_pos.load(std::memory_order_relaxed);
+    unsigned int rpos = read_pos.load(std::memory_order_acquire);
+    unsigned int space = ring_capacity - (wpos - rpos);
+    unsigned int offset = wpos % ring_capacity;
+    // don't wrap around within a chunk
+    int n = (int)am_min(am_min(space, ring_capacity - offset), (unsigned int)AM_STREAM_DECODE_CHUNK);
+    if (n == 0) return false;
+    stb_vorbis *f = (stb_vorbis*)handle;
+    float *dest = ring + offset * ring_channels;
+    int m = stb_vorbis_get_samples_float_interleaved(f, ring_channels, dest, n * ring_channels);
+    if (m == 0 && loop) {
+        stb_vorbis_seek_start(f);
+        m = stb_vorbis_get_samples_float_interleaved(f, ring_channels, dest, n * ring_channels);
+        // m is still 0 if the stream has no samples at all
+    }
+    if (m == 0) {
+        end_of_stream.store(true, std::memory_order_release);
+        return false;
+    }
+    write_pos.store(wpos + m, std::memory_order_release);
+    return true;
 }
 
-void am_audio_stream_node::sync_params() {
-    playback_speed.update_target();
+void am_audio_stream_node::sync_params(lua_State *L) {
+    playback_speed.sync();
     done_client = done_server;
 }
 
+void am_audio_stream_node::apply_params() {
+    playback_speed.update_target();
+}
+
 void am_audio_stream_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
     if (done_server) return;
     int bus_num_samples = bus->num_samples;
     int bus_num_channels = bus->num_channels;
-    stb_vorbis *f = (stb_vorbis*)handle;
-    int n = 0;
-    float *channel_data[AM_MAX_CHANNELS];
-    am_audio_bus tmp(bus);
-    for (int i = 0; i < bus_num_channels; i++) {
-        channel_data[i] = tmp.channel_data[i];
-    }
-    while (n < bus_num_samples) {
-        int m = stb_vorbis_get_samples_float(f, bus_num_channels, channel_data, bus_num_samples - n);
-        if (m == 0) {
-            if (loop) {
-                stb_vorbis_seek_start(f);
-            } else {
-                done_server = true;
-                break;
-            }
-        } else {
-            n += m;
-            for (int i = 0; i < bus_num_channels; i++) {
-                channel_data[i] += m;
-            }
+#if !defined(AM_HAVE_THREADS)
+    // no decoder thread, so decode what's needed now
+    while (write_pos - read_pos < (unsigned int)bus_num_samples && decode_ahead()) {}
+#endif
+    // end_of_stream is read first, so if it's set write_pos is final
+    bool eos = end_of_stream.load(std::memory_order_acquire);
+    unsigned int rpos = read_pos.load(std::memory_order_relaxed);
+    unsigned int wpos = write_pos.load(std::memory_order_acquire);
+    int n = (int)am_min(wpos - rpos, (unsigned int)bus_num_samples);
+    int offset = (int)(rpos % ring_capacity);
+    // copy up to the end of the ring, then from the start
+    int n1 = am_min(n, (int)ring_capacity - offset);
+    for (int c = 0; c < bus_num_channels; c++) {
+        float *bus_data = bus->channel_data[c];
+        // extra bus channels repeat the last channel of the stream
+        int src_c = am_min(c, ring_channels - 1);
+        float *src = ring + offset * ring_channels + src_c;
+        for (int i = 0; i < n1; i++) {
+            bus_data[i] += src[i * ring_channels];
+        }
+        src = ring + src_c;
+        for (int i = n1; i < n; i++) {
+            bus_data[i] += src[(i - n1) * ring_channels];
         }
     }
-    // fill in missing channels
-    for (int c = num_channels; c < bus_num_channels; c++) {
-        assert(c > 0);
-        memcpy(tmp.channel_data[c], tmp.channel_data[c-1], bus_num_samples * sizeof(float));
+    read_pos.store(rpos + n, std::memory_order_release);
+    if (n < bus_num_samples) {
+        if (eos) {
+            done_server = true;
+        } else {
+            // the decoder has fallen behind
+            underruns.fetch_add(1, std::memory_order_relaxed);
+        }
     }
-    mix_bus(bus, &tmp);
 }
 
 void am_audio_stream_node::post_render(am_audio_context *context, int num_samples) {
@@ -600,6 +711,162 @@ bool am_audio_stream_node::finished() {
     return done_client;
 }
 
+// Voice pool node
+
+am_voice_state::am_voice_state()
+    : playback_speed(1.0f)
+    , gain(1.0f)
+{
+    buffer = NULL;
+    sample_rate_ratio = 1.0f;
+    loop = false;
+    active = false;
+    stopping = false;
+    current_position = 0;
+    next_position = 0;
+}
+
+am_voice::am_voice()
+    : playback_speed(1.0f)
+    , gain(1.0f)
+{
+    pending_buffer = NULL;
+    pending_ref = LUA_NOREF;
+    synced_ref = LUA_NOREF;
+    retired_ref = LUA_NOREF;
+    pending_command = AM_VOICE_COMMAND_NONE;
+    pending_loop = false;
+    priority = 0;
+    serial = 0;
+    playing = false;
+    sync_command = AM_VOICE_COMMAND_NONE;
+    sync_buffer = NULL;
+    sync_loop = false;
+    done = true;
+}
+
+am_voice_pool_node::am_voice_pool_node() {
+    num_voices = 0;
+    voices = NULL;
+    next_serial = 1;
+}
+
+static void retire_voice_buffer(am_voice *voice) {
+    assert(voice->retired_ref == LUA_NOREF);
+    voice->retired_ref = voice->synced_ref;
+    voice->synced_ref = LUA_NOREF;
+}
+
+void am_voice_pool_node::sync_params(lua_State *L) {
+    for (int i = 0; i < num_voices; i++) {
+        am_voice *voice = &voices[i];
+        // The audio thread has applied the last sync and rendered
+        // with it, so it's finished with any retired buffer.
+        if (voice->retired_ref != LUA_NOREF) {
+            unref(L, voice->retired_ref);
+            voice->retired_ref = LUA_NOREF;
+        }
+        switch (voice->pending_command) {
+            case AM_VOICE_COMMAND_START:
+                retire_voice_buffer(voice);
+                voice->synced_ref = voice->pending_ref;
+                voice->pending_ref = LUA_NOREF;
+                voice->sync_buffer = voice->pending_buffer;
+                voice->sync_loop = voice->pending_loop;
+                voice->playback_speed.sync();
+                voice->gain.sync();
+                break;
+            case AM_VOICE_COMMAND_STOP:
+                retire_voice_buffer(voice);
+                break;
+            case AM_VOICE_COMMAND_NONE:
+                if (voice->synced_ref != LUA_NOREF && voice->done) {
+                    voice->playing = false;
+                    retire_voice_buffer(voice);
+                }
+                break;
+        }
+        voice->sync_command = voice->pending_command;
+        voice->pending_command = AM_VOICE_COMMAND_NONE;
+    }
+}
+
+void am_voice_pool_node::apply_params() {
+    for (int i = 0; i < num_voices; i++) {
+        am_voice *voice = &voices[i];
+        am_voice_state *live = &voice->live;
+        switch (voice->sync_command) {
+            case AM_VOICE_COMMAND_START:
+                if (live->active) {
+                    // fade out the old sound instead of cutting it off
+                    voice->fading = *live;
+                    voice->fading.gain.target_value = 0.0f;
+                }
+                live->buffer = voice->sync_buffer;
+                live->playback_speed.set_immediate(voice->playback_speed.sync_value);
+                live->gain.set_immediate(voice->gain.sync_value);
+                live->sample_rate_ratio = (float)live->buffer->sample_rate / (float)am_conf_audio_sample_rate;
+                live->loop = voice->sync_loop;
+                live->active = true;
+                live->stopping = false;
+                live->current_position = 0;
+                live->next_position = 0;
+                voice->done = false;
+                break;
+            case AM_VOICE_COMMAND_STOP:
+                if (live->active) {
+                    live->gain.target_value = 0.0f;
+                    live->stopping = true;
+                }
+                break;
+            case AM_VOICE_COMMAND_NONE:
+                break;
+        }
+    }
+}
+
+static bool render_voice(am_voice_state *state, am_audio_bus *bus) {
+    if (!state->active) return false;
+    if (is_too_slow(state->playback_speed.current_value)) return false;
+    if (state->buffer->buffer->data == NULL) return true;
+    return mix_audio_buffer(bus, state->buffer, state->current_position, &state->next_position,
+        &state->playback_speed, &state->gain, state->sample_rate_ratio, state->loop);
+}
+
+void am_voice_pool_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
+    for (int i = 0; i < num_voices; i++) {
+        am_voice *voice = &voices[i];
+        render_voice(&voice->fading, bus);
+        if (render_voice(&voice->live, bus)) {
+            voice->live.stopping = true;
+        }
+    }
+}
+
+void am_voice_pool_node::post_render(am_audio_context *context, int num_samples) {
+    for (int i = 0; i < num_voices; i++) {
+        am_voice *voice = &voices[i];
+        am_voice_state *live = &voice->live;
+        if (live->active) {
+            if (live->stopping) {
+                live->active = false;
+                voice->done = true;
+            } else {
+                live->playback_speed.update_current();
+                live->gain.update_current();
+                live->current_position = live->next_position;
+            }
+        }
+        // fades only last one buffer
+        voice->fading.active = false;
+    }
+}
+
+bool am_voice_pool_node::finished() {
+    // the pool stays around to play more sounds
+    return false;
+}
+
 // Oscillator Node
 
 am_oscillator_node::am_oscillator_node()
@@ -610,7 +877,12 @@ am_oscillator_node::am_oscillator_node()
     offset = 0;
 }
 
-void am_oscillator_node::sync_params() {
+void am_oscillator_node::sync_params(lua_State *L) {
+    phase.sync();
+    freq.sync();
+}
+
+void am_oscillator_node::apply_params() {
     phase.update_target();
     freq.update_target();
 }
@@ -661,20 +933,34 @@ am_spectrum_node::am_spectrum_node() : smoothing(0.9f) {
     cfg = NULL;
     arr = NULL;
     arr_ref = LUA_NOREF;
+    done = false;
+    memset(bin_slots, 0, sizeof(bin_slots));
+    write_slot = 0;
+    newest_slot = 1;
+    read_slot = 2;
 }
 
-void am_spectrum_node::sync_params() {
+void am_spectrum_node::sync_params(lua_State *L) {
+    smoothing.sync();
+    int newest = newest_slot.load();
+    if (newest & AM_SPECTRUM_SLOT_FRESH) {
+        read_slot = newest_slot.exchange(read_slot) & ~AM_SPECTRUM_SLOT_FRESH;
+    }
     if (arr->size < num_bins - 1) return;
     if (arr->type != AM_VIEW_TYPE_F32) return;
     if (arr->components != 1) return;
     if (arr->buffer->data == NULL) return;
+    float *bins = bin_slots[read_slot];
     float *farr = (float*)&arr->buffer->data[arr->offset];
     for (int i = 1; i < num_bins; i++) {
-        float data = bin_data[i];
+        float data = bins[i];
         float decibels = data == 0.0f ? -1000.0f : 20.0f * log10f(data);
         *farr = decibels;
         farr = (float*)(((uint8_t*)farr) + arr->stride);
     }
+}
+
+void am_spectrum_node::apply_params() {
     smoothing.update_target();
     smoothing.update_current();
     done = false;
@@ -752,6 +1038,10 @@ void am_spectrum_node::render_audio(am_audio_context *context, am_audio_bus *bus
         input += fftsize;
     }
 
+    // publish the new bins for the lua thread
+    memcpy(bin_slots[write_slot], bin_data, num_bins * sizeof(float));
+    write_slot = newest_slot.exchange(write_slot | AM_SPECTRUM_SLOT_FRESH) & ~AM_SPECTRUM_SLOT_FRESH;
+
     done = true;
 }
 
@@ -760,7 +1050,7 @@ void am_spectrum_node::render_audio(am_audio_context *context, am_audio_bus *bus
 am_capture_node::am_capture_node() {
 }
 
-void am_capture_node::sync_params() {
+void am_capture_node::sync_params(lua_State *L) {
 }
 
 void am_capture_node::post_render(am_audio_context *context, int num_samples) {
@@ -1105,9 +1395,10 @@ static int reset_track(lua_State *L) {
     if (nargs > 1) {
         int buf_num_channels = node->audio_buffer->num_channels;
         int buf_num_samples = node->audio_buffer->buffer->size / (buf_num_channels * sizeof(float));
-        node->reset_position = am_min(luaL_checknumber(L, 2) * node->audio_buffer->sample_rate, (double)(buf_num_samples-1));
+        node->reset_position = am_resample_pos_from_samples(
+            am_min(luaL_checknumber(L, 2) * node->audio_buffer->sample_rate, (double)(buf_num_samples-1)));
     } else {
-        node->reset_position = 0.0;
+        node->reset_position = 0;
     }
     return 0;
 }
@@ -1178,15 +1469,30 @@ static int create_audio_stream_node(lua_State *L) {
     }
     node->num_channels = info.channels;
     node->sample_rate_ratio = (float)node->sample_rate / (float)am_conf_audio_sample_rate;
+
+    // the ring holds at least a few audio callbacks' worth of frames
+    int latency_frames = (int)(am_conf_audio_stream_latency * (double)am_conf_audio_sample_rate);
+    node->ring_capacity = am_max(latency_frames, am_conf_audio_buffer_size * 4);
+    node->ring_channels = am_min(node->num_channels, AM_MAX_CHANNELS);
+    node->ring = (float*)malloc(node->ring_capacity * node->ring_channels * sizeof(float));
+    // decode the first couple of buffers now, so playback can start
+    // straight away
+    while (node->write_pos < (unsigned int)am_conf_audio_buffer_size * 2 && node->decode_ahead()) {}
+    am_add_decoder_stream(node);
     return 1;
 }
 
 static int audio_stream_gc(lua_State *L) {
     am_audio_stream_node *node = (am_audio_stream_node*)lua_touserdata(L, 1);
     if (node->handle != NULL) {
+        am_remove_decoder_stream(node);
         stb_vorbis_close((stb_vorbis*)node->handle);
         node->handle = NULL;
     }
+    if (node->ring != NULL) {
+        free(node->ring);
+        node->ring = NULL;
+    }
     return 0;
 }
 
@@ -1202,6 +1508,20 @@ static void set_stream_playback_speed(lua_State *L, void *obj) {
 
 static am_property stream_playback_speed_property = {get_stream_playback_speed, set_stream_playback_speed};
 
+static void get_stream_underruns(lua_State *L, void *obj) {
+    am_audio_stream_node *node = (am_audio_stream_node*)obj;
+    lua_pushinteger(L, node->underruns.load(std::memory_order_relaxed));
+}
+
+static am_property stream_underruns_property = {get_stream_underruns, NULL};
+
+static void get_stream_capacity(lua_State *L, void *obj) {
+    am_audio_stream_node *node = (am_audio_stream_node*)obj;
+    lua_pushinteger(L, node->ring_capacity);
+}
+
+static am_property stream_capacity_property = {get_stream_capacity, NULL};
+
 static void register_audio_stream_node_mt(lua_State *L) {
     lua_newtable(L);
     lua_pushcclosure(L, am_audio_node_index, 0);
@@ -1211,10 +1531,170 @@ static void register_audio_stream_node_mt(lua_State *L) {
     lua_setfield(L, -2, "__gc");
 
     am_register_property(L, "playback_speed", &stream_playback_speed_property);
+    am_register_property(L, "underruns", &stream_underruns_property);
+    am_register_property(L, "capacity", &stream_capacity_property);
 
     am_register_metatable(L, "audio_stream", MT_am_audio_stream_node, MT_am_audio_node);
 }
 
+// Voice pool node lua bindings
+
+static int create_voice_pool_node(lua_State *L) {
+    am_check_nargs(L, 1);
+    int n = luaL_checkinteger(L, 1);
+    if (n < 1) {
+        return luaL_error(L, "a voice pool must have at least 1 voice");
+    }
+    // allocate extra space for the voices
+    am_voice_pool_node *node = (am_voice_pool_node*)am_set_metatable(L,
+        new (lua_newuserdata(L,
+            sizeof(am_voice_pool_node) + n * sizeof(am_voice)))
+        am_voice_pool_node(), MT_am_voice_pool_node);
+    node->voices = (am_voice*)(node + 1);
+    for (int i = 0; i < n; i++) {
+        new (&node->voices[i]) am_voice();
+    }
+    node->num_voices = n;
+    return 1;
+}
+
+static void cancel_pending_start(lua_State *L, am_voice_pool_node *node, am_voice *voice) {
+    if (voice->pending_command == AM_VOICE_COMMAND_START) {
+        node->unref(L, voice->pending_ref);
+        voice->pending_ref = LUA_NOREF;
+        voice->pending_buffer = NULL;
+        voice->pending_command = AM_VOICE_COMMAND_NONE;
+    }
+}
+
+// Returns a free voice, or else the playing voice with the lowest
+// priority (the oldest if there's a tie), or NULL if all the voices
+// have a higher priority than the given one.
+static am_voice *choose_voice(am_voice_pool_node *node, int priority) {
+    am_voice *victim = NULL;
+    for (int i = 0; i < node->num_voices; i++) {
+        am_voice *voice = &node->voices[i];
+        if (!voice->playing) return voice;
+        if (victim == NULL || voice->priority < victim->priority
+            || (voice->priority == victim->priority && voice->serial < victim->serial))
+        {
+            victim = voice;
+        }
+    }
+    if (victim != NULL && victim->priority > priority) return NULL;
+    return victim;
+}
+
+static int voice_pool_play(lua_State *L) {
+    int nargs = am_check_nargs(L, 2);
+    am_voice_pool_node *node = am_get_userdata(L, am_voice_pool_node, 1);
+    am_audio_buffer *buf = am_get_userdata(L, am_audio_buffer, 2);
+    bool loop = false;
+    float pitch = 1.0f;
+    float volume = 1.0f;
+    int priority = 0;
+    if (nargs > 2 && !lua_isnil(L, 3)) {
+        luaL_checktype(L, 3, LUA_TTABLE);
+        lua_getfield(L, 3, "loop");
+        loop = lua_toboolean(L, -1);
+        lua_getfield(L, 3, "pitch");
+        pitch = luaL_optnumber(L, -1, 1.0);
+        lua_getfield(L, 3, "volume");
+        volume = luaL_optnumber(L, -1, 1.0);
+        lua_getfield(L, 3, "priority");
+        priority = luaL_optinteger(L, -1, 0);
+        lua_pop(L, 4);
+    }
+    am_voice *voice = choose_voice(node, priority);
+    if (voice == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+    cancel_pending_start(L, node, voice);
+    voice->pending_buffer = buf;
+    voice->pending_ref = node->ref(L, 2);
+    voice->pending_command = AM_VOICE_COMMAND_START;
+    voice->pending_loop = loop;
+    voice->playback_speed.pending_value = pitch;
+    voice->gain.pending_value = volume;
+    voice->priority = priority;
+    voice->serial = node->next_serial++;
+    voice->playing = true;
+    lua_pushinteger(L, voice->serial);
+    return 1;
+}
+
+static void stop_voice(lua_State *L, am_voice_pool_node *node, am_voice *voice) {
+    cancel_pending_start(L, node, voice);
+    if (voice->synced_ref != LUA_NOREF) {
+        voice->pending_command = AM_VOICE_COMMAND_STOP;
+    }
+    voice->playing = false;
+}
+
+static int voice_pool_stop(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_voice_pool_node *node = am_get_userdata(L, am_voice_pool_node, 1);
+    int serial = luaL_checkinteger(L, 2);
+    for (int i = 0; i < node->num_voices; i++) {
+        am_voice *voice = &node->voices[i];
+        if (voice->playing && voice->serial == serial) {
+            stop_voice(L, node, voice);
+            break;
+        }
+    }
+    return 0;
+}
+
+static int voice_pool_stop_all(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_voice_pool_node *node = am_get_userdata(L, am_voice_pool_node, 1);
+    for (int i = 0; i < node->num_voices; i++) {
+        am_voice *voice = &node->voices[i];
+        if (voice->playing) {
+            stop_voice(L, node, voice);
+        }
+    }
+    return 0;
+}
+
+static void get_num_voices(lua_State *L, void *obj) {
+    am_voice_pool_node *node = (am_voice_pool_node*)obj;
+    lua_pushinteger(L, node->num_voices);
+}
+
+static am_property num_voices_property = {get_num_voices, NULL};
+
+static void get_num_playing(lua_State *L, void *obj) {
+    am_voice_pool_node *node = (am_voice_pool_node*)obj;
+    int n = 0;
+    for (int i = 0; i < node->num_voices; i++) {
+        if (node->voices[i].playing) n++;
+    }
+    lua_pushinteger(L, n);
+}
+
+static am_property num_playing_property = {get_num_playing, NULL};
+
+static void register_voice_pool_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_audio_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    am_set_default_newindex_func(L);
+
+    lua_pushcclosure(L, voice_pool_play, 0);
+    lua_setfield(L, -2, "play");
+    lua_pushcclosure(L, voice_pool_stop, 0);
+    lua_setfield(L, -2, "stop");
+    lua_pushcclosure(L, voice_pool_stop_all, 0);
+    lua_setfield(L, -2, "stop_all");
+
+    am_register_property(L, "num_voices", &num_voices_property);
+    am_register_property(L, "num_playing", &num_playing_property);
+
+    am_register_metatable(L, "voice_pool", MT_am_voice_pool_node, MT_am_audio_node);
+}
+
 // Oscillator node lua bindings
 
 static int create_oscillator_node(lua_State *L) {
@@ -1505,98 +1985,29 @@ static void register_audio_buffer_mt(lua_State *L) {
 
 //-------------------------------------------------------------------------
 
-static int load_audio(lua_State *L) {
-    char *errmsg;
-    int len;
-    const char *filename = luaL_checkstring(L, 1);
-    void *data = am_read_resource(filename, &len, &errmsg);
-    if (data == NULL) {
-        free(errmsg);
-        lua_pushnil(L);
-        return 1;
-    }
-    int num_channels;
-    int sample_rate;
-    short *tmp_data;
-    int num_samples = stb_vorbis_decode_memory((unsigned char*)data,
-        len, &num_channels, &sample_rate, &tmp_data);
-    free(data);
-    if (num_samples <= 0) {
-        return luaL_error(L, "error loading audio '%s'", filename);
-    }
-    am_buffer *dest_buf;
-    float *dest_data;
-    num_channels = am_min(num_channels, am_conf_audio_channels);
-    int dest_samples;
-    if (sample_rate != am_conf_audio_sample_rate) {
-        // resample required
-        am_log0("WARNING: resampling buffer '%s' from %dHz to %dHz",
-            filename, sample_rate, am_conf_audio_sample_rate);
-        double sample_rate_ratio = (double)sample_rate / (double)am_conf_audio_sample_rate;
-        dest_samples = floor((double)num_samples / sample_rate_ratio);
-        dest_buf = am_push_new_buffer_and_init(L, dest_samples * num_channels * 4);
-        dest_data = (float*)dest_buf->data;
-        for (int c = 0; c < num_channels; c++) {
-            double pos = 0.0f;
-            for (int write_index = 0; write_index < dest_samples; write_index++) {
-                int read_index1 = (int)floor(pos);
-                int read_index2 = read_index1 + 1;
-                if (read_index2 >= num_samples) {
-                    break;
-                }
-                float interpolation_factor = (float)(pos - (float)read_index1);
-                float sample1 = (float)tmp_data[read_index1 * num_channels + c] / (float)INT16_MAX;
-                float sample2 = (float)tmp_data[read_index2 * num_channels + c] / (float)INT16_MAX;
-                float interpolated_sample = (1.0f - interpolation_factor) * sample1 + interpolation_factor * sample2;
-                dest_data[c * dest_samples + write_index] = interpolated_sample;
-                pos += sample_rate_ratio;
-                if (pos >= (double)num_samples) {
-                    break;
-                }
-            }
-        }
-    } else {
-        // no resample required
-        dest_buf = am_push_new_buffer_and_init(L, num_samples * num_channels * 4);
-        dest_data = (float*)dest_buf->data;
-        dest_samples = num_samples;
-        for (int c = 0; c < num_channels; c++) {
-            for (int s = 0; s < num_samples; s++) {
-                dest_data[c * num_samples + s] = (float)tmp_data[s * num_channels + c] / (float)INT16_MAX;
-            }
-        }
-    }
-    free(tmp_data);
-    am_audio_buffer *audio_buffer = am_new_userdata(L, am_audio_buffer);
-    audio_buffer->num_channels = num_channels;
-    audio_buffer->sample_rate = am_conf_audio_sample_rate;
-    audio_buffer->buffer = dest_buf;
-    audio_buffer->buffer_ref = audio_buffer->ref(L, -2);
-    lua_remove(L, -2); // remove dest buf
-    return 1;
-}
-
-//-------------------------------------------------------------------------
-
 void am_destroy_audio() {
     audio_context.root = NULL;
+    audio_context.sync_pending = false;
     clear_buffer_pool();
 }
 
-static void update_live_pause_state(am_audio_node *node) {
-    switch (live_pause_state(node)) {
-        case LIVE_PAUSE_STATE_BEGIN: set_live_pause_state(node, LIVE_PAUSE_STATE_PAUSED); break;
-        case LIVE_PAUSE_STATE_END: set_live_pause_state(node, LIVE_PAUSE_STATE_UNPAUSED); break;
+// Audio thread
+
+static void update_pause_state(am_audio_node *node) {
+    switch (node->pause_state) {
+        case PAUSE_STATE_BEGIN: node->pause_state = PAUSE_STATE_PAUSED; break;
+        case PAUSE_STATE_END: node->pause_state = PAUSE_STATE_UNPAUSED; break;
     }
 }
 
 static void do_post_render(am_audio_context *context, int num_samples, am_audio_node *node) {
     if (node->last_render >= context->render_id) return; // already processed
     node->last_render = context->render_id;
-    update_live_pause_state(node);
+    update_pause_state(node);
     node->post_render(context, num_samples);
-    for (int i = 0; i < node->live_children.size; i++) {
-        am_audio_node_child *child = &node->live_children.arr[i];
+    am_lua_array<am_audio_node_child> *live = node->live_children;
+    for (int i = 0; i < live->size; i++) {
+        am_audio_node_child *child = &live->arr[i];
         if (child->state == AM_AUDIO_NODE_CHILD_STATE_REMOVED) {
             child->state = AM_AUDIO_NODE_CHILD_STATE_DONE;
         } else if (child->state == AM_AUDIO_NODE_CHILD_STATE_NEW) {
@@ -1606,12 +2017,35 @@ static void do_post_render(am_audio_context *context, int num_samples, am_audio_
     }
 }
 
+// Switches the node and its descendants over to the values
+// written by the last sync.
+static void apply_sync(am_audio_context *context, am_audio_node *node) {
+    if (node->last_apply >= context->sync_id) return; // already applied
+    node->last_apply = context->sync_id;
+    node->apply_params();
+    if (node->children_synced) {
+        node->live_children = node->live_children == &node->child_lists[0]
+            ? &node->child_lists[1] : &node->child_lists[0];
+    }
+    node->pause_state = node->sync_pause_state;
+    am_lua_array<am_audio_node_child> *live = node->live_children;
+    for (int i = 0; i < live->size; i++) {
+        apply_sync(context, live->arr[i].child);
+    }
+}
+
 void am_fill_audio_bus(am_audio_bus *bus) {
     if (audio_context.root == NULL) return;
     double t0 = 0.0;
     if (am_record_perf_timings) {
         t0 = am_get_current_time();
     }
+    bool synced = audio_context.sync_pending.load(std::memory_order_acquire);
+    if (synced) {
+        apply_sync(&audio_context, audio_context.root);
+        synced_audio_time = audio_time_accum;
+        audio_time_accum = 0.0;
+    }
     if (!am_conf_audio_mute) {
 #if AM_STEAMWORKS
         // mute audio if steam overlay shown
@@ -1627,20 +2061,43 @@ void am_fill_audio_bus(am_audio_bus *bus) {
     if (am_record_perf_timings) {
         audio_time_accum += am_get_current_time() - t0;
     }
+    if (synced) {
+        // The lua thread relies on everything in the synced graph
+        // having been rendered at least once when this is cleared.
+        audio_context.sync_pending.store(false, std::memory_order_release);
+    }
 }
 
+// Lua thread
+
 static void sync_children_list(lua_State *L, am_audio_node *node) {
     int p = 0;
     int l = 0;
 
     am_lua_array<am_audio_node_child> *parr = &node->pending_children;
-    am_lua_array<am_audio_node_child> *larr = &node->live_children;
-
-    // remove live children that need to be removed
-    for (l = larr->size-1; l >= 0; l--) {
-        if (larr->arr[l].state == AM_AUDIO_NODE_CHILD_STATE_DONE) {
-            node->unref(L, larr->arr[l].ref);
-            larr->remove(l);
+    am_lua_array<am_audio_node_child> *sarr = &node->sync_children;
+
+    // The audio thread has rendered the node since its last sync, so
+    // its live children have moved on to the next state. DONE children
+    // were left out of the last sync, which has now been applied, so
+    // they're no longer used by the audio thread and can be released.
+    bool changed = children_dirty(node);
+    for (l = sarr->size-1; l >= 0; l--) {
+        switch (sarr->arr[l].state) {
+            case AM_AUDIO_NODE_CHILD_STATE_NEW:
+                sarr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_OLD;
+                changed = true;
+                break;
+            case AM_AUDIO_NODE_CHILD_STATE_REMOVED:
+                sarr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_DONE;
+                changed = true;
+                break;
+            case AM_AUDIO_NODE_CHILD_STATE_DONE:
+                node->unref(L, sarr->arr[l].ref);
+                sarr->remove(l);
+                break;
+            case AM_AUDIO_NODE_CHILD_STATE_OLD:
+                break;
         }
     }
 
@@ -1648,73 +2105,109 @@ static void sync_children_list(lua_State *L, am_audio_node *node) {
         // insert NEW children and mark REMOVED children
         l = 0;
         p = 0;
-        while (p < parr->size && l < larr->size) {
-            while (p < parr->size && parr->arr[p].child < larr->arr[l].child) {
+        while (p < parr->size && l < sarr->size) {
+            while (p < parr->size && parr->arr[p].child < sarr->arr[l].child) {
                 parr->arr[p].state = AM_AUDIO_NODE_CHILD_STATE_NEW;
-                larr->insert(L, l, parr->arr[p]);
-                larr->arr[l].child->push(L);
-                larr->arr[l].ref = node->ref(L, -1);
+                sarr->insert(L, l, parr->arr[p]);
+                sarr->arr[l].child->push(L);
+                sarr->arr[l].ref = node->ref(L, -1);
                 lua_pop(L, 1);
                 p++;
                 l++;
             }
-            while (p < parr->size && l < larr->size && parr->arr[p].child == larr->arr[l].child) {
+            while (p < parr->size && l < sarr->size && parr->arr[p].child == sarr->arr[l].child) {
+                if (sarr->arr[l].state == AM_AUDIO_NODE_CHILD_STATE_DONE) {
+                    // re-added after it was removed
+                    sarr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_NEW;
+                }
                 p++;
                 l++;
             }
-            while (p < parr->size && l < larr->size && parr->arr[p].child > larr->arr[l].child) {
-                if (larr->arr[l].state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
-                    larr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_REMOVED;
+            while (p < parr->size && l < sarr->size && parr->arr[p].child > sarr->arr[l].child) {
+                if (sarr->arr[l].state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
+                    sarr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_REMOVED;
                 }
                 l++;
             }
         }
         while (p < parr->size) {
             parr->arr[p].state = AM_AUDIO_NODE_CHILD_STATE_NEW;
-            larr->insert(L, l, parr->arr[p]);
-            larr->arr[l].child->push(L);
-            larr->arr[l].ref = node->ref(L, -1);
+            sarr->insert(L, l, parr->arr[p]);
+            sarr->arr[l].child->push(L);
+            sarr->arr[l].ref = node->ref(L, -1);
             lua_pop(L, 1);
             p++;
             l++;
         }
-        while (l < larr->size) {
-            if (larr->arr[l].state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
-                larr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_REMOVED;
+        while (l < sarr->size) {
+            if (sarr->arr[l].state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
+                sarr->arr[l].state = AM_AUDIO_NODE_CHILD_STATE_REMOVED;
             }
             l++;
         }
 
         clear_children_dirty(node);
     }
+
+    // Write the new list of live children into the list the audio
+    // thread isn't using. DONE children are left out, but kept in
+    // sync_children until the next sync so they aren't collected
+    // while the audio thread may still be looking at them.
+    node->children_synced = changed;
+    if (changed) {
+        am_lua_array<am_audio_node_child> *next = node->live_children == &node->child_lists[0]
+            ? &node->child_lists[1] : &node->child_lists[0];
+        next->clear();
+        for (l = 0; l < sarr->size; l++) {
+            if (sarr->arr[l].state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
+                next->push_back(L, sarr->arr[l]);
+            }
+        }
+    }
 }
 
 static void sync_paused(am_audio_node *node) {
-    int live_state = live_pause_state(node);
-    if (pending_pause(node) && live_state != LIVE_PAUSE_STATE_PAUSED) {
-        set_live_pause_state(node, LIVE_PAUSE_STATE_BEGIN);
-    } else if (!pending_pause(node) && live_state != LIVE_PAUSE_STATE_UNPAUSED) {
-        set_live_pause_state(node, LIVE_PAUSE_STATE_END);
+    // the audio thread has moved on from any fades since the last sync
+    int state = node->sync_pause_state;
+    if (state == PAUSE_STATE_BEGIN) {
+        state = PAUSE_STATE_PAUSED;
+    } else if (state == PAUSE_STATE_END) {
+        state = PAUSE_STATE_UNPAUSED;
     }
+    if (pending_pause(node) && state != PAUSE_STATE_PAUSED) {
+        state = PAUSE_STATE_BEGIN;
+    } else if (!pending_pause(node) && state != PAUSE_STATE_UNPAUSED) {
+        state = PAUSE_STATE_END;
+    }
+    node->sync_pause_state = state;
 }
 
 static void sync_audio_graph(lua_State *L, am_audio_context *context, am_audio_node *node) {
     if (node->last_sync >= context->sync_id) return; // already synced
     node->last_sync = context->sync_id;
-    node->sync_params();
+    node->sync_params(L);
     sync_children_list(L, node);
     sync_paused(node);
-    for (int i = 0; i < node->live_children.size; i++) {
-        sync_audio_graph(L, context, node->live_children.arr[i].child);
+    for (int i = 0; i < node->sync_children.size; i++) {
+        am_audio_node_child *child = &node->sync_children.arr[i];
+        if (child->state != AM_AUDIO_NODE_CHILD_STATE_DONE) {
+            sync_audio_graph(L, context, child->child);
+        }
     }
-    am_last_frame_audio_time = audio_time_accum;
-    audio_time_accum = 0.0;
 }
 
 void am_sync_audio_graph(lua_State *L) {
     if (audio_context.root == NULL) return;
+    if (audio_context.sync_pending.load(std::memory_order_acquire)) {
+        // The audio thread hasn't picked up the last sync yet, so
+        // leave the changes pending until the next frame.
+        return;
+    }
+    AM_PROFILE_ZONE("audio sync");
+    am_last_frame_audio_time = synced_audio_time;
     audio_context.sync_id++;
     sync_audio_graph(L, &audio_context, audio_context.root);
+    audio_context.sync_pending.store(true, std::memory_order_release);
 }
 
 //-------------------------------------------------------------------------
@@ -1782,7 +2275,7 @@ void am_open_audio_module(lua_State *L) {
         {"capture_audio", create_capture_node},
         {"track", create_audio_track_node},
         {"stream", create_audio_stream_node},
-        {"load_audio", load_audio},
+        {"voice_pool", create_voice_pool_node},
         {"root_audio_node", get_root_audio_node},
         {NULL, NULL}
     };
@@ -1794,13 +2287,17 @@ void am_open_audio_module(lua_State *L) {
     register_highpass_filter_node_mt(L);
     register_audio_track_node_mt(L);
     register_audio_stream_node_mt(L);
+    register_voice_pool_node_mt(L);
     register_oscillator_node_mt(L);
     register_capture_node_mt(L);
     register_spectrum_node_mt(L);
 
+    am_init_resampler(am_conf_audio_resample_quality);
+
     audio_context.sample_rate = am_conf_audio_sample_rate;
     audio_context.sync_id = 0;
     audio_context.render_id = 0;
+    audio_context.sync_pending = false;
 
     // Create root audio node
     create_audio_node(L);
@@ -5,11 +5,26 @@
 
 struct am_audio_node;
 
+// The Lua thread and the audio thread never wait for each other.
+// Once per frame the Lua thread copies the changes made since the last
+// sync (param values, children lists and paused flags) into the sync
+// fields of the graph's nodes and sets sync_pending. The audio thread
+// applies them at the start of its next callback and clears
+// sync_pending after it's rendered with them. The Lua thread doesn't
+// touch the sync fields while sync_pending is set, and skips the sync
+// for that frame instead, so the changes are picked up the frame
+// after. Because a node stays in the live graph until at least one
+// callback after it's been removed, the Lua thread can work out the
+// audio thread's view of the graph without reading anything the audio
+// thread writes. When no audio device is open (e.g. in headless mode)
+// the backend renders a buffer on the Lua thread after each sync
+// instead, so the syncs still go through.
 struct am_audio_context {
     int sample_rate;
     int sync_id;
     int render_id;
     am_audio_node* root;
+    std::atomic<bool> sync_pending;
 };
 
 // each channel is a contiguous chunk of memory
@@ -46,18 +61,26 @@ struct am_audio_node_child {
 
 template<typename T>
 struct am_audio_param {
-    T pending_value;
-    T target_value;
-    T current_value;
+    T pending_value; // lua thread
+    T sync_value;    // pending_value at the last sync
+    T target_value;  // audio thread
+    T current_value; // audio thread
 
     am_audio_param(T val) {
         pending_value = val;
+        sync_value = val;
         target_value = val;
         current_value = val;
     }
 
+    // lua thread
+    void sync() {
+        sync_value = pending_value;
+    }
+
+    // audio thread
     void update_target() {
-        target_value = pending_value;
+        target_value = sync_value;
     }
 
     void update_current() {
@@ -66,6 +89,7 @@ struct am_audio_param {
 
     void set_immediate(T val) {
         pending_value = val;
+        sync_value = val;
         target_value = val;
         current_value = val;
     }
@@ -87,19 +111,33 @@ struct am_audio_buffer : am_nonatomic_userdata {
 };
 
 struct am_audio_node : am_nonatomic_userdata {
+    // lua thread
     am_lua_array<am_audio_node_child> pending_children;
-    am_lua_array<am_audio_node_child> live_children;
+    am_lua_array<am_audio_node_child> sync_children; // audio thread's children as of the last sync
     int last_sync;
-    int last_render;
     uint32_t flags;
+
+    // written by the lua thread during a sync and read by the
+    // audio thread when it applies the sync
+    am_lua_array<am_audio_node_child> child_lists[2];
+    bool children_synced; // children changed in the last sync
+    int sync_pause_state;
+
+    // audio thread
+    am_lua_array<am_audio_node_child> *live_children; // points to one of child_lists
+    int last_apply;
+    int last_render;
+    int pause_state;
     int recursion_limit;
 
     am_audio_node();
 
-    void sync(lua_State *L, am_audio_context *context, int num_samples);
     void render_children(am_audio_context *context, am_audio_bus *bus);
 
-    virtual void sync_params();
+    // called on the lua thread to copy pending values into sync values
+    virtual void sync_params(lua_State *L);
+    // called on the audio thread to start using the sync values
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -109,7 +147,8 @@ struct am_gain_node : am_audio_node {
     am_audio_param<float> gain;
 
     am_gain_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
 };
@@ -149,7 +188,8 @@ struct am_lowpass_filter_node : am_biquad_filter_node {
     am_audio_param<float> resonance;
     
     am_lowpass_filter_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
 };
 
 struct am_highpass_filter_node : am_biquad_filter_node {
@@ -157,7 +197,8 @@ struct am_highpass_filter_node : am_biquad_filter_node {
     am_audio_param<float> resonance;
     
     am_highpass_filter_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
 };
 
 struct am_audio_track_node : am_audio_node {
@@ -168,15 +209,18 @@ struct am_audio_track_node : am_audio_node {
     am_audio_param<float> gain;
     bool loop;
     bool needs_reset;
-    bool done_server;
+    bool sync_reset;
+    std::atomic<bool> done_server;
     bool done_client;
 
-    double current_position;
-    double next_position;
-    double reset_position;
+    am_resample_pos current_position;
+    am_resample_pos next_position;
+    am_resample_pos reset_position;
+    am_resample_pos sync_reset_position;
 
     am_audio_track_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -185,20 +229,100 @@ struct am_audio_track_node : am_audio_node {
 struct am_audio_stream_node : am_audio_node {
     am_buffer *buffer;
     int buffer_ref;
-    void *handle;
+    void *handle; // only used by the decoder
     int num_channels;
     int sample_rate;
     float sample_rate_ratio;
     am_audio_param<float> playback_speed;
     bool loop;
-    bool done_server;
+    std::atomic<bool> done_server;
     bool done_client;
 
     double current_position;
     double next_position;
 
+    // Decoded samples (interleaved) waiting to be played. The
+    // decoder writes them and advances write_pos, the audio thread
+    // reads them and advances read_pos. The positions count frames
+    // and wrap around, so write_pos - read_pos is the number of frames
+    // ready.
+    float *ring;
+    int ring_channels;
+    unsigned int ring_capacity; // in frames
+    std::atomic<unsigned int> write_pos;
+    std::atomic<unsigned int> read_pos;
+    std::atomic<bool> end_of_stream; // set once the last frame is written
+    std::atomic<int> underruns;
+
     am_audio_stream_node();
-    virtual void sync_params();
+    bool decode_ahead();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
+    virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
+    virtual void post_render(am_audio_context *context, int num_samples);
+    virtual bool finished();
+};
+
+enum am_voice_command {
+    AM_VOICE_COMMAND_NONE,
+    AM_VOICE_COMMAND_START,
+    AM_VOICE_COMMAND_STOP,
+};
+
+// audio thread state of a voice
+struct am_voice_state {
+    am_audio_buffer *buffer;
+    am_audio_param<float> playback_speed;
+    am_audio_param<float> gain;
+    float sample_rate_ratio;
+    bool loop;
+    bool active;
+    bool stopping; // fading out
+
+    am_resample_pos current_position;
+    am_resample_pos next_position;
+
+    am_voice_state();
+};
+
+struct am_voice {
+    // lua thread
+    am_audio_buffer *pending_buffer;
+    int pending_ref;
+    int synced_ref;  // buffer the audio thread is playing
+    int retired_ref; // released at the next sync
+    am_voice_command pending_command;
+    bool pending_loop;
+    int priority;
+    int serial;
+    bool playing;
+
+    // written during a sync
+    am_voice_command sync_command;
+    am_audio_buffer *sync_buffer;
+    bool sync_loop;
+    am_audio_param<float> playback_speed;
+    am_audio_param<float> gain;
+
+    // audio thread
+    am_voice_state live;
+    am_voice_state fading; // a stolen voice fading out
+    std::atomic<bool> done;
+
+    am_voice();
+};
+
+// A fixed number of voices that play audio buffers. Voices are mixed
+// straight into the output bus, so playing a buffer doesn't allocate
+// anything. The voices are stored after the node in the same userdata.
+struct am_voice_pool_node : am_audio_node {
+    int num_voices;
+    am_voice *voices;
+    int next_serial;
+
+    am_voice_pool_node();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -218,7 +342,8 @@ struct am_oscillator_node : am_audio_node {
     int offset;
 
     am_oscillator_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -233,16 +358,25 @@ struct am_spectrum_node : am_audio_node {
     am_buffer_view *arr;
     int arr_ref;
     bool done;
+
+    // bin_data is handed to the lua thread through a triple buffer:
+    // the audio thread writes to one slot, the lua thread reads from
+    // another and the third holds the newest complete bins.
+    float bin_slots[3][AM_MAX_FFT_BINS];
+    std::atomic<int> newest_slot; // AM_SPECTRUM_SLOT_FRESH set if not read yet
+    int write_slot; // audio thread
+    int read_slot;  // lua thread
     
     am_spectrum_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
+    virtual void apply_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
 };
 
 struct am_capture_node : am_audio_node {
     am_capture_node();
-    virtual void sync_params();
+    virtual void sync_params(lua_State *L);
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
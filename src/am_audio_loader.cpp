@@ -0,0 +1,490 @@
+#include "amulet.h"
+
+#if defined(AM_HAVE_THREADS)
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#if !defined(AM_BACKEND_EMSCRIPTEN)
+#define AM_HAVE_AUDIO_CACHE
+#endif
+
+#define AM_AUDIO_CACHE_MAGIC 0x4d43504d // "MPCM"
+#define AM_AUDIO_CACHE_VERSION 2
+
+struct am_audio_cache_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_channels;
+    uint32_t sample_rate;
+    uint32_t num_samples;
+};
+
+// One file to load. The fields are filled in on the lua thread before
+// decoding starts, then the results are filled in by whichever thread
+// decodes the file.
+struct am_audio_load_task {
+    char *filename;
+    void *data; // file contents, freed once decoded
+    int len;
+
+    // results
+    float *samples; // malloced, one channel after another
+    int num_channels;
+    int num_samples; // per channel
+    int file_sample_rate; // 0 if the samples came from the cache
+    char *errmsg; // set if the file couldn't be loaded
+};
+
+struct am_audio_load_job {
+    int num_tasks;
+    am_audio_load_task *tasks;
+    char *cache_dir; // NULL if caching is disabled
+    int sample_rate;
+    int max_channels;
+
+    std::atomic<int> num_done;
+    // the loader and the thread running the job each hold a reference
+    std::atomic<int> refs;
+#if defined(AM_HAVE_THREADS)
+    std::mutex mutex;
+    std::condition_variable done_cond;
+#endif
+};
+
+// 64 bit FNV-1a
+static uint64_t hash_bytes(uint64_t h, const void *data, size_t len) {
+    const uint8_t *bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static char *cache_filename(am_audio_load_job *job, am_audio_load_task *task) {
+    uint32_t settings[3] = {AM_AUDIO_CACHE_VERSION, (uint32_t)job->sample_rate, (uint32_t)job->max_channels};
+    uint64_t h = 14695981039346656037ULL;
+    h = hash_bytes(h, settings, sizeof(settings));
+    h = hash_bytes(h, task->data, task->len);
+    return am_format("%s%016llx.pcm", job->cache_dir, (unsigned long long)h);
+}
+
+static bool read_cache(am_audio_load_job *job, am_audio_load_task *task, const char *path) {
+    FILE *f = am_fopen(path, "rb");
+    if (f == NULL) return false;
+    am_audio_cache_header header;
+    bool ok = fread(&header, sizeof(header), 1, f) == 1
+        && header.magic == AM_AUDIO_CACHE_MAGIC
+        && header.version == AM_AUDIO_CACHE_VERSION
+        && header.sample_rate == (uint32_t)job->sample_rate
+        && header.num_channels >= 1
+        && header.num_channels <= (uint32_t)job->max_channels
+        && header.num_samples > 0;
+    if (ok) {
+        size_t n = (size_t)header.num_channels * header.num_samples;
+        float *samples = (float*)malloc(n * sizeof(float));
+        if (fread(samples, sizeof(float), n, f) == n) {
+            task->samples = samples;
+            task->num_channels = header.num_channels;
+            task->num_samples = header.num_samples;
+        } else {
+            free(samples);
+            ok = false;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+static void write_cache(am_audio_load_task *task, const char *path, int sample_rate) {
+    // Write to a temporary file first, so a partly written file is
+    // never read. The name includes the task's address, so two tasks
+    // with the same contents don't write to the same file.
+    char *tmp_path = am_format("%s.%p.tmp", path, (void*)task);
+    FILE *f = am_fopen(tmp_path, "wb");
+    if (f == NULL) {
+        free(tmp_path);
+        return;
+    }
+    am_audio_cache_header header;
+    header.magic = AM_AUDIO_CACHE_MAGIC;
+    header.version = AM_AUDIO_CACHE_VERSION;
+    header.num_channels = task->num_channels;
+    header.sample_rate = sample_rate;
+    header.num_samples = task->num_samples;
+    size_t n = (size_t)task->num_channels * task->num_samples;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1
+        && fwrite(task->samples, sizeof(float), n, f) == n;
+    ok = fclose(f) == 0 && ok;
+    if (!ok || !am_rename_file(tmp_path, path)) {
+        // on windows the rename fails if another task got there first
+        am_delete_file(tmp_path);
+    }
+    free(tmp_path);
+}
+
+// Decodes task->data and converts it to the output sample rate.
+static void decode_task(am_audio_load_task *task, int sample_rate, int max_channels) {
+    int num_channels;
+    int file_sample_rate;
+    short *tmp_data;
+    int num_samples = stb_vorbis_decode_memory((unsigned char*)task->data,
+        task->len, &num_channels, &file_sample_rate, &tmp_data);
+    if (num_samples <= 0) {
+        task->errmsg = am_format("error loading audio '%s'", task->filename);
+        return;
+    }
+    int src_channels = num_channels;
+    num_channels = am_min(num_channels, max_channels);
+    float *dest_data;
+    int dest_samples;
+    if (file_sample_rate != sample_rate) {
+        // resample required
+        double sample_rate_ratio = (double)file_sample_rate / (double)sample_rate;
+        dest_samples = floor((double)num_samples / sample_rate_ratio);
+        dest_data = (float*)calloc((size_t)dest_samples * num_channels, sizeof(float));
+        float *src_data = (float*)malloc((size_t)num_samples * sizeof(float));
+        am_resample_pos step = am_resample_pos_from_samples(sample_rate_ratio);
+        for (int c = 0; c < num_channels; c++) {
+            for (int s = 0; s < num_samples; s++) {
+                src_data[s] = (float)tmp_data[s * src_channels + c] / (float)INT16_MAX;
+            }
+            am_resample_pos pos = 0;
+            am_resample(AM_RESAMPLE_HIGH, src_data, num_samples, false, &pos, step, 0,
+                dest_data + (size_t)c * dest_samples, dest_samples);
+        }
+        free(src_data);
+    } else {
+        // no resample required
+        dest_data = (float*)malloc((size_t)num_samples * num_channels * sizeof(float));
+        dest_samples = num_samples;
+        for (int c = 0; c < num_channels; c++) {
+            for (int s = 0; s < num_samples; s++) {
+                dest_data[c * num_samples + s] = (float)tmp_data[s * src_channels + c] / (float)INT16_MAX;
+            }
+        }
+    }
+    free(tmp_data);
+    task->samples = dest_data;
+    task->num_channels = num_channels;
+    task->num_samples = dest_samples;
+    task->file_sample_rate = file_sample_rate;
+}
+
+// Called on any thread. Doesn't touch the lua state.
+static void run_task(am_audio_load_job *job, am_audio_load_task *task) {
+    if (task->errmsg == NULL) {
+        char *cache_path = NULL;
+        if (job->cache_dir != NULL) {
+            cache_path = cache_filename(job, task);
+        }
+        if (cache_path == NULL || !read_cache(job, task, cache_path)) {
+            decode_task(task, job->sample_rate, job->max_channels);
+            if (cache_path != NULL && task->samples != NULL) {
+                write_cache(task, cache_path, job->sample_rate);
+            }
+        }
+        free(cache_path);
+    }
+    free(task->data);
+    task->data = NULL;
+}
+
+static am_audio_load_job *new_job(int num_tasks) {
+    am_audio_load_job *job = new am_audio_load_job();
+    job->num_tasks = num_tasks;
+    job->tasks = (am_audio_load_task*)calloc(num_tasks, sizeof(am_audio_load_task));
+    job->cache_dir = NULL;
+    job->sample_rate = am_conf_audio_sample_rate;
+    job->max_channels = am_conf_audio_channels;
+    job->num_done = 0;
+    job->refs = 1;
+    am_init_resampler(AM_RESAMPLE_HIGH);
+#if defined(AM_HAVE_AUDIO_CACHE)
+    if (am_conf_audio_cache) {
+        char *data_dir = am_get_data_path();
+        job->cache_dir = am_format("%saudio_cache%c", data_dir, AM_PATH_SEP);
+        free(data_dir);
+        am_make_dir(job->cache_dir);
+    }
+#endif
+    return job;
+}
+
+static void release_job(am_audio_load_job *job) {
+    if (job->refs.fetch_sub(1) != 1) return;
+    for (int i = 0; i < job->num_tasks; i++) {
+        am_audio_load_task *task = &job->tasks[i];
+        free(task->filename);
+        free(task->data);
+        free(task->samples);
+        free(task->errmsg);
+    }
+    free(job->tasks);
+    free(job->cache_dir);
+    delete job;
+}
+
+// Reads the file on the lua thread, since am_read_resource may read
+// from the data package, which isn't thread safe.
+static void init_task(am_audio_load_task *task, const char *filename) {
+    task->filename = am_format("%s", filename);
+    char *errmsg;
+    task->data = am_read_resource(filename, &task->len, &errmsg);
+    if (task->data == NULL) {
+        task->errmsg = errmsg;
+    }
+}
+
+// Pushes a new audio buffer that takes over the task's samples.
+static void push_task_audio_buffer(lua_State *L, am_audio_load_task *task) {
+    if (task->file_sample_rate != 0 && task->file_sample_rate != am_conf_audio_sample_rate) {
+        am_log0("WARNING: resampling buffer '%s' from %dHz to %dHz",
+            task->filename, task->file_sample_rate, am_conf_audio_sample_rate);
+    }
+    am_push_new_buffer_with_data(L, task->num_samples * task->num_channels * sizeof(float), task->samples);
+    task->samples = NULL;
+    am_buffer *buf = am_get_userdata(L, am_buffer, -1);
+    am_audio_buffer *audio_buffer = am_new_userdata(L, am_audio_buffer);
+    audio_buffer->num_channels = task->num_channels;
+    audio_buffer->sample_rate = am_conf_audio_sample_rate;
+    audio_buffer->buffer = buf;
+    audio_buffer->buffer_ref = audio_buffer->ref(L, -2);
+    lua_remove(L, -2); // remove buf
+}
+
+static int load_audio(lua_State *L) {
+    const char *filename = luaL_checkstring(L, 1);
+    am_audio_load_job *job = new_job(1);
+    am_audio_load_task *task = &job->tasks[0];
+    init_task(task, filename);
+    if (task->data == NULL) {
+        release_job(job);
+        lua_pushnil(L);
+        return 1;
+    }
+    run_task(job, task);
+    if (task->errmsg != NULL) {
+        lua_pushstring(L, task->errmsg);
+        release_job(job);
+        return lua_error(L);
+    }
+    push_task_audio_buffer(L, task);
+    release_job(job);
+    return 1;
+}
+
+//-------------------------------------------------------------------------
+// Async loading
+
+struct am_audio_loader : am_nonatomic_userdata {
+    am_audio_load_job *job;
+    bool collected;
+    int buffers_ref;
+    int errors_ref;
+};
+
+static bool job_done(am_audio_load_job *job) {
+    return job->num_done.load(std::memory_order_acquire) == job->num_tasks;
+}
+
+static void run_task_func(void *data, int i) {
+    am_audio_load_job *job = (am_audio_load_job*)data;
+    run_task(job, &job->tasks[i]);
+    job->num_done.fetch_add(1, std::memory_order_release);
+}
+
+#if defined(AM_HAVE_THREADS)
+
+struct am_audio_load_batch {
+    am_audio_load_job *job;
+    int start;
+};
+
+static void run_batch_task_func(void *data, int i) {
+    am_audio_load_batch *batch = (am_audio_load_batch*)data;
+    run_task_func(batch->job, batch->start + i);
+}
+
+static void run_job(am_audio_load_job *job) {
+    // Hand the tasks to the pool a batch at a time. If the pool's busy
+    // when a batch is started that batch runs on this thread, so
+    // keeping the batches small means the next one gets another chance
+    // to use the pool.
+    int batch_size = (am_get_worker_thread_count() + 1) * 2;
+    for (int start = 0; start < job->num_tasks; start += batch_size) {
+        am_audio_load_batch batch;
+        batch.job = job;
+        batch.start = start;
+        int n = am_min(batch_size, job->num_tasks - start);
+        am_parallel_for(n, run_batch_task_func, &batch);
+    }
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+    }
+    job->done_cond.notify_all();
+    release_job(job);
+}
+
+static void start_job(am_audio_load_job *job) {
+    job->refs++;
+    std::thread(run_job, job).detach();
+}
+
+static void wait_job(am_audio_load_job *job) {
+    std::unique_lock<std::mutex> lock(job->mutex);
+    while (!job_done(job)) {
+        job->done_cond.wait(lock);
+    }
+}
+
+#else
+
+static void start_job(am_audio_load_job *job) {
+    for (int i = 0; i < job->num_tasks; i++) {
+        run_task_func(job, i);
+    }
+}
+
+static void wait_job(am_audio_load_job *job) {
+}
+
+#endif
+
+static int load_audio_async(lua_State *L) {
+    am_check_nargs(L, 1);
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int n = lua_objlen(L, 1);
+    for (int i = 1; i <= n; i++) {
+        lua_rawgeti(L, 1, i);
+        if (lua_type(L, -1) != LUA_TSTRING) {
+            return luaL_error(L, "expecting a filename at index %d", i);
+        }
+        lua_pop(L, 1);
+    }
+    am_audio_loader *loader = am_new_userdata(L, am_audio_loader);
+    loader->collected = false;
+    loader->buffers_ref = LUA_NOREF;
+    loader->errors_ref = LUA_NOREF;
+    loader->job = new_job(n);
+    for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, 1, i + 1);
+        init_task(&loader->job->tasks[i], lua_tostring(L, -1));
+        lua_pop(L, 1);
+    }
+    start_job(loader->job);
+    return 1;
+}
+
+static int audio_loader_gc(lua_State *L) {
+    am_audio_loader *loader = (am_audio_loader*)lua_touserdata(L, 1);
+    if (loader->job != NULL) {
+        release_job(loader->job);
+        loader->job = NULL;
+    }
+    return 0;
+}
+
+// Turns the finished tasks into the buffers and errors tables.
+static void collect_results(lua_State *L, am_audio_loader *loader) {
+    if (loader->collected) return;
+    am_audio_load_job *job = loader->job;
+    lua_newtable(L);
+    int buffers = lua_gettop(L);
+    lua_newtable(L);
+    int errors = lua_gettop(L);
+    for (int i = 0; i < job->num_tasks; i++) {
+        am_audio_load_task *task = &job->tasks[i];
+        if (task->errmsg != NULL) {
+            lua_pushstring(L, task->errmsg);
+            lua_setfield(L, errors, task->filename);
+        } else {
+            push_task_audio_buffer(L, task);
+            lua_setfield(L, buffers, task->filename);
+        }
+    }
+    loader->errors_ref = loader->ref(L, errors);
+    loader->buffers_ref = loader->ref(L, buffers);
+    lua_pop(L, 2);
+    loader->collected = true;
+}
+
+static int audio_loader_block(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_audio_loader *loader = am_get_userdata(L, am_audio_loader, 1);
+    wait_job(loader->job);
+    return 0;
+}
+
+static void get_loader_done(lua_State *L, void *obj) {
+    am_audio_loader *loader = (am_audio_loader*)obj;
+    lua_pushboolean(L, job_done(loader->job));
+}
+
+static am_property loader_done_property = {get_loader_done, NULL};
+
+static void get_loader_progress(lua_State *L, void *obj) {
+    am_audio_loader *loader = (am_audio_loader*)obj;
+    am_audio_load_job *job = loader->job;
+    if (job->num_tasks == 0) {
+        lua_pushnumber(L, 1.0);
+    } else {
+        lua_pushnumber(L, (double)job->num_done.load() / (double)job->num_tasks);
+    }
+}
+
+static am_property loader_progress_property = {get_loader_progress, NULL};
+
+static void get_loader_buffers(lua_State *L, void *obj) {
+    am_audio_loader *loader = (am_audio_loader*)obj;
+    if (!job_done(loader->job)) {
+        lua_pushnil(L);
+        return;
+    }
+    collect_results(L, loader);
+    loader->pushref(L, loader->buffers_ref);
+}
+
+static am_property loader_buffers_property = {get_loader_buffers, NULL};
+
+static void get_loader_errors(lua_State *L, void *obj) {
+    am_audio_loader *loader = (am_audio_loader*)obj;
+    if (!job_done(loader->job)) {
+        lua_pushnil(L);
+        return;
+    }
+    collect_results(L, loader);
+    loader->pushref(L, loader->errors_ref);
+}
+
+static am_property loader_errors_property = {get_loader_errors, NULL};
+
+static void register_audio_loader_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_default_index_func, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, audio_loader_gc, 0);
+    lua_setfield(L, -2, "__gc");
+
+    lua_pushcclosure(L, audio_loader_block, 0);
+    lua_setfield(L, -2, "_block");
+
+    am_register_property(L, "done", &loader_done_property);
+    am_register_property(L, "progress", &loader_progress_property);
+    am_register_property(L, "buffers", &loader_buffers_property);
+    am_register_property(L, "errors", &loader_errors_property);
+
+    am_register_metatable(L, "audio_loader", MT_am_audio_loader, 0);
+}
+
+void am_open_audio_loader_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"load_audio", load_audio},
+        {"load_audio_async", load_audio_async},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_audio_loader_mt(L);
+}
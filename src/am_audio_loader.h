@@ -0,0 +1,14 @@
+// Loading of audio files into audio buffers (am.load_audio and
+// am.load_audio_async).
+//
+// Files are decoded to float samples at am_conf_audio_sample_rate.
+// am.load_audio_async decodes on background threads (see
+// am_thread_pool.h) and returns an audio_loader that can be polled
+// each frame or waited on.
+//
+// If audio_cache is set in conf.lua the decoded samples are saved in
+// the app's data directory, keyed by a hash of the file's contents and
+// the audio settings, so the file doesn't need to be decoded again
+// next time.
+
+void am_open_audio_loader_module(lua_State *L);
@@ -24,7 +24,6 @@ static int android_win_width = 480;
 static int android_win_height = 705;
 static char *android_data_dir = NULL;
 static char *android_lang = NULL;
-static pthread_mutex_t android_audio_mutex;
 
 static int win_dummy = 0;
 
@@ -88,9 +87,7 @@ static void android_draw() {
 static void android_update() {
     if (!android_running) return;
 
-    pthread_mutex_lock(&android_audio_mutex);
     am_sync_audio_graph(android_eng->L);
-    pthread_mutex_unlock(&android_audio_mutex);
 
     frame_time = am_get_current_time();
     
@@ -159,7 +156,6 @@ JNIEXPORT void JNICALL Java_xyz_amulet_AmuletActivity_jniStep(JNIEnv * env, jobj
 JNIEXPORT void JNICALL Java_xyz_amulet_AmuletActivity_jniInit(JNIEnv * env, jobject obj, jobject jassman, jstring jdatadir, jstring jlang)
 {
     jni_env = env;
-    pthread_mutex_init(&android_audio_mutex, NULL);
 
     asset_manager = AAssetManager_fromJava(env, jassman);
 
@@ -296,9 +292,7 @@ JNIEXPORT void JNICALL Java_xyz_amulet_AmuletActivity_jniFillAudioBuffer(JNIEnv
     memset(android_audio_buffer, 0, size * sizeof(float));
     if (!audio_is_paused) {
         am_audio_bus bus(2, size / 2, android_audio_buffer);
-        pthread_mutex_lock(&android_audio_mutex);
         am_fill_audio_bus(&bus);
-        pthread_mutex_unlock(&android_audio_mutex);
     }
     am_interleave_audio(buffer, android_audio_buffer, 2, size / 2, 0, size / 2);
     env->ReleaseFloatArrayElements(jbuffer, buffer, 0);
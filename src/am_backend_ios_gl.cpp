@@ -33,7 +33,6 @@ static bool ios_force_touch_recognised = false;
 static bool force_touch_is_available();
 static float *ios_audio_buffer = NULL;
 static int ios_audio_offset = 0;
-static NSLock *ios_audio_mutex = [[NSLock alloc] init];
 static bool ios_done_first_draw = false;
 #ifdef AM_GOOGLE_ADS
 #import <GoogleMobileAds/GADBannerView.h>
@@ -239,9 +238,7 @@ ios_audio_callback(void *inRefCon,
                 // Generate the data
                 memset(ios_audio_buffer, 0, num_samples * num_channels * sizeof(float));
                 am_audio_bus bus(num_channels, num_samples, ios_audio_buffer);
-                [ios_audio_mutex lock];
                 am_fill_audio_bus(&bus);
-                [ios_audio_mutex unlock];
                 ios_audio_offset = 0;
             }
 
@@ -406,9 +403,7 @@ static void ios_update() {
     frames_since_disable_animations++;
     if (!ios_running) return;
 
-    [ios_audio_mutex lock];
     am_sync_audio_graph(ios_eng->L);
-    [ios_audio_mutex unlock];
 
     frame_time = am_get_current_time();
     
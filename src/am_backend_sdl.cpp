@@ -53,13 +53,16 @@ static float *capture_buffer = NULL;
 static int capture_write_offset = 0;
 static int capture_read_offset = 0;
 static int capture_ring_size;
-static bool capture_initialized = false;
-static bool should_init_capture = false;
+static std::atomic<bool> capture_initialized(false);
+static std::atomic<bool> should_init_capture(false);
 static std::vector<win_info> windows;
 SDL_Window *main_window = NULL;
 static bool sdl_initialized = false;
 static bool restart_triggered = false;
 static lua_State *global_lua_state = NULL;
+#if defined(AM_HEADLESS_SUPPORTED)
+static am_native_window *headless_window = NULL;
+#endif
 
 #ifdef AM_USE_METAL
 extern NSWindow *am_metal_window;
@@ -80,6 +83,7 @@ static am_package *package = NULL;
 
 static void init_sdl();
 static void init_audio();
+static void render_audio_without_device();
 static void init_audio_capture();
 static void init_controllers();
 static bool handle_events(lua_State *L);
@@ -87,6 +91,7 @@ static am_key convert_key_scancode(SDL_Scancode key);
 static am_mouse_button convert_mouse_button(Uint8 button);
 static bool check_for_package();
 static win_info *win_from_id(Uint32 winid);
+static bool have_windows();
 
 static am_controller_button convert_controller_button(Uint8 button);
 static am_controller_axis convert_controller_axis(Uint8 axis);
@@ -111,6 +116,20 @@ am_native_window *am_create_native_window(
     if (!sdl_initialized) {
         init_sdl();
     }
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_conf_headless) {
+        headless_window = am_headless_create_window(width, height,
+            depth_buffer, stencil_buffer, msaa_samples);
+        if (headless_window == NULL) return NULL;
+#ifdef AM_NEED_GL_FUNC_PTRS
+        init_gl_func_ptrs();
+#endif
+        if (!am_gl_is_initialized()) {
+            am_init_gl();
+        }
+        return headless_window;
+    }
+#endif
 #ifdef AM_USE_METAL
     Uint32 flags = 0;
     if (main_window) {
@@ -227,6 +246,14 @@ void am_get_native_window_size(am_native_window *window, int *pw, int *ph, int *
     *sw = am_metal_window_swidth;
     *sh = am_metal_window_sheight;
 #else
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (window == headless_window) {
+        am_headless_get_window_size(pw, ph);
+        *sw = *pw;
+        *sh = *ph;
+        return;
+    }
+#endif
     for (unsigned int i = 0; i < windows.size(); i++) {
         if (windows[i].window == (SDL_Window*)window) {
             SDL_GetWindowSize(windows[i].window, sw, sh);
@@ -247,6 +274,12 @@ void am_get_native_window_safe_area_margin(am_native_window *window,
 }
 
 bool am_set_native_window_size_and_mode(am_native_window *window, int w, int h, am_window_mode mode) {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (window == headless_window) {
+        // there's no display, so fullscreen modes just keep the requested size
+        return am_headless_resize_window(w, h);
+    }
+#endif
     for (unsigned int i = 0; i < windows.size(); i++) {
         if (windows[i].window == (SDL_Window*)window) {
             SDL_Window *sdl_win = (SDL_Window*)window;
@@ -340,6 +373,14 @@ void am_set_native_window_show_cursor(am_native_window *window, bool show) {
 
 void am_destroy_native_window(am_native_window* window) {
     am_log_gl("// destroy window");
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (window == headless_window) {
+        // keep the context until exit, like the main window,
+        // so gl objects can still be deleted
+        headless_window = NULL;
+        return;
+    }
+#endif
     SDL_Window *sdl_win = (SDL_Window*)window;
     for (unsigned int i = 0; i < windows.size(); i++) {
         if (windows[i].window == sdl_win) {
@@ -351,6 +392,13 @@ void am_destroy_native_window(am_native_window* window) {
 }
 
 void am_native_window_bind_framebuffer(am_native_window* window) {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (window == headless_window) {
+        am_headless_make_current();
+        am_bind_framebuffer(0);
+        return;
+    }
+#endif
 #if !defined(AM_USE_METAL)
     SDL_GL_MakeCurrent((SDL_Window*)window, gl_context);
 #endif
@@ -359,6 +407,9 @@ void am_native_window_bind_framebuffer(am_native_window* window) {
 
 void am_native_window_swap_buffers(am_native_window* window) {
     am_gl_end_frame(true);
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (window == headless_window) return; // nothing to present
+#endif
 #if !defined(AM_USE_METAL)
     SDL_GL_SwapWindow((SDL_Window*)window);
 #endif
@@ -588,11 +639,11 @@ restart:
     lua_pushcclosure(L, am_require, 0);
     lua_pushstring(L, am_opt_main_module);
     if (!am_call(L, 1, 0)) {
-        if (windows.size() == 0) {
+        if (!have_windows()) {
             exit_status = EXIT_FAILURE;
         }
     }
-    if (windows.size() == 0) goto quit;
+    if (!have_windows()) goto quit;
 
     if (restart_triggered) {
         // re "attach" the controllers on the lua side after reloading the
@@ -613,9 +664,9 @@ restart:
     t_debt = 0.0;
     vsync = -2;
 
-    while (windows.size() > 0 && !restart_triggered) {
+    while (have_windows() && !restart_triggered) {
 #if !defined(AM_USE_METAL)
-        if (vsync != (am_conf_vsync ? 1 : 0)) {
+        if (!am_conf_headless && vsync != (am_conf_vsync ? 1 : 0)) {
             vsync = (am_conf_vsync ? 1 : 0);
             SDL_GL_SetSwapInterval(vsync);
         }
@@ -631,14 +682,27 @@ restart:
         [pool release];
         pool = [[NSAutoreleasePool alloc] init];
 #endif
-        SDL_LockAudioDevice(audio_device);
+        // doesn't need the audio device lock (see am_audio.h)
         am_sync_audio_graph(L);
+        if (audio_device == 0) {
+            render_audio_without_device();
+        }
         if (should_init_capture) {
+            SDL_LockAudioDevice(audio_device);
             init_audio_capture();
             should_init_capture = false;
             capture_initialized = true;
+            SDL_UnlockAudioDevice(audio_device);
         }
-        SDL_UnlockAudioDevice(audio_device);
+
+#if defined(AM_HEADLESS_SUPPORTED)
+        if (am_conf_headless) {
+            // There are no events and each frame advances by
+            // the same amount, however long it took to render.
+            am_execute_actions(L, am_headless_time_step());
+            continue;
+        }
+#endif
 
         if (!handle_events(L)) goto quit;
 
@@ -729,6 +793,13 @@ quit:
         SDL_DestroyWindow(main_window);
         main_window = NULL;
     }
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_headless_window_exists()) {
+        am_log_gl("// destroy headless window");
+        am_headless_destroy_window();
+        headless_window = NULL;
+    }
+#endif
     if (sdl_initialized) {
         am_log_gl("// quit sdl");
         SDL_Quit();
@@ -879,6 +950,14 @@ static void add_extra_controller_mappings() {
 }
 
 static void init_sdl() {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_conf_headless) {
+        // only the timer is needed, for am.current_time
+        SDL_Init(SDL_INIT_TIMER);
+        sdl_initialized = true;
+        return;
+    }
+#endif
     add_extra_controller_mappings();
     SDL_Init(SDL_INIT_TIMER | SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_JOYSTICK | SDL_INIT_HAPTIC | SDL_INIT_GAMECONTROLLER);
     init_audio();
@@ -892,10 +971,17 @@ static void init_sdl() {
 }
 
 #ifdef AM_NEED_GL_FUNC_PTRS
+static void *get_gl_proc_address(const char *name) {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_conf_headless) return am_headless_get_proc_address(name);
+#endif
+    return SDL_GL_GetProcAddress(name);
+}
+
 static void init_gl_func_ptrs() {
 #define AM_GLPROC(ret,func,params) \
     do { \
-        func##_ptr = (func##_ptr_t)SDL_GL_GetProcAddress(#func); \
+        func##_ptr = (func##_ptr_t)get_gl_proc_address(#func); \
         if ( ! func##_ptr ) { \
             am_abort("Couldn't load GL function %s: %s", #func, SDL_GetError()); \
         } \
@@ -931,6 +1017,21 @@ static void audio_callback(void *ud, Uint8 *stream, int len) {
     //if (capture_device != 0) SDL_UnlockAudioDevice(capture_device);
 }
 
+// Without an audio device (e.g. in headless mode) nothing else
+// applies the syncs, so the main loop renders one buffer per frame
+// and throws it away. This keeps the graph's state moving, so removed
+// nodes are released and the next sync isn't skipped.
+static void render_audio_without_device() {
+    int num_channels = am_conf_audio_channels;
+    int num_samples = am_conf_audio_buffer_size;
+    if (audio_buffer == NULL) {
+        audio_buffer = (float*)malloc(sizeof(float) * num_channels * num_samples);
+    }
+    memset(audio_buffer, 0, sizeof(float) * num_channels * num_samples);
+    am_audio_bus bus(num_channels, num_samples, audio_buffer);
+    am_fill_audio_bus(&bus);
+}
+
 static void capture_callback(void *ud, Uint8 *stream, int len) {
     SDL_LockAudioDevice(audio_device);
 
@@ -1499,6 +1600,13 @@ static win_info *win_from_id(Uint32 winid) {
     return NULL;
 }
 
+static bool have_windows() {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (headless_window != NULL) return true;
+#endif
+    return windows.size() > 0;
+}
+
 lua_State *am_get_global_lua_state() {
     return global_lua_state;
 }
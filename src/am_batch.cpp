@@ -0,0 +1,322 @@
+#include "amulet.h"
+
+am_draw_batch::am_draw_batch() {
+    position_name = -1;
+    state.program = NULL;
+    values = NULL;
+    components = NULL;
+    key_capacity = 0;
+    verts = NULL;
+    num_verts = 0;
+    vert_stride = 0;
+    verts_capacity = 0;
+    vbo = 0;
+}
+
+static am_program_param_client_type uniform_client_type(am_program_param_type t) {
+    switch (t) {
+        case AM_PROGRAM_PARAM_UNIFORM_1F: return AM_PROGRAM_PARAM_CLIENT_TYPE_1F;
+        case AM_PROGRAM_PARAM_UNIFORM_2F: return AM_PROGRAM_PARAM_CLIENT_TYPE_2F;
+        case AM_PROGRAM_PARAM_UNIFORM_3F: return AM_PROGRAM_PARAM_CLIENT_TYPE_3F;
+        case AM_PROGRAM_PARAM_UNIFORM_4F: return AM_PROGRAM_PARAM_CLIENT_TYPE_4F;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT2: return AM_PROGRAM_PARAM_CLIENT_TYPE_MAT2;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT3: return AM_PROGRAM_PARAM_CLIENT_TYPE_MAT3;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT4: return AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
+        case AM_PROGRAM_PARAM_UNIFORM_SAMPLER2D: return AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D;
+        default: return AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY;
+    }
+}
+
+static bool is_attribute(am_program_param_type t) {
+    switch (t) {
+        case AM_PROGRAM_PARAM_ATTRIBUTE_1F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_2F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_3F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_4F:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Check whether transforming the position attribute on the cpu
+// gives the same result as the shader would, assuming the shader
+// extends the position to a vec4 with z = 0 and w = 1.
+static bool can_pretransform(double *m, int components) {
+    switch (components) {
+        case 2:
+            return m[2] == 0.0 && m[6] == 0.0 && m[14] == 0.0
+                && m[3] == 0.0 && m[7] == 0.0 && m[15] == 1.0;
+        case 3:
+            return m[3] == 0.0 && m[7] == 0.0 && m[11] == 0.0 && m[15] == 1.0;
+        case 4:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool am_draw_batch::add(am_render_state *rstate, am_draw_mode mode, int first, int count,
+    am_buffer_view *indices_view, am_element_index_type type, int instances)
+{
+    am_program *prog = rstate->active_program;
+    if (mode != AM_DRAWMODE_TRIANGLES || instances != 1) {
+        flush(rstate);
+        return false;
+    }
+
+    // check the draw is batchable and work out the vertex layout
+    int stride = 0;
+    int max_size = INT_MAX;
+    int pos_param = -1;
+    double *mv = NULL;
+    bool pretransform = prog->batch_pretransform;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        am_program_param_value *val = &rstate->param_name_map[param->name].value;
+        if (is_attribute(param->type)) {
+            if (val->type != AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) goto fallback;
+            am_buffer_view *view = val->value.arr;
+            if (view->type != AM_VIEW_TYPE_F32 || view->buffer->data == NULL || view->divisor > 0) goto fallback;
+            if (view->size < max_size) max_size = view->size;
+            if (param->name == position_name) pos_param = i;
+            stride += view->components;
+        } else {
+            if (val->type != uniform_client_type(param->type)) goto fallback;
+            if (pretransform && param->name == rstate->modelview_param_index) {
+                if (param->type != AM_PROGRAM_PARAM_UNIFORM_MAT4) goto fallback;
+                mv = &val->value.m4[0];
+            }
+        }
+    }
+    if (max_size == INT_MAX) goto fallback;
+    if (mv != NULL) {
+        if (pos_param < 0) goto fallback;
+        am_program_param_value *pos = &rstate->param_name_map[prog->params[pos_param].name].value;
+        if (!can_pretransform(mv, pos->value.arr->components)) goto fallback;
+    }
+
+    // work out which vertices to draw
+    if (indices_view == NULL) {
+        if (count > max_size - first) count = max_size - first;
+    } else {
+        if (indices_view->buffer->data == NULL) goto fallback;
+        indices_view->update_max_elem_if_required();
+        if (indices_view->size > 0 && (int)indices_view->max_elem >= max_size) goto fallback;
+        if (count > indices_view->size - first) count = indices_view->size - first;
+    }
+    count -= count % 3;
+    if (count <= 0) return true;
+
+    // flush if the key doesn't match the current batch
+    if (num_verts > 0) {
+        bool same = vert_stride == stride && state.matches(rstate);
+        for (int i = 0; same && i < prog->num_params; i++) {
+            am_program_param *param = &prog->params[i];
+            am_program_param_value *val = &rstate->param_name_map[param->name].value;
+            if (is_attribute(param->type)) {
+                same = components[i] == val->value.arr->components;
+            } else if (!pretransform || param->name != rstate->modelview_param_index) {
+                same = values[i].equals(val);
+            }
+        }
+        if (!same) flush(rstate);
+    }
+
+    // capture the key if starting a new batch
+    if (num_verts == 0) {
+        if (prog->num_params > key_capacity) {
+            key_capacity = prog->num_params;
+            values = (am_program_param_value*)realloc(values, sizeof(am_program_param_value) * key_capacity);
+            components = (int*)realloc(components, sizeof(int) * key_capacity);
+        }
+        state.capture(rstate);
+        vert_stride = stride;
+        for (int i = 0; i < prog->num_params; i++) {
+            am_program_param *param = &prog->params[i];
+            am_program_param_value *val = &rstate->param_name_map[param->name].value;
+            values[i] = *val;
+            components[i] = is_attribute(param->type) ? val->value.arr->components : 0;
+        }
+    }
+
+    // append the vertices
+    {
+        if ((num_verts + count) * stride > verts_capacity) {
+            int new_capacity = verts_capacity == 0 ? 1024 : verts_capacity;
+            while ((num_verts + count) * stride > new_capacity) new_capacity *= 2;
+            verts = (float*)realloc(verts, sizeof(float) * new_capacity);
+            verts_capacity = new_capacity;
+        }
+        glm::mat4 fmv = mv == NULL ? glm::mat4(1.0f) : glm::mat4(glm::make_mat4(mv));
+        uint8_t *idata = indices_view == NULL ? NULL : indices_view->buffer->data + indices_view->offset;
+        am_buffer_view **views = (am_buffer_view**)alloca(sizeof(am_buffer_view*) * prog->num_params);
+        for (int i = 0; i < prog->num_params; i++) {
+            views[i] = components[i] == 0 ? NULL : rstate->param_name_map[prog->params[i].name].value.value.arr;
+        }
+        float *dst = verts + num_verts * stride;
+        for (int v = 0; v < count; v++) {
+            int index;
+            if (idata == NULL) {
+                index = first + v;
+            } else if (type == AM_ELEMENT_TYPE_USHORT) {
+                index = ((uint16_t*)(idata + (first + v) * indices_view->stride))[0];
+            } else {
+                index = (int)((uint32_t*)(idata + (first + v) * indices_view->stride))[0];
+            }
+            for (int i = 0; i < prog->num_params; i++) {
+                int n = components[i];
+                if (n == 0) continue;
+                am_buffer_view *view = views[i];
+                float *src = (float*)(view->buffer->data + view->offset + index * view->stride);
+                if (i == pos_param && mv != NULL) {
+                    glm::vec4 p(0.0f, 0.0f, 0.0f, 1.0f);
+                    for (int c = 0; c < n; c++) p[c] = src[c];
+                    p = fmv * p;
+                    for (int c = 0; c < n; c++) dst[c] = p[c];
+                } else {
+                    memcpy(dst, src, sizeof(float) * n);
+                }
+                dst += n;
+            }
+        }
+        num_verts += count;
+    }
+    return true;
+
+fallback:
+    flush(rstate);
+    return false;
+}
+
+void am_draw_batch::flush(am_render_state *rstate) {
+    if (num_verts == 0) return;
+    am_program *program = state.program;
+    int nparams = program->num_params;
+
+    // install the batch's state
+    am_draw_state old_state;
+    old_state.capture(rstate);
+    am_program_param_value *old_vals = (am_program_param_value*)alloca(sizeof(am_program_param_value) * nparams);
+    for (int i = 0; i < nparams; i++) {
+        am_program_param_value *val = &rstate->param_name_map[program->params[i].name].value;
+        old_vals[i] = *val;
+        *val = values[i];
+        if (program->batch_pretransform && program->params[i].name == rstate->modelview_param_index) {
+            val->set_mat4(glm::dmat4(1.0));
+        }
+    }
+    state.install(rstate);
+
+    rstate->active_viewport_state.bind(rstate, false);
+    rstate->active_scissor_test_state.bind(rstate, false);
+    rstate->active_color_mask_state.bind(rstate, false);
+    rstate->active_depth_test_state.bind(rstate, false);
+    rstate->active_stencil_test_state.bind(rstate, false);
+    rstate->active_cull_face_state.bind(rstate, false);
+    rstate->active_blend_state.bind(rstate, false);
+    rstate->bind_active_program();
+
+    // orphan and refill the vbo each flush, so we don't stall on
+    // draws from the previous flush
+    if (vbo == 0) {
+        vbo = am_create_buffer_object();
+    }
+    am_bind_buffer(AM_ARRAY_BUFFER, vbo);
+    am_set_buffer_data(AM_ARRAY_BUFFER, num_verts * vert_stride * sizeof(float), verts, AM_BUFFER_USAGE_STREAM_DRAW);
+
+    int offset = 0;
+    for (int i = 0; i < nparams; i++) {
+        am_program_param *param = &program->params[i];
+        if (components[i] > 0) {
+            am_set_attribute_pointer(param->location, components[i], AM_ATTRIBUTE_CLIENT_TYPE_FLOAT,
+                false, vert_stride * sizeof(float), offset * sizeof(float));
+            if (am_instancing_supported) {
+                // the location may still be per-instance from an earlier draw
+                rstate->set_attribute_divisor(param->location, 0);
+            }
+            offset += components[i];
+        } else {
+            param->bind(rstate);
+        }
+    }
+    // the program's attributes no longer match what it last bound
+    rstate->attributes_program = NULL;
+    rstate->enable_vaas(program->num_vaas);
+    if (rstate->validate_active_program(AM_DRAWMODE_TRIANGLES)) {
+        am_draw_arrays(AM_DRAWMODE_TRIANGLES, 0, num_verts);
+    }
+
+    // restore the state
+    for (int i = 0; i < nparams; i++) {
+        rstate->param_name_map[program->params[i].name].value = old_vals[i];
+    }
+    old_state.install(rstate);
+
+    num_verts = 0;
+}
+
+bool am_begin_batch(am_render_state *rstate, am_param_name_id position_name) {
+    if (rstate->active_batch != NULL) {
+        // already inside a batch
+        return false;
+    }
+    if (rstate->recording != NULL) {
+        rstate->recording->record_batch(true, position_name);
+    }
+    if (rstate->draw_batch == NULL) {
+        rstate->draw_batch = new am_draw_batch();
+    }
+    am_draw_batch *batch = rstate->draw_batch;
+    batch->position_name = position_name;
+    rstate->active_batch = batch;
+    return true;
+}
+
+void am_end_batch(am_render_state *rstate) {
+    if (rstate->recording != NULL) {
+        rstate->recording->record_batch(false, -1);
+    }
+    am_draw_batch *batch = rstate->active_batch;
+    rstate->active_batch = NULL;
+    batch->flush(rstate);
+}
+
+void am_sprite_batch_node::render(am_render_state *rstate) {
+    bool began = am_begin_batch(rstate, position_name);
+    render_children(rstate);
+    if (began) am_end_batch(rstate);
+}
+
+static int create_sprite_batch_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    am_sprite_batch_node *node = am_new_userdata(L, am_sprite_batch_node);
+    node->tags.push_back(L, AM_TAG_SPRITE_BATCH);
+    if (nargs > 0) {
+        node->position_name = am_lookup_param_name(L, 1);
+    } else {
+        lua_pushstring(L, "vert");
+        node->position_name = am_lookup_param_name(L, -1);
+        lua_pop(L, 1);
+    }
+    return 1;
+}
+
+static void register_sprite_batch_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+
+    am_register_metatable(L, "sprite_batch", MT_am_sprite_batch_node, MT_am_scene_node);
+}
+
+void am_open_batch_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"sprite_batch", create_sprite_batch_node},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_sprite_batch_node_mt(L);
+}
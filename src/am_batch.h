@@ -0,0 +1,44 @@
+// Coalesces consecutive triangle draws that share the same program,
+// uniforms, textures and render state into a single draw from a
+// dynamic vbo. For the built-in shaders vertex positions are
+// transformed by the modelview matrix on the cpu, so draws with
+// different transforms can still share a batch. Other programs may
+// use MV for more than the position, so for those MV is part of the
+// batch key like any other uniform.
+struct am_draw_batch {
+    am_param_name_id        position_name;
+
+    // batch key (captured from the first draw in the batch)
+    am_draw_state           state;
+    am_program_param_value  *values;     // one per program param
+    int                     *components; // one per program param (0 for uniforms)
+    int                     key_capacity;
+
+    // pending vertices
+    float                   *verts;
+    int                     num_verts;
+    int                     vert_stride; // in floats
+    int                     verts_capacity; // in floats
+
+    am_buffer_id            vbo;
+
+    am_draw_batch();
+
+    // Returns false if the draw can't be batched, in which case
+    // any pending draws will have been flushed and the caller should
+    // draw as normal.
+    bool add(am_render_state *rstate, am_draw_mode mode, int first, int count,
+        am_buffer_view *indices_view, am_element_index_type type, int instances);
+    void flush(am_render_state *rstate);
+};
+
+struct am_sprite_batch_node : am_scene_node {
+    am_param_name_id position_name;
+    virtual void render(am_render_state *rstate);
+};
+
+// Start batching draws. Returns false if a batch is already active.
+bool am_begin_batch(am_render_state *rstate, am_param_name_id position_name);
+void am_end_batch(am_render_state *rstate);
+
+void am_open_batch_module(lua_State *L);
@@ -2,6 +2,8 @@
 
 static size_t total_buffer_malloc_bytes = 0;
 
+uint32_t am_bounds_data_generation = 1;
+
 am_buffer_data_allocator::am_buffer_data_allocator() {
     pooled_buffers.owner = this;
     pool_scratch = NULL;
@@ -100,10 +102,12 @@ am_buffer::am_buffer() {
     texture2d = NULL;
     dirty_start = INT_MAX;
     dirty_end = 0;
+    num_dirty_ranges = 0;
     version = 1;
     alloc_method = AM_BUF_ALLOC_LUA;
     origin = "anonymous buffer";
     usage = AM_BUFFER_USAGE_STATIC_DRAW;
+    used_for_bounds = false;
 }
 
 am_buffer *am_push_new_buffer_and_init(lua_State *L, int size) {
@@ -180,6 +184,7 @@ static int free_buffer(lua_State *L) {
 
 void am_buffer::update_if_dirty() {
     if (data != NULL && dirty_start < dirty_end) {
+        AM_PROFILE_ZONE("buffer upload");
         if (arraybuf != NULL) {
             arraybuf->update_dirty(this);
         } 
@@ -191,10 +196,56 @@ void am_buffer::update_if_dirty() {
         }
         dirty_start = INT_MAX;
         dirty_end = 0;
+        num_dirty_ranges = 0;
         version++;
     }
 }
 
+void am_buffer::add_dirty_range(int byte_start, int byte_end) {
+    int gap = am_conf_buffer_dirty_range_gap;
+    am_dirty_range *ranges = dirty_ranges;
+    int n = num_dirty_ranges;
+    // find the first range that ends close enough to byte_start
+    // to be merged with it, or that comes after it
+    int i = 0;
+    while (i < n && ranges[i].end + gap < byte_start) i++;
+    if (i < n && ranges[i].start <= byte_end + gap) {
+        // merge with range i and any following ranges it now reaches
+        if (byte_start < ranges[i].start) ranges[i].start = byte_start;
+        if (byte_end > ranges[i].end) ranges[i].end = byte_end;
+        int j = i + 1;
+        while (j < n && ranges[j].start <= ranges[i].end + gap) {
+            if (ranges[j].end > ranges[i].end) ranges[i].end = ranges[j].end;
+            j++;
+        }
+        int removed = j - (i + 1);
+        if (removed > 0) {
+            memmove(&ranges[i + 1], &ranges[j], sizeof(am_dirty_range) * (n - j));
+            n -= removed;
+        }
+    } else {
+        // insert a new range at i
+        memmove(&ranges[i + 1], &ranges[i], sizeof(am_dirty_range) * (n - i));
+        ranges[i].start = byte_start;
+        ranges[i].end = byte_end;
+        n++;
+        if (n > AM_MAX_DIRTY_RANGES) {
+            // too many ranges, so merge the two closest ones
+            int closest = 0;
+            for (int k = 1; k < n - 1; k++) {
+                if (ranges[k + 1].start - ranges[k].end < ranges[closest + 1].start - ranges[closest].end) {
+                    closest = k;
+                }
+            }
+            ranges[closest].end = ranges[closest + 1].end;
+            memmove(&ranges[closest + 1], &ranges[closest + 2],
+                sizeof(am_dirty_range) * (n - closest - 2));
+            n--;
+        }
+    }
+    num_dirty_ranges = n;
+}
+
 void am_buffer::create_arraybuf(lua_State *L) {
     assert(arraybuf == NULL);
     assert(L != NULL);
@@ -7,18 +7,37 @@ enum am_buffer_alloc_method {
 struct am_texture2d;
 struct am_vbo;
 
+// Maximum number of separate dirty ranges tracked per buffer. When there
+// would be more, the two closest ranges are merged.
+#define AM_MAX_DIRTY_RANGES 8
+
+struct am_dirty_range {
+    int start;
+    int end;
+};
+
+// Incremented whenever a buffer that has been used to compute
+// bounds for culling is modified (see am_culling.h).
+extern uint32_t am_bounds_data_generation;
+
 struct am_buffer : am_nonatomic_userdata {
     int                     size;  // in bytes
     uint8_t                 *data;
     am_vbo                  *arraybuf;
     am_vbo                  *elembuf;
     am_texture2d            *texture2d;
+    // dirty_start and dirty_end cover all the changes since the last
+    // update. dirty_ranges are the (sorted, disjoint) parts that
+    // actually changed.
     int                     dirty_start;
     int                     dirty_end;
+    am_dirty_range          dirty_ranges[AM_MAX_DIRTY_RANGES + 1];
+    int                     num_dirty_ranges;
     uint32_t                version;
     am_buffer_alloc_method  alloc_method;
     const char              *origin;
     am_buffer_usage         usage;
+    bool                    used_for_bounds;
 
     am_buffer();
 
@@ -26,6 +45,7 @@ struct am_buffer : am_nonatomic_userdata {
     void create_arraybuf(lua_State *L);
     void create_elembuf(lua_State *L);
     void update_if_dirty();
+    void add_dirty_range(int byte_start, int byte_end);
 
     void mark_dirty(int byte_start, int byte_end) {
         assert(byte_start >= 0);
@@ -36,6 +56,17 @@ struct am_buffer : am_nonatomic_userdata {
         if (byte_end > dirty_end) {
             dirty_end = byte_end;
         }
+        if (num_dirty_ranges == 1 && byte_start >= dirty_ranges[0].start
+            && byte_end <= dirty_ranges[0].end + am_conf_buffer_dirty_range_gap)
+        {
+            // common case: extending or re-writing a single range
+            if (byte_end > dirty_ranges[0].end) dirty_ranges[0].end = byte_end;
+        } else {
+            add_dirty_range(byte_start, byte_end);
+        }
+        if (used_for_bounds) {
+            am_bounds_data_generation++;
+        }
     }
 };
 
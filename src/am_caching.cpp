@@ -0,0 +1,344 @@
+#include "amulet.h"
+
+am_command_list::am_command_list() {
+    commands = NULL;
+    num_commands = 0;
+    commands_capacity = 0;
+    params = NULL;
+    num_params = 0;
+    params_capacity = 0;
+}
+
+void am_command_list::clear() {
+    num_commands = 0;
+    num_params = 0;
+}
+
+void am_command_list::free_storage() {
+    if (commands != NULL) free(commands);
+    if (params != NULL) free(params);
+    commands = NULL;
+    params = NULL;
+    commands_capacity = 0;
+    params_capacity = 0;
+    clear();
+}
+
+static am_render_command *new_command(am_command_list *list) {
+    if (list->num_commands >= list->commands_capacity) {
+        list->commands_capacity = list->commands_capacity == 0 ? 16 : list->commands_capacity * 2;
+        list->commands = (am_render_command*)realloc(list->commands,
+            sizeof(am_render_command) * list->commands_capacity);
+    }
+    return &list->commands[list->num_commands++];
+}
+
+void am_command_list::record_draw(am_render_state *rstate, am_draw_mode mode, int first, int count,
+    am_buffer_view *indices_view, am_element_index_type type, int instances)
+{
+    am_program *prog = rstate->active_program;
+    if (num_params + prog->num_params > params_capacity) {
+        while (num_params + prog->num_params > params_capacity) {
+            params_capacity = params_capacity == 0 ? 32 : params_capacity * 2;
+        }
+        params = (am_cached_param*)realloc(params, sizeof(am_cached_param) * params_capacity);
+    }
+    am_render_command *cmd = new_command(this);
+    cmd->type = AM_RENDER_COMMAND_DRAW;
+    cmd->state.capture(rstate);
+    cmd->params_start = num_params;
+    cmd->mode = mode;
+    cmd->first = first;
+    cmd->count = count;
+    cmd->instances = instances;
+    cmd->indices_view = indices_view;
+    cmd->elem_type = type;
+    cmd->position_name = -1;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_param_name_id name = prog->params[i].name;
+        params[num_params].name = name;
+        params[num_params].value = rstate->param_name_map[name].value;
+        num_params++;
+    }
+}
+
+void am_command_list::record_batch(bool begin, am_param_name_id position_name) {
+    am_render_command *cmd = new_command(this);
+    cmd->type = begin ? AM_RENDER_COMMAND_BEGIN_BATCH : AM_RENDER_COMMAND_END_BATCH;
+    cmd->position_name = position_name;
+}
+
+void am_command_list::replay(am_render_state *rstate) {
+    am_draw_state old_state;
+    old_state.capture(rstate);
+    // the draws were already filtered by pass when they were recorded
+    uint32_t old_pass_mask = rstate->pass_mask;
+    rstate->pass_mask = rstate->pass;
+    bool began_batch = false;
+    for (int c = 0; c < num_commands; c++) {
+        am_render_command *cmd = &commands[c];
+        switch (cmd->type) {
+            case AM_RENDER_COMMAND_DRAW: {
+                cmd->state.install(rstate);
+                am_cached_param *p = &params[cmd->params_start];
+                for (int i = 0; i < cmd->state.program->num_params; i++) {
+                    rstate->param_name_map[p[i].name].value = p[i].value;
+                }
+                if (cmd->indices_view == NULL) {
+                    rstate->draw_arrays(cmd->mode, cmd->first, cmd->count, cmd->instances);
+                } else {
+                    rstate->draw_elements(cmd->mode, cmd->first, cmd->count,
+                        cmd->indices_view, cmd->elem_type, cmd->instances);
+                }
+                break;
+            }
+            case AM_RENDER_COMMAND_BEGIN_BATCH:
+                began_batch = am_begin_batch(rstate, cmd->position_name);
+                break;
+            case AM_RENDER_COMMAND_END_BATCH:
+                if (began_batch) {
+                    am_end_batch(rstate);
+                    began_batch = false;
+                }
+                break;
+        }
+    }
+    old_state.install(rstate);
+    rstate->pass_mask = old_pass_mask;
+}
+
+am_cached_group_node::am_cached_group_node() {
+    valid = false;
+    recording = false;
+    recorded_gen = 0;
+    entry_params = NULL;
+    entry_params_capacity = 0;
+    entry_texture_unit = 0;
+    entry_pass = 0;
+    entry_pass_mask = 0;
+    entry_next_pass = 0;
+    exit_next_pass = 0;
+    objects = NULL;
+    num_objects = 0;
+    objects_capacity = 0;
+}
+
+static void ref_object(lua_State *L, am_cached_group_node *node, am_nonatomic_userdata *obj) {
+    if (obj == NULL) return;
+    for (int i = 0; i < node->num_objects; i++) {
+        if (node->objects[i].obj == obj) return;
+    }
+    if (node->num_objects >= node->objects_capacity) {
+        node->objects_capacity = node->objects_capacity == 0 ? 8 : node->objects_capacity * 2;
+        node->objects = (am_cached_object*)realloc(node->objects,
+            sizeof(am_cached_object) * node->objects_capacity);
+    }
+    am_cached_object *cobj = &node->objects[node->num_objects++];
+    cobj->obj = obj;
+    obj->push(L);
+    cobj->ref = node->ref(L, -1);
+    lua_pop(L, 1);
+}
+
+void am_cached_group_node::ref_objects(lua_State *L) {
+    for (int c = 0; c < list.num_commands; c++) {
+        am_render_command *cmd = &list.commands[c];
+        if (cmd->type != AM_RENDER_COMMAND_DRAW) continue;
+        ref_object(L, this, cmd->state.program);
+        ref_object(L, this, cmd->indices_view);
+        am_cached_param *p = &list.params[cmd->params_start];
+        for (int i = 0; i < cmd->state.program->num_params; i++) {
+            am_program_param_value *value = &p[i].value;
+            if (value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) {
+                ref_object(L, this, value->value.arr);
+            } else if (value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D) {
+                ref_object(L, this, value->value.sampler2d.texture);
+            }
+        }
+    }
+}
+
+void am_cached_group_node::unref_objects(lua_State *L) {
+    for (int i = 0; i < num_objects; i++) {
+        unref(L, objects[i].ref);
+    }
+    num_objects = 0;
+}
+
+void am_cached_group_node::capture_entry(am_render_state *rstate) {
+    entry_state.capture(rstate);
+    if (entry_params_capacity != rstate->param_name_map_capacity) {
+        entry_params_capacity = rstate->param_name_map_capacity;
+        entry_params = (am_program_param_name_slot*)realloc(entry_params,
+            sizeof(am_program_param_name_slot) * entry_params_capacity);
+    }
+    memcpy(entry_params, rstate->param_name_map,
+        sizeof(am_program_param_name_slot) * entry_params_capacity);
+    entry_texture_unit = rstate->next_free_texture_unit;
+    entry_pass = rstate->pass;
+    entry_pass_mask = rstate->pass_mask;
+    entry_next_pass = rstate->next_pass;
+}
+
+bool am_cached_group_node::entry_matches(am_render_state *rstate) {
+    if (!entry_state.matches(rstate)) return false;
+    if (entry_texture_unit != rstate->next_free_texture_unit) return false;
+    if (entry_pass != rstate->pass || entry_pass_mask != rstate->pass_mask) return false;
+    if (entry_params_capacity != rstate->param_name_map_capacity) return false;
+    for (int i = 0; i < entry_params_capacity; i++) {
+        if (!entry_params[i].value.equals(&rstate->param_name_map[i].value)) return false;
+    }
+    return true;
+}
+
+void am_cached_group_node::render(am_render_state *rstate) {
+    // replayed draws don't go through auto_cull
+    am_bounds_unbounded(rstate);
+    if (recording) {
+        // cycle back to this node while recording
+        render_children(rstate);
+        return;
+    }
+    if (valid && !am_subtree_changed_since(this, recorded_gen) && entry_matches(rstate)) {
+        list.replay(rstate);
+        memcpy(rstate->param_name_map, entry_params,
+            sizeof(am_program_param_name_slot) * entry_params_capacity);
+        if (exit_next_pass != entry_next_pass && exit_next_pass > rstate->pass &&
+            (rstate->next_pass == rstate->pass || exit_next_pass < rstate->next_pass))
+        {
+            rstate->next_pass = exit_next_pass;
+        }
+        return;
+    }
+    if (rstate->recording != NULL) {
+        // an ancestor cached group is recording, so our draws will
+        // end up in its list.
+        render_children(rstate);
+        return;
+    }
+    if (rstate->L == NULL) {
+        // objects in the list couldn't be kept alive
+        render_children(rstate);
+        return;
+    }
+    capture_entry(rstate);
+    recorded_gen = am_begin_scene_generation();
+    unref_objects(rstate->L);
+    list.clear();
+    recording = true;
+    rstate->recording = &list;
+    // the recording needs to include draws that are currently culled
+    am_cull_context *old_cull = rstate->cull;
+    am_bounds_frame *old_bounds = rstate->bounds;
+    rstate->cull = NULL;
+    rstate->bounds = NULL;
+    render_children(rstate);
+    rstate->cull = old_cull;
+    rstate->bounds = old_bounds;
+    rstate->recording = NULL;
+    recording = false;
+    exit_next_pass = rstate->next_pass;
+    ref_objects(rstate->L);
+    valid = true;
+}
+
+static int create_cached_group_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    am_cached_group_node *node = am_new_userdata(L, am_cached_group_node);
+    node->tags.push_back(L, AM_TAG_CACHED_GROUP);
+    if (nargs >= 1 && lua_istable(L, 1)) {
+        int i = 1;
+        do {
+            lua_rawgeti(L, 1, i);
+            if (lua_isnil(L, -1)) {
+                lua_pop(L, 1); // nil
+                break;
+            }
+            am_scene_node *child = am_get_userdata(L, am_scene_node, -1);
+            am_node_child child_slot;
+            child_slot.child = child;
+            child_slot.ref = node->ref(L, -1); // ref from node to child
+            node->children.push_back(L, child_slot);
+            am_node_child_added(node, child);
+            lua_pop(L, 1); // child
+            i++;
+        } while (true);
+    } else {
+        for (int i = 0; i < nargs; i++) {
+            am_scene_node *child = am_get_userdata(L, am_scene_node, i+1);
+            am_node_child child_slot;
+            child_slot.child = child;
+            child_slot.ref = node->ref(L, i+1); // ref from node to child
+            node->children.push_back(L, child_slot);
+            am_node_child_added(node, child);
+        }
+    }
+    return 1;
+}
+
+int am_compile_scene_node(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_get_userdata(L, am_scene_node, 1);
+    lua_settop(L, 1);
+    return create_cached_group_node(L);
+}
+
+static int invalidate(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_cached_group_node *node = am_get_userdata(L, am_cached_group_node, 1);
+    node->valid = false;
+    node->unref_objects(L);
+    lua_pushvalue(L, 1); // for chaining
+    return 1;
+}
+
+static void get_num_commands(lua_State *L, void *obj) {
+    am_cached_group_node *node = (am_cached_group_node*)obj;
+    if (node->valid) {
+        lua_pushinteger(L, node->list.num_commands);
+    } else {
+        lua_pushnil(L);
+    }
+}
+
+static am_property num_commands_property = {get_num_commands, NULL};
+
+static int gc_cached_group_node(lua_State *L) {
+    am_cached_group_node *node = (am_cached_group_node*)lua_touserdata(L, 1);
+    node->list.free_storage();
+    if (node->objects != NULL) {
+        free(node->objects);
+        node->objects = NULL;
+    }
+    if (node->entry_params != NULL) {
+        free(node->entry_params);
+        node->entry_params = NULL;
+    }
+    return am_scene_node_gc(L);
+}
+
+static void register_cached_group_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcclosure(L, gc_cached_group_node, 0);
+    lua_setfield(L, -2, "__gc");
+
+    lua_pushcclosure(L, invalidate, 0);
+    lua_setfield(L, -2, "invalidate");
+
+    am_register_property(L, "num_commands", &num_commands_property);
+
+    am_register_metatable(L, "cached_group", MT_am_cached_group_node, MT_am_scene_node);
+}
+
+void am_open_caching_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"cached_group", create_cached_group_node},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_cached_group_node_mt(L);
+}
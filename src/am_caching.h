@@ -0,0 +1,83 @@
+enum am_render_command_type {
+    AM_RENDER_COMMAND_DRAW,
+    AM_RENDER_COMMAND_BEGIN_BATCH,
+    AM_RENDER_COMMAND_END_BATCH,
+};
+
+struct am_cached_param {
+    am_param_name_id        name;
+    am_program_param_value  value;
+};
+
+struct am_render_command {
+    am_render_command_type  type;
+    am_draw_state           state;
+    int                     params_start; // index into am_command_list::params
+    am_draw_mode            mode;
+    int                     first;
+    int                     count;
+    int                     instances;
+    am_buffer_view          *indices_view;
+    am_element_index_type   elem_type;
+    am_param_name_id        position_name; // for AM_RENDER_COMMAND_BEGIN_BATCH
+};
+
+// A flattened list of the draws (and the state they were drawn with)
+// produced by rendering a subtree.
+struct am_command_list {
+    am_render_command       *commands;
+    int                     num_commands;
+    int                     commands_capacity;
+    am_cached_param         *params;
+    int                     num_params;
+    int                     params_capacity;
+
+    am_command_list();
+    void clear();
+    void free_storage();
+    void record_draw(am_render_state *rstate, am_draw_mode mode, int first, int count,
+        am_buffer_view *indices_view, am_element_index_type type, int instances);
+    void record_batch(bool begin, am_param_name_id position_name);
+    void replay(am_render_state *rstate);
+};
+
+// A program, view or texture used by a recorded list. The cached group
+// holds a ref to it, so it isn't collected while the list can be
+// replayed.
+struct am_cached_object {
+    am_nonatomic_userdata   *obj;
+    int                     ref;
+};
+
+struct am_cached_group_node : am_scene_node {
+    am_command_list         list;
+    bool                    valid;
+    bool                    recording;
+    uint32_t                recorded_gen;
+
+    // state on entry when the list was recorded
+    am_draw_state           entry_state;
+    am_program_param_name_slot *entry_params;
+    int                     entry_params_capacity;
+    int                     entry_texture_unit;
+    uint32_t                entry_pass;
+    uint32_t                entry_pass_mask;
+    uint32_t                entry_next_pass;
+    uint32_t                exit_next_pass;
+
+    am_cached_object        *objects;
+    int                     num_objects;
+    int                     objects_capacity;
+
+    am_cached_group_node();
+    virtual void render(am_render_state *rstate);
+    bool entry_matches(am_render_state *rstate);
+    void capture_entry(am_render_state *rstate);
+    void ref_objects(lua_State *L);
+    void unref_objects(lua_State *L);
+};
+
+// node:compile() - wraps the node in a cached_group
+int am_compile_scene_node(lua_State *L);
+
+void am_open_caching_module(lua_State *L);
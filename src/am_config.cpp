@@ -48,6 +48,7 @@ const char *am_conf_default_modelview_matrix_name = "MV";
 const char *am_conf_default_projection_matrix_name = "P";
 
 bool am_conf_d3dangle = false;
+bool am_conf_headless = false;
 
 double am_conf_fixed_delta_time = -1.0; //1.0 / 60.0;
 double am_conf_delta_time_step = -1.0; //1.0/240.0;
@@ -62,6 +63,12 @@ int am_conf_audio_channels = 2;
 int am_conf_audio_sample_rate = 44100;
 int am_conf_audio_interpolate_samples = 128; // must be less than am_conf_audio_buffer_size
 bool am_conf_audio_mute = false;
+// seconds of audio streams decoded ahead of playback
+double am_conf_audio_stream_latency = 0.5;
+// save decoded audio files in the data dir (see am_audio_loader.h)
+bool am_conf_audio_cache = false;
+// used when playing tracks and voices at other speeds or sample rates
+am_resample_quality am_conf_audio_resample_quality = AM_RESAMPLE_MEDIUM;
 
 // This determines whether non-pooled buffers are allocated
 // using lua's allocator or malloc. If a buffer's data area is smaller
@@ -72,6 +79,15 @@ bool am_conf_audio_mute = false;
 // it raises the Lua GC's high water mark too much.
 int am_conf_buffer_malloc_threshold = 512;
 
+// Changed regions of a buffer that are at most this many bytes apart
+// are uploaded together, because a few extra bytes are cheaper than an
+// extra upload call.
+int am_conf_buffer_dirty_range_gap = 1024;
+
+// Number of threads (including the main thread) used for mathv
+// functions on large views. 0 means one per cpu.
+int am_conf_mathv_threads = 0;
+
 // Note: enabling either of the following two options causes substantial
 // slowdowns on the html backend in some browsers
 #ifdef AM_DEBUG
@@ -111,6 +127,22 @@ static void read_bool_setting(lua_State *L, const char *name, bool *value) {
     lua_pop(L, 1);
 }
 
+static void read_int_setting(lua_State *L, const char *name, int *value) {
+    lua_getglobal(L, name);
+    if (lua_isnumber(L, -1)) {
+        *value = (int)lua_tointeger(L, -1);
+    }
+    lua_pop(L, 1);
+}
+
+static void read_number_setting(lua_State *L, const char *name, double *value) {
+    lua_getglobal(L, name);
+    if (lua_isnumber(L, -1)) {
+        *value = lua_tonumber(L, -1);
+    }
+    lua_pop(L, 1);
+}
+
 static void free_if_not_null(void **ptr) {
     if (*ptr != NULL) {
         free(*ptr);
@@ -238,10 +270,31 @@ bool am_load_config() {
     //    am_conf_android_needs_internet_permission = true;
     //}
 
+    read_int_setting(eng->L, "mathv_threads", &am_conf_mathv_threads);
+    read_int_setting(eng->L, "buffer_dirty_range_gap", &am_conf_buffer_dirty_range_gap);
+    if (am_conf_buffer_dirty_range_gap < 0) am_conf_buffer_dirty_range_gap = 0;
+
+    read_number_setting(eng->L, "audio_stream_latency", &am_conf_audio_stream_latency);
+    read_bool_setting(eng->L, "audio_cache", &am_conf_audio_cache);
+    const char *resample_quality_str = NULL;
+    read_string_setting(eng->L, "audio_resample_quality", &resample_quality_str, "medium");
+    if (!am_parse_resample_quality(resample_quality_str, &am_conf_audio_resample_quality)) {
+        fprintf(stderr, "Invalid audio_resample_quality in conf.lua: %s\n", resample_quality_str);
+        free((void*)resample_quality_str);
+        am_destroy_engine(eng);
+        return false;
+    }
+    free((void*)resample_quality_str);
+
     read_bool_setting(eng->L, "d3dangle", &am_conf_d3dangle);
     #if !defined(AM_WINDOWS)
         am_conf_d3dangle = false;
     #endif
+
+    read_bool_setting(eng->L, "headless", &am_conf_headless);
+    #if !defined(AM_HEADLESS_SUPPORTED)
+        am_conf_headless = false;
+    #endif
     am_destroy_engine(eng);
     return true;
 }
@@ -44,6 +44,7 @@ extern bool am_conf_android_needs_billing_permission;
 
 // graphic driver options
 extern bool am_conf_d3dangle;
+extern bool am_conf_headless;
 
 // scene options
 extern int am_conf_default_recursion_limit;
@@ -64,9 +65,16 @@ extern int am_conf_audio_channels;
 extern int am_conf_audio_sample_rate;
 extern int am_conf_audio_interpolate_samples;
 extern bool am_conf_audio_mute;
+extern double am_conf_audio_stream_latency;
+extern bool am_conf_audio_cache;
+extern am_resample_quality am_conf_audio_resample_quality;
 
 // memory options
 extern int am_conf_buffer_malloc_threshold;
+extern int am_conf_buffer_dirty_range_gap;
+
+// mathv options
+extern int am_conf_mathv_threads;
 
 // dev options
 extern bool am_conf_validate_shader_programs;
@@ -63,11 +63,14 @@ void am_cull_sphere_node::render(am_render_state *rstate) {
             matrix = matrix * *m;
         } else {
             am_log1("WARNING: matrix '%s' is not a mat4 in cull_sphere node (node will be culled)", slot->name);
+            am_bounds_unbounded(rstate);
             return;
         }
     }
     if (am_sphere_visible(matrix, center, radius)) {
         render_children(rstate);
+    } else {
+        am_bounds_unbounded(rstate);
     }
 }
 
@@ -155,11 +158,14 @@ void am_cull_box_node::render(am_render_state *rstate) {
             matrix = matrix * *m;
         } else {
             am_log1("WARNING: matrix '%s' is not a mat4 in cull_box node (node will be culled)", slot->name);
+            am_bounds_unbounded(rstate);
             return;
         }
     }
     if (am_box_visible(matrix, min, max)) {
         render_children(rstate);
+    } else {
+        am_bounds_unbounded(rstate);
     }
 }
 
@@ -234,6 +240,266 @@ static void register_cull_box_node_mt(lua_State *L) {
     am_register_metatable(L, "cull_box", MT_am_cull_box_node, MT_am_scene_node);
 }
 
+// Auto cull
+
+#define AM_ALL_PLANES 63
+
+static bool get_matrix(am_program_param_value *param, glm::dmat4 *m) {
+    if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
+        *m = *(glm::dmat4*)&param->value.m4[0];
+        return true;
+    }
+    return false;
+}
+
+static bool is_affine(glm::dmat4 &m) {
+    return m[0][3] == 0.0 && m[1][3] == 0.0 && m[2][3] == 0.0 && m[3][3] == 1.0;
+}
+
+// Returns the center and half-extents of a box containing
+// the given box transformed by the affine matrix m.
+static void transform_box(glm::dmat4 &m, glm::dvec3 &min, glm::dvec3 &max,
+    glm::dvec3 *center, glm::dvec3 *extent)
+{
+    glm::dvec3 c = (min + max) * 0.5;
+    glm::dvec3 e = (max - min) * 0.5;
+    *center = glm::dvec3(m * glm::dvec4(c, 1.0));
+    *extent = glm::dvec3(
+        fabs(m[0][0]) * e.x + fabs(m[1][0]) * e.y + fabs(m[2][0]) * e.z,
+        fabs(m[0][1]) * e.x + fabs(m[1][1]) * e.y + fabs(m[2][1]) * e.z,
+        fabs(m[0][2]) * e.x + fabs(m[1][2]) * e.y + fabs(m[2][2]) * e.z);
+}
+
+static bool compute_planes(am_program_param_value *proj, glm::dvec4 *planes) {
+    glm::dmat4 p;
+    if (!get_matrix(proj, &p)) return false;
+    glm::dvec4 r0 = glm::row(p, 0);
+    glm::dvec4 r1 = glm::row(p, 1);
+    glm::dvec4 r2 = glm::row(p, 2);
+    glm::dvec4 r3 = glm::row(p, 3);
+    planes[0] = r3 + r0; // left
+    planes[1] = r3 - r0; // right
+    planes[2] = r3 + r1; // bottom
+    planes[3] = r3 - r1; // top
+    planes[4] = r3 + r2; // near
+    planes[5] = r3 - r2; // far
+    return true;
+}
+
+// Recomputes the frustum planes if a descendant has bound a different
+// projection matrix. Returns false if the projection isn't a mat4.
+static bool update_planes(am_render_state *rstate, am_cull_context *ctx) {
+    am_program_param_value *proj = &rstate->param_name_map[rstate->projection_param_index].value;
+    if (proj->version != ctx->projection_version) {
+        ctx->projection_version = proj->version;
+        ctx->has_planes = compute_planes(proj, ctx->planes);
+        ctx->plane_mask = AM_ALL_PLANES;
+    }
+    return ctx->has_planes;
+}
+
+// Tests the box (in the space of mv) against the planes in the context's
+// plane mask. If the box is visible, planes it's entirely inside of are
+// removed from the mask.
+static bool box_in_frustum(am_cull_context *ctx, glm::dmat4 &mv, glm::dvec3 &min, glm::dvec3 &max) {
+    if (!is_affine(mv)) return true;
+    glm::dvec3 c, e;
+    transform_box(mv, min, max, &c, &e);
+    uint32_t mask = ctx->plane_mask;
+    for (int i = 0; i < 6; i++) {
+        if (!(mask & (1 << i))) continue;
+        glm::dvec3 n = glm::dvec3(ctx->planes[i]);
+        double d = glm::dot(n, c) + ctx->planes[i].w;
+        double r = glm::dot(glm::abs(n), e);
+        if (d + r < 0.0) return false;
+        if (d - r >= 0.0) mask &= ~(1 << i);
+    }
+    ctx->plane_mask = mask;
+    return true;
+}
+
+// Adds bounds, given in the space of the current modelview matrix,
+// to the bounds being computed.
+static void merge_bounds(am_render_state *rstate, am_bounds_state state, glm::dvec3 min, glm::dvec3 max) {
+    am_bounds_frame *frame = rstate->bounds;
+    if (frame == NULL || frame->state == AM_BOUNDS_UNBOUNDED || state == AM_BOUNDS_EMPTY) return;
+    if (state == AM_BOUNDS_UNBOUNDED) {
+        frame->state = AM_BOUNDS_UNBOUNDED;
+        return;
+    }
+    am_program_param_value *mv = &rstate->param_name_map[rstate->modelview_param_index].value;
+    if (mv->version != frame->mv_version) {
+        // The modelview matrix has been changed since the frame was
+        // started (e.g. by a transform node), so map the bounds into
+        // the frame's space.
+        if (!frame->inverse_computed) {
+            frame->inverse_computed = true;
+            frame->has_inverse = frame->has_mv && is_affine(frame->mv)
+                && glm::determinant(frame->mv) != 0.0;
+            if (frame->has_inverse) frame->inverse_mv = glm::inverse(frame->mv);
+        }
+        glm::dmat4 m;
+        if (!frame->has_inverse || !get_matrix(mv, &m) || !is_affine(m)) {
+            frame->state = AM_BOUNDS_UNBOUNDED;
+            return;
+        }
+        glm::dmat4 rel = frame->inverse_mv * m;
+        glm::dvec3 c, e;
+        transform_box(rel, min, max, &c, &e);
+        min = c - e;
+        max = c + e;
+    }
+    if (frame->state == AM_BOUNDS_EMPTY) {
+        frame->state = AM_BOUNDS_FINITE;
+        frame->min = min;
+        frame->max = max;
+    } else {
+        frame->min = glm::min(frame->min, min);
+        frame->max = glm::max(frame->max, max);
+    }
+}
+
+void am_render_culled(am_render_state *rstate, am_scene_node *node) {
+    am_cull_context *ctx = rstate->cull;
+    am_program_param_value *mv = &rstate->param_name_map[rstate->modelview_param_index].value;
+    am_program_param_value *pos = &rstate->param_name_map[ctx->position_name].value;
+    am_buffer_view *pos_view = pos->type == AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY ? pos->value.arr : NULL;
+    am_bounds_frame *old_frame = rstate->bounds;
+    uint32_t old_mask = ctx->plane_mask;
+    am_node_bounds *b = node->bounds;
+    if (b != NULL
+        && !am_subtree_changed_since(node, b->gen)
+        && b->data_gen == am_bounds_data_generation
+        && b->program == rstate->active_program
+        && b->position == pos_view)
+    {
+        // copy, because a cycle could recompute the node's bounds while
+        // it's being rendered
+        am_bounds_state state = b->state;
+        glm::dvec3 min = b->min;
+        glm::dvec3 max = b->max;
+        if (state == AM_BOUNDS_EMPTY) return;
+        if (state == AM_BOUNDS_FINITE && ctx->plane_mask != 0 && update_planes(rstate, ctx)) {
+            glm::dmat4 m;
+            if (get_matrix(mv, &m) && !box_in_frustum(ctx, m, min, max)) {
+                merge_bounds(rstate, state, min, max);
+                ctx->plane_mask = old_mask;
+                return;
+            }
+        }
+        rstate->bounds = NULL;
+        node->render(rstate);
+        rstate->bounds = old_frame;
+        merge_bounds(rstate, state, min, max);
+    } else {
+        am_bounds_frame frame;
+        frame.state = AM_BOUNDS_EMPTY;
+        frame.mv_version = mv->version;
+        frame.has_mv = get_matrix(mv, &frame.mv);
+        frame.inverse_computed = false;
+        frame.has_inverse = false;
+        uint32_t gen = am_begin_scene_generation();
+        uint32_t data_gen = am_bounds_data_generation;
+        am_program *program = rstate->active_program;
+        rstate->bounds = &frame;
+        node->render(rstate);
+        rstate->bounds = old_frame;
+        b = node->bounds;
+        if (b == NULL) {
+            b = (am_node_bounds*)malloc(sizeof(am_node_bounds));
+            node->bounds = b;
+        }
+        b->state = frame.state;
+        b->min = frame.min;
+        b->max = frame.max;
+        b->gen = gen;
+        b->data_gen = data_gen;
+        b->program = program;
+        b->position = pos_view;
+        merge_bounds(rstate, frame.state, frame.min, frame.max);
+    }
+    ctx->plane_mask = old_mask;
+}
+
+void am_bounds_add_draw(am_render_state *rstate) {
+    am_program *prog = rstate->active_program;
+    if (prog == NULL) return; // nothing will be drawn
+    am_param_name_id position_name = rstate->cull->position_name;
+    bool has_position = false;
+    bool has_modelview = false;
+    bool has_projection = false;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_param_name_id name = prog->params[i].name;
+        if (name == position_name) {
+            has_position = true;
+        } else if (name == rstate->modelview_param_index) {
+            has_modelview = true;
+        } else if (name == rstate->projection_param_index) {
+            has_projection = true;
+        }
+    }
+    am_program_param_value *pos = &rstate->param_name_map[position_name].value;
+    if (!has_position || !has_modelview || !has_projection
+        || pos->type != AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY)
+    {
+        // we don't know where the vertices will end up
+        am_bounds_unbounded(rstate);
+        return;
+    }
+    am_buffer_view *view = pos->value.arr;
+    if (view->buffer->usage != AM_BUFFER_USAGE_STATIC_DRAW || !view->update_bounds_if_required()) {
+        // Vertices that change often would invalidate all the cached
+        // bounds each time, so don't track them.
+        am_bounds_unbounded(rstate);
+        return;
+    }
+    if (view->bounds_min.x > view->bounds_max.x) return; // no vertices
+    merge_bounds(rstate, AM_BOUNDS_FINITE,
+        glm::dvec3(view->bounds_min), glm::dvec3(view->bounds_max));
+}
+
+void am_auto_cull_node::render(am_render_state *rstate) {
+    if (rstate->recording != NULL) {
+        // a cached_group is recording, so it needs all the draws
+        render_children(rstate);
+        return;
+    }
+    am_cull_context ctx;
+    am_program_param_value *proj = &rstate->param_name_map[rstate->projection_param_index].value;
+    ctx.position_name = position_name;
+    ctx.projection_version = proj->version;
+    ctx.has_planes = compute_planes(proj, ctx.planes);
+    ctx.plane_mask = AM_ALL_PLANES;
+    am_cull_context *old_ctx = rstate->cull;
+    rstate->cull = &ctx;
+    render_children(rstate);
+    rstate->cull = old_ctx;
+}
+
+static int create_auto_cull_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    am_auto_cull_node *node = am_new_userdata(L, am_auto_cull_node);
+    node->tags.push_back(L, AM_TAG_AUTO_CULL);
+    if (nargs > 0) {
+        node->position_name = am_lookup_param_name(L, 1);
+    } else {
+        lua_pushstring(L, "vert");
+        node->position_name = am_lookup_param_name(L, -1);
+        lua_pop(L, 1);
+    }
+    return 1;
+}
+
+static void register_auto_cull_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+
+    am_register_metatable(L, "auto_cull", MT_am_auto_cull_node, MT_am_scene_node);
+}
+
 // Module init
 
 void am_open_culling_module(lua_State *L) {
@@ -241,6 +507,7 @@ void am_open_culling_module(lua_State *L) {
         {"cull_face", create_cull_face_node},
         {"cull_sphere", create_cull_sphere_node},
         {"cull_box", create_cull_box_node},
+        {"auto_cull", create_auto_cull_node},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
@@ -256,4 +523,5 @@ void am_open_culling_module(lua_State *L) {
     register_cull_face_node_mt(L);
     register_cull_sphere_node_mt(L);
     register_cull_box_node_mt(L);
+    register_auto_cull_node_mt(L);
 }
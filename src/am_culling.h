@@ -28,4 +28,73 @@ struct am_cull_box_node : am_scene_node {
     virtual void render(am_render_state *rstate);
 };
 
+// Automatic frustum culling.
+//
+// Under an auto_cull node every node caches the bounding box of
+// everything its subtree draws, in the space of the modelview matrix in
+// effect when the node is rendered. Draw nodes use the bounds of the bound
+// position view. Each node's bounds are the union of its children's,
+// mapped through any transforms in between. A node is skipped if its
+// bounds are outside the view frustum. Frustum planes that a node is
+// entirely inside of are not tested again for its descendants.
+//
+// Nodes that set the modelview matrix to something not derived from
+// the matrix they were rendered with (lookat, billboard, bind), that
+// change the projection matrix, or that don't always render their
+// children, should call am_bounds_unbounded so their ancestors are never
+// culled.
+
+enum am_bounds_state {
+    AM_BOUNDS_EMPTY,
+    AM_BOUNDS_FINITE,
+    AM_BOUNDS_UNBOUNDED,
+};
+
+struct am_node_bounds {
+    am_bounds_state         state;
+    glm::dvec3              min;
+    glm::dvec3              max;
+    // the bounds are valid as long as these haven't changed
+    uint32_t                gen;
+    uint32_t                data_gen;
+    am_program              *program;
+    am_buffer_view          *position;
+};
+
+// The bounds of the subtree currently being rendered, if its cached
+// bounds need to be recomputed.
+struct am_bounds_frame {
+    am_bounds_state         state;
+    glm::dvec3              min;
+    glm::dvec3              max;
+    uint64_t                mv_version;
+    glm::dmat4              mv;
+    bool                    has_mv;
+    bool                    inverse_computed;
+    bool                    has_inverse;
+    glm::dmat4              inverse_mv;
+};
+
+struct am_cull_context {
+    am_param_name_id        position_name;
+    glm::dvec4              planes[6]; // in eye space
+    uint64_t                projection_version;
+    bool                    has_planes;
+    uint32_t                plane_mask; // planes that still need testing
+};
+
+struct am_auto_cull_node : am_scene_node {
+    am_param_name_id position_name;
+    virtual void render(am_render_state *rstate);
+};
+
+void am_render_culled(am_render_state *rstate, am_scene_node *node);
+void am_bounds_add_draw(am_render_state *rstate);
+
+static inline void am_bounds_unbounded(am_render_state *rstate) {
+    if (rstate->bounds != NULL) {
+        rstate->bounds->state = AM_BOUNDS_UNBOUNDED;
+    }
+}
+
 void am_open_culling_module(lua_State *L);
@@ -0,0 +1,7586 @@
+#include "amulet.h"
+
+static const uint8_t data1[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 
+    0x6E, 0x63, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x74, 0x65, 0x70, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x66, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 
+    0x70, 0x65, 0x28, 0x66, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 
+    0x69, 0x6E, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x66, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x64, 0x65, 
+    0x61, 0x64, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x6F, 0x6B, 0x2C, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 
+    0x69, 0x6E, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x28, 0x66, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6F, 0x6B, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x72, 0x61, 0x63, 0x65, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x72, 
+    0x65, 0x73, 0x2C, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x5F, 0x5F, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 
+    0x65, 0x5F, 0x5F, 0x22, 0x2E, 0x2E, 0x72, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x66, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x74, 0x65, 0x70, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5F, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x5F, 0x6E, 0x6F, 0x64, 
+    0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5F, 0x62, 0x65, 0x67, 0x69, 
+    0x6E, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 
+    0x5F, 0x65, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x5F, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 
+    0x6F, 0x5F, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x2C, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 
+    0x65, 0x5F, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x7A, 0x6F, 0x6E, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6C, 0x6F, 
+    0x73, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 
+    0x2D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x64, 0x6F, 0x6E, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x2C, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 
+    0x65, 0x5F, 0x65, 0x6E, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x2C, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 
+    0x6F, 0x66, 0x69, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x77, 0x72, 0x61, 0x70, 0x73, 0x20, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x70, 0x72, 0x6F, 
+    0x66, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 
+    0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x5F, 0x61, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 
+    0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x69, 0x6E, 0x67, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x73, 0x28, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x6F, 0x5F, 0x70, 0x72, 0x6F, 0x66, 
+    0x69, 0x6C, 0x65, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 
+    0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x2C, 0x20, 0x74, 0x6F, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x66, 0x72, 0x61, 0x6D, 
+    0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x69, 
+    0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 
+    0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x6F, 0x6D, 
+    0x2C, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x61, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x20, 0x3C, 0x3D, 0x20, 0x70, 
+    0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
+    0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x2E, 0x73, 0x65, 0x71, 0x20, 0x7E, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x2D, 0x2D, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x5F, 0x61, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6A, 
+    0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 
+    0x28, 0x22, 0x71, 0x75, 0x65, 0x72, 0x79, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x25, 0x64, 0x5D, 0x20, 
+    0x3D, 0x20, 0x25, 0x73, 0x22, 0x2C, 0x20, 0x6A, 0x2C, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x6E, 
+    0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x6A, 0x5D, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x6A, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x6A, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x70, 0x20, 0x3C, 0x3D, 0x20, 0x6E, 
+    0x65, 0x78, 0x74, 0x5F, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x65, 
+    0x78, 0x74, 0x5F, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 
+    0x20, 0x3D, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x3D, 0x20, 0x31, 
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 
+    0x6F, 0x64, 0x65, 0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 
+    0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x70, 0x20, 0x3D, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x70, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x70, 0x20, 0x3D, 
+    0x3D, 0x20, 0x22, 0x6E, 0x69, 0x6C, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x69, 0x64, 
+    0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x70, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x70, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x61, 
+    0x6E, 0x64, 0x20, 0x74, 0x70, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x20, 0x28, 0x69, 0x6E, 
+    0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x61, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x70, 0x2E, 0x2E, 0x22, 0x29, 0x22, 0x2C, 0x20, 
+    0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x64, 0x20, 0x3D, 0x20, 0x69, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x2C, 0x20, 0x2D, 0x2D, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x78, 
+    0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x70, 
+    0x72, 0x69, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x2E, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 
+    0x3D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x23, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 
+    0x31, 0x2C, 0x20, 0x2D, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x63, 0x74, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 
+    0x20, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x61, 0x63, 0x74, 0x2E, 0x73, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x20, 0x2D, 0x2D, 0x20, 0x6D, 0x61, 
+    0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 
+    0x61, 0x64, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x69, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x61, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 
+    0x6F, 0x67, 0x28, 0x22, 0x73, 0x65, 0x74, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x25, 0x64, 0x5D, 0x20, 
+    0x3D, 0x20, 0x25, 0x73, 0x22, 0x2C, 0x20, 0x6E, 0x2B, 0x31, 0x2C, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x2D, 0x2D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6E, 0x69, 0x6E, 
+    0x67, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x6C, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 
+    0x64, 0x65, 0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x3D, 0x20, 0x69, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 
+    0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x29, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 
+    0x63, 0x65, 0x6C, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x69, 0x64, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x23, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 
+    0x20, 0x31, 0x2C, 0x20, 0x2D, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x73, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 0x20, 0x2D, 0x2D, 0x20, 
+    0x6D, 0x61, 0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x65, 
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x61, 0x6C, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x61, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x28, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x61, 0x64, 0x64, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
+    0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x6E, 
+    0x6F, 0x64, 0x65, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 
+    0x74, 0x72, 0x79, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x6C, 0x61, 0x74, 0x65, 0x5F, 
+    0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x64, 0x64, 0x5F, 0x6C, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 
+    0x73, 0x74, 0x72, 0x79, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x63, 0x61, 0x6E, 0x63, 
+    0x65, 0x6C, 0x20, 0x3D, 0x20, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x5F, 
+    0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x73, 
+    0x63, 0x65, 0x6E, 0x65, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x75, 
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x61, 
+    0x79, 0x28, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x20, 
+    0x2B, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3E, 0x3D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x73, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 
+    0x6F, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x20, 
+    0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7E, 0x3D, 
+    0x20, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 
+    0x28, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x74, 0x20, 0x69, 
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x22, 0x2E, 0x2E, 0x69, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x66, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 
+    0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x6F, 0x70, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 
+    0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x28, 0x6E, 0x6F, 
+    0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x61, 
+    0x72, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x69, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x7E, 0x3D, 
+    0x20, 0x22, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 
+    0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x22, 0x2E, 0x2E, 
+    0x69, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x2E, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x23, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x2D, 0x31, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x6F, 
+    0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x66, 0x75, 
+    0x6E, 0x63, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x23, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x77, 0x61, 0x69, 0x74, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x3D, 
+    0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x77, 
+    0x61, 0x69, 0x74, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x6C, 0x6C, 
+    0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x72, 
+    0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x64, 0x6F, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 
+    0x6E, 0x63, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data2[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x6F, 0x6F, 0x74, 
+    0x5F, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x29, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 
+    0x6E, 0x63, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 
+    0x6F, 0x74, 0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x61, 0x6C, 0x6C, 0x28, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x29, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 
+    0x6C, 0x65, 0x5F, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x3A, 0x61, 0x64, 0x64, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x64, 
+    0x69, 0x6F, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x5F, 0x6D, 0x65, 0x74, 0x61, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x61, 0x75, 0x64, 0x69, 0x6F, 
+    0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x59, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x75, 
+    0x6E, 0x74, 0x69, 0x6C, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x69, 0x6E, 
+    0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x72, 
+    0x6F, 0x6D, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2C, 0x0A, 0x2D, 0x2D, 0x20, 0x6F, 
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x2E, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x6D, 
+    0x74, 0x2E, 0x77, 0x61, 0x69, 0x74, 0x28, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x28, 
+    0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x64, 0x6F, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 
+    0x65, 0x2E, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x61, 0x64, 0x65, 0x72, 0x3A, 0x5F, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 
+    0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x72, 0x2E, 0x65, 0x72, 0x72, 
+    0x6F, 0x72, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x28, 0x66, 
+    0x69, 0x6C, 0x65, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 
+    0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x70, 0x69, 0x74, 0x63, 
+    0x68, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x67, 0x61, 
+    0x69, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 
+    0x66, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x66, 0x69, 0x6C, 
+    0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x75, 0x66, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x66, 0x69, 
+    0x6C, 0x65, 0x5D, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x28, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 
+    0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 
+    0x6F, 0x64, 0x65, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x73, 0x65, 0x65, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x2C, 
+    0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x20, 0x6F, 0x72, 
+    0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x6F, 
+    0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x73, 0x65, 0x65, 0x64, 0x5D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x75, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x66, 0x78, 0x72, 
+    0x5F, 0x73, 0x79, 0x6E, 0x74, 0x68, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x73, 0x65, 0x65, 0x64, 0x5D, 0x20, 
+    0x3D, 0x20, 0x62, 0x75, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x74, 0x72, 0x61, 0x63, 0x6B, 0x28, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x70, 0x69, 0x74, 
+    0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x62, 0x75, 0x66, 0x28, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 
+    0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 
+    0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x28, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2C, 
+    0x20, 0x70, 0x69, 0x74, 0x63, 0x68, 0x2C, 0x20, 0x67, 0x61, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 
+    0x6F, 0x64, 0x65, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 
+    0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x61, 0x72, 0x67, 0x31, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x32, 0x2C, 0x20, 0x61, 
+    0x72, 0x67, 0x33, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 
+    0x74, 0x20, 0x61, 0x72, 0x67, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x31, 0x20, 0x69, 0x73, 
+    0x20, 0x6E, 0x69, 0x6C, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 
+    0x61, 0x72, 0x67, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x72, 0x67, 
+    0x31, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x32, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x33, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x34, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 
+    0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x73, 0x65, 0x65, 0x64, 0x28, 0x61, 0x72, 0x67, 0x31, 
+    0x2C, 0x20, 0x61, 0x72, 0x67, 0x32, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x33, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x34, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x61, 0x75, 0x64, 
+    0x69, 0x6F, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x62, 0x75, 0x66, 0x28, 
+    0x61, 0x72, 0x67, 0x31, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x32, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x33, 0x2C, 0x20, 0x61, 0x72, 
+    0x67, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 
+    0x61, 0x72, 0x67, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 
+    0x65, 0x65, 0x70, 0x20, 0x3D, 0x20, 0x61, 0x72, 0x67, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 
+    0x2E, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x28, 0x61, 0x75, 0x64, 0x69, 
+    0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 
+    0x2E, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x63, 
+    0x68, 0x65, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x28, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x5F, 0x6E, 
+    0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data3[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 
+    0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x74, 0x33, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x39, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x31, 0x36, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x20, 0x3D, 0x20, 
+    0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x76, 0x65, 0x63, 0x32, 0x20, 0x20, 0x3D, 
+    0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 
+    0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x76, 0x65, 0x63, 0x33, 0x20, 0x20, 
+    0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 
+    0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x76, 0x65, 0x63, 0x34, 0x20, 
+    0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6D, 0x61, 0x74, 0x33, 
+    0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x39, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6D, 0x61, 0x74, 
+    0x34, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x38, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 
+    0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x36, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x79, 0x74, 0x65, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x79, 0x74, 0x65, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x79, 0x74, 0x65, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x79, 0x74, 0x65, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x62, 0x79, 0x74, 0x65, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 
+    0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 
+    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 
+    0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x32, 
+    0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5F, 
+    0x6E, 0x6F, 0x72, 0x6D, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 
+    0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+    0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x3D, 0x20, 
+    0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 
+    0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x62, 
+    0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 
+    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 
+    0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x20, 0x20, 0x3D, 0x20, 
+    0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x32, 0x20, 0x3D, 
+    0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 
+    0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x33, 0x20, 
+    0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 
+    0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x34, 
+    0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x68, 0x6F, 
+    0x72, 0x74, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 
+    0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 
+    0x68, 0x6F, 0x72, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 
+    0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
+    0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x3D, 0x20, 0x7B, 
+    0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 
+    0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 
+    0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 
+    0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 
+    0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x68, 
+    0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
+    0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x33, 0x20, 0x3D, 0x20, 0x7B, 
+    0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 
+    0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 
+    0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+    0x20, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+    0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 
+    0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x33, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x34, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x34, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x7D, 0x2C, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x7B, 0x73, 0x69, 0x7A, 
+    0x65, 0x20, 0x3D, 0x20, 0x34, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 
+    0x31, 0x7D, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x3D, 
+    0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x34, 0x20, 0x2A, 0x20, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 
+    0x69, 0x65, 0x77, 0x28, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x28, 0x34, 0x20, 0x2A, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 
+    0x28, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 
+    0x28, 0x22, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 
+    0x69, 0x65, 0x77, 0x28, 0x22, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 
+    0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x62, 0x79, 
+    0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 
+    0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 
+    0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 
+    0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x6F, 
+    0x72, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x73, 
+    0x68, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x22, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 
+    0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 
+    0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 
+    0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 
+    0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 
+    0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x69, 0x6E, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 
+    0x22, 0x69, 0x6E, 0x74, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x69, 0x6E, 0x74, 0x5F, 0x6E, 
+    0x6F, 0x72, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 
+    0x69, 0x6E, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 
+    0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x28, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x69, 0x6E, 
+    0x74, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 
+    0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x28, 0x32, 0x20, 0x2A, 0x20, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 
+    0x22, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x32, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 0x5F, 
+    0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x34, 0x20, 0x2A, 0x20, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x3A, 0x76, 
+    0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 
+    0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x76, 0x65, 0x63, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x6E, 0x61, 
+    0x6D, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x2A, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 
+    0x65, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x6E, 0x61, 0x6D, 0x65, 
+    0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 
+    0x31, 0x5D, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 
+    0x25, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 
+    0x69, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x20, 0x22, 0x2E, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 
+    0x73, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 
+    0x6C, 0x65, 0x6E, 0x20, 0x2F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 
+    0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x6E, 
+    0x61, 0x6D, 0x65, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x3A, 
+    0x76, 0x69, 0x65, 0x77, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x76, 0x65, 0x63, 0x32, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 
+    0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x32, 
+    0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x76, 0x65, 0x63, 0x33, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x5F, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x33, 0x22, 0x2C, 0x20, 0x33, 
+    0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x76, 
+    0x65, 0x63, 0x34, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x34, 0x22, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x6C, 0x65, 0x6E, 0x2C, 0x20, 0x69, 
+    0x6E, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 
+    0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 
+    0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5B, 0x65, 0x6C, 
+    0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 
+    0x6E, 0x66, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 
+    0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x65, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 
+    0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x2A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6C, 0x65, 0x6E, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 
+    0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 
+    0x61, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 
+    0x3D, 0x20, 0x23, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 
+    0x65, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x28, 0x30, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5B, 0x31, 0x5D, 0x29, 0x20, 0x3D, 0x3D, 0x20, 
+    0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x25, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x73, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x69, 0x62, 
+    0x6C, 0x65, 0x20, 0x62, 0x79, 0x20, 0x22, 0x2E, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x2C, 
+    0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6C, 0x65, 
+    0x6E, 0x20, 0x2F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6C, 0x65, 
+    0x6E, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x65, 0x6C, 0x65, 
+    0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 
+    0x73, 0x65, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x64, 0x65, 0x29, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 
+    0x28, 0x69, 0x6E, 0x69, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x63, 0x61, 0x73, 0x74, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 
+    0x2C, 0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 
+    0x6F, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5B, 0x65, 
+    0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x69, 0x6E, 0x66, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 
+    0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x65, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 
+    0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 
+    0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x2A, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x23, 0x61, 0x72, 0x72, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x28, 0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x3A, 0x76, 
+    0x69, 0x65, 0x77, 0x28, 0x65, 0x6C, 0x65, 0x6D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x5F, 0x6D, 0x74, 0x0A, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 
+    0x6F, 0x75, 0x70, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x69, 0x6E, 0x64, 
+    0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
+    0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x5F, 0x76, 0x69, 
+    0x65, 0x77, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 
+    0x70, 0x5F, 0x6D, 0x74, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 0x6E, 0x65, 0x77, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 
+    0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 
+    0x74, 0x2E, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x3A, 0x73, 0x65, 0x74, 0x28, 
+    0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 
+    0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x75, 
+    0x63, 0x74, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x3A, 0x66, 0x69, 
+    0x6C, 0x74, 0x65, 0x72, 0x28, 0x70, 0x72, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x3D, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2C, 0x20, 0x73, 0x74, 
+    0x61, 0x72, 0x74, 0x2C, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 
+    0x20, 0x7B, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x70, 
+    0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x73, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 
+    0x74, 0x2E, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x3A, 
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x2C, 0x20, 
+    0x73, 0x74, 0x65, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x72, 
+    0x65, 0x73, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x5F, 0x6D, 0x74, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 
+    0x75, 0x6C, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x72, 
+    0x72, 0x61, 0x79, 0x5F, 0x6F, 0x66, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 
+    0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x6E, 0x20, 0x3D, 0x20, 0x23, 0x73, 0x70, 0x65, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x20, 
+    0x25, 0x20, 0x32, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x61, 0x63, 0x68, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x72, 0x72, 
+    0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x20, 0x33, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 0x6F, 
+    0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x22, 0x2C, 0x20, 
+    0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x61, 0x74, 0x74, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x2C, 0x20, 0x32, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x74, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x65, 
+    0x63, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 
+    0x70, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x65, 0x63, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 
+    0x77, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5B, 0x74, 0x70, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 
+    0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x74, 
+    0x70, 0x29, 0x2C, 0x20, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x7A, 0x20, 0x3D, 0x20, 0x69, 0x6E, 
+    0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 
+    0x6E, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x61, 0x6C, 0x69, 
+    0x67, 0x6E, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 
+    0x6C, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x25, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 
+    0x65, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x2B, 0x20, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x69, 
+    0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x73, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x70, 0x2C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x69, 
+    0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x2B, 0x20, 0x73, 0x7A, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x73, 0x74, 
+    0x72, 0x75, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 
+    0x65, 0x20, 0x25, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 
+    0x65, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 0x69, 0x6E, 0x66, 
+    0x6F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x61, 0x74, 0x74, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 
+    0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x73, 
+    0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x73, 
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x5F, 0x6F, 0x66, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 
+    0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x23, 0x73, 0x70, 0x65, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 
+    0x20, 0x25, 0x20, 0x32, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x61, 0x63, 0x68, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 
+    0x62, 0x75, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x72, 
+    0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x20, 0x33, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 
+    0x6F, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x22, 0x2C, 
+    0x20, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x61, 0x74, 0x74, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x2C, 0x20, 0x32, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x74, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x70, 
+    0x65, 0x63, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x70, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x65, 0x63, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x3D, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x5B, 0x74, 0x70, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 
+    0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 
+    0x74, 0x70, 0x29, 0x2C, 0x20, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 
+    0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2A, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 
+    0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x74, 0x74, 0x72, 0x73, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x6F, 0x66, 0x66, 0x73, 
+    0x65, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x3D, 0x20, 0x74, 0x70, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x20, 0x3D, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2B, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 
+    0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 
+    0x20, 0x38, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x20, 0x25, 0x20, 0x38, 0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 
+    0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x61, 0x74, 0x74, 0x72, 0x73, 
+    0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x5B, 0x61, 
+    0x74, 0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x69, 
+    0x6E, 0x66, 0x6F, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x2C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x2C, 0x20, 0x63, 0x61, 0x70, 0x61, 
+    0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 
+    0x70, 0x28, 0x76, 0x69, 0x65, 0x77, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 
+    0x72, 0x6F, 0x75, 0x70, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x76, 0x69, 
+    0x65, 0x77, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x67, 0x72, 0x6F, 0x75, 
+    0x70, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x5F, 0x6D, 0x74, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x5F, 0x6F, 0x66, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 
+    0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 
+    0x61, 0x74, 0x68, 0x76, 0x2E, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x28, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x6F, 0x66, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x28, 
+    0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x29, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x73, 0x74, 0x72, 
+    0x75, 0x63, 0x74, 0x5F, 0x6F, 0x66, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 
+    0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x28, 0x63, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5F, 0x6F, 0x66, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x29, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x28, 0x66, 0x29, 
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x66, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 
+    0x6F, 0x6C, 0x64, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x73, 
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x2D, 0x2D, 0x20, 0x72, 0x65, 
+    0x63, 0x6F, 0x72, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 
+    0x20, 0x66, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 
+    0x62, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x73, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x72, 0x20, 
+    0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x29, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 
+    0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x2C, 
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 
+    0x74, 0x65, 0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x73, 0x2E, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x65, 0x78, 0x70, 0x72, 0x3A, 0x69, 0x6E, 0x74, 0x6F, 0x28, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x2E, 
+    0x2E, 0x2E, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 
+    0x74, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x2E, 0x0A, 0x2D, 0x2D, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x2A, 0x20, 
+    0x69, 0x73, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x2D, 
+    0x77, 0x69, 0x73, 0x65, 0x2E, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x65, 0x78, 0x70, 
+    0x72, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x36, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 
+    0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x65, 0x78, 0x70, 
+    0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x2E, 0x5F, 0x5F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 
+    0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x6F, 
+    0x70, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 
+    0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x7B, 0x6F, 0x70, 0x20, 0x3D, 0x20, 0x6F, 0x70, 
+    0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x7D, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 
+    0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20, 
+    0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x7B, 0x22, 0x61, 0x64, 0x64, 0x22, 0x2C, 0x20, 0x22, 0x73, 0x75, 0x62, 0x22, 0x2C, 
+    0x20, 0x22, 0x6D, 0x75, 0x6C, 0x22, 0x2C, 0x20, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x22, 
+    0x2C, 0x20, 0x22, 0x70, 0x6F, 0x77, 0x22, 0x7D, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x72, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x5B, 0x22, 0x5F, 0x5F, 0x22, 0x2E, 0x2E, 0x6F, 0x70, 0x5D, 0x20, 0x3D, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x20, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 
+    0x28, 0x6F, 0x70, 0x2C, 0x20, 0x61, 0x2C, 0x20, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x2E, 0x5F, 0x5F, 0x75, 0x6E, 
+    0x6D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x22, 0x75, 0x6E, 
+    0x6D, 0x22, 0x2C, 0x20, 0x61, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x6F, 0x70, 
+    0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x7B, 0x22, 0x61, 0x62, 0x73, 0x22, 0x2C, 0x20, 0x22, 0x61, 
+    0x63, 0x6F, 0x73, 0x22, 0x2C, 0x20, 0x22, 0x61, 0x73, 0x69, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x61, 0x74, 0x61, 0x6E, 0x22, 
+    0x2C, 0x20, 0x22, 0x63, 0x65, 0x69, 0x6C, 0x22, 0x2C, 0x20, 0x22, 0x63, 0x6F, 0x73, 0x22, 0x2C, 0x20, 0x22, 0x66, 0x6C, 
+    0x6F, 0x6F, 0x72, 0x22, 0x2C, 0x20, 0x22, 0x66, 0x72, 0x61, 0x63, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x6C, 0x6F, 0x67, 0x22, 
+    0x2C, 0x20, 0x22, 0x73, 0x69, 0x67, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x73, 0x69, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x74, 0x61, 
+    0x6E, 0x22, 0x7D, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 
+    0x5F, 0x6D, 0x74, 0x5B, 0x6F, 0x70, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 
+    0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x6F, 0x70, 0x2C, 0x20, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20, 0x69, 
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x7B, 0x22, 0x61, 0x74, 0x61, 0x6E, 0x32, 0x22, 0x2C, 0x20, 0x22, 0x6D, 0x61, 0x78, 0x22, 
+    0x2C, 0x20, 0x22, 0x6D, 0x69, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x6D, 0x6F, 0x64, 0x22, 0x2C, 0x20, 0x22, 0x70, 0x6F, 0x77, 
+    0x22, 0x2C, 0x20, 0x22, 0x6C, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x6C, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x22, 0x67, 0x74, 0x22, 
+    0x2C, 0x20, 0x22, 0x67, 0x74, 0x65, 0x22, 0x7D, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x72, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x5B, 0x6F, 0x70, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x20, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x6F, 0x70, 0x2C, 0x20, 0x61, 
+    0x2C, 0x20, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x66, 0x6F, 0x72, 
+    0x20, 0x5F, 0x2C, 0x20, 0x6F, 0x70, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x7B, 0x22, 0x63, 0x6C, 
+    0x61, 0x6D, 0x70, 0x22, 0x2C, 0x20, 0x22, 0x6D, 0x69, 0x78, 0x22, 0x7D, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x5B, 0x6F, 0x70, 0x5D, 0x20, 0x3D, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 
+    0x65, 0x28, 0x6F, 0x70, 0x2C, 0x20, 0x61, 0x2C, 0x20, 0x62, 0x2C, 0x20, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 
+    0x68, 0x76, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x28, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 
+    0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x61, 0x72, 0x67, 0x73, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 
+    0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x22, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x22, 0x2C, 0x20, 
+    0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x28, 0x75, 0x6E, 0x70, 0x61, 0x63, 0x6B, 0x28, 0x61, 
+    0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x65, 0x78, 0x70, 
+    0x72, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5F, 0x6D, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 
+    0x65, 0x78, 0x70, 0x72, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6F, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x22, 0x2C, 0x20, 0x32, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x66, 0x6C, 0x61, 
+    0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 
+    0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x73, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x6C, 
+    0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x65, 0x78, 0x70, 0x72, 0x5F, 0x6E, 0x6F, 
+    0x64, 0x65, 0x5F, 0x6D, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x2C, 0x20, 0x7B, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x22, 0x2C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x7D, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x23, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x6E, 0x6F, 0x64, 0x65, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 
+    0x3D, 0x20, 0x7B, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x6F, 0x70, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x6F, 0x70, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x70, 
+    0x61, 0x72, 0x61, 0x6D, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5B, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x5B, 0x31, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 
+    0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x5B, 0x69, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x5B, 0x6E, 0x6F, 0x64, 0x65, 0x5D, 0x20, 0x3D, 0x20, 0x23, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x73, 0x5B, 0x6E, 0x6F, 0x64, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x5F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 
+    0x65, 0x5F, 0x65, 0x78, 0x70, 0x72, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x2D, 0x2D, 0x20, 0x6C, 0x65, 0x67, 0x61, 0x63, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 
+    0x6B, 0x65, 0x65, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x63, 
+    0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 
+    0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x6F, 
+    0x66, 0x5F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 
+    0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x4F, 0x6E, 0x20, 0x4C, 0x75, 0x61, 
+    0x4A, 0x49, 0x54, 0x2C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x74, 0x69, 0x67, 0x68, 0x74, 
+    0x6C, 0x79, 0x20, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6E, 0x75, 0x6D, 
+    0x62, 0x65, 0x72, 0x73, 0x0A, 0x2D, 0x2D, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x73, 0x20, 0x74, 
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4A, 0x49, 0x54, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x73, 
+    0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 0x74, 0x72, 0x61, 0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x27, 0x73, 0x0A, 0x2D, 0x2D, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x70, 0x74, 0x72, 0x2C, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65, 
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 
+    0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x4C, 0x75, 0x61, 0x20, 0x41, 0x50, 0x49, 0x2E, 0x20, 0x45, 0x76, 0x65, 
+    0x72, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x0A, 0x2D, 0x2D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x67, 0x6F, 0x65, 0x73, 
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x3A, 
+    0x73, 0x65, 0x74, 0x2E, 0x20, 0x49, 0x74, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x73, 
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x0A, 
+    0x2D, 0x2D, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x73, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x61, 
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 
+    0x72, 0x73, 0x2E, 0x0A, 0x69, 0x66, 0x20, 0x6A, 0x69, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x66, 0x69, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x33, 0x32, 0x5F, 0x76, 0x69, 
+    0x65, 0x77, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x46, 0x33, 0x32, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 
+    0x66, 0x33, 0x32, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x73, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x5F, 0x70, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x66, 
+    0x69, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x28, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x2A, 0x22, 0x29, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x33, 0x32, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x73, 0x65, 0x74, 0x20, 
+    0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x73, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 0x22, 0x23, 0x22, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x3E, 0x20, 
+    0x30, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x7E, 0x3D, 
+    0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x73, 0x5B, 0x31, 0x5D, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x73, 0x65, 0x74, 0x28, 0x76, 0x69, 0x65, 0x77, 0x2C, 
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x5F, 
+    0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x28, 0x76, 0x69, 0x65, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3E, 0x20, 0x34, 0x20, 0x6F, 
+    0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x7E, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 
+    0x74, 0x73, 0x20, 0x2A, 0x20, 0x34, 0x20, 0x6F, 0x72, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x25, 0x20, 0x34, 
+    0x20, 0x7E, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x73, 0x65, 0x74, 
+    0x28, 0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x66, 
+    0x66, 0x69, 0x2E, 0x63, 0x61, 0x73, 0x74, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x5F, 0x70, 0x74, 0x72, 0x2C, 0x20, 0x62, 
+    0x75, 0x66, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x70, 0x74, 0x72, 0x29, 0x20, 0x2B, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x20, 0x2F, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 
+    0x65, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 
+    0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x78, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 
+    0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x69, 0x20, 0x2D, 0x20, 
+    0x31, 0x5D, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 
+    0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x32, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 
+    0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x20, 0x3D, 0x20, 
+    0x65, 0x20, 0x2A, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x73, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x28, 0x78, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 
+    0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x79, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 
+    0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x32, 0x5D, 0x2C, 
+    0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 
+    0x20, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x33, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x20, 0x2A, 0x20, 0x33, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x78, 0x2C, 0x20, 0x79, 0x2C, 0x20, 0x7A, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x20, 0x2D, 
+    0x20, 0x32, 0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x2C, 0x20, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x78, 0x29, 0x20, 0x7E, 0x3D, 0x20, 
+    0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x79, 0x29, 0x20, 
+    0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 
+    0x7A, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x33, 0x5D, 0x2C, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 
+    0x2D, 0x20, 0x32, 0x5D, 0x2C, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x78, 
+    0x2C, 0x20, 0x79, 0x2C, 0x20, 0x7A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x65, 0x20, 0x2A, 
+    0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x2C, 0x20, 0x7A, 0x2C, 0x20, 0x77, 0x20, 0x3D, 0x20, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x33, 0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 
+    0x6B, 0x20, 0x2D, 0x20, 0x32, 0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 
+    0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6B, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x78, 0x29, 0x20, 
+    0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 
+    0x79, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x79, 
+    0x70, 0x65, 0x28, 0x7A, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6F, 0x72, 
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x77, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x34, 0x5D, 0x2C, 0x20, 
+    0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x33, 0x5D, 0x2C, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 
+    0x32, 0x5D, 0x2C, 0x20, 0x64, 0x73, 0x74, 0x5B, 0x6B, 0x20, 0x2D, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x78, 0x2C, 0x20, 
+    0x79, 0x2C, 0x20, 0x7A, 0x2C, 0x20, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3C, 0x20, 0x73, 0x69, 0x7A, 
+    0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x63, 
+    0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x7E, 0x3D, 0x20, 0x6E, 0x69, 
+    0x6C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x73, 0x65, 0x74, 0x28, 0x76, 0x69, 0x65, 
+    0x77, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3E, 0x20, 
+    0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x75, 0x66, 0x3A, 0x6D, 0x61, 0x72, 0x6B, 0x5F, 0x64, 0x69, 0x72, 0x74, 0x79, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x2C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2B, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 
+    0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data4[] = {
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x32, 0x64, 
+    0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2C, 0x20, 0x70, 0x6F, 0x73, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x28, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x50, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2F, 0x32, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x2F, 0x32, 0x2C, 0x20, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x32, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x32, 0x29, 0x2C, 0x20, 0x4D, 0x56, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x28, 0x31, 0x29, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 
+    0x65, 0x74, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x2D, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x4D, 0x56, 0x5B, 0x34, 0x5D, 
+    0x2E, 0x78, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x70, 0x6F, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 
+    0x2E, 0x4D, 0x56, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x28, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 
+    0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x70, 0x6F, 0x73, 
+    0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x28, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x3D, 0x20, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x50, 0x20, 0x3D, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2F, 0x32, 
+    0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2F, 0x32, 0x2C, 0x20, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x32, 
+    0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 
+    0x74, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 
+    0x65, 0x74, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x50, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 
+    0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2F, 0x32, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2F, 0x32, 0x2C, 0x20, 0x2D, 
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x32, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x32, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x74, 0x61, 0x67, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x32, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data5[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x5F, 
+    0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x3A, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x22, 0x5E, 0x4C, 0x75, 0x61, 0x20, 0x28, 
+    0x5B, 0x30, 0x2D, 0x39, 0x25, 0x2E, 0x5D, 0x2B, 0x29, 0x24, 0x22, 0x29, 0x0A, 0x69, 0x66, 0x20, 0x76, 0x20, 0x3E, 0x20, 
+    0x35, 0x2E, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x62, 0x65, 0x68, 
+    0x61, 0x76, 0x69, 0x6F, 0x75, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 
+    0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 
+    0x65, 0x65, 0x6E, 0x20, 0x35, 0x2E, 0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x35, 0x2E, 0x32, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x2D, 0x2D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 
+    0x20, 0x35, 0x2E, 0x31, 0x20, 0x73, 0x65, 0x6D, 0x61, 0x6E, 0x74, 0x69, 0x63, 0x73, 0x20, 0x28, 0x77, 0x65, 0x20, 0x64, 
+    0x65, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6D, 
+    0x2E, 0x77, 0x61, 0x69, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x6C, 0x64, 0x5F, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x63, 
+    0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x2E, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x3D, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2C, 0x20, 0x69, 0x73, 0x5F, 0x6D, 0x61, 0x69, 
+    0x6E, 0x20, 0x3D, 0x20, 0x6F, 0x6C, 0x64, 0x5F, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x73, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x72, 
+    0x65, 0x61, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x75, 0x6E, 0x70, 
+    0x61, 0x63, 0x6B, 0x20, 0x61, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x35, 
+    0x2E, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x75, 
+    0x6E, 0x70, 0x61, 0x63, 0x6B, 0x22, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x75, 0x6E, 0x70, 0x61, 0x63, 0x6B, 
+    0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x20, 0x69, 0x73, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x35, 0x2E, 0x32, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6C, 0x6F, 0x61, 
+    0x64, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0};
+
+static const uint8_t data6[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x64, 
+    0x65, 0x76, 0x6D, 0x6F, 0x64, 0x65, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x20, 0x3D, 
+    0x20, 0x7B, 0x7D, 0x20, 0x2D, 0x2D, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 
+    0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 
+    0x20, 0x7B, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x6B, 0x22, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x28, 0x6F, 0x62, 0x6A, 0x2C, 
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x5D, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x62, 0x6A, 0x5B, 0x69, 0x6E, 0x64, 
+    0x65, 0x78, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x5D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x64, 0x65, 0x76, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 
+    0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x20, 0x3D, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5B, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x77, 0x61, 
+    0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x20, 0x3D, 0x20, 0x7B, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 
+    0x6C, 0x65, 0x28, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x2C, 0x20, 0x77, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x5F, 0x6D, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x5D, 0x20, 
+    0x3D, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 
+    0x3D, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x5B, 0x6F, 0x62, 0x6A, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x61, 0x74, 0x63, 
+    0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x5B, 0x6F, 0x62, 0x6A, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x65, 0x6C, 
+    0x64, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x2E, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x28, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 
+    0x66, 0x69, 0x65, 0x6C, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x69, 0x66, 0x20, 0x64, 0x65, 0x76, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x2C, 0x20, 0x7B, 
+    0x5F, 0x5F, 0x6E, 0x65, 0x77, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2C, 0x20, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 
+    0x63, 0x6F, 0x6E, 0x66, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x20, 0x3D, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5B, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6F, 0x62, 0x6A, 0x2C, 0x20, 
+    0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x77, 0x61, 0x74, 0x63, 
+    0x68, 0x65, 0x64, 0x5F, 0x6F, 0x62, 0x6A, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6F, 0x62, 0x6A, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x7D, 0x29, 0x0A, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x2C, 0x20, 0x7B, 0x5F, 0x5F, 0x6E, 0x65, 0x77, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 
+    0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x6F, 0x6E, 0x66, 0x2C, 0x20, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x64, 
+    0x65, 0x76, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 
+    0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x7D, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data7[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x5F, 0x6D, 
+    0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x20, 0x2D, 0x2D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x63, 0x74, 0x69, 
+    0x76, 0x65, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x0A, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x6B, 0x65, 0x79, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x6B, 0x65, 
+    0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 
+    0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x28, 
+    0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 
+    0x22, 0x64, 0x6F, 0x77, 0x6E, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x6B, 0x65, 0x79, 0x2E, 0x2E, 0x22, 0x28, 0x22, 0x2E, 0x2E, 
+    0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x2E, 
+    0x2E, 0x22, 0x2C, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 
+    0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x29, 0x2E, 0x2E, 0x22, 0x29, 0x22, 
+    0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 
+    0x6B, 0x65, 0x79, 0x5F, 0x75, 0x70, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 
+    0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 
+    0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 
+    0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 
+    0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x75, 0x70, 0x3A, 
+    0x20, 0x22, 0x2E, 0x2E, 0x6B, 0x65, 0x79, 0x2E, 0x2E, 0x22, 0x28, 0x22, 0x2E, 0x2E, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 
+    0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x2E, 0x2E, 0x22, 0x2C, 0x20, 0x22, 
+    0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x29, 0x2E, 0x2E, 0x22, 0x29, 0x22, 0x29, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x65, 
+    0x61, 0x72, 0x5F, 0x6B, 0x65, 0x79, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 
+    0x73, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 
+    0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x75, 
+    0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 
+    0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x6F, 0x72, 
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 
+    0x20, 0x3D, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x31, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x2D, 0x20, 
+    0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 
+    0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x65, 0x77, 0x5F, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 
+    0x73, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x74, 
+    0x61, 0x6C, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x6F, 0x6E, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 
+    0x74, 0x6F, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 
+    0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 
+    0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 
+    0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 
+    0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x72, 0x65, 
+    0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6B, 
+    0x65, 0x79, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x6B, 0x65, 0x79, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 
+    0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 
+    0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 
+    0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 
+    0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 
+    0x65, 0x73, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x5F, 0x64, 0x6F, 0x77, 
+    0x6E, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 
+    0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 
+    0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 
+    0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 
+    0x65, 0x79, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 
+    0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 
+    0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 
+    0x74, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x6B, 
+    0x65, 0x79, 0x73, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 
+    0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 
+    0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 
+    0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x28, 
+    0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x5F, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 
+    0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x6E, 
+    0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 
+    0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x6B, 0x65, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x6B, 0x65, 0x79, 
+    0x73, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 
+    0x65, 0x79, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 
+    0x6D, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x2C, 
+    0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 
+    0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 
+    0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 
+    0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 
+    0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 
+    0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 
+    0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 
+    0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6B, 0x65, 
+    0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x6B, 
+    0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x6F, 0x72, 0x20, 
+    0x30, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 
+    0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
+    0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 
+    0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 
+    0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 
+    0x20, 0x3D, 0x20, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 
+    0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 
+    0x73, 0x65, 0x5F, 0x75, 0x70, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 
+    0x20, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x2C, 0x20, 0x6E, 0x78, 
+    0x2C, 0x20, 0x6E, 0x79, 0x2C, 0x20, 0x70, 0x78, 0x2C, 0x20, 0x70, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 
+    0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x79, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x6E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 
+    0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6E, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 
+    0x70, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 
+    0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x70, 0x79, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 
+    0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x79, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 
+    0x6C, 0x65, 0x61, 0x72, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 
+    0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 
+    0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 
+    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x65, 0x77, 
+    0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 
+    0x74, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x2D, 0x20, 0x72, 0x65, 
+    0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 
+    0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 
+    0x20, 0x74, 0x6F, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 
+    0x20, 0x3E, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x2D, 0x2D, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x6F, 0x6E, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6F, 
+    0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 
+    0x3D, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 
+    0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x75, 
+    0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 
+    0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 
+    0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 
+    0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 
+    0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 
+    0x6C, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 
+    0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 
+    0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x79, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x6F, 
+    0x77, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x30, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 
+    0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 
+    0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 
+    0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 
+    0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 
+    0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x61, 0x6E, 0x64, 
+    0x20, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 
+    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 
+    0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x2C, 
+    0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 
+    0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x75, 
+    0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 
+    0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x77, 
+    0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 
+    0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 
+    0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 
+    0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 
+    0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 
+    0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 
+    0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x2D, 
+    0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 
+    0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x78, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 
+    0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x79, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 
+    0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 
+    0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 
+    0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 
+    0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 
+    0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 
+    0x65, 0x65, 0x6C, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 
+    0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x78, 
+    0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 
+    0x65, 0x6C, 0x5F, 0x78, 0x2C, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 
+    0x5F, 0x79, 0x20, 0x2D, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 
+    0x68, 0x65, 0x65, 0x6C, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x5F, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x78, 0x2C, 0x20, 
+    0x79, 0x2C, 0x20, 0x6E, 0x78, 0x2C, 0x20, 0x6E, 0x79, 0x2C, 0x20, 0x70, 0x78, 0x2C, 0x20, 0x70, 0x79, 0x2C, 0x20, 0x66, 
+    0x6F, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 
+    0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x72, 0x65, 0x65, 0x5F, 0x69, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x72, 0x65, 0x65, 0x5F, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x72, 
+    0x65, 0x65, 0x5F, 0x69, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x65, 0x73, 0x5B, 0x66, 0x72, 0x65, 0x65, 0x5F, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x69, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 
+    0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 
+    0x20, 0x3D, 0x20, 0x6E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 
+    0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6E, 0x79, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x70, 0x78, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x70, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x20, 0x3D, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x65, 0x6E, 
+    0x64, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x2C, 0x20, 0x6E, 0x78, 0x2C, 
+    0x20, 0x6E, 0x79, 0x2C, 0x20, 0x70, 0x78, 0x2C, 0x20, 0x70, 0x79, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x5F, 0x78, 0x20, 0x3D, 0x20, 0x6E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x79, 0x20, 0x3D, 0x20, 0x6E, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x78, 0x20, 0x3D, 0x20, 0x70, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x79, 0x20, 0x3D, 0x20, 0x70, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 
+    0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x77, 0x69, 
+    0x6E, 0x2C, 0x20, 0x69, 0x64, 0x2C, 0x20, 0x78, 0x2C, 0x20, 0x79, 0x2C, 0x20, 0x6E, 0x78, 0x2C, 0x20, 0x6E, 0x79, 0x2C, 
+    0x20, 0x70, 0x78, 0x2C, 0x20, 0x70, 0x79, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 
+    0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 
+    0x20, 0x3D, 0x20, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 
+    0x20, 0x6E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x6E, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 
+    0x70, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x70, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 
+    0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 
+    0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 
+    0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 
+    0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 
+    0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 
+    0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 
+    0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 
+    0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 
+    0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x28, 0x77, 0x69, 
+    0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 
+    0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x66, 0x6F, 0x72, 0x63, 
+    0x65, 0x5F, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 
+    0x69, 0x6F, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 
+    0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 
+    0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 
+    0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 
+    0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x2D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 
+    0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 
+    0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 
+    0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 
+    0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x2D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 
+    0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 
+    0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x78, 0x20, 0x2D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 
+    0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5F, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x62, 0x65, 
+    0x67, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 
+    0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 
+    0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 
+    0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5F, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 
+    0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 
+    0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 
+    0x6D, 0x74, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x28, 0x77, 0x69, 
+    0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 
+    0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x75, 0x2E, 
+    0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 
+    0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x61, 0x63, 0x74, 0x69, 
+    0x76, 0x65, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 
+    0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 
+    0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 
+    0x2E, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 
+    0x64, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x5F, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x28, 0x77, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 
+    0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 
+    0x5F, 0x6D, 0x74, 0x2E, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x5F, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x2C, 
+    0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x69, 0x5D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x28, 
+    0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 
+    0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 
+    0x73, 0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 
+    0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 
+    0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 
+    0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 
+    0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 0x63, 
+    0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 
+    0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x63, 
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x38, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x66, 0x6F, 
+    0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 
+    0x6C, 0x65, 0x72, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 
+    0x65, 0x72, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 
+    0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 
+    0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 
+    0x64, 0x20, 0x25, 0x64, 0x20, 0x25, 0x64, 0x22, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x69, 0x64, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 
+    0x65, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x69, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x3D, 
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x65, 0x66, 0x74, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5F, 0x79, 0x20, 
+    0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x74, 0x20, 
+    0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x74, 0x20, 
+    0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 
+    0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 
+    0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x22, 0x2E, 0x2E, 0x69, 0x64, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 
+    0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 
+    0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x64, 
+    0x6F, 0x77, 0x6E, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x62, 0x75, 
+    0x74, 0x74, 0x6F, 0x6E, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x20, 0x22, 0x2E, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 
+    0x2E, 0x22, 0x20, 0x22, 0x2E, 0x2E, 0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 
+    0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 
+    0x69, 0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 
+    0x3D, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 
+    0x30, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x5F, 0x75, 0x70, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x62, 
+    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x75, 0x70, 0x20, 0x22, 0x2E, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2E, 0x2E, 
+    0x22, 0x20, 0x22, 0x2E, 0x2E, 0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 
+    0x64, 0x20, 0x3D, 0x3D, 0x20, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 
+    0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 
+    0x3D, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 
+    0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x61, 0x78, 0x69, 0x73, 
+    0x5F, 0x6D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x69, 0x64, 0x2C, 0x20, 0x61, 0x78, 0x69, 0x73, 0x2C, 0x20, 0x76, 0x61, 
+    0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x6D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x2E, 0x2E, 
+    0x61, 0x78, 0x69, 0x73, 0x2E, 0x2E, 0x22, 0x20, 0x22, 0x2E, 0x2E, 0x76, 0x61, 0x6C, 0x2E, 0x2E, 0x22, 0x20, 0x22, 0x2E, 
+    0x2E, 0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 0x6F, 0x6E, 
+    0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x3D, 
+    0x20, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5B, 0x61, 0x78, 0x69, 0x73, 0x5D, 0x20, 0x3D, 0x20, 
+    0x76, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 
+    0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 
+    0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 
+    0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 
+    0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 
+    0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x31, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x2D, 0x20, 
+    0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 
+    0x73, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x70, 0x6F, 
+    0x73, 0x74, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x65, 
+    0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 
+    0x6F, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 
+    0x20, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x6F, 0x6E, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6E, 
+    0x65, 0x78, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x5F, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 
+    0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 
+    0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 
+    0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x6C, 0x65, 
+    0x61, 0x73, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x61, 0x74, 0x74, 
+    0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x64, 0x65, 0x74, 0x61, 
+    0x63, 0x68, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x70, 0x6F, 0x73, 
+    0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x28, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x6C, 0x74, 0x5F, 0x76, 
+    0x61, 0x6C, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x2E, 
+    0x6C, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x72, 0x74, 0x5F, 0x76, 
+    0x61, 0x6C, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x2E, 
+    0x72, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x6C, 0x73, 0x74, 0x69, 
+    0x63, 0x6B, 0x5F, 0x70, 0x6F, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 
+    0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x72, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 
+    0x72, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x5F, 0x78, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 
+    0x2E, 0x6C, 0x65, 0x66, 0x74, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x72, 0x73, 0x74, 
+    0x69, 0x63, 0x6B, 0x5F, 0x70, 0x6F, 0x73, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 
+    0x72, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 
+    0x65, 0x72, 0x2E, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5F, 0x78, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 
+    0x65, 0x72, 0x2E, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5F, 0x79, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 
+    0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 
+    0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 
+    0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x6F, 0x74, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x61, 0x6E, 0x64, 
+    0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 
+    0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x64, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x62, 0x75, 0x74, 
+    0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 
+    0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0x28, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 
+    0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x5B, 0x62, 0x75, 0x74, 0x74, 
+    0x6F, 0x6E, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 
+    0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 0x72, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 
+    0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x5B, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x5D, 0x20, 0x6F, 
+    0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3E, 0x20, 
+    0x30, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6C, 0x65, 
+    0x61, 0x73, 0x65, 0x73, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x70, 0x72, 
+    0x65, 0x73, 0x65, 0x6E, 0x74, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6E, 
+    0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 
+    0x72, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 
+    0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 
+    0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5F, 0x70, 0x72, 0x65, 
+    0x73, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x73, 
+    0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 
+    0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x72, 
+    0x65, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 
+    0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x69, 
+    0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 
+    0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x74, 
+    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 
+    0x72, 0x65, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 
+    0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x72, 
+    0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 
+    0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 
+    0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x6F, 0x6E, 
+    0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 
+    0x28, 0x72, 0x65, 0x73, 0x2C, 0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x72, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x5F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x75, 0x6D, 0x62, 
+    0x6C, 0x65, 0x28, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 
+    0x73, 0x74, 0x72, 0x65, 0x6E, 0x67, 0x68, 0x29, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x72, 0x75, 0x6D, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x3D, 0x20, 
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 
+    0x65, 0x72, 0x2E, 0x69, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x75, 0x6D, 0x62, 0x6C, 0x65, 
+    0x28, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x2E, 0x69, 0x64, 0x2C, 0x20, 0x64, 0x75, 0x72, 0x61, 
+    0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x65, 0x6E, 0x67, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x0A, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 
+    0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 
+    0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x20, 0x7E, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x6F, 0x72, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x7E, 
+    0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 
+    0x6C, 0x65, 0x61, 0x72, 0x5F, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x65, 0x76, 0x65, 0x6E, 
+    0x74, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x6B, 0x65, 
+    0x79, 0x73, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 
+    0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x28, 0x77, 0x69, 0x6E, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x73, 0x65, 0x74, 0x5F, 0x77, 0x69, 0x6E, 
+    0x64, 0x6F, 0x77, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 
+    0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 
+    0x64, 0x6F, 0x77, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 
+    0x74, 0x61, 0x74, 0x65, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 
+    0x61, 0x72, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 
+    0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 
+    0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x69, 0x2C, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x28, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x2E, 0x65, 0x6E, 0x64, 0x65, 0x64, 
+    0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x75, 
+    0x63, 0x68, 0x2E, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 
+    0x6D, 0x2E, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x75, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x5F, 0x65, 0x76, 0x65, 0x6E, 
+    0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x6B, 0x65, 0x79, 0x62, 0x6F, 
+    0x61, 0x72, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x30, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 0x65, 0x79, 0x5F, 0x70, 
+    0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6B, 
+    0x65, 0x79, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 
+    0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 
+    0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 
+    0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x5F, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x30, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x78, 
+    0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 
+    0x65, 0x65, 0x6C, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 
+    0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 0x65, 0x65, 0x6C, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x5F, 0x77, 0x68, 
+    0x65, 0x65, 0x6C, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x74, 0x6F, 
+    0x75, 0x63, 0x68, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x74, 
+    0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 0x73, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 0x5F, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x65, 
+    0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x67, 0x61, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 
+    0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 
+    0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x6E, 0x6F, 0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6E, 0x6F, 
+    0x72, 0x6D, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 
+    0x6C, 0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x2E, 
+    0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x61, 0x70, 0x70, 0x20, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x62, 0x65, 0x63, 0x61, 0x6D, 0x65, 0x5F, 
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x64, 0x69, 0x64, 
+    0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 
+    0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x67, 0x69, 
+    0x73, 0x74, 0x65, 0x72, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 
+    0x2E, 0x5F, 0x64, 0x69, 0x64, 0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 0x61, 0x63, 
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 
+    0x2E, 0x5F, 0x69, 0x6E, 0x5F, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x64, 0x69, 0x64, 0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x6E, 0x5F, 0x62, 
+    0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x29, 0x0A, 
+    0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x61, 0x70, 0x70, 0x5F, 0x62, 0x65, 0x63, 
+    0x61, 0x6D, 0x65, 0x5F, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x6E, 0x5F, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x5F, 0x61, 0x63, 
+    0x74, 0x69, 0x76, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data8[] = {
+    0x2D, 0x2D, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3D, 0x20, 
+    0x5F, 0x47, 0x2E, 0x64, 0x65, 0x62, 0x75, 0x67, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x28, 0x74, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
+    0x64, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x67, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x74, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x74, 0x29, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x5B, 0x6B, 0x5D, 0x20, 
+    0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x65, 0x70, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x5F, 0x32, 0x28, 
+    0x74, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 
+    0x20, 0x3D, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x5B, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x5B, 0x74, 
+    0x5D, 0x20, 0x3D, 0x20, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 
+    0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x74, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6B, 0x29, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x65, 
+    0x70, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x5F, 0x32, 0x28, 0x6B, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x29, 0x20, 0x3D, 0x3D, 0x20, 
+    0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x65, 0x70, 0x5F, 0x63, 0x6F, 
+    0x70, 0x79, 0x5F, 0x32, 0x28, 0x76, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x64, 0x65, 0x65, 0x70, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x28, 0x74, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x65, 0x65, 0x70, 0x5F, 0x63, 0x6F, 0x70, 0x79, 0x5F, 0x32, 0x28, 0x74, 
+    0x2C, 0x20, 0x7B, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x70, 0x65, 
+    0x63, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x67, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x22, 0x2E, 0x2E, 0x74, 
+    0x79, 0x70, 0x65, 0x28, 0x74, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x73, 
+    0x65, 0x61, 0x72, 0x63, 0x68, 0x28, 0x74, 0x2C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x74, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
+    0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x23, 0x74, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x2D, 
+    0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x5B, 0x69, 0x5D, 
+    0x20, 0x3D, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x74, 0x2C, 
+    0x20, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x72, 0x72, 0x31, 0x2C, 0x20, 0x61, 0x72, 0x72, 
+    0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x23, 0x61, 0x72, 
+    0x72, 0x31, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x76, 0x20, 
+    0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x61, 0x72, 0x72, 0x32, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x31, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x74, 0x31, 0x2C, 0x20, 0x74, 0x32, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 
+    0x28, 0x74, 0x32, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x31, 0x5B, 0x6B, 
+    0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x28, 0x74, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x5F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x74, 0x29, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 
+    0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 
+    0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x76, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x69, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x76, 0x20, 0x69, 
+    0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x74, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x74, 
+    0x2C, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 
+    0x73, 0x28, 0x74, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 
+    0x28, 0x76, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x32, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x32, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x5F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x74, 0x29, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 
+    0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x74, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 
+    0x73, 0x28, 0x74, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x75, 0x6E, 
+    0x74, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x73, 
+    0x68, 0x75, 0x66, 0x66, 0x6C, 0x65, 0x28, 0x74, 0x2C, 0x20, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x67, 
+    0x6F, 0x74, 0x20, 0x61, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 
+    0x61, 0x74, 0x68, 0x5F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x3D, 0x20, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x6D, 0x61, 
+    0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 
+    0x20, 0x3D, 0x20, 0x23, 0x74, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x2D, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x5F, 0x72, 
+    0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x5B, 0x61, 
+    0x5D, 0x2C, 0x20, 0x74, 0x5B, 0x62, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x5B, 0x62, 0x5D, 0x2C, 0x20, 0x74, 0x5B, 0x61, 0x5D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x28, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 
+    0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x2C, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x6E, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x70, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 
+    0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x70, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 
+    0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x73, 0x65, 0x65, 0x6E, 0x5B, 0x74, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x20, 0x64, 0x65, 
+    0x74, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x22, 0x2E, 0x2E, 0x74, 
+    0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x29, 0x2C, 0x20, 0x64, 0x65, 0x70, 0x74, 
+    0x68, 0x20, 0x2B, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x5B, 0x74, 0x5D, 0x20, 
+    0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x20, 0x3D, 0x20, 0x22, 
+    0x20, 0x20, 0x20, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x72, 0x65, 0x70, 0x28, 
+    0x74, 0x61, 0x62, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x7B, 0x5C, 0x6E, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x72, 0x72, 
+    0x61, 0x79, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x5F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 
+    0x74, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x2C, 0x20, 0x6B, 0x65, 0x79, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6B, 0x65, 0x79, 
+    0x20, 0x7E, 0x3D, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x61, 
+    0x79, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x74, 
+    0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5F, 0x74, 0x65, 
+    0x73, 0x74, 0x20, 0x2D, 0x20, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x20, 0x2E, 0x2E, 0x20, 0x70, 
+    0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2E, 0x2E, 0x20, 0x74, 0x61, 0x62, 0x20, 0x2E, 0x2E, 0x20, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x69, 0x2C, 0x20, 0x74, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 
+    0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x20, 0x2B, 0x20, 0x31, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x2C, 0x20, 0x64, 0x65, 
+    0x70, 0x74, 0x68, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x20, 0x2E, 0x2E, 0x20, 0x22, 0x2C, 0x5C, 0x6E, 0x22, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B, 0x31, 0x2C, 0x20, 0x6B, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x28, 0x6B, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x6B, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 
+    0x6E, 0x64, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 0x31, 0x20, 0x3C, 0x20, 0x6B, 0x32, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x31, 0x20, 
+    0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x32, 0x20, 0x3D, 
+    0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6B, 0x31, 0x20, 0x3C, 0x20, 0x6B, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 
+    0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x74, 0x31, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 
+    0x32, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x28, 0x6B, 0x31, 0x29, 0x20, 0x3C, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x6B, 
+    0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x6B, 
+    0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x29, 0x20, 0x64, 
+    0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x74, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x20, 0x3D, 0x3D, 0x20, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6B, 0x65, 0x79, 0x3A, 0x6D, 0x61, 0x74, 
+    0x63, 0x68, 0x22, 0x5E, 0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 0x5F, 0x5D, 0x5B, 0x41, 0x2D, 0x5A, 0x61, 0x2D, 0x7A, 
+    0x30, 0x2D, 0x39, 0x5F, 0x5D, 0x2A, 0x24, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x74, 0x72, 
+    0x20, 0x3D, 0x20, 0x6B, 0x65, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x5B, 0x22, 
+    0x2E, 0x2E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x22, 0x3C, 0x6B, 
+    0x65, 0x79, 0x3E, 0x22, 0x2C, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x2C, 0x20, 
+    0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x2E, 0x2E, 0x22, 0x5D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x61, 
+    0x6C, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x28, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 
+    0x20, 0x2B, 0x20, 0x31, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x2C, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x2B, 0x20, 
+    0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x20, 0x2E, 0x2E, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x2E, 
+    0x2E, 0x20, 0x74, 0x61, 0x62, 0x20, 0x2E, 0x2E, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x74, 0x72, 0x20, 0x2E, 0x2E, 0x20, 0x22, 
+    0x20, 0x3D, 0x20, 0x22, 0x20, 0x2E, 0x2E, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x74, 0x72, 0x20, 0x2E, 0x2E, 0x20, 0x22, 0x2C, 
+    0x5C, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x20, 0x2E, 0x2E, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 
+    0x2E, 0x2E, 0x20, 0x22, 0x7D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x5B, 
+    0x74, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 
+    0x70, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x27, 0x22, 0x27, 0x20, 0x2E, 0x2E, 
+    0x20, 0x74, 0x3A, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x5C, 0x22, 0x22, 0x2C, 0x20, 0x22, 0x5C, 0x5C, 0x5C, 0x22, 0x22, 
+    0x29, 0x3A, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x25, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x5C, 0x5C, 0x6E, 0x22, 0x29, 
+    0x20, 0x2E, 0x2E, 0x20, 0x27, 0x22, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x74, 0x61, 0x62, 
+    0x6C, 0x65, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 
+    0x22, 0x3C, 0x72, 0x6F, 0x6F, 0x74, 0x3E, 0x22, 0x2C, 0x20, 0x74, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x2C, 
+    0x20, 0x7B, 0x7D, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x65, 0x78, 0x74, 0x72, 
+    0x61, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x76, 0x65, 0x63, 0x32, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x6D, 
+    0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 
+    0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x76, 0x65, 0x63, 0x33, 0x28, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 
+    0x6D, 0x28, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x29, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 
+    0x61, 0x6E, 0x64, 0x76, 0x65, 0x63, 0x34, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x2C, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 
+    0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 
+    0x6F, 0x6D, 0x28, 0x29, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6D, 0x61, 0x74, 0x68, 0x2E, 0x73, 0x69, 0x67, 0x6E, 0x28, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6E, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x20, 0x6F, 0x72, 0x20, 0x6E, 
+    0x20, 0x3C, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2D, 0x31, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2F, 0x6D, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x73, 
+    0x74, 0x75, 0x66, 0x66, 0x0A, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x76, 0x65, 
+    0x63, 0x32, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x76, 0x65, 0x63, 0x32, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 
+    0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x33, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x76, 0x65, 0x63, 0x33, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x76, 0x65, 
+    0x63, 0x34, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x76, 0x65, 0x63, 0x34, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 
+    0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6D, 0x61, 0x74, 0x32, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x6D, 0x61, 0x74, 0x32, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6D, 0x61, 
+    0x74, 0x33, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x74, 0x33, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 
+    0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6D, 0x61, 0x74, 0x34, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x6D, 0x61, 0x74, 0x34, 0x29, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x71, 0x75, 
+    0x61, 0x74, 0x22, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x71, 0x75, 0x61, 0x74, 0x29, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x6E, 
+    0x75, 0x6D, 0x28, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20, 
+    0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x22, 0x25, 0x2E, 0x31, 
+    0x36, 0x67, 0x22, 0x2C, 0x20, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 
+    0x3D, 0x20, 0x22, 0x2D, 0x30, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x22, 0x30, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
+    0x5F, 0x76, 0x65, 0x63, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x20, 
+    0x3D, 0x20, 0x23, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 
+    0x20, 0x22, 0x76, 0x65, 0x63, 0x22, 0x2E, 0x2E, 0x6E, 0x2E, 0x2E, 0x22, 0x28, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
+    0x5F, 0x6E, 0x75, 0x6D, 0x28, 0x76, 0x5B, 0x69, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x69, 0x20, 0x3D, 0x3D, 0x20, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x29, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x2C, 0x20, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x61, 0x29, 0x2E, 
+    0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x62, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x5F, 0x6D, 
+    0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 
+    0x63, 0x32, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x5F, 0x76, 0x65, 0x63, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 
+    0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 0x63, 0x33, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x76, 0x65, 0x63, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 
+    0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 0x63, 0x34, 
+    0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
+    0x5F, 0x76, 0x65, 0x63, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 
+    0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 0x63, 0x32, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 
+    0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x5F, 0x6D, 0x65, 
+    0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 0x63, 
+    0x33, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
+    0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x76, 0x65, 0x63, 0x34, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 
+    0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 
+    0x74, 0x5F, 0x6D, 0x61, 0x74, 0x28, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 
+    0x20, 0x3D, 0x20, 0x23, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x6F, 0x77, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x7B, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x20, 0x64, 
+    0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x6E, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x28, 0x6D, 0x5B, 0x63, 0x6F, 0x6C, 0x5D, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x23, 0x73, 0x74, 0x72, 0x20, 0x3E, 0x20, 0x72, 0x6F, 0x77, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x77, 0x69, 0x64, 0x74, 0x68, 0x5B, 
+    0x72, 0x6F, 0x77, 0x5D, 0x20, 0x3D, 0x20, 0x23, 0x73, 0x74, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 
+    0x72, 0x20, 0x3D, 0x20, 0x22, 0x6D, 0x61, 0x74, 0x22, 0x2E, 0x2E, 0x6E, 0x2E, 0x2E, 0x22, 0x28, 0x22, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x20, 0x64, 0x6F, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x31, 0x2C, 
+    0x20, 0x6E, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x66, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x25, 0x22, 0x2E, 0x2E, 0x72, 0x6F, 0x77, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x2E, 0x2E, 0x22, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x66, 0x6D, 0x74, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x5F, 0x6E, 0x75, 0x6D, 0x28, 0x6D, 0x5B, 0x63, 0x6F, 0x6C, 0x5D, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x29, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x6F, 0x77, 0x20, 
+    0x7E, 0x3D, 0x20, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x2C, 0x20, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x3D, 0x20, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x29, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x2C, 
+    0x5C, 0x6E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x73, 0x74, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 0x61, 0x74, 0x32, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x6D, 0x61, 0x74, 0x0A, 0x5F, 0x6D, 
+    0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 0x61, 
+    0x74, 0x33, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x5F, 0x6D, 0x61, 0x74, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 
+    0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 0x61, 0x74, 0x34, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x6D, 0x61, 0x74, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 
+    0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 0x61, 0x74, 
+    0x32, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
+    0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 
+    0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 0x61, 0x74, 0x33, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 
+    0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x5F, 
+    0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x6D, 
+    0x61, 0x74, 0x34, 0x2E, 0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x71, 0x75, 0x61, 0x74, 0x28, 0x71, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x22, 0x71, 0x75, 0x61, 0x74, 0x28, 0x22, 0x2E, 
+    0x2E, 0x71, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x2E, 0x2E, 0x22, 0x2C, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x28, 0x71, 0x2E, 0x61, 0x78, 0x69, 0x73, 0x29, 0x2E, 0x2E, 0x22, 0x29, 0x22, 0x3B, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 
+    0x74, 0x72, 0x79, 0x2E, 0x71, 0x75, 0x61, 0x74, 0x2E, 0x5F, 0x5F, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 
+    0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x71, 0x75, 0x61, 0x74, 0x0A, 0x0A, 0x5F, 0x6D, 0x65, 0x74, 0x61, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x2E, 0x71, 0x75, 0x61, 0x74, 0x2E, 
+    0x5F, 0x5F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 
+    0x6F, 0x6E, 0x63, 0x61, 0x74, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x62, 0x75, 0x69, 0x6C, 
+    0x74, 0x69, 0x6E, 0x73, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 
+    0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 
+    0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 
+    0x61, 0x78, 0x5F, 0x6C, 0x6F, 0x67, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x30, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5F, 0x6C, 0x6F, 0x67, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x67, 0x28, 
+    0x66, 0x6D, 0x74, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6D, 0x73, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x6D, 0x74, 0x29, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2E, 0x2E, 0x2E, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x61, 0x72, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x61, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 0x22, 0x23, 0x22, 0x2C, 
+    0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x72, 0x67, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x28, 
+    0x61, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x61, 0x72, 0x67, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x75, 0x73, 0x65, 
+    0x72, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x67, 0x20, 0x3D, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x28, 0x61, 0x72, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x61, 0x72, 0x67, 0x73, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6D, 0x73, 0x67, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 
+    0x66, 0x6D, 0x74, 0x2C, 0x20, 0x75, 0x6E, 0x70, 0x61, 0x63, 0x6B, 0x28, 0x61, 0x72, 0x67, 0x73, 0x29, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x73, 0x67, 0x20, 
+    0x3D, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x66, 0x6D, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 
+    0x3D, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2E, 0x67, 0x65, 0x74, 0x69, 0x6E, 0x66, 0x6F, 0x28, 0x32, 0x2C, 0x20, 0x22, 
+    0x53, 0x6C, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 
+    0x2E, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x73, 0x72, 0x63, 0x2E, 0x2E, 0x22, 0x3A, 0x22, 0x2E, 0x2E, 0x69, 0x6E, 0x66, 
+    0x6F, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0x2E, 0x22, 0x3A, 0x20, 0x22, 0x2E, 
+    0x2E, 0x6D, 0x73, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 
+    0x6C, 0x6F, 0x67, 0x28, 0x6D, 0x73, 0x67, 0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x67, 0x20, 
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x66, 0x20, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x73, 0x6B, 0x74, 0x6F, 0x70, 0x20, 0x73, 
+    0x79, 0x73, 0x74, 0x65, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x6C, 0x61, 0x74, 
+    0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x22, 0x20, 
+    0x6F, 0x72, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x75, 0x78, 0x22, 0x20, 0x6F, 
+    0x72, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6F, 0x73, 0x78, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x69, 
+    0x6F, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x61, 0x6D, 0x2E, 0x61, 0x70, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x5F, 0x64, 
+    0x69, 0x72, 0x2E, 0x2E, 0x22, 0x6C, 0x6F, 0x67, 0x2E, 0x74, 0x78, 0x74, 0x22, 0x2C, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 
+    0x5F, 0x6C, 0x6F, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x22, 0x77, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x61, 0x22, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x6D, 
+    0x73, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x77, 0x72, 
+    0x69, 0x74, 0x65, 0x28, 0x22, 0x5C, 0x6E, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x3A, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 
+    0x69, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 
+    0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 
+    0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5F, 0x74, 0x65, 
+    0x73, 0x74, 0x28, 0x22, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x22, 0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x50, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 
+    0x28, 0x30, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x29, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 
+    0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x30, 0x2C, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 
+    0x63, 0x74, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 
+    0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x74, 
+    0x65, 0x78, 0x74, 0x28, 0x22, 0x22, 0x2C, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x31, 0x29, 0x2C, 0x20, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 
+    0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x69, 0x6E, 0x3A, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 
+    0x28, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x50, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 
+    0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 0x30, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 
+    0x61, 0x74, 0x65, 0x22, 0x2E, 0x79, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 
+    0x74, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x2E, 
+    0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 
+    0x61, 0x79, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 
+    0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x6C, 0x6F, 0x67, 0x5F, 
+    0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x2C, 0x20, 0x6D, 0x73, 0x67, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x23, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 
+    0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x6C, 
+    0x6F, 0x67, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x6C, 0x6F, 0x67, 
+    0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 
+    0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x6C, 0x6F, 
+    0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x23, 0x6C, 
+    0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 
+    0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x2E, 0x22, 0x5C, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x74, 0x20, 0x3D, 
+    0x20, 0x6C, 0x6F, 0x67, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x72, 0x65, 
+    0x63, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x74, 0x2E, 0x78, 0x32, 0x20, 
+    0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x74, 0x2E, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x2D, 0x74, 0x65, 0x78, 
+    0x74, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5F, 0x6C, 0x6F, 0x67, 0x20, 0x3D, 0x20, 0x66, 
+    0x61, 0x6C, 0x73, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x5F, 0x47, 0x2C, 0x20, 
+    0x22, 0x6C, 0x6F, 0x67, 0x22, 0x2C, 0x20, 0x6C, 0x6F, 0x67, 0x29, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x67, 0x31, 0x28, 0x66, 0x6D, 0x74, 0x2C, 0x20, 0x2E, 0x2E, 
+    0x2E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x6D, 0x74, 0x29, 0x20, 
+    0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x2E, 0x2E, 0x2E, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x67, 0x28, 
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x66, 0x6D, 0x74, 0x2C, 0x20, 0x2E, 
+    0x2E, 0x2E, 0x29, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x67, 0x28, 0x74, 0x6F, 
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x66, 0x6D, 0x74, 0x29, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x32, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 
+    0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6C, 0x6F, 0x67, 0x31, 0x22, 0x2C, 0x20, 0x6C, 0x6F, 0x67, 0x31, 0x29, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x67, 0x6C, 0x6F, 
+    0x62, 0x61, 0x6C, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x28, 0x5F, 0x47, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x74, 0x2C, 0x20, 
+    0x6B, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 
+    0x28, 0x22, 0x61, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 
+    0x63, 0x65, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x22, 0x2E, 
+    0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x6B, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5F, 0x5F, 
+    0x6E, 0x65, 0x77, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x74, 0x2C, 0x20, 0x6B, 0x2C, 0x20, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x61, 0x74, 0x74, 0x65, 0x6D, 0x70, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x73, 
+    0x65, 0x74, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x28, 0x6B, 0x29, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 
+    0x28, 0x5F, 0x47, 0x2C, 0x20, 0x22, 0x6E, 0x6F, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x73, 0x22, 0x2C, 0x20, 0x6E, 0x6F, 
+    0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0};
+
+static const uint8_t data9[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 
+    0x61, 0x64, 0x65, 0x72, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 
+    0x64, 0x65, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
+    0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 
+    0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 
+    0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 
+    0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x6F, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x74, 0x2E, 0x7A, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 
+    0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
+    0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 
+    0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 
+    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 
+    0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x76, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
+    0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 
+    0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x76, 0x2C, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 
+    0x68, 0x61, 0x64, 0x65, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 
+    0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x5F, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 
+    0x65, 0x78, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 
+    0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 
+    0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 
+    0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x5F, 0x73, 
+    0x63, 0x61, 0x6C, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 
+    0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x20, 0x3D, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x2A, 0x20, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x2B, 0x20, 0x75, 0x76, 0x5F, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 
+    0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x72, 0x74, 0x2E, 0x7A, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 
+    0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 
+    0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 
+    0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 
+    0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x29, 0x20, 0x2A, 0x20, 0x76, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 
+    0x65, 0x78, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x76, 0x2C, 0x20, 0x66, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x2D, 0x2D, 0x20, 0x47, 0x50, 0x55, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 
+    0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6B, 0x65, 0x70, 0x74, 
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 
+    0x65, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0A, 0x2D, 0x2D, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x79, 0x20, 0x72, 
+    0x65, 0x6E, 0x64, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x65, 0x63, 0x6F, 
+    0x6E, 0x64, 0x20, 0x70, 0x61, 0x69, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x0A, 
+    0x2D, 0x2D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x77, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 
+    0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x41, 0x20, 0x68, 0x6F, 0x6C, 
+    0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x76, 0x65, 0x6C, 0x6F, 0x63, 0x69, 0x74, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x2D, 0x2D, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x20, 0x42, 0x20, 0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 
+    0x2D, 0x74, 0x6F, 0x2D, 0x6C, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 
+    0x6C, 0x69, 0x66, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x73, 0x65, 
+    0x65, 0x64, 0x0A, 0x2D, 0x2D, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 
+    0x20, 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x64, 0x65, 0x72, 0x69, 0x76, 
+    0x65, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x27, 0x73, 0x20, 0x73, 
+    0x69, 0x7A, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x0A, 0x2D, 0x2D, 0x20, 0x41, 0x20, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x61, 0x64, 0x20, 0x69, 0x66, 0x20, 
+    0x69, 0x74, 0x73, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2D, 0x74, 0x6F, 0x2D, 0x6C, 0x69, 0x76, 0x65, 0x20, 0x69, 0x73, 0x20, 
+    0x7A, 0x65, 0x72, 0x6F, 0x20, 0x6F, 0x72, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x2E, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x67, 0x70, 0x75, 0x5F, 0x68, 0x61, 0x73, 0x68, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, 
+    0x70, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x33, 
+    0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x76, 0x65, 0x63, 0x33, 0x28, 0x70, 0x2E, 0x78, 0x79, 0x78, 0x29, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x30, 0x33, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x70, 0x33, 0x20, 0x2B, 0x3D, 0x20, 0x64, 0x6F, 0x74, 0x28, 0x70, 0x33, 0x2C, 0x20, 0x70, 0x33, 0x2E, 0x79, 0x7A, 0x78, 
+    0x20, 0x2B, 0x20, 0x33, 0x33, 0x2E, 0x33, 0x33, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x28, 0x28, 0x70, 0x33, 0x2E, 0x78, 0x20, 0x2B, 0x20, 
+    0x70, 0x33, 0x2E, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x70, 0x33, 0x2E, 0x7A, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 
+    0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 
+    0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 0x6F, 0x75, 0x74, 
+    0x70, 0x75, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 
+    0x72, 0x73, 0x5B, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 
+    0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x73, 0x5B, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 
+    0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 
+    0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 
+    0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 
+    0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x5F, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
+    0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 
+    0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x64, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x65, 
+    0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+    0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 
+    0x65, 0x5F, 0x70, 0x6F, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
+    0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 
+    0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x67, 0x6C, 0x65, 
+    0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x70, 0x65, 
+    0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6C, 0x69, 
+    0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+    0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x2E, 0x2E, 0x67, 0x70, 0x75, 
+    0x5F, 0x68, 0x61, 0x73, 0x68, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x2E, 0x2E, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x20, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x61, 0x73, 0x68, 0x28, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 
+    0x43, 0x6F, 0x6F, 0x72, 0x64, 0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x65, 0x65, 0x64, 
+    0x2C, 0x20, 0x6B, 0x20, 0x2A, 0x20, 0x31, 0x37, 0x2E, 0x30, 0x29, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 
+    0x20, 0x31, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x20, 0x3D, 0x20, 
+    0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x2E, 0x78, 0x79, 0x20, 0x2F, 0x20, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x61, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 
+    0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x2C, 0x20, 0x75, 0x76, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x2C, 0x20, 0x75, 0x76, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 
+    0x6F, 0x6F, 0x72, 0x64, 0x2E, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 
+    0x2E, 0x78, 0x20, 0x2B, 0x20, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 
+    0x6F, 0x72, 0x64, 0x2E, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x2F, 0x2F, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x67, 0x6F, 0x20, 
+    0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x64, 0x20, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x5B, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x2C, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x2B, 0x20, 0x73, 0x70, 0x61, 0x77, 
+    0x6E, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x29, 0x2C, 0x20, 0x77, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x61, 
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x20, 0x72, 0x69, 0x6E, 0x67, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x6F, 0x64, 0x28, 0x69, 
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x2D, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x2B, 
+    0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x2E, 0x78, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x26, 
+    0x26, 0x20, 0x72, 0x69, 0x6E, 0x67, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3C, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x63, 
+    0x6F, 0x75, 0x6E, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x74, 0x74, 0x6C, 0x20, 0x3D, 0x20, 0x6C, 0x69, 0x66, 0x65, 
+    0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x6C, 
+    0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 
+    0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x33, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x73, 
+    0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x61, 0x6E, 
+    0x67, 0x6C, 0x65, 0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x34, 0x2E, 0x30, 0x29, 0x20, 
+    0x2A, 0x20, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x78, 0x79, 0x20, 0x3D, 0x20, 0x73, 0x6F, 0x75, 0x72, 
+    0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x2B, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 
+    0x61, 0x72, 0x28, 0x31, 0x2E, 0x30, 0x29, 0x2C, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x32, 0x2E, 
+    0x30, 0x29, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 
+    0x7A, 0x77, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x63, 0x6F, 0x73, 0x28, 0x61, 0x6E, 0x67, 0x29, 0x2C, 0x20, 
+    0x73, 0x69, 0x6E, 0x28, 0x61, 0x6E, 0x67, 0x29, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 
+    0x74, 0x74, 0x6C, 0x2C, 0x20, 0x74, 0x74, 0x6C, 0x2C, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x35, 
+    0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 
+    0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x2E, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 
+    0x67, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x2A, 0x20, 0x64, 0x74, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x2E, 0x78, 0x20, 0x2D, 0x3D, 
+    0x20, 0x64, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x61, 0x2E, 0x78, 0x79, 0x20, 0x2B, 0x3D, 0x20, 0x64, 0x74, 0x20, 0x2A, 0x20, 0x28, 0x61, 0x2E, 0x7A, 0x77, 0x20, 
+    0x2B, 0x20, 0x67, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x2E, 0x7A, 0x77, 0x20, 0x3D, 0x20, 0x28, 0x61, 0x2E, 0x7A, 0x77, 
+    0x20, 0x2B, 0x20, 0x67, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x61, 0x6D, 0x70, 0x69, 
+    0x6E, 0x67, 0x20, 0x2A, 0x20, 0x64, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 
+    0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x5D, 0x5D, 0x2E, 0x2E, 0x6F, 0x75, 0x74, 0x70, 0x75, 
+    0x74, 0x2E, 0x2E, 0x5B, 0x5B, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 
+    0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 0x6F, 
+    0x75, 0x74, 0x70, 0x75, 0x74, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 
+    0x76, 0x2C, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 
+    0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 
+    0x70, 0x75, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 
+    0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 0x74, 
+    0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74, 
+    0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 
+    0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x64, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 
+    0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 
+    0x65, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 
+    0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 
+    0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x5F, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 
+    0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 
+    0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x65, 0x6E, 
+    0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x63, 
+    0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 
+    0x63, 0x34, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x20, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x63, 0x68, 0x61, 0x6E, 
+    0x67, 0x65, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
+    0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 
+    0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 
+    0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x2E, 0x2E, 0x67, 0x70, 
+    0x75, 0x5F, 0x68, 0x61, 0x73, 0x68, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x2E, 0x2E, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6B, 0x29, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x68, 0x61, 0x73, 0x68, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x65, 0x65, 0x64, 0x20, 0x2A, 0x20, 0x34, 0x30, 
+    0x39, 0x36, 0x2E, 0x30, 0x2C, 0x20, 0x6B, 0x20, 0x2A, 0x20, 0x31, 0x37, 0x2E, 0x30, 0x29, 0x29, 0x20, 0x2A, 0x20, 0x32, 
+    0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 
+    0x72, 0x34, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+    0x20, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x73, 
+    0x65, 0x65, 0x64, 0x2C, 0x20, 0x6B, 0x29, 0x2C, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x73, 0x65, 
+    0x65, 0x64, 0x2C, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x73, 
+    0x65, 0x65, 0x64, 0x2C, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x32, 0x2E, 0x30, 0x29, 0x2C, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 
+    0x76, 0x61, 0x72, 0x28, 0x73, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x33, 0x2E, 0x30, 0x29, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 
+    0x6F, 0x72, 0x28, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 
+    0x2F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x28, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x2D, 0x20, 0x72, 0x6F, 0x77, 0x20, 
+    0x2A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x78, 0x2C, 0x20, 0x72, 0x6F, 0x77, 0x29, 
+    0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x2F, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x61, 
+    0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 
+    0x2C, 0x20, 0x75, 0x76, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x5F, 0x62, 0x2C, 0x20, 0x75, 0x76, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x62, 0x2E, 0x7A, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+    0x74, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x62, 0x2E, 0x78, 0x20, 
+    0x2F, 0x20, 0x6D, 0x61, 0x78, 0x28, 0x62, 0x2E, 0x79, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x31, 0x29, 0x2C, 0x20, 
+    0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x30, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x73, 
+    0x65, 0x65, 0x64, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 
+    0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x31, 0x20, 0x3D, 0x20, 0x6D, 0x69, 0x78, 0x28, 0x73, 0x69, 
+    0x7A, 0x65, 0x30, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 
+    0x5F, 0x76, 0x61, 0x72, 0x28, 0x73, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x65, 0x6E, 
+    0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x63, 0x68, 0x61, 
+    0x6E, 0x67, 0x65, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x30, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x34, 0x28, 0x73, 0x65, 0x65, 
+    0x64, 0x2C, 0x20, 0x32, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x5F, 0x76, 0x61, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x31, 0x20, 0x3D, 0x20, 0x6D, 0x69, 0x78, 0x28, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x30, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x2B, 0x20, 0x72, 0x61, 0x6E, 
+    0x64, 0x5F, 0x76, 0x61, 0x72, 0x34, 0x28, 0x73, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x36, 0x2E, 0x30, 0x29, 0x20, 0x2A, 0x20, 
+    0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x62, 0x2E, 0x78, 0x20, 
+    0x3C, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x3F, 0x20, 0x30, 0x2E, 0x30, 0x20, 0x3A, 0x20, 0x6D, 0x69, 0x78, 0x28, 0x73, 
+    0x69, 0x7A, 0x65, 0x30, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x31, 0x2C, 0x20, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6D, 
+    0x69, 0x78, 0x28, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x30, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x31, 0x2C, 0x20, 0x74, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x20, 
+    0x3D, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x2A, 0x20, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x2B, 0x20, 0x75, 0x76, 0x5F, 0x6F, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 
+    0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 
+    0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x61, 0x2E, 0x78, 0x79, 0x20, 0x2B, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x20, 0x2A, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x20, 
+    0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 
+    0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 
+    0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 
+    0x6C, 0x61, 0x6D, 0x70, 0x28, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 
+    0x76, 0x5F, 0x75, 0x76, 0x29, 0x20, 0x2A, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+    0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 
+    0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 
+    0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 
+    0x70, 0x28, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x5D, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 
+    0x72, 0x73, 0x5B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x72, 
+    0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x76, 0x2C, 0x20, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x73, 
+    0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x64, 0x5D, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x2F, 0x72, 0x65, 0x73, 0x65, 0x74, 0x0A, 0x2D, 0x2D, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x73, 
+    0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x73, 0x2E, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x32, 0x64, 0x28, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x20, 
+    0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x67, 0x70, 0x75, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x75, 0x70, 
+    0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x28, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x6D, 
+    0x61, 0x74, 0x68, 0x2E, 0x6D, 0x69, 0x6E, 0x28, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x2C, 0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x63, 0x65, 0x69, 0x6C, 0x28, 0x6D, 0x61, 
+    0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x2F, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x32, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x65, 0x78, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2C, 0x20, 0x22, 0x66, 0x6C, 0x6F, 0x61, 
+    0x74, 0x22, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 
+    0x5F, 0x62, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2C, 0x20, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x22, 
+    0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x6B, 0x5F, 0x61, 0x2C, 0x20, 0x66, 0x62, 0x5F, 0x61, 0x20, 0x3D, 0x20, 
+    0x70, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x6D, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+    0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x6B, 0x5F, 0x62, 0x2C, 0x20, 0x66, 0x62, 0x5F, 0x62, 0x20, 
+    0x3D, 0x20, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x6D, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x62, 0x75, 0x66, 0x66, 
+    0x65, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x28, 0x6F, 0x6B, 0x5F, 0x61, 0x20, 0x61, 0x6E, 
+    0x64, 0x20, 0x6F, 0x6B, 0x5F, 0x62, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x2E, 0x66, 0x62, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x66, 0x62, 0x5F, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66, 0x62, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x66, 0x62, 0x5F, 0x62, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 
+    0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x20, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x64, 
+    0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 
+    0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x73, 
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 
+    0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 
+    0x74, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 
+    0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x28, 0x2D, 0x31, 0x2C, 
+    0x20, 0x2D, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 
+    0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x31, 0x5D, 
+    0x2E, 0x74, 0x65, 0x78, 0x5F, 0x61, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x65, 0x78, 0x5F, 
+    0x62, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x30, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 
+    0x74, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 
+    0x65, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 
+    0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 
+    0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 
+    0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 
+    0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 
+    0x28, 0x22, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 
+    0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x61, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x5E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x6C, 0x65, 0x6E, 0x64, 0x28, 0x22, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x67, 0x65, 0x74, 
+    0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x62, 0x22, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 
+    0x3D, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x73, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x61, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x31, 
+    0x5D, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x62, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 
+    0x74, 0x65, 0x70, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x72, 0x63, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x63, 0x75, 
+    0x72, 0x72, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x73, 
+    0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5B, 0x33, 0x20, 0x2D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 
+    0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x61, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 
+    0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x62, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 
+    0x2E, 0x64, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x72, 0x6E, 0x64, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x31, 0x30, 0x30, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x20, 0x3D, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x5F, 0x63, 
+    0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 
+    0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x20, 
+    0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x6F, 0x75, 
+    0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 
+    0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 
+    0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x70, 0x65, 
+    0x65, 0x64, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 
+    0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 
+    0x2E, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x6C, 0x69, 0x66, 
+    0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 
+    0x2E, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x67, 0x72, 0x61, 0x76, 0x69, 
+    0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 
+    0x6E, 0x64, 0x2E, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x64, 0x61, 0x6D, 
+    0x70, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x2E, 0x66, 0x62, 0x5F, 
+    0x61, 0x3A, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x28, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x2E, 0x66, 0x62, 0x5F, 0x62, 0x3A, 0x72, 0x65, 0x6E, 0x64, 
+    0x65, 0x72, 0x28, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x20, 0x3D, 0x20, 0x28, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x73, 
+    0x6C, 0x6F, 0x74, 0x20, 0x2B, 0x20, 0x6E, 0x29, 0x20, 0x25, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x20, 0x3D, 0x20, 
+    0x33, 0x20, 0x2D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 
+    0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x20, 0x3D, 0x20, 0x64, 0x73, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x61, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 
+    0x20, 0x3D, 0x20, 0x64, 0x73, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x5F, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x75, 
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x64, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x20, 0x3E, 
+    0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2F, 0x20, 0x73, 0x79, 
+    0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 
+    0x20, 0x3D, 0x20, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x2B, 0x20, 0x64, 0x74, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 
+    0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 
+    0x20, 0x2F, 0x20, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x65, 0x6D, 0x69, 
+    0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x2D, 0x20, 0x6E, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x6C, 0x61, 
+    0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x20, 0x3D, 0x20, 0x6D, 0x61, 
+    0x74, 0x68, 0x2E, 0x6D, 0x69, 0x6E, 0x28, 0x6E, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 
+    0x6C, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 
+    0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x6E, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x2E, 0x66, 0x62, 0x5F, 0x61, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x66, 0x62, 0x5F, 0x62, 0x3A, 0x63, 0x6C, 0x65, 
+    0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6D, 0x69, 0x74, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x30, 0x2C, 0x20, 0x6E, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x2D, 0x2D, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x78, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 
+    0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x20, 0x74, 0x68, 
+    0x61, 0x74, 0x20, 0x64, 0x72, 0x61, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x3A, 
+    0x62, 0x69, 0x6E, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 
+    0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x79, 
+    0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 
+    0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 
+    0x65, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x72, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 
+    0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x63, 0x68, 
+    0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x73, 
+    0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 
+    0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x65, 
+    0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x2E, 0x65, 0x6E, 0x64, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x31, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 
+    0x65, 0x5F, 0x70, 0x6F, 0x73, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
+    0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 
+    0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x5F, 
+    0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x67, 
+    0x6C, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 
+    0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x69, 0x66, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 
+    0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6D, 0x69, 0x73, 0x73, 
+    0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x77, 0x61, 0x72, 0x6D, 0x75, 0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x70, 0x75, 
+    0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x65, 0x64, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x28, 0x6F, 0x70, 
+    0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 
+    0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x6D, 0x61, 0x78, 0x5F, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x30, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x6C, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x3E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 
+    0x63, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 
+    0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x69, 0x66, 
+    0x65, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3E, 0x3D, 0x20, 0x6C, 0x69, 
+    0x66, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x69, 0x66, 0x65, 
+    0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x2D, 0x20, 0x30, 0x2E, 0x30, 0x30, 0x31, 0x20, 
+    0x2D, 0x2D, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x20, 0x74, 0x69, 0x6D, 0x65, 
+    0x2D, 0x74, 0x6F, 0x2D, 0x6C, 0x69, 0x76, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x2D, 0x2D, 0x20, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x65, 0x64, 0x20, 0x69, 0x73, 
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x73, 0x65, 0x65, 
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x77, 0x69, 0x74, 
+    0x68, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x73, 0x65, 0x65, 0x64, 0x20, 0x6D, 0x61, 
+    0x6B, 0x65, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 
+    0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x65, 0x65, 0x64, 0x20, 0x6F, 
+    0x72, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 
+    0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x20, 0x5E, 0x20, 0x33, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 
+    0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 
+    0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+    0x6A, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 
+    0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 
+    0x6B, 0x20, 0x2B, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 
+    0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x33, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 
+    0x3D, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 
+    0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x20, 0x3D, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x33, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x36, 
+    0x5D, 0x20, 0x3D, 0x20, 0x6B, 0x20, 0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x20, 0x3D, 0x20, 
+    0x6B, 0x20, 0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x2A, 0x20, 0x34, 0x20, 
+    0x3C, 0x20, 0x32, 0x20, 0x5E, 0x20, 0x31, 0x36, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x68, 
+    0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x69, 0x63, 
+    0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 
+    0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6D, 0x61, 
+    0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x2D, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 
+    0x32, 0x28, 0x2D, 0x31, 0x2C, 0x20, 0x2D, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x66, 
+    0x66, 0x73, 0x65, 0x74, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 
+    0x31, 0x2C, 0x20, 0x2D, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x31, 0x2C, 0x20, 
+    0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x34, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x76, 0x65, 0x63, 0x32, 
+    0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 
+    0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x31, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 
+    0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x73, 0x32, 0x20, 0x2D, 0x20, 0x73, 0x70, 
+    0x72, 0x69, 0x74, 0x65, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x32, 0x20, 0x2D, 
+    0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x79, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x67, 0x70, 0x75, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x67, 
+    0x70, 0x75, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x28, 0x6D, 0x61, 0x78, 0x5F, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x79, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 
+    0x6C, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x20, 0x2A, 0x20, 0x34, 0x20, 0x2D, 0x20, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x5B, 0x6A, 0x20, 0x2B, 0x20, 0x31, 
+    0x5D, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x6A, 0x20, 0x2F, 0x20, 0x34, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x66, 0x6C, 0x6F, 0x61, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 
+    0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x2D, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 
+    0x20, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x61, 0x69, 0x67, 0x68, 0x74, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x62, 0x75, 0x66, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x61, 0x6D, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x2E, 0x63, 0x70, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 
+    0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x2A, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x32, 0x20, 0x2B, 0x20, 
+    0x31, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 
+    0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x62, 0x75, 0x66, 0x2E, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x3D, 
+    0x20, 0x22, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x62, 0x75, 0x66, 0x3A, 0x76, 0x69, 
+    0x65, 0x77, 0x28, 0x22, 0x76, 0x65, 0x63, 0x33, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x76, 0x69, 0x65, 0x77, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x62, 0x75, 0x66, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x76, 0x65, 0x63, 0x34, 
+    0x22, 0x2C, 0x20, 0x31, 0x32, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 
+    0x65, 0x73, 0x32, 0x64, 0x28, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x2C, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x70, 0x75, 0x20, 0x3D, 0x20, 0x70, 
+    0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x76, 0x69, 0x65, 0x77, 0x20, 0x7E, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5F, 0x6F, 0x70, 0x74, 0x28, 0x76, 0x2C, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
+    0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x76, 0x2E, 0x78, 0x2C, 0x20, 0x76, 0x2E, 0x79, 0x29, 0x20, 0x6F, 
+    0x72, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5F, 0x6F, 0x70, 0x74, 0x28, 0x76, 0x2C, 0x20, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x76, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x2E, 0x72, 0x2C, 0x20, 0x76, 
+    0x2E, 0x67, 0x2C, 0x20, 0x76, 0x2E, 0x62, 0x2C, 0x20, 0x76, 0x2E, 0x61, 0x29, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x5F, 0x6F, 0x70, 0x74, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
+    0x5F, 0x70, 0x6F, 0x73, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 
+    0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5F, 0x6F, 
+    0x70, 0x74, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 
+    0x61, 0x72, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 
+    0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x32, 0x30, 0x29, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 
+    0x20, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 
+    0x72, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6F, 
+    0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+    0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 
+    0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 
+    0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x29, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 
+    0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 
+    0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 
+    0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 
+    0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x6F, 0x72, 
+    0x20, 0x31, 0x30, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 
+    0x61, 0x72, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x20, 
+    0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x3D, 0x20, 
+    0x6C, 0x69, 0x66, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 
+    0x72, 0x20, 0x3D, 0x20, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 
+    0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5F, 
+    0x6F, 0x70, 0x74, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5F, 0x6F, 0x70, 0x74, 0x28, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 
+    0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x5F, 0x6F, 0x70, 0x74, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5F, 0x6F, 0x70, 
+    0x74, 0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 
+    0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 
+    0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x35, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 
+    0x73, 0x2E, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5F, 0x6F, 0x70, 0x74, 
+    0x28, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 
+    0x2E, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x70, 0x75, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3D, 0x20, 
+    0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x67, 0x70, 0x75, 0x5F, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x7E, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 
+    0x3D, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 
+    0x61, 0x64, 0x65, 0x72, 0x5F, 0x74, 0x65, 0x78, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 
+    0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x5F, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x76, 0x69, 0x65, 
+    0x77, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x72, 
+    0x69, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 
+    0x72, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 
+    0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x67, 0x70, 0x75, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x20, 0x3D, 
+    0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 
+    0x65, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x75, 0x76, 0x5F, 0x6F, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x72, 
+    0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x5F, 
+    0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x73, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 
+    0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x75, 
+    0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x28, 0x62, 0x69, 0x6E, 
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x65, 0x6C, 
+    0x65, 0x6D, 0x73, 0x76, 0x69, 0x65, 0x77, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x64, 
+    0x72, 0x61, 0x77, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x64, 0x74, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x77, 0x2E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 
+    0x20, 0x73, 0x79, 0x73, 0x3A, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x64, 0x74, 0x29, 0x20, 0x2A, 0x20, 0x36, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x70, 0x75, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x62, 0x69, 0x6E, 0x64, 
+    0x5F, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x61, 0x6D, 0x2E, 0x64, 0x65, 
+    0x6C, 0x74, 0x61, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 
+    0x6E, 0x69, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x77, 0x2E, 0x63, 
+    0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x29, 0x20, 0x2A, 0x20, 0x36, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x67, 0x70, 0x75, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x3A, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x75, 
+    0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x64, 0x74, 0x20, 0x3D, 0x20, 0x31, 0x2F, 0x36, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x72, 0x6D, 0x75, 0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x6F, 
+    0x70, 0x74, 0x73, 0x2E, 0x77, 0x61, 0x72, 0x6D, 0x75, 0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x72, 0x6D, 0x75, 
+    0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x64, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x61, 0x72, 0x6D, 0x75, 0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 
+    0x20, 0x3D, 0x20, 0x77, 0x61, 0x72, 0x6D, 0x75, 0x70, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2D, 0x20, 0x64, 0x74, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 
+    0x65, 0x5F, 0x70, 0x6F, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x28, 0x70, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
+    0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x70, 0x2E, 0x78, 0x2C, 0x20, 0x70, 0x2E, 0x79, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 
+    0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 
+    0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 
+    0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x79, 0x73, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x70, 0x6F, 0x73, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x32, 0x28, 0x76, 0x2E, 0x78, 0x2C, 0x20, 0x76, 0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x74, 
+    0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 
+    0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 
+    0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 
+    0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x65, 0x6E, 
+    0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 
+    0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 
+    0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 
+    0x74, 0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x5F, 0x76, 
+    0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x61, 0x6E, 0x67, 
+    0x6C, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 
+    0x61, 0x6E, 0x67, 0x6C, 0x65, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 
+    0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 
+    0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x76, 0x61, 
+    0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x6E, 0x67, 
+    0x6C, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 
+    0x73, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 
+    0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x6C, 0x69, 0x66, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x6C, 0x69, 0x66, 0x65, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 0x66, 0x65, 0x5F, 
+    0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x6C, 0x69, 0x66, 0x65, 0x5F, 0x76, 
+    0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x6C, 0x69, 
+    0x66, 0x65, 0x5F, 0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 
+    0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x28, 0x76, 0x2E, 0x72, 0x2C, 0x20, 0x76, 0x2E, 0x67, 0x2C, 0x20, 0x76, 0x2E, 0x62, 0x2C, 0x20, 0x76, 0x2E, 0x61, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 0x72, 0x74, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 
+    0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x2E, 0x72, 0x2C, 0x20, 0x76, 0x2E, 0x67, 0x2C, 0x20, 0x76, 
+    0x2E, 0x62, 0x2C, 0x20, 0x76, 0x2E, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x65, 
+    0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 
+    0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x2E, 0x72, 0x2C, 0x20, 0x76, 0x2E, 0x67, 
+    0x2C, 0x20, 0x76, 0x2E, 0x62, 0x2C, 0x20, 0x76, 0x2E, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 
+    0x74, 0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 
+    0x5F, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x61, 0x72, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 
+    0x76, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x2E, 0x72, 0x2C, 0x20, 0x76, 0x2E, 0x67, 0x2C, 
+    0x20, 0x76, 0x2E, 0x62, 0x2C, 0x20, 0x76, 0x2E, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 
+    0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 
+    0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x74, 0x65, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x65, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 
+    0x74, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x70, 0x61, 0x72, 0x74, 
+    0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x6D, 0x61, 0x78, 0x5F, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 
+    0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x67, 0x72, 
+    0x61, 0x76, 0x69, 0x74, 0x79, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x79, 0x73, 
+    0x2E, 0x67, 0x72, 0x61, 0x76, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x76, 0x2E, 0x78, 0x2C, 
+    0x20, 0x76, 0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x64, 0x61, 0x6D, 0x70, 
+    0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x73, 0x79, 0x73, 0x2E, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 
+    0x65, 0x74, 0x5F, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x28, 0x76, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x64, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x28, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 
+    0x72, 0x6F, 0x72, 0x28, 0x22, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 
+    0x69, 0x63, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x69, 
+    0x66, 0x20, 0x69, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 
+    0x69, 0x7A, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x22, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x70, 0x72, 
+    0x69, 0x74, 0x65, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x31, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x28, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x73, 0x32, 0x20, 0x2D, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 
+    0x65, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x32, 0x20, 0x2D, 0x20, 0x73, 0x70, 
+    0x72, 0x69, 0x74, 0x65, 0x2E, 0x74, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 
+    0x75, 0x76, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 0x20, 
+    0x75, 0x76, 0x5F, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x61, 
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x2E, 0x61, 0x63, 0x74, 
+    0x69, 0x76, 0x65, 0x5F, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 
+    0x67, 0x65, 0x74, 0x5F, 0x67, 0x70, 0x75, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x70, 0x75, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x72, 0x65, 0x73, 0x65, 0x74, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 
+    0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x73, 0x32, 0x64, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data10[] = {
+    0x2D, 0x2D, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x69, 0x6E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x0A, 
+    0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0A, 0x2D, 
+    0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x6E, 0x63, 0x69, 0x6C, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 
+    0x0A, 0x2D, 0x2D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 
+    0x28, 0x6F, 0x70, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x69, 
+    0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 
+    0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x5F, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x6F, 
+    0x70, 0x74, 0x73, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x72, 0x61, 0x63, 0x6B, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 
+    0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x2C, 0x20, 0x68, 
+    0x20, 0x3D, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 
+    0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 
+    0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 0x6F, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x20, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x69, 0x6E, 0x66, 
+    0x69, 0x6C, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x6F, 
+    0x70, 0x74, 0x73, 0x2E, 0x6D, 0x69, 0x6E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x6E, 0x65, 
+    0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 
+    0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 
+    0x72, 0x65, 0x32, 0x64, 0x28, 0x77, 0x2C, 0x20, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x2E, 0x6D, 
+    0x69, 0x6E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x6D, 0x69, 0x6E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x2E, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 
+    0x20, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x66, 0x62, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+    0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5F, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x2C, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x65, 0x6E, 0x63, 0x69, 0x6C, 0x5F, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x63, 0x6C, 
+    0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x62, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 
+    0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x2E, 
+    0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 
+    0x65, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x3D, 0x20, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6D, 0x2E, 0x73, 
+    0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x70, 0x72, 0x6F, 
+    0x67, 0x72, 0x61, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 
+    0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x20, 0x3D, 
+    0x20, 0x6D, 0x61, 0x74, 0x34, 0x28, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 
+    0x5F, 0x32, 0x64, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 
+    0x65, 0x63, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x28, 0x2D, 0x31, 0x2C, 0x20, 0x2D, 0x31, 0x2C, 
+    0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 
+    0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 
+    0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x77, 0x72, 0x61, 0x70, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x77, 0x72, 0x61, 0x70, 0x28, 0x6E, 0x6F, 0x64, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x3D, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x69, 0x6E, 
+    0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x3A, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x28, 0x29, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 
+    0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x70, 0x69, 
+    0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 
+    0x6F, 0x77, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x3A, 0x72, 0x65, 0x73, 0x69, 0x7A, 
+    0x65, 0x28, 0x77, 0x2C, 0x20, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 
+    0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 
+    0x6C, 0x65, 0x61, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x62, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x3A, 0x72, 0x65, 0x6E, 0x64, 
+    0x65, 0x72, 0x5F, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x28, 0x77, 0x72, 0x61, 0x70, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x66, 0x62, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x77, 0x72, 0x61, 0x70, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x28, 0x63, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x2E, 0x63, 0x6C, 0x65, 0x61, 
+    0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x67, 
+    0x65, 0x74, 0x5F, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 
+    0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 
+    0x61, 0x72, 0x28, 0x61, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 
+    0x73, 0x65, 0x74, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x3D, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x22, 
+    0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x3D, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x63, 
+    0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x62, 0x3A, 0x63, 0x6C, 
+    0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x72, 
+    0x61, 0x70, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x77, 0x72, 0x61, 0x70, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0};
+
+static const uint8_t data11[] = {
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x61, 0x76, 0x65, 0x5F, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 
+    0x6D, 0x61, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x6C, 0x75, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6C, 0x75, 0x61, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x22, 0x2E, 0x2E, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 
+    0x3D, 0x3D, 0x20, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x6F, 0x5F, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x66, 
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2C, 0x20, 0x32, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x70, 
+    0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x76, 0x61, 0x6C, 0x5F, 0x6A, 
+    0x73, 0x28, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x53, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x73, 0x65, 0x74, 0x49, 
+    0x74, 0x65, 0x6D, 0x28, 0x27, 0x22, 0x2E, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x2E, 0x22, 0x27, 0x2C, 0x27, 0x22, 0x2E, 
+    0x2E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x3A, 0x67, 0x73, 
+    0x75, 0x62, 0x28, 0x22, 0x25, 0x27, 0x22, 0x2C, 0x20, 0x22, 0x5C, 0x5C, 0x27, 0x22, 0x29, 0x3A, 0x67, 0x73, 0x75, 0x62, 
+    0x28, 0x22, 0x25, 0x5C, 0x6E, 0x22, 0x2C, 0x20, 0x22, 0x5C, 0x5C, 0x6E, 0x22, 0x29, 0x2E, 0x2E, 0x22, 0x27, 0x29, 0x3B, 
+    0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 
+    0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x69, 0x6F, 0x73, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x69, 0x6F, 0x73, 0x5F, 0x73, 0x74, 0x6F, 0x72, 0x65, 
+    0x5F, 0x70, 0x72, 0x65, 0x66, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x61, 0x70, 0x70, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x5F, 0x64, 0x69, 0x72, 0x2E, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x2E, 0x22, 0x2E, 0x73, 0x61, 0x76, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x2C, 0x20, 0x65, 0x72, 
+    0x72, 0x20, 0x3D, 0x20, 0x69, 0x6F, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 
+    0x2C, 0x20, 0x22, 0x77, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x77, 
+    0x72, 0x69, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x3A, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x67, 
+    0x28, 0x22, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x27, 0x25, 0x73, 0x27, 
+    0x5C, 0x6E, 0x25, 0x73, 0x22, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x74, 0x6F, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x65, 0x72, 0x72, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x28, 
+    0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x6D, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x6C, 0x75, 
+    0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x7E, 0x3D, 0x20, 
+    0x22, 0x6C, 0x75, 0x61, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x7E, 0x3D, 0x20, 
+    0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x2C, 0x20, 0x32, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6F, 0x6B, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x73, 0x74, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x70, 
+    0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x65, 0x76, 0x61, 0x6C, 0x5F, 0x6A, 0x73, 0x28, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x53, 0x74, 
+    0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6D, 0x28, 0x27, 0x22, 0x2E, 0x2E, 0x6E, 0x61, 
+    0x6D, 0x65, 0x2E, 0x2E, 0x22, 0x27, 0x29, 0x3B, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 
+    0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x69, 0x6F, 0x73, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x69, 0x6F, 0x73, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 0x70, 0x72, 0x65, 
+    0x66, 0x28, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x74, 0x72, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 
+    0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x69, 0x6F, 0x2E, 0x6F, 0x70, 0x65, 
+    0x6E, 0x28, 0x61, 0x6D, 0x2E, 0x61, 0x70, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x5F, 0x64, 0x69, 0x72, 0x2E, 0x2E, 0x6E, 
+    0x61, 0x6D, 0x65, 0x2E, 0x2E, 0x22, 0x2E, 0x73, 0x61, 0x76, 0x22, 0x2C, 0x20, 0x22, 0x72, 0x22, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x74, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x3A, 0x72, 0x65, 0x61, 0x64, 0x28, 0x22, 0x2A, 0x61, 0x22, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6C, 0x75, 0x61, 0x22, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x73, 0x74, 0x72, 0x29, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x2C, 
+    0x20, 0x65, 0x72, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5F, 0x6A, 0x73, 0x6F, 0x6E, 
+    0x28, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x72, 0x72, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 
+    0x67, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 
+    0x20, 0x22, 0x2E, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x2E, 0x22, 0x3A, 0x5C, 0x6E, 0x22, 0x2E, 0x2E, 0x65, 0x72, 0x72, 
+    0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6B, 
+    0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 
+    0x61, 0x74, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6F, 
+    0x6B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data12[] = {
+    0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x6D, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x5F, 
+    0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x74, 0x2E, 0x5F, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x20, 
+    0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x6D, 0x74, 0x20, 
+    0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 
+    0x6C, 0x65, 0x20, 0x6D, 0x74, 0x2E, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x74, 0x20, 0x64, 0x6F, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x20, 0x3D, 0x20, 0x6D, 0x74, 0x2E, 0x5F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x6D, 0x74, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x2E, 0x5F, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x2C, 0x20, 0x6D, 0x74, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 
+    0x5F, 0x32, 0x28, 0x6D, 0x74, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x5F, 0x2C, 0x20, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x69, 
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x6D, 0x74, 0x2E, 0x5F, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x61, 
+    0x77, 0x67, 0x65, 0x74, 0x28, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x29, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 0x73, 
+    0x65, 0x74, 0x28, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5F, 0x32, 0x28, 0x63, 0x68, 0x69, 
+    0x6C, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x28, 0x6D, 0x74, 0x2C, 
+    0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 
+    0x73, 0x65, 0x74, 0x28, 0x6D, 0x74, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x5F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5F, 0x32, 0x28, 0x6D, 
+    0x74, 0x2C, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x74, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 
+    0x5F, 0x6E, 0x65, 0x77, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x5F, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x2C, 0x0A, 0x7D, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x2C, 0x20, 0x6D, 0x74, 0x20, 0x69, 0x6E, 
+    0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x5F, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x72, 0x65, 
+    0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 
+    0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x6D, 0x74, 0x2C, 0x20, 0x6D, 0x74, 0x6D, 0x74, 0x29, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 
+    0x75, 0x6E, 0x63, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x6F, 0x73, 0x74, 
+    0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 
+    0x65, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x20, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x5B, 0x69, 0x5D, 0x28, 
+    0x64, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x70, 0x6F, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 
+    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x23, 0x70, 0x6F, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x5B, 0x69, 0x5D, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 
+    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 
+    0x72, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x28, 0x66, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x70, 0x72, 0x65, 
+    0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x2C, 0x20, 0x66, 0x29, 0x0A, 0x65, 0x6E, 0x64, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x67, 0x69, 0x73, 
+    0x74, 0x65, 0x72, 0x5F, 0x70, 0x6F, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x28, 
+    0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 
+    0x70, 0x6F, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 0x73, 0x2C, 0x20, 0x66, 0x29, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 
+    0x73, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 
+    0x61, 0x63, 0x6B, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 
+    0x76, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x61, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x5F, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x28, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x69, 0x64, 0x2C, 
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 
+    0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 
+    0x72, 0x6F, 0x72, 0x28, 0x22, 0x6E, 0x6F, 0x20, 0x69, 0x61, 0x70, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x61, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 
+    0x72, 0x65, 0x64, 0x21, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 
+    0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x70, 0x72, 0x6F, 0x64, 
+    0x75, 0x63, 0x74, 0x69, 0x64, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x63, 0x62, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x5F, 0x63, 0x61, 
+    0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x63, 0x62, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 
+    0x65, 0x5F, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x28, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x5F, 0x63, 
+    0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 
+    0x6B, 0x28, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x67, 0x69, 
+    0x73, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x5F, 0x63, 0x61, 0x6C, 
+    0x6C, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x63, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 
+    0x73, 0x74, 0x6F, 0x72, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x63, 0x62, 0x0A, 
+    0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x61, 
+    0x70, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x5F, 
+    0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x28, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 0x63, 
+    0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 
+    0x63, 0x6B, 0x28, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 
+    0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x69, 0x61, 0x70, 0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 
+    0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x63, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x61, 0x70, 
+    0x5F, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x3D, 
+    0x20, 0x63, 0x62, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data13[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x63, 0x6F, 0x64, 0x65, 
+    0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x69, 
+    0x73, 0x65, 0x20, 0x3D, 0x20, 0x33, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x61, 0x76, 
+    0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x22, 0x73, 0x69, 0x6E, 0x65, 0x22, 0x2C, 
+    0x0A, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x22, 0x6E, 0x6F, 0x69, 0x73, 0x65, 0x22, 
+    0x2C, 0x0A, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x7B, 0x0A, 0x09, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 
+    0x72, 0x65, 0x22, 0x2C, 0x0A, 0x09, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 0x2E, 
+    0x33, 0x2C, 0x0A, 0x09, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 
+    0x2C, 0x0A, 0x09, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 
+    0x09, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x64, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 
+    0x64, 0x75, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x64, 0x75, 0x74, 0x79, 0x5F, 0x72, 0x61, 
+    0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x76, 0x69, 0x62, 0x5F, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x20, 
+    0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 
+    0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x3D, 
+    0x20, 0x30, 0x2E, 0x33, 0x2C, 0x0A, 0x09, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x34, 0x2C, 0x0A, 0x09, 0x65, 0x6E, 0x76, 0x5F, 0x70, 0x75, 0x6E, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 
+    0x2C, 0x0A, 0x09, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x5F, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 
+    0x2C, 0x0A, 0x09, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x65, 0x73, 0x6F, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x31, 0x2E, 0x30, 0x2C, 
+    0x0A, 0x09, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x68, 
+    0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x68, 0x70, 0x66, 0x5F, 
+    0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x70, 0x68, 0x61, 0x5F, 0x72, 0x61, 0x6D, 0x70, 
+    0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 
+    0x3D, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x0A, 0x09, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 
+    0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x75, 0x70, 0x28, 0x73, 0x65, 0x65, 0x64, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 
+    0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x34, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 
+    0x20, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 
+    0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 
+    0x65, 0x63, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x31, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 
+    0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 
+    0x70, 0x75, 0x6E, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x33, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 
+    0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x2B, 
+    0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x32, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x6F, 0x74, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 
+    0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x20, 
+    0x3D, 0x20, 0x72, 0x28, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x31, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 
+    0x72, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x77, 0x20, 0x3D, 0x3D, 0x20, 
+    0x32, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 
+    0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x69, 0x6E, 0x65, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 
+    0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 
+    0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x35, 
+    0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x3D, 0x20, 0x6D, 
+    0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x30, 0x2E, 0x32, 0x2C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x2D, 0x20, 0x30, 0x2E, 0x32, 0x20, 0x2D, 0x20, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x30, 0x2E, 0x31, 
+    0x35, 0x20, 0x2D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x72, 0x28, 0x33, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 
+    0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x33, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 
+    0x65, 0x71, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 
+    0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x30, 0x2E, 0x33, 0x35, 0x20, 0x2D, 0x20, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x20, 
+    0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 
+    0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 
+    0x79, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x34, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 
+    0x79, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x37, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 
+    0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 
+    0x69, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x31, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 
+    0x63, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x70, 
+    0x75, 0x6E, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x33, 0x29, 0x20, 0x3D, 0x3D, 0x20, 
+    0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x72, 0x28, 0x29, 0x20, 
+    0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 
+    0x71, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x6F, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 
+    0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x6E, 0x6F, 0x69, 0x73, 
+    0x65, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 0x2D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 
+    0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 0x32, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x37, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 
+    0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 0x2D, 0x30, 0x2E, 0x32, 0x2D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x2A, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x72, 0x28, 0x35, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 
+    0x6D, 0x70, 0x3D, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x72, 0x28, 0x33, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 
+    0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3D, 0x30, 0x2E, 0x33, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x3D, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 
+    0x6E, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x3D, 0x72, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 
+    0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x2D, 
+    0x30, 0x2E, 0x33, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x39, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 
+    0x2D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x70, 0x75, 0x6E, 0x63, 
+    0x68, 0x3D, 0x30, 0x2E, 0x32, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 
+    0x74, 0x72, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x37, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 
+    0x70, 0x65, 0x65, 0x64, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x33, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3D, 0x30, 0x2E, 0x36, 0x2B, 0x72, 0x28, 0x29, 0x20, 
+    0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x3D, 0x30, 0x2E, 0x38, 0x2D, 0x72, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x31, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x75, 0x70, 
+    0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 
+    0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 
+    0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 
+    0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 
+    0x2E, 0x32, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 
+    0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 
+    0x65, 0x65, 0x64, 0x3D, 0x30, 0x2E, 0x34, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 0x32, 0x2B, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 0x30, 0x2E, 0x30, 0x35, 0x2B, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 
+    0x5F, 0x73, 0x74, 0x72, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x37, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 
+    0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 
+    0x74, 0x61, 0x63, 0x6B, 0x3D, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 
+    0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 
+    0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x68, 0x69, 0x74, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x33, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 
+    0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x32, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 
+    0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 
+    0x22, 0x6E, 0x6F, 0x69, 0x73, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x3D, 0x72, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 
+    0x32, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 0x2D, 0x30, 0x2E, 0x33, 0x2D, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x3D, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 
+    0x69, 0x6E, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 
+    0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6A, 0x75, 0x6D, 0x70, 
+    0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 
+    0x65, 0x3D, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 
+    0x71, 0x3D, 0x30, 0x2E, 0x33, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x3D, 0x30, 
+    0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x3D, 0x30, 0x2E, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 
+    0x73, 0x74, 0x61, 0x69, 0x6E, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 
+    0x61, 0x79, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 
+    0x66, 0x72, 0x65, 0x71, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x31, 0x2E, 0x30, 0x2D, 0x72, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x6C, 0x69, 0x70, 0x28, 0x73, 0x65, 
+    0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 
+    0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x3D, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 
+    0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 
+    0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 0x32, 0x2B, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 
+    0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 
+    0x74, 0x74, 0x61, 0x63, 0x6B, 0x3D, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x3D, 0x30, 0x2E, 0x31, 0x2B, 0x72, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x3D, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 
+    0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x66, 
+    0x72, 0x65, 0x71, 0x3D, 0x30, 0x2E, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x67, 0x28, 0x73, 0x65, 0x65, 0x64, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 
+    0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x77, 
+    0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x72, 0x28, 0x23, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 
+    0x70, 0x65, 0x73, 0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 
+    0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 
+    0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x32, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x72, 0x28, 0x32, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 
+    0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 
+    0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 
+    0x71, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x35, 
+    0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 
+    0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3E, 0x20, 0x30, 0x2E, 0x37, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3E, 0x20, 
+    0x30, 0x2E, 0x32, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x32, 0x20, 0x61, 0x6E, 
+    0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 
+    0x20, 0x3C, 0x20, 0x2D, 0x30, 0x2E, 0x30, 0x35, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 
+    0x20, 0x3D, 0x20, 0x2D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 
+    0x6D, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x64, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x20, 0x3D, 
+    0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 
+    0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 
+    0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 
+    0x69, 0x62, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 
+    0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 
+    0x63, 0x6B, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 
+    0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x32, 0x2E, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 
+    0x61, 0x79, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x70, 0x75, 
+    0x6E, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x20, 0x5E, 0x20, 
+    0x32, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x2B, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x2B, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x32, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x2B, 0x20, 
+    0x30, 0x2E, 0x32, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 
+    0x61, 0x79, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 
+    0x63, 0x61, 0x79, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x32, 0x20, 0x2B, 0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 
+    0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x65, 0x73, 0x6F, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x72, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x31, 
+    0x2E, 0x30, 0x20, 0x2D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 
+    0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 
+    0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 
+    0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3C, 0x20, 0x30, 0x2E, 
+    0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 
+    0x61, 0x6D, 0x70, 0x20, 0x3C, 0x20, 0x2D, 0x30, 0x2E, 0x30, 0x35, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 
+    0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 
+    0x61, 0x6D, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 
+    0x5E, 0x20, 0x35, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 
+    0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 
+    0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x35, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 
+    0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 
+    0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 
+    0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 
+    0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 
+    0x20, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3D, 0x20, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x72, 0x64, 
+    0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 
+    0x70, 0x65, 0x20, 0x3D, 0x20, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x72, 0x28, 0x23, 0x77, 
+    0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x29, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 
+    0x3D, 0x20, 0x22, 0x73, 0x61, 0x77, 0x74, 0x6F, 0x6F, 0x74, 0x68, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 
+    0x6F, 0x69, 0x73, 0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 
+    0x73, 0x69, 0x6E, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x38, 0x35, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x35, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 
+    0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x33, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 
+    0x35, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 
+    0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x30, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x30, 0x2E, 0x30, 0x39, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x32, 0x20, 0x2B, 0x20, 
+    0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x20, 0x2B, 
+    0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x32, 0x2E, 0x30, 0x29, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 0x28, 0x72, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x29, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 
+    0x2E, 0x30, 0x0A, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 
+    0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x2B, 0x20, 0x28, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x2D, 0x30, 
+    0x2E, 0x33, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x39, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 
+    0x20, 0x2D, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x30, 0x2E, 0x34, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x36, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x20, 0x3D, 
+    0x20, 0x30, 0x2E, 0x38, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x65, 0x73, 
+    0x6F, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x29, 
+    0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x28, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x28, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x33, 
+    0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3C, 0x20, 0x2D, 
+    0x30, 0x2E, 0x30, 0x35, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 
+    0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x72, 0x28, 0x29, 0x20, 0x5E, 0x20, 0x35, 0x2E, 0x30, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 
+    0x3D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 
+    0x5E, 0x20, 0x35, 0x2E, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x75, 0x73, 0x68, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x28, 0x73, 
+    0x65, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x77, 0x61, 0x76, 0x65, 0x5F, 
+    0x74, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x72, 0x28, 0x23, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x29, 
+    0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 
+    0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x69, 0x6E, 0x65, 0x22, 0x20, 0x6F, 
+    0x72, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 
+    0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x6E, 0x6F, 0x69, 0x73, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x62, 0x61, 0x73, 
+    0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x31, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 
+    0x2A, 0x20, 0x30, 0x2E, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x35, 0x20, 0x2B, 0x20, 0x28, 
+    0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x32, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x30, 0x2E, 
+    0x30, 0x31, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x30, 0x39, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 
+    0x69, 0x6E, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x31, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 
+    0x2E, 0x30, 0x39, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 
+    0x76, 0x5F, 0x64, 0x65, 0x63, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x31, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x30, 0x39, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 
+    0x2E, 0x33, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x20, 0x3D, 0x20, 0x2D, 0x30, 0x2E, 0x33, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x39, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x72, 
+    0x61, 0x6D, 0x70, 0x20, 0x3D, 0x20, 0x2D, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x36, 0x20, 0x2B, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x33, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 
+    0x6F, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x38, 0x20, 0x2D, 0x20, 0x28, 0x72, 0x28, 0x29, 0x20, 0x2A, 0x20, 0x31, 0x2E, 
+    0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 
+    0x74, 0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x63, 0x6B, 0x75, 0x70, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x6F, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6C, 
+    0x6F, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x75, 0x70, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x75, 0x6D, 0x70, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x6C, 0x69, 0x70, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x72, 0x64, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x67, 
+    0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x66, 0x78, 
+    0x72, 0x5F, 0x73, 0x79, 0x6E, 0x74, 0x68, 0x28, 0x61, 0x72, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x61, 0x72, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x61, 0x72, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x61, 0x72, 
+    0x67, 0x29, 0x20, 0x25, 0x20, 0x31, 0x30, 0x30, 0x29, 0x20, 0x25, 0x20, 0x23, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 
+    0x6F, 0x72, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x67, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x73, 0x5B, 0x69, 
+    0x6E, 0x64, 0x65, 0x78, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 
+    0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x67, 0x65, 0x6E, 0x28, 
+    0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x61, 0x72, 0x67, 0x20, 0x2F, 0x20, 0x31, 0x30, 0x30, 
+    0x29, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x77, 0x20, 0x3D, 0x20, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x63, 0x6F, 0x64, 0x65, 
+    0x5B, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 
+    0x64, 0x20, 0x77, 0x61, 0x76, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 
+    0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x73, 0x66, 0x78, 0x72, 0x28, 0x0A, 0x09, 0x77, 0x61, 0x76, 0x65, 0x5F, 0x74, 
+    0x79, 0x70, 0x65, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x5B, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x77, 0x61, 
+    0x76, 0x65, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 
+    0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x66, 0x72, 0x65, 0x71, 0x5F, 0x64, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x64, 0x75, 0x74, 0x79, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x0A, 0x09, 0x73, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2C, 0x0A, 0x09, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x76, 0x69, 0x62, 0x5F, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x2C, 0x0A, 0x09, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6B, 0x2C, 
+    0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x73, 0x75, 0x73, 0x74, 0x61, 
+    0x69, 0x6E, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x64, 0x65, 
+    0x63, 0x61, 0x79, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x65, 0x6E, 0x76, 0x5F, 0x70, 
+    0x75, 0x6E, 0x63, 0x68, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x69, 0x6C, 0x74, 
+    0x65, 0x72, 0x5F, 0x6F, 0x6E, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x6C, 0x70, 0x66, 
+    0x5F, 0x72, 0x65, 0x73, 0x6F, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x6C, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x66, 0x72, 0x65, 0x71, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x68, 0x70, 0x66, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x70, 0x68, 0x61, 0x5F, 0x72, 0x61, 0x6D, 0x70, 0x2C, 0x0A, 0x09, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x2E, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2C, 0x0A, 0x09, 0x73, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2C, 0x0A, 0x09, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x61, 0x72, 0x70, 0x5F, 0x6D, 0x6F, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x75, 0x66, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0};
+
+static const uint8_t data14[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 
+    0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 
+    0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 
+    0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 
+    0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x5F, 
+    0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 
+    0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 
+    0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 
+    0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 0x6D, 
+    0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 
+    0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x73, 0x5F, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 
+    0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 
+    0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 
+    0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 
+    0x20, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x32, 0x64, 0x5F, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 
+    0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 
+    0x5F, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 
+    0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x20, 0x3D, 0x20, 0x76, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 
+    0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x76, 0x20, 0x3D, 
+    0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 
+    0x67, 0x68, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 
+    0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 
+    0x76, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x3D, 0x20, 0x50, 0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 
+    0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x5F, 0x76, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 
+    0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x72, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x4D, 0x56, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x6D, 0x61, 0x74, 0x34, 0x20, 0x50, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x50, 
+    0x20, 0x2A, 0x20, 0x4D, 0x56, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x76, 0x65, 0x72, 0x74, 0x2C, 0x20, 0x30, 
+    0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 
+    0x6D, 0x70, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 
+    0x6D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 
+    0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 
+    0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 0x76, 0x5F, 
+    0x75, 0x76, 0x29, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 
+    0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x5F, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x75, 0x6D, 0x70, 0x20, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x73, 0x61, 
+    0x6D, 0x70, 0x6C, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6E, 0x69, 
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5F, 0x75, 0x76, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6C, 0x5F, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x28, 0x74, 0x65, 0x78, 0x2C, 0x20, 0x76, 0x5F, 0x75, 0x76, 
+    0x29, 0x20, 0x2A, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 0x62, 0x20, 0x2A, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x6F, 0x75, 0x72, 
+    0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x76, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x32, 0x64, 0x5F, 0x76, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5F, 0x76, 0x2C, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x73, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x32, 0x64, 0x5F, 0x76, 0x2C, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 
+    0x65, 0x20, 0x3D, 0x20, 0x7B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x76, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 
+    0x64, 0x20, 0x3D, 0x20, 0x7B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x5F, 0x76, 0x2C, 0x20, 0x74, 0x65, 
+    0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 
+    0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x7B, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x76, 0x2C, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x7B, 
+    0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x5F, 0x76, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 
+    0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x7B, 
+    0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x5F, 0x76, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 
+    0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x66, 0x7D, 0x2C, 0x0A, 0x7D, 0x0A, 
+    0x0A, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x73, 0x65, 
+    0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x73, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 
+    0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x20, 0x6C, 0x61, 0x7A, 0x69, 0x6C, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x5F, 
+    0x5F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x68, 
+    0x61, 0x64, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x20, 0x3D, 0x20, 0x72, 0x61, 0x77, 0x67, 0x65, 0x74, 
+    0x28, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x20, 0x3D, 
+    0x20, 0x61, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x5B, 
+    0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x5B, 0x31, 0x5D, 0x2C, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73, 0x5B, 0x6E, 0x61, 
+    0x6D, 0x65, 0x5D, 0x5B, 0x32, 0x5D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x5F, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5F, 0x70, 0x72, 0x65, 0x74, 
+    0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x28, 0x70, 0x72, 0x6F, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x77, 0x73, 0x65, 0x74, 0x28, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x73, 0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x7D, 0x29, 0x0A, 0};
+
+static const uint8_t data15[] = {
+    0x2D, 0x2D, 0x20, 0x72, 0x65, 0x63, 0x74, 0x73, 0x3A, 0x0A, 0x2D, 0x2D, 0x20, 0x31, 0x2D, 0x34, 0x0A, 0x2D, 0x2D, 0x20, 
+    0x7C, 0x5C, 0x7C, 0x0A, 0x2D, 0x2D, 0x20, 0x32, 0x2D, 0x33, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 
+    0x63, 0x68, 0x65, 0x64, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 
+    0x7B, 0x31, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x33, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x33, 0x2C, 0x20, 0x34, 0x7D, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x69, 0x6E, 0x64, 
+    0x69, 0x63, 0x65, 0x73, 0x28, 0x29, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 
+    0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 0x61, 0x64, 
+    0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x6D, 0x20, 0x3D, 0x20, 0x28, 0x6E, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x6D, 0x2C, 0x20, 0x36, 0x20, 0x64, 0x6F, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 
+    0x31, 0x5D, 0x20, 0x3D, 0x20, 0x6A, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x6A, 0x20, 0x2B, 0x20, 
+    0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 
+    0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x6A, 0x20, 0x2B, 0x20, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 0x3D, 0x20, 0x6A, 0x20, 
+    0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 
+    0x69, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x20, 0x3D, 0x20, 0x6A, 0x20, 0x2B, 0x20, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x36, 0x5D, 0x20, 0x3D, 0x20, 
+    0x6A, 0x20, 0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x6A, 0x20, 
+    0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 
+    0x20, 0x2A, 0x20, 0x34, 0x20, 0x3C, 0x20, 0x32, 0x5E, 0x31, 0x36, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x68, 0x6F, 0x72, 
+    0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x28, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 
+    0x71, 0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x3D, 
+    0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x7B, 0x7D, 0x2C, 0x20, 0x7B, 0x5F, 
+    0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x76, 0x22, 0x7D, 0x29, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x52, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 
+    0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x20, 0x51, 0x75, 0x61, 0x64, 
+    0x73, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x61, 0x73, 
+    0x20, 0x6D, 0x61, 0x6E, 0x79, 0x0A, 0x2D, 0x2D, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x77, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 
+    0x79, 0x20, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x73, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 
+    0x61, 0x6D, 0x65, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x32, 0x2E, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x71, 0x75, 
+    0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x3C, 0x20, 0x6E, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 
+    0x3D, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x2A, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 
+    0x63, 0x65, 0x73, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 
+    0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 
+    0x61, 0x72, 0x65, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5F, 0x63, 0x61, 
+    0x63, 0x68, 0x65, 0x5B, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5D, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20, 0x61, 0x6E, 
+    0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6D, 0x2E, 
+    0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x62, 0x61, 
+    0x74, 0x63, 0x68, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x0A, 0x2D, 0x2D, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x61, 0x72, 
+    0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 
+    0x20, 0x71, 0x75, 0x61, 0x64, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x61, 0x6D, 0x5F, 
+    0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x63, 0x70, 0x70, 0x29, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0A, 0x2D, 0x2D, 
+    0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x67, 0x75, 0x6F, 
+    0x75, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 
+    0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x2C, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x73, 
+    0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 
+    0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x31, 0x2C, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 
+    0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 
+    0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 
+    0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 
+    0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 
+    0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x2A, 0x20, 0x34, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x5F, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x20, 0x3D, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x75, 0x73, 
+    0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x74, 
+    0x63, 0x68, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x62, 0x61, 0x74, 0x63, 0x68, 0x28, 
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x2C, 0x20, 0x63, 
+    0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 
+    0x72, 0x61, 0x77, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 
+    0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x71, 
+    0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 
+    0x29, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x28, 0x62, 
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x20, 0x5E, 0x20, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x74, 
+    0x63, 0x68, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x6D, 0x61, 0x6B, 
+    0x65, 0x73, 0x20, 0x72, 0x6F, 0x6F, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 
+    0x20, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2C, 0x20, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x61, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x2E, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x28, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6E, 0x20, 0x3C, 0x3D, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x3C, 0x20, 0x6E, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 
+    0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x2A, 0x20, 0x32, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x61, 0x74, 0x63, 0x68, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x5F, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x2C, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 
+    0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 
+    0x72, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x62, 0x69, 0x6E, 
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 
+    0x76, 0x69, 0x65, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x69, 0x6E, 
+    0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x71, 0x75, 0x61, 
+    0x64, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 
+    0x64, 0x73, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x28, 0x62, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x6E, 0x75, 0x6D, 
+    0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x71, 0x20, 0x3D, 0x20, 0x62, 0x61, 
+    0x74, 0x63, 0x68, 0x3A, 0x61, 0x64, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 
+    0x61, 0x77, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x74, 0x63, 
+    0x68, 0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x2A, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x71, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x71, 0x2C, 0x20, 0x64, 0x61, 0x74, 0x61, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x28, 
+    0x71, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x34, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x20, 0x69, 0x6E, 
+    0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x5B, 0x61, 0x74, 0x74, 
+    0x72, 0x5D, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x73, 0x2C, 0x20, 0x69, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 
+    0x74, 0x5F, 0x61, 0x74, 0x74, 0x72, 0x28, 0x71, 0x2C, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x5B, 0x61, 
+    0x74, 0x74, 0x72, 0x5D, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x73, 0x2C, 0x20, 0x28, 0x71, 0x20, 0x2D, 0x20, 
+    0x31, 0x29, 0x20, 0x2A, 0x20, 0x34, 0x20, 0x2B, 0x20, 0x31, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 
+    0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 
+    0x20, 0x3D, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x2A, 
+    0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 
+    0x69, 0x6E, 0x67, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 
+    0x61, 0x64, 0x73, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x2C, 0x20, 
+    0x75, 0x73, 0x61, 0x67, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x69, 0x6E, 
+    0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 
+    0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x2C, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x2E, 0x62, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x2E, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5B, 0x22, 0x71, 0x75, 0x61, 0x64, 0x5F, 
+    0x22, 0x2E, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x71, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x71, 0x20, 0x3E, 0x20, 0x62, 
+    0x61, 0x74, 0x63, 0x68, 0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 
+    0x73, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x28, 0x71, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 
+    0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x3C, 0x20, 0x71, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 
+    0x61, 0x64, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 
+    0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 0x74, 0x5F, 0x61, 0x74, 0x74, 0x72, 0x28, 0x71, 0x2C, 0x20, 0x61, 0x74, 0x74, 0x72, 
+    0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 
+    0x71, 0x75, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x5F, 0x2C, 0x20, 0x71, 0x20, 0x3D, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x71, 0x2C, 0x20, 
+    0x71, 0x75, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x71, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 0x71, 0x2C, 0x20, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6D, 0x20, 0x3D, 0x20, 0x6D, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x71, 0x20, 0x2B, 0x20, 0x6D, 0x20, 0x2D, 0x20, 0x31, 0x20, 0x3E, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x2E, 
+    0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 
+    0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x71, 0x75, 0x61, 0x64, 0x20, 0x22, 0x2E, 0x2E, 0x28, 0x71, 0x20, 0x2B, 
+    0x20, 0x6D, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x2E, 0x2E, 0x22, 0x2C, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 
+    0x69, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x6E, 0x27, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x22, 0x2C, 0x20, 0x32, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 
+    0x28, 0x71, 0x2C, 0x20, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 
+    0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x61, 
+    0x74, 0x63, 0x68, 0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 
+    0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x71, 0x75, 0x61, 0x64, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 0x61, 0x64, 0x5F, 
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x28, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 
+    0x2C, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x28, 0x63, 0x61, 0x70, 0x61, 
+    0x63, 0x69, 0x74, 0x79, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x63, 0x2C, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x71, 0x75, 0x61, 
+    0x64, 0x73, 0x2E, 0x62, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x73, 0x70, 0x65, 0x63, 0x2C, 0x20, 0x32, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x73, 0x70, 0x65, 0x63, 0x5B, 0x69, 0x5D, 0x5D, 0x20, 
+    0x3D, 0x20, 0x73, 0x70, 0x65, 0x63, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 
+    0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x62, 0x69, 0x6E, 0x64, 
+    0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x5B, 0x22, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x22, 0x2E, 0x2E, 0x61, 0x74, 
+    0x74, 0x72, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x69, 0x6E, 0x64, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 
+    0x74, 0x5F, 0x61, 0x74, 0x74, 0x72, 0x28, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x6E, 0x75, 
+    0x6D, 0x62, 0x65, 0x72, 0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x2C, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 
+    0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 
+    0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 0x71, 0x75, 
+    0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x71, 0x20, 0x3D, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x61, 0x64, 0x64, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x71, 0x75, 0x61, 0x64, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x2E, 0x73, 0x65, 0x74, 0x28, 0x71, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 
+    0x65, 0x74, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x73, 0x65, 0x74, 0x28, 
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x29, 0x2C, 0x20, 0x71, 0x75, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 
+    0x6F, 0x64, 0x65, 0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 0x68, 0x61, 0x6E, 0x64, 
+    0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x72, 0x65, 
+    0x6D, 0x6F, 0x76, 0x65, 0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x71, 0x75, 0x61, 
+    0x64, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 
+    0x72, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x62, 0x69, 0x6E, 
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 
+    0x6F, 0x72, 0x28, 0x22, 0x6E, 0x6F, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x61, 0x74, 0x74, 0x72, 0x29, 
+    0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x76, 0x2E, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x74, 0x79, 
+    0x70, 0x65, 0x73, 0x5B, 0x61, 0x74, 0x74, 0x72, 0x5D, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x61, 0x74, 0x74, 0x72, 0x28, 
+    0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x71, 0x75, 0x61, 0x64, 0x5F, 
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x71, 0x75, 0x61, 0x64, 
+    0x5F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 
+    0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x61, 
+    0x74, 0x63, 0x68, 0x2E, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 
+    0x2E, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x74, 
+    0x63, 0x68, 0x3A, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x71, 
+    0x75, 0x61, 0x64, 0x73, 0x2E, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 
+    0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x71, 0x75, 0x61, 0x64, 0x5F, 0x62, 0x61, 0x74, 0x63, 0x68, 0x22, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 
+    0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x28, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 
+    0x2C, 0x20, 0x79, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x76, 0x65, 0x63, 0x32, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x7B, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x32, 0x2C, 0x20, 0x78, 
+    0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 
+    0x32, 0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x72, 0x65, 0x63, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x33, 0x64, 0x28, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 
+    0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x61, 0x6D, 0x2E, 0x76, 0x65, 0x63, 0x33, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x7B, 0x78, 0x31, 0x2C, 0x20, 0x79, 
+    0x32, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x78, 0x32, 0x2C, 
+    0x20, 0x79, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x2C, 0x20, 0x30, 0x7D, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x20, 0x3D, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 0x20, 0x3D, 0x20, 0x7B, 0x31, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x31, 0x7D, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x7B, 0x32, 0x2C, 0x20, 0x33, 0x2C, 0x20, 0x32, 0x7D, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x33, 0x2C, 0x20, 0x34, 0x2C, 0x20, 0x31, 0x7D, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x7B, 0x31, 0x2C, 0x20, 0x34, 0x2C, 0x20, 0x32, 0x7D, 
+    0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x70, 0x72, 0x6F, 0x70, 
+    0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x6F, 0x73, 
+    0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x29, 0x20, 0x64, 
+    0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x73, 0x31, 0x2C, 0x20, 0x6F, 0x73, 0x32, 
+    0x2C, 0x20, 0x63, 0x20, 0x3D, 0x20, 0x75, 0x6E, 0x70, 0x61, 0x63, 0x6B, 0x28, 0x6F, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x5B, 0x22, 0x67, 0x65, 0x74, 0x5F, 0x22, 0x2E, 0x2E, 
+    0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 
+    0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x2E, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x6F, 0x73, 0x31, 0x5D, 0x5B, 0x63, 0x5D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x70, 0x72, 0x6F, 0x70, 0x73, 
+    0x5B, 0x22, 0x73, 0x65, 0x74, 0x5F, 0x22, 0x2E, 0x2E, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x65, 0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x5B, 0x6F, 0x73, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x6F, 0x73, 
+    0x31, 0x5D, 0x28, 0x63, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x5B, 0x6F, 0x73, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x6F, 0x73, 
+    0x32, 0x5D, 0x28, 0x63, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x70, 0x72, 0x6F, 
+    0x70, 0x73, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x74, 
+    0x5F, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x28, 0x78, 0x31, 0x2C, 0x20, 0x79, 
+    0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 
+    0x64, 0x28, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 
+    0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 
+    0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 
+    0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x22, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 
+    0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x69, 0x6E, 
+    0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x76, 0x65, 0x72, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x72, 
+    0x6F, 0x70, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x72, 0x65, 
+    0x63, 0x74, 0x5F, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x28, 
+    0x22, 0x72, 0x65, 0x63, 0x74, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x2D, 0x2D, 0x20, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x3A, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 
+    0x65, 0x5F, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x35, 0x35, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 
+    0x73, 0x28, 0x73, 0x69, 0x64, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x3D, 
+    0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x69, 
+    0x72, 0x63, 0x6C, 0x65, 0x5F, 0x73, 0x69, 0x64, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x32, 0x2C, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x5B, 0x69, 
+    0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x5B, 
+    0x69, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x25, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x73, 0x20, 0x2B, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 
+    0x20, 0x69, 0x20, 0x2B, 0x20, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x3C, 0x20, 0x32, 0x5E, 0x31, 0x35, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 
+    0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x74, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x5F, 0x61, 0x72, 0x72, 0x61, 
+    0x79, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 
+    0x6C, 0x65, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 
+    0x65, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x28, 0x73, 0x69, 0x64, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x73, 0x69, 0x64, 0x65, 0x73, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 
+    0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x5B, 0x73, 0x69, 0x64, 0x65, 0x73, 
+    0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 
+    0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x5B, 0x73, 0x69, 0x64, 0x65, 0x73, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x7B, 
+    0x30, 0x2C, 0x20, 0x30, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x6E, 0x67, 0x6C, 
+    0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x61, 0x6E, 0x67, 
+    0x6C, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x20, 0x2A, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x70, 0x69, 0x20, 0x2F, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x73, 0x2C, 0x20, 
+    0x73, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x63, 0x6F, 0x73, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 
+    0x2E, 0x73, 0x69, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x33, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x69, 0x64, 0x65, 
+    0x73, 0x20, 0x2D, 0x20, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x5B, 0x69, 
+    0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x73, 0x28, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x73, 0x69, 0x6E, 0x28, 0x61, 0x6E, 
+    0x67, 0x6C, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 
+    0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x61, 
+    0x6E, 0x67, 0x6C, 0x65, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x76, 0x65, 0x63, 0x32, 0x5F, 0x61, 0x72, 0x72, 0x61, 0x79, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 
+    0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x5B, 0x73, 0x69, 0x64, 0x65, 0x73, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x69, 
+    0x72, 0x63, 0x6C, 0x65, 0x28, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x2C, 0x20, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x2C, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x69, 0x64, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x69, 0x64, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x73, 0x69, 0x64, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 
+    0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 0x74, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x5F, 0x32, 0x64, 0x28, 0x73, 0x69, 0x64, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x28, 
+    0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 
+    0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 
+    0x72, 0x73, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x22, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 
+    0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x61, 0x6D, 0x2E, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x5F, 0x69, 0x6E, 
+    0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x73, 0x69, 0x64, 0x65, 0x73, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x2E, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 
+    0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x28, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x65, 
+    0x6E, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x22, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x72, 0x61, 
+    0x64, 0x69, 0x75, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x72, 
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x28, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x64, 
+    0x69, 0x75, 0x73, 0x20, 0x3D, 0x20, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x22, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x22, 0x2E, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x32, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x63, 0x32, 0x28, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 
+    0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 
+    0x22, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 
+    0x6D, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x28, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x2C, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 
+    0x32, 0x2C, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x68, 0x69, 
+    0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x61, 
+    0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x34, 0x20, 0x2A, 0x20, 0x32, 0x20, 0x2A, 0x20, 0x34, 0x29, 0x3A, 
+    0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x76, 0x65, 0x63, 0x32, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x5F, 
+    0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x6C, 0x6F, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 
+    0x6C, 0x69, 0x7A, 0x65, 0x28, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x32, 0x20, 0x2D, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x73, 0x31, 0x5F, 
+    0x78, 0x20, 0x3D, 0x20, 0x2D, 0x73, 0x6C, 0x6F, 0x70, 0x65, 0x2E, 0x79, 0x20, 0x2A, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 
+    0x6E, 0x65, 0x73, 0x73, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x6F, 0x73, 0x31, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x73, 0x6C, 0x6F, 0x70, 0x65, 0x2E, 0x78, 0x20, 0x2A, 
+    0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x73, 0x32, 0x5F, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x6C, 0x6F, 
+    0x70, 0x65, 0x2E, 0x79, 0x20, 0x2A, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x2F, 0x20, 0x32, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x73, 0x32, 0x5F, 0x79, 
+    0x20, 0x3D, 0x20, 0x2D, 0x73, 0x6C, 0x6F, 0x70, 0x65, 0x2E, 0x78, 0x20, 0x2A, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 
+    0x65, 0x73, 0x73, 0x20, 0x2F, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x78, 0x31, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x2E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 
+    0x31, 0x2E, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x32, 
+    0x20, 0x3D, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x32, 0x2E, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x32, 0x2E, 0x79, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x3A, 0x73, 0x65, 0x74, 0x7B, 0x6F, 0x73, 
+    0x31, 0x5F, 0x78, 0x20, 0x2B, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x6F, 0x73, 0x31, 0x5F, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x31, 
+    0x2C, 0x20, 0x6F, 0x73, 0x32, 0x5F, 0x78, 0x20, 0x2B, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x6F, 0x73, 0x32, 0x5F, 0x79, 0x20, 
+    0x2B, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x6F, 0x73, 0x32, 0x5F, 0x78, 0x20, 0x2B, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x6F, 0x73, 
+    0x32, 0x5F, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x32, 0x2C, 0x20, 0x6F, 0x73, 0x31, 0x5F, 0x78, 0x20, 0x2B, 0x20, 0x78, 0x32, 
+    0x2C, 0x20, 0x6F, 0x73, 0x31, 0x5F, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x32, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x61, 0x6D, 
+    0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x22, 0x61, 0x6C, 0x70, 0x68, 
+    0x61, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 
+    0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x64, 
+    0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x6F, 0x69, 
+    0x6E, 0x74, 0x31, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x70, 0x6F, 
+    0x69, 0x6E, 0x74, 0x31, 0x28, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 
+    0x74, 0x31, 0x20, 0x3D, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x6F, 0x69, 
+    0x6E, 0x74, 0x32, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x70, 0x6F, 
+    0x69, 0x6E, 0x74, 0x32, 0x28, 0x70, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x69, 0x6E, 
+    0x74, 0x32, 0x20, 0x3D, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x68, 0x69, 
+    0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 
+    0x73, 0x65, 0x74, 0x5F, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x69, 0x63, 0x6B, 0x6E, 0x65, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x63, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+    0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data16[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x2A, 0x20, 0x31, 
+    0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x76, 0x65, 0x63, 0x32, 0x22, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x31, 0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x76, 
+    0x73, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x76, 0x65, 0x63, 
+    0x32, 0x22, 0x2C, 0x20, 0x38, 0x2C, 0x20, 0x31, 0x36, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x74, 
+    0x72, 0x69, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x2F, 0x20, 0x34, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x20, 
+    0x3D, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x74, 0x72, 0x69, 0x73, 0x20, 0x2A, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x72, 0x72, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x75, 
+    0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x20, 0x3C, 0x20, 0x32, 0x5E, 0x31, 0x36, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x22, 
+    0x75, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x72, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 
+    0x22, 0x75, 0x69, 0x6E, 0x74, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x65, 0x6C, 0x65, 0x6D, 0x73, 0x20, 0x2A, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x61, 0x72, 0x72, 
+    0x5F, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x74, 0x72, 0x69, 0x73, 0x20, 0x2D, 0x20, 0x31, 
+    0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 
+    0x69, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 
+    0x32, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 
+    0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x33, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 
+    0x3D, 0x20, 0x31, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 
+    0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 0x3D, 0x20, 0x33, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x69, 0x20, 0x2B, 0x20, 0x35, 
+    0x5D, 0x20, 0x3D, 0x20, 0x34, 0x20, 0x2B, 0x20, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6B, 0x20, 0x3D, 0x20, 
+    0x6B, 0x20, 0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x28, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x69, 0x65, 0x77, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 
+    0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x5C, 0x6E, 0x22, 0x29, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x70, 0x61, 
+    0x63, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x20, 0x22, 
+    0x29, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x78, 0x20, 0x3D, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x2A, 0x22, 0x29, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x64, 0x61, 0x73, 0x68, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 
+    0x22, 0x2D, 0x22, 0x29, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6F, 0x72, 
+    0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x5F, 0x22, 0x29, 
+    0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 
+    0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 
+    0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x5F, 0x76, 
+    0x69, 0x65, 0x77, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x75, 0x76, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x75, 
+    0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 
+    0x20, 0x3D, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 
+    0x2D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x20, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x30, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x6E, 
+    0x74, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+    0x70, 0x2C, 0x20, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x75, 0x74, 0x66, 0x38, 0x2E, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x28, 0x73, 
+    0x74, 0x72, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x20, 
+    0x3D, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x68, 0x20, 0x2B, 0x20, 0x66, 0x6F, 0x6E, 0x74, 
+    0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x5B, 
+    0x63, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x5B, 0x30, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x68, 
+    0x61, 0x72, 0x73, 0x5B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x2B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 
+    0x2E, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x3D, 0x20, 0x77, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x20, 0x3E, 0x20, 
+    0x6D, 0x61, 0x78, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x3D, 0x20, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 
+    0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 
+    0x20, 0x2D, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x2F, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x72, 0x69, 0x67, 0x68, 
+    0x74, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 0x20, 
+    0x2D, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 
+    0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 
+    0x72, 0x28, 0x68, 0x20, 0x2F, 0x20, 0x32, 0x29, 0x20, 0x2D, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 
+    0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x76, 
+    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x68, 0x20, 0x2D, 0x20, 0x66, 
+    0x6F, 0x6E, 0x74, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x2D, 0x66, 0x6F, 
+    0x6E, 0x74, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x2C, 0x20, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x75, 
+    0x74, 0x66, 0x38, 0x2E, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 
+    0x61, 0x2C, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x2C, 0x20, 0x61, 
+    0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x20, 
+    0x3D, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x79, 0x20, 0x2D, 0x20, 0x66, 0x6F, 0x6E, 0x74, 
+    0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x20, 
+    0x3D, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x73, 0x5B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x2B, 0x20, 0x31, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 
+    0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x2D, 
+    0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x72, 0x6F, 0x77, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x2F, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 
+    0x20, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x2D, 0x72, 0x6F, 0x77, 0x5F, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 
+    0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x5B, 0x63, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 
+    0x5B, 0x30, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x5B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 
+    0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x78, 
+    0x31, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x79, 0x31, 0x2C, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x78, 0x32, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 
+    0x2E, 0x79, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x76, 0x61, 
+    0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x61, 0x64, 0x76, 0x61, 
+    0x6E, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x78, 
+    0x20, 0x2B, 0x20, 0x78, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 
+    0x76, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x78, 
+    0x20, 0x2B, 0x20, 0x78, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 
+    0x76, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 0x3D, 0x20, 0x78, 
+    0x20, 0x2B, 0x20, 0x78, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 
+    0x76, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x20, 0x3D, 0x20, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x36, 0x5D, 0x20, 0x3D, 0x20, 0x78, 
+    0x20, 0x2B, 0x20, 0x78, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 
+    0x76, 0x20, 0x2B, 0x20, 0x37, 0x5D, 0x20, 0x3D, 0x20, 0x79, 0x20, 0x2B, 0x20, 0x79, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x76, 0x20, 0x2B, 0x20, 0x38, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x31, 0x2C, 0x20, 0x74, 0x31, 0x2C, 0x20, 0x73, 0x32, 0x2C, 0x20, 
+    0x74, 0x32, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x74, 0x31, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x2E, 0x73, 0x32, 0x2C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x74, 0x32, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 0x75, 0x5D, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 
+    0x20, 0x73, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 0x75, 0x20, 0x2B, 0x20, 
+    0x31, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 
+    0x75, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x73, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x76, 0x73, 0x5B, 0x75, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 0x75, 0x20, 0x2B, 0x20, 0x34, 0x5D, 0x20, 0x3D, 0x20, 0x73, 0x32, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 0x75, 0x20, 0x2B, 0x20, 0x35, 0x5D, 0x20, 0x3D, 
+    0x20, 0x74, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 0x75, 0x20, 0x2B, 0x20, 
+    0x36, 0x5D, 0x20, 0x3D, 0x20, 0x73, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5B, 
+    0x75, 0x20, 0x2B, 0x20, 0x37, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x20, 0x3D, 0x20, 0x75, 0x20, 0x2B, 0x20, 0x38, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 
+    0x3D, 0x20, 0x78, 0x20, 0x2B, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 
+    0x28, 0x76, 0x65, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 
+    0x3A, 0x73, 0x65, 0x74, 0x28, 0x75, 0x76, 0x73, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x73, 
+    0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x69, 0x6D, 0x67, 0x2C, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x2C, 0x20, 0x68, 
+    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x79, 0x32, 0x20, 
+    0x3D, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x78, 0x31, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x79, 0x31, 0x2C, 0x20, 0x69, 0x6D, 
+    0x67, 0x2E, 0x78, 0x32, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x79, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x73, 0x31, 0x2C, 0x20, 0x74, 0x31, 0x2C, 0x20, 0x73, 0x32, 0x2C, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 
+    0x69, 0x6D, 0x67, 0x2E, 0x73, 0x31, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x74, 0x31, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x2E, 
+    0x73, 0x32, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x77, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x67, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 0x79, 0x5F, 0x6F, 0x73, 
+    0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 
+    0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x5F, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x2D, 0x77, 0x2F, 0x32, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 
+    0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x78, 0x5F, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x2D, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x63, 0x65, 0x6E, 
+    0x74, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5F, 
+    0x6F, 0x73, 0x20, 0x3D, 0x20, 0x2D, 0x68, 0x2F, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 
+    0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5F, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x2D, 0x68, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5F, 0x76, 0x69, 
+    0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x7B, 0x78, 0x31, 0x20, 0x2B, 0x20, 0x78, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 0x79, 0x32, 
+    0x20, 0x2B, 0x20, 0x79, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 0x78, 0x31, 0x20, 0x2B, 0x20, 0x78, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 
+    0x79, 0x31, 0x20, 0x2B, 0x20, 0x79, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 0x78, 0x32, 0x20, 0x2B, 0x20, 0x78, 0x5F, 0x6F, 0x73, 
+    0x2C, 0x20, 0x79, 0x31, 0x20, 0x2B, 0x20, 0x79, 0x5F, 0x6F, 0x73, 0x2C, 0x20, 0x78, 0x32, 0x20, 0x2B, 0x20, 0x78, 0x5F, 
+    0x6F, 0x73, 0x2C, 0x20, 0x79, 0x32, 0x20, 0x2B, 0x20, 0x79, 0x5F, 0x6F, 0x73, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x76, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x3A, 0x73, 0x65, 0x74, 0x7B, 0x73, 0x31, 0x2C, 0x20, 0x74, 0x32, 0x2C, 0x20, 
+    0x73, 0x31, 0x2C, 0x20, 0x74, 0x31, 0x2C, 0x20, 0x73, 0x32, 0x2C, 0x20, 0x74, 0x31, 0x2C, 0x20, 0x73, 0x32, 0x2C, 0x20, 
+    0x74, 0x32, 0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x6B, 0x65, 0x79, 0x20, 0x3D, 0x20, 0x5B, 0x5B, 0x0A, 0x20, 0xE2, 0x98, 
+    0xBA, 0xE2, 0x98, 0xBB, 0xE2, 0x99, 0xA5, 0xE2, 0x99, 0xA6, 0xE2, 0x99, 0xA3, 0xE2, 0x99, 0xA0, 0xE2, 0x80, 0xA2, 0xE2, 
+    0x97, 0x98, 0xE2, 0x97, 0x8B, 0xE2, 0x97, 0x99, 0xE2, 0x99, 0x82, 0xE2, 0x99, 0x80, 0xE2, 0x99, 0xAA, 0xE2, 0x99, 0xAB, 
+    0xE2, 0x98, 0xBC, 0xE2, 0x96, 0xBA, 0xE2, 0x97, 0x84, 0xE2, 0x86, 0x95, 0xE2, 0x80, 0xBC, 0xC2, 0xB6, 0xC2, 0xA7, 0xE2, 
+    0x96, 0xAC, 0xE2, 0x86, 0xA8, 0xE2, 0x86, 0x91, 0xE2, 0x86, 0x93, 0xE2, 0x86, 0x92, 0xE2, 0x86, 0x90, 0xE2, 0x88, 0x9F, 
+    0xE2, 0x86, 0x94, 0xE2, 0x96, 0xB2, 0xE2, 0x96, 0xBC, 0x0A, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 
+    0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 
+    0x3E, 0x3F, 0x0A, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 
+    0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x0A, 0x60, 0x61, 0x62, 0x63, 
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 
+    0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0xE2, 0x8C, 0x82, 0x0A, 0xC3, 0x87, 0xC3, 0xBC, 0xC3, 0xA9, 0xC3, 0xA2, 0xC3, 
+    0xA4, 0xC3, 0xA0, 0xC3, 0xA5, 0xC3, 0xA7, 0xC3, 0xAA, 0xC3, 0xAB, 0xC3, 0xA8, 0xC3, 0xAF, 0xC3, 0xAE, 0xC3, 0xAC, 0xC3, 
+    0x84, 0xC3, 0x85, 0xC3, 0x89, 0xC3, 0xA6, 0xC3, 0x86, 0xC3, 0xB4, 0xC3, 0xB6, 0xC3, 0xB2, 0xC3, 0xBB, 0xC3, 0xB9, 0xC3, 
+    0xBF, 0xC3, 0x96, 0xC3, 0x9C, 0xC2, 0xA2, 0xC2, 0xA3, 0xC2, 0xA5, 0xE2, 0x82, 0xA7, 0xC6, 0x92, 0x0A, 0xC3, 0xA1, 0xC3, 
+    0xAD, 0xC3, 0xB3, 0xC3, 0xBA, 0xC3, 0xB1, 0xC3, 0x91, 0xC2, 0xAA, 0xC2, 0xBA, 0xC2, 0xBF, 0xE2, 0x8C, 0x90, 0xC2, 0xAC, 
+    0xC2, 0xBD, 0xC2, 0xBC, 0xC2, 0xA1, 0xC2, 0xAB, 0xC2, 0xBB, 0xE2, 0x96, 0x91, 0xE2, 0x96, 0x92, 0xE2, 0x96, 0x93, 0xE2, 
+    0x94, 0x82, 0xE2, 0x94, 0xA4, 0xE2, 0x95, 0xA1, 0xE2, 0x95, 0xA2, 0xE2, 0x95, 0x96, 0xE2, 0x95, 0x95, 0xE2, 0x95, 0xA3, 
+    0xE2, 0x95, 0x91, 0xE2, 0x95, 0x97, 0xE2, 0x95, 0x9D, 0xE2, 0x95, 0x9C, 0xE2, 0x95, 0x9B, 0xE2, 0x94, 0x90, 0x0A, 0xE2, 
+    0x94, 0x94, 0xE2, 0x94, 0xB4, 0xE2, 0x94, 0xAC, 0xE2, 0x94, 0x9C, 0xE2, 0x94, 0x80, 0xE2, 0x94, 0xBC, 0xE2, 0x95, 0x9E, 
+    0xE2, 0x95, 0x9F, 0xE2, 0x95, 0x9A, 0xE2, 0x95, 0x94, 0xE2, 0x95, 0xA9, 0xE2, 0x95, 0xA6, 0xE2, 0x95, 0xA0, 0xE2, 0x95, 
+    0x90, 0xE2, 0x95, 0xAC, 0xE2, 0x95, 0xA7, 0xE2, 0x95, 0xA8, 0xE2, 0x95, 0xA4, 0xE2, 0x95, 0xA5, 0xE2, 0x95, 0x99, 0xE2, 
+    0x95, 0x98, 0xE2, 0x95, 0x92, 0xE2, 0x95, 0x93, 0xE2, 0x95, 0xAB, 0xE2, 0x95, 0xAA, 0xE2, 0x94, 0x98, 0xE2, 0x94, 0x8C, 
+    0xE2, 0x96, 0x88, 0xE2, 0x96, 0x84, 0xE2, 0x96, 0x8C, 0xE2, 0x96, 0x90, 0xE2, 0x96, 0x80, 0x0A, 0xCE, 0xB1, 0xC3, 0x9F, 
+    0xCE, 0x93, 0xCF, 0x80, 0xCE, 0xA3, 0xCF, 0x83, 0xC2, 0xB5, 0xCF, 0x84, 0xCE, 0xA6, 0xCE, 0x98, 0xCE, 0xA9, 0xCE, 0xB4, 
+    0xE2, 0x88, 0x9E, 0xCF, 0x86, 0xCE, 0xB5, 0xE2, 0x88, 0xA9, 0xE2, 0x89, 0xA1, 0xC2, 0xB1, 0xE2, 0x89, 0xA5, 0xE2, 0x89, 
+    0xA4, 0xE2, 0x8C, 0xA0, 0xE2, 0x8C, 0xA1, 0xC3, 0xB7, 0xE2, 0x89, 0x88, 0xC2, 0xB0, 0xE2, 0x88, 0x99, 0xC2, 0xB7, 0xE2, 
+    0x88, 0x9A, 0xE2, 0x81, 0xBF, 0xC2, 0xB2, 0xE2, 0x96, 0xA0, 0x20, 0x0A, 0x5D, 0x5D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2C, 0x20, 0x73, 
+    0x74, 0x72, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 
+    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 
+    0x6F, 0x6E, 0x74, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 
+    0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x66, 0x6F, 
+    0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 
+    0x67, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6D, 
+    0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
+    0x74, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x62, 0x69, 0x74, 
+    0x6D, 0x61, 0x70, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x28, 0x22, 0x6C, 0x75, 0x61, 0x2F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
+    0x74, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x2C, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
+    0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x5F, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x6E, 
+    0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 
+    0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 
+    0x67, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 
+    0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x68, 
+    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x63, 
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 
+    0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 
+    0x6F, 0x6E, 0x74, 0x2E, 0x69, 0x73, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x69, 0x6E, 
+    0x67, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x31, 0x22, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x74, 
+    0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x73, 0x74, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x69, 0x73, 0x73, 0x75, 0x65, 0x73, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x20, 0x22, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 
+    0x20, 0x75, 0x74, 0x66, 0x38, 0x2E, 0x6C, 0x65, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x6E, 
+    0x20, 0x2A, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 
+    0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 
+    0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6D, 
+    0x61, 0x6B, 0x65, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 
+    0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 
+    0x73, 0x65, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2C, 
+    0x20, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x2C, 0x20, 0x68, 0x61, 
+    0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 
+    0x75, 0x6C, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x22, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x22, 0x20, 0x6F, 0x72, 
+    0x20, 0x22, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 
+    0x6D, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x69, 
+    0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 
+    0x64, 0x65, 0x72, 0x73, 0x2E, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 
+    0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x75, 
+    0x76, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x20, 
+    0x3D, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 
+    0x22, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x28, 0x73, 0x74, 0x72, 0x31, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x31, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x73, 0x74, 0x72, 0x31, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x61, 
+    0x6E, 0x64, 0x20, 0x73, 0x74, 0x72, 0x31, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x6F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 
+    0x73, 0x74, 0x72, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6C, 0x65, 0x6E, 0x31, 0x20, 0x3D, 0x20, 0x75, 0x74, 0x66, 0x38, 0x2E, 0x6C, 0x65, 0x6E, 0x28, 0x73, 0x74, 0x72, 0x31, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6C, 0x65, 0x6E, 0x31, 0x20, 0x3E, 0x20, 
+    0x6C, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x6C, 
+    0x65, 0x6E, 0x31, 0x20, 0x2A, 0x20, 0x34, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x20, 
+    0x3D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x64, 
+    0x69, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 
+    0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 
+    0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x73, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x64, 0x72, 0x61, 0x77, 
+    0x22, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x6C, 
+    0x65, 0x6E, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 
+    0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 
+    0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x64, 0x72, 0x61, 
+    0x77, 0x22, 0x2E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x75, 0x74, 0x66, 0x38, 0x2E, 0x6C, 0x65, 0x6E, 0x28, 
+    0x73, 0x74, 0x72, 0x29, 0x20, 0x2A, 0x20, 0x36, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x28, 0x63, 0x6F, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 
+    0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x77, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 
+    0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 
+    0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x5F, 0x6D, 0x61, 0x70, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x57, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 
+    0x34, 0x28, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 
+    0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x37, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x2C, 0x20, 
+    0x30, 0x2E, 0x37, 0x35, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4B, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6B, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 
+    0x2E, 0x35, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x52, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x59, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2C, 0x20, 0x31, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x79, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x47, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x30, 0x2C, 0x20, 
+    0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x67, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 
+    0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x43, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 
+    0x2E, 0x35, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x42, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x29, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x4D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2C, 0x20, 0x30, 0x2C, 
+    0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x4F, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 
+    0x2E, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x32, 0x35, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 
+    0x5F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x28, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x61, 0x73, 
+    0x63, 0x69, 0x69, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x6D, 0x61, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x6C, 0x66, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 
+    0x28, 0x22, 0x5C, 0x6E, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x72, 0x20, 
+    0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x5C, 0x72, 0x22, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x70, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 0x20, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x74, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x62, 0x79, 0x74, 0x65, 0x28, 0x22, 
+    0x5C, 0x74, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 
+    0x6F, 0x77, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x6B, 0x65, 
+    0x79, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x6B, 0x65, 
+    0x79, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x6B, 0x65, 
+    0x79, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x6B, 0x65, 
+    0x79, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x68, 0x72, 0x2C, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x74, 0x20, 
+    0x3D, 0x20, 0x63, 0x68, 0x72, 0x3A, 0x62, 0x79, 0x74, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x20, 
+    0x2A, 0x20, 0x32, 0x35, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6B, 0x65, 0x79, 0x5B, 0x62, 
+    0x74, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x67, 0x20, 0x2A, 0x20, 0x32, 0x35, 0x35, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x2E, 0x62, 0x20, 0x2A, 0x20, 0x32, 0x35, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x20, 0x2A, 
+    0x20, 0x32, 0x35, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x23, 0x73, 0x74, 0x72, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x3A, 
+    0x62, 0x79, 0x74, 0x65, 0x28, 0x70, 0x6F, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x62, 0x20, 0x3D, 0x3D, 0x20, 0x63, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x20, 0x3D, 0x3D, 0x20, 0x73, 0x70, 0x20, 
+    0x6F, 0x72, 0x20, 0x62, 0x20, 0x3D, 0x3D, 0x20, 0x74, 0x62, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x20, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x62, 0x20, 0x3D, 0x3D, 0x20, 0x6C, 0x66, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x72, 0x6F, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x63, 0x75, 
+    0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3E, 0x20, 0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x7E, 0x3D, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x61, 0x6C, 0x6C, 0x20, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x6D, 0x75, 0x73, 
+    0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x22, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 
+    0x20, 0x72, 0x6F, 0x77, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x28, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x2C, 0x20, 0x62, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 
+    0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x20, 0x7E, 0x3D, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x61, 0x6C, 0x6C, 
+    0x20, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 
+    0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x2D, 
+    0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x34, 0x20, 
+    0x2A, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2A, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x3A, 
+    0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x34, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 0x62, 0x75, 
+    0x66, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x34, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3D, 0x20, 
+    0x62, 0x75, 0x66, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 0x32, 0x2C, 
+    0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x76, 0x69, 0x65, 0x77, 0x20, 
+    0x3D, 0x20, 0x62, 0x75, 0x66, 0x3A, 0x76, 0x69, 0x65, 0x77, 0x28, 0x22, 0x75, 0x62, 0x79, 0x74, 0x65, 0x22, 0x2C, 0x20, 
+    0x33, 0x2C, 0x20, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x20, 0x3D, 0x20, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x2D, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x62, 0x74, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x5B, 0x63, 0x6F, 
+    0x6C, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x76, 0x69, 0x65, 0x77, 
+    0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x72, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x76, 0x69, 0x65, 0x77, 0x5B, 0x69, 0x5D, 
+    0x20, 0x3D, 0x20, 0x67, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x76, 0x69, 0x65, 0x77, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 
+    0x62, 0x6B, 0x65, 0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x76, 0x69, 0x65, 0x77, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x61, 0x6B, 0x65, 
+    0x79, 0x5B, 0x62, 0x74, 0x5D, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 
+    0x32, 0x64, 0x28, 0x61, 0x6D, 0x2E, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x62, 
+    0x75, 0x66, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x29, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x2C, 
+    0x20, 0x73, 0x32, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x2C, 
+    0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+    0x3D, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x5F, 
+    0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x69, 0x6D, 0x67, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x69, 0x6D, 
+    0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x69, 0x6D, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 0x20, 0x74, 0x20, 
+    0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x6D, 
+    0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 
+    0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x70, 0x72, 0x69, 
+    0x74, 0x65, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 
+    0x6D, 0x67, 0x3A, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x22, 0x25, 0x5C, 0x6E, 0x22, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 
+    0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x28, 0x69, 0x6D, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 
+    0x69, 0x6D, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x73, 0x31, 0x2C, 0x20, 0x74, 0x31, 0x2C, 0x20, 0x73, 0x32, 0x2C, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 
+    0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 
+    0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x31, 0x20, 0x3D, 
+    0x20, 0x73, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x74, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x32, 0x20, 0x3D, 0x20, 0x73, 0x32, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x74, 0x32, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 0x20, 0x3D, 
+    0x20, 0x78, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x79, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x78, 0x32, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x79, 0x32, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x20, 0x3D, 0x20, 0x78, 0x32, 0x20, 0x2D, 0x20, 0x78, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x79, 0x32, 
+    0x20, 0x2D, 0x20, 0x79, 0x31, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x20, 
+    0x3D, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x65, 0x78, 0x70, 
+    0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x22, 0x2E, 0x2E, 0x74, 0x2E, 0x2E, 0x22, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x22, 0x2C, 0x20, 0x33, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 0x63, 
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 
+    0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 
+    0x75, 0x72, 0x63, 0x65, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x70, 
+    0x72, 0x69, 0x74, 0x65, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x30, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 
+    0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x68, 0x61, 0x6C, 0x69, 
+    0x67, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x63, 
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 
+    0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x69, 0x6D, 0x61, 0x67, 
+    0x65, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x20, 0x3D, 0x20, 0x6D, 
+    0x61, 0x6B, 0x65, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 
+    0x3D, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x76, 
+    0x65, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 
+    0x20, 0x75, 0x76, 0x73, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x69, 0x67, 0x6E, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x28, 0x69, 0x6D, 0x61, 0x67, 
+    0x65, 0x2E, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x22, 0x70, 0x72, 
+    0x65, 0x6D, 0x75, 0x6C, 0x74, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x22, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x22, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 
+    0x61, 0x6D, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x20, 
+    0x61, 0x6E, 0x64, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x70, 0x72, 0x65, 0x6D, 0x75, 
+    0x6C, 0x74, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x20, 0x6F, 0x72, 
+    0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 
+    0x62, 0x69, 0x6E, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x75, 0x76, 0x20, 0x3D, 0x20, 0x75, 0x76, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x74, 0x65, 
+    0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x61, 0x6D, 0x2E, 0x64, 0x72, 0x61, 0x77, 
+    0x28, 0x22, 0x74, 0x72, 0x69, 0x61, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x65, 
+    0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x69, 0x6D, 0x67, 0x30, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 
+    0x72, 0x74, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x28, 0x69, 0x6D, 0x67, 
+    0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x30, 0x20, 0x3D, 0x20, 
+    0x69, 0x6D, 0x67, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x72, 
+    0x69, 0x74, 0x65, 0x5F, 0x76, 0x65, 0x72, 0x74, 0x73, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x73, 0x2C, 0x20, 0x75, 0x76, 0x73, 0x2C, 0x20, 0x68, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2C, 0x20, 0x76, 0x61, 0x6C, 
+    0x69, 0x67, 0x6E, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 
+    0x6E, 0x64, 0x22, 0x2E, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x73, 0x65, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x63, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6C, 0x66, 0x22, 0x62, 0x69, 0x6E, 0x64, 0x22, 0x2E, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 
+    0x65, 0x74, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
+    0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x67, 0x65, 0x74, 0x5F, 0x73, 0x70, 0x65, 0x63, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6D, 0x61, 
+    0x67, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x69, 0x6E, 0x69, 0x74, 
+    0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x69, 0x6D, 0x67, 0x66, 0x69, 0x6C, 0x65, 
+    0x2C, 0x20, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x5F, 0x2C, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 
+    0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x66, 0x69, 0x6C, 0x65, 
+    0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x22, 0x28, 0x5B, 0x5E, 0x2F, 0x3A, 0x5C, 0x5C, 0x5D, 
+    0x2B, 0x29, 0x25, 0x2E, 0x28, 0x5B, 0x5E, 0x2F, 0x25, 0x2E, 0x3A, 0x5C, 0x5C, 0x5D, 0x2B, 0x29, 0x24, 0x22, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x69, 0x73, 0x5F, 
+    0x66, 0x6F, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 
+    0x28, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 
+    0x61, 0x6D, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 
+    0x6D, 0x65, 0x2C, 0x20, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 
+    0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 
+    0x2E, 0x73, 0x69, 0x7A, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61, 
+    0x6D, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x73, 0x69, 0x7A, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x20, 0x22, 0x2E, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 
+    0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x33, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x69, 0x73, 0x5F, 0x70, 0x72, 
+    0x65, 0x6D, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 
+    0x75, 0x6C, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5B, 0x6E, 0x61, 0x6D, 
+    0x65, 0x5D, 0x20, 0x3D, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 
+    0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x5F, 0x69, 0x6D, 
+    0x61, 0x67, 0x65, 0x28, 0x69, 0x6D, 0x67, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 0x69, 0x6D, 0x67, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x6D, 0x69, 0x6E, 
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6D, 0x69, 0x6E, 0x66, 0x69, 0x6C, 
+    0x74, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 
+    0x75, 0x72, 0x65, 0x2E, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 
+    0x2E, 0x6D, 0x61, 0x67, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x6D, 0x65, 
+    0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x7B, 0x5F, 0x5F, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x6F, 0x6E, 0x74, 0x73, 
+    0x2C, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 
+    0x61, 0x6D, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 
+    0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x3D, 0x20, 0x64, 
+    0x61, 0x74, 0x61, 0x5B, 0x6E, 0x61, 0x6D, 0x65, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x73, 0x75, 0x72, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x2E, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6E, 0x64, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6F, 0x6E, 
+    0x74, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x73, 0x70, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x67, 0x72, 0x69, 0x64, 0x28, 0x66, 0x69, 0x6C, 
+    0x65, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x2C, 
+    0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 
+    0x6F, 0x72, 0x28, 0x74, 0x65, 0x78, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x2F, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x29, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 0x74, 0x65, 0x78, 0x2E, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2F, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x72, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x2E, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x64, 0x78, 0x20, 0x3D, 0x20, 0x77, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x79, 0x20, 0x3D, 0x20, 0x68, 0x20, 0x2F, 
+    0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x64, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x74, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 
+    0x5F, 0x72, 0x6F, 0x77, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 
+    0x31, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 
+    0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x67, 0x72, 0x69, 0x64, 0x5B, 0x72, 0x6F, 0x77, 0x5D, 0x5B, 0x63, 0x6F, 0x6C, 0x5D, 0x20, 0x3D, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x31, 
+    0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x79, 0x31, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x64, 0x78, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x64, 0x79, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x31, 0x20, 0x3D, 
+    0x20, 0x28, 0x63, 0x6F, 0x6C, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x64, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x28, 0x6E, 
+    0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x2D, 0x20, 0x72, 0x6F, 0x77, 0x29, 0x20, 0x2A, 0x20, 0x64, 0x74, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x32, 0x20, 
+    0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x2A, 0x20, 0x64, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 
+    0x77, 0x73, 0x20, 0x2D, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x64, 0x74, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x20, 0x3D, 0x20, 0x64, 0x78, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x79, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 
+    0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x72, 0x69, 0x64, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 
+    0x62, 0x69, 0x74, 0x6D, 0x61, 0x70, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 
+    0x2C, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 
+    0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x28, 0x61, 0x6D, 0x2E, 0x5F, 0x6C, 0x6F, 0x61, 0x64, 0x5F, 0x65, 0x6D, 0x62, 0x65, 
+    0x64, 0x64, 0x65, 0x64, 0x5F, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x29, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 
+    0x64, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x2C, 0x20, 
+    0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x6F, 0x77, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x2C, 
+    0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x2C, 0x20, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x75, 
+    0x74, 0x66, 0x38, 0x2E, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x63, 0x20, 0x7E, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x68, 0x61, 0x72, 0x73, 0x5B, 0x63, 0x5D, 0x20, 0x3D, 0x20, 0x7B, 0x72, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x72, 0x6F, 0x77, 
+    0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 
+    0x6D, 0x61, 0x78, 0x28, 0x63, 0x6F, 0x6C, 0x20, 0x2D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 
+    0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6F, 0x77, 0x20, 0x3D, 
+    0x20, 0x72, 0x6F, 0x77, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x63, 0x6F, 0x6C, 0x20, 0x2D, 0x20, 0x31, 
+    0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 
+    0x72, 0x6F, 0x77, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+    0x72, 0x6F, 0x77, 0x20, 0x2D, 0x20, 0x31, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 
+    0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x78, 0x20, 0x3D, 0x20, 0x77, 0x20, 0x2F, 
+    0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x64, 0x79, 0x20, 0x3D, 0x20, 0x68, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 
+    0x5F, 0x63, 0x6F, 0x6C, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x74, 0x20, 0x3D, 
+    0x20, 0x31, 0x20, 0x2F, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 
+    0x72, 0x20, 0x63, 0x2C, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x63, 
+    0x68, 0x61, 0x72, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x69, 0x2C, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x63, 0x6F, 0x6C, 0x20, 0x2D, 
+    0x20, 0x31, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x72, 0x6F, 0x77, 0x73, 0x20, 0x2D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 
+    0x72, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x78, 0x31, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x79, 0x31, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x78, 0x32, 0x20, 
+    0x3D, 0x20, 0x64, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x79, 0x32, 
+    0x20, 0x3D, 0x20, 0x64, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 
+    0x31, 0x20, 0x3D, 0x20, 0x69, 0x20, 0x2A, 0x20, 0x64, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x6E, 0x66, 0x6F, 0x2E, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x6A, 0x20, 0x2A, 0x20, 0x64, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 0x32, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x73, 
+    0x31, 0x20, 0x2B, 0x20, 0x64, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 
+    0x74, 0x32, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x74, 0x31, 0x20, 0x2B, 0x20, 0x64, 0x74, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x2E, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x3D, 
+    0x20, 0x64, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x69, 0x6E, 0x65, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x79, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x6D, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x61, 
+    0x6C, 0x73, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73, 0x5F, 0x66, 0x6F, 0x6E, 0x74, 
+    0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 
+    0x72, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6F, 0x6E, 0x74, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data17[] = {
+    0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x61, 0x6D, 
+    0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+    0x20, 0x36, 0x30, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 
+    0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x70, 0x73, 
+    0x5F, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x5F, 
+    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x5F, 0x70, 0x72, 0x65, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x66, 
+    0x75, 0x6E, 0x63, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 
+    0x72, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 
+    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 
+    0x74, 0x69, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x64, 0x74, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5B, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x70, 0x6F, 0x73, 
+    0x5D, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2D, 0x20, 0x66, 0x70, 0x73, 0x5F, 
+    0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x70, 0x72, 
+    0x65, 0x76, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x75, 0x72, 0x72, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x3D, 
+    0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x70, 0x6F, 0x73, 0x20, 0x25, 0x20, 0x66, 0x70, 
+    0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x65, 0x6E, 
+    0x64, 0x29, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x65, 0x72, 0x66, 
+    0x5F, 0x73, 0x74, 0x61, 0x74, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 
+    0x74, 0x61, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x30, 
+    0x30, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x64, 0x74, 0x20, 
+    0x3D, 0x20, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+    0x69, 0x20, 0x3D, 0x20, 0x31, 0x2C, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5F, 0x73, 0x69, 
+    0x7A, 0x65, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x70, 0x73, 
+    0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5B, 0x69, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 
+    0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 
+    0x6E, 0x64, 0x6F, 0x77, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x66, 0x70, 0x73, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5B, 0x69, 0x5D, 0x20, 0x3E, 0x20, 0x6D, 
+    0x61, 0x78, 0x5F, 0x64, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x64, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x70, 0x73, 0x5F, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x5B, 0x69, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+    0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x2D, 0x2D, 0x6C, 0x6F, 0x67, 0x28, 0x22, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 
+    0x25, 0x30, 0x2E, 0x35, 0x66, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x25, 0x30, 
+    0x2E, 0x35, 0x66, 0x22, 0x2C, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x6D, 0x61, 
+    0x78, 0x5F, 0x64, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2E, 0x74, 0x69, 0x6D, 0x65, 
+    0x20, 0x3D, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 
+    0x61, 0x74, 0x73, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2E, 0x6D, 0x69, 0x6E, 0x5F, 0x66, 0x70, 0x73, 0x20, 0x3D, 0x20, 0x31, 
+    0x20, 0x2F, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x64, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2E, 
+    0x61, 0x76, 0x67, 0x5F, 0x66, 0x70, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x2F, 0x20, 0x74, 0x6F, 
+    0x74, 0x61, 0x6C, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2E, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x5F, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x64, 0x72, 0x61, 0x77, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x75, 0x73, 0x65, 
+    0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x5F, 0x63, 
+    0x61, 0x6C, 0x6C, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x74, 
+    0x61, 0x74, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x65, 0x72, 0x66, 0x5F, 
+    0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 
+    0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6D, 0x2E, 
+    0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x65, 0x72, 0x66, 
+    0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x70, 0x65, 0x72, 0x66, 
+    0x5F, 0x74, 0x69, 0x6D, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x62, 0x61, 0x72, 0x5F, 0x77, 0x20, 0x3D, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x20, 0x3D, 0x20, 0x31, 0x30, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x68, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x69, 0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x20, 0x3D, 
+    0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x74, 0x20, 0x3D, 
+    0x20, 0x31, 0x2F, 0x36, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x67, 
+    0x72, 0x61, 0x70, 0x68, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 
+    0x20, 0x30, 0x2E, 0x37, 0x38, 0x38, 0x2C, 0x20, 0x30, 0x2E, 0x39, 0x34, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 
+    0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x36, 0x31, 0x39, 0x2C, 0x20, 0x30, 0x2E, 0x39, 
+    0x34, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x31, 0x34, 0x39, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x30, 0x39, 0x2C, 0x20, 0x30, 
+    0x2E, 0x33, 0x30, 0x31, 0x2C, 0x20, 0x30, 0x2E, 0x38, 0x35, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+    0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x36, 0x33, 0x39, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x30, 0x2E, 0x37, 0x39, 
+    0x32, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 
+    0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 
+    0x2C, 0x20, 0x30, 0x2E, 0x33, 0x30, 0x31, 0x2C, 0x20, 0x30, 0x2E, 0x34, 0x35, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2C, 0x20, 0x30, 0x2E, 0x36, 0x31, 0x39, 0x2C, 
+    0x20, 0x30, 0x2E, 0x37, 0x30, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2E, 0x39, 0x38, 0x34, 0x2C, 0x20, 0x30, 0x2E, 0x39, 0x32, 0x35, 0x2C, 0x20, 0x30, 
+    0x2E, 0x31, 0x33, 0x37, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x67, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x29, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x63, 
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x61, 0x6D, 
+    0x2E, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x3D, 0x20, 
+    0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x77, 0x2C, 0x20, 0x70, 0x68, 0x20, 0x3D, 
+    0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x77, 0x69, 
+    0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x77, 0x20, 0x3D, 0x20, 0x70, 0x77, 0x20, 
+    0x2D, 0x20, 0x62, 0x75, 0x66, 0x20, 0x2A, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x61, 0x72, 0x73, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x63, 0x65, 0x69, 0x6C, 
+    0x28, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x77, 0x20, 0x2F, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x77, 0x29, 0x20, 
+    0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 0x75, 
+    0x61, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x61, 0x72, 0x73, 0x20, 0x2A, 0x20, 0x6E, 0x75, 0x6D, 
+    0x5F, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x20, 
+    0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x71, 0x75, 
+    0x61, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x71, 0x75, 0x61, 0x64, 0x73, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x71, 
+    0x75, 0x61, 0x64, 0x73, 0x2C, 0x20, 0x7B, 0x22, 0x76, 0x65, 0x72, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x32, 
+    0x22, 0x2C, 0x20, 0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x2C, 0x20, 0x22, 0x76, 0x65, 0x63, 0x34, 0x22, 0x7D, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x20, 
+    0x3D, 0x20, 0x62, 0x75, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x72, 0x61, 0x70, 
+    0x68, 0x5F, 0x79, 0x32, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x20, 0x2B, 0x20, 0x67, 0x72, 
+    0x61, 0x70, 0x68, 0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x72, 0x61, 0x70, 
+    0x68, 0x5F, 0x78, 0x31, 0x20, 0x3D, 0x20, 0x62, 0x75, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x31, 
+    0x20, 0x2B, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x31, 0x20, 0x2B, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x62, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 
+    0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x20, 0x5E, 0x20, 0x62, 0x61, 0x72, 
+    0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x6E, 
+    0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x67, 0x72, 0x6F, 0x75, 0x70, 
+    0x28, 0x29, 0x20, 0x5E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x6C, 0x69, 
+    0x6E, 0x65, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x31, 0x2C, 0x20, 0x66, 0x70, 
+    0x73, 0x36, 0x30, 0x5F, 0x79, 0x29, 0x2C, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 
+    0x32, 0x2C, 0x20, 0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x79, 0x29, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x66, 0x70, 0x73, 0x36, 
+    0x30, 0x5F, 0x6C, 0x69, 0x6E, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x67, 0x72, 0x61, 0x70, 
+    0x68, 0x5F, 0x78, 0x31, 0x20, 0x2B, 0x20, 0x35, 0x2C, 0x20, 0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x79, 0x20, 0x2D, 0x20, 
+    0x35, 0x29, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x30, 0x22, 0x2C, 0x20, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x65, 0x66, 
+    0x74, 0x22, 0x2C, 0x20, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x66, 0x72, 0x61, 0x6D, 0x65, 
+    0x5F, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 
+    0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x31, 0x20, 0x2B, 0x20, 0x35, 0x2C, 0x20, 
+    0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x32, 0x35, 0x29, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 
+    0x65, 0x78, 0x74, 0x28, 0x22, 0x30, 0x22, 0x2C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 
+    0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x3A, 
+    0x74, 0x61, 0x67, 0x22, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 
+    0x31, 0x20, 0x2B, 0x20, 0x35, 0x2C, 0x20, 0x66, 0x70, 0x73, 0x36, 0x30, 0x5F, 0x79, 0x20, 0x2D, 0x20, 0x34, 0x35, 0x29, 
+    0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x30, 0x22, 0x2C, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 
+    0x74, 0x65, 0x78, 0x74, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x20, 
+    0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x3A, 0x74, 0x61, 0x67, 0x22, 0x6D, 0x65, 0x6D, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5F, 0x74, 0x65, 0x73, 
+    0x74, 0x28, 0x22, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x22, 0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x7B, 0x50, 0x20, 0x3D, 
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 0x30, 0x2C, 0x20, 0x70, 0x77, 0x2C, 0x20, 0x30, 
+    0x2C, 0x20, 0x70, 0x68, 0x29, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x75, 0x73, 0x65, 0x5F, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x28, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x61, 0x64, 0x65, 
+    0x72, 0x73, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x73, 0x32, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x22, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x7B, 0x62, 0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 
+    0x61, 0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x7D, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6C, 0x75, 0x61, 0x5F, 0x79, 0x20, 
+    0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 
+    0x68, 0x5F, 0x79, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x6D, 0x61, 0x78, 0x5F, 0x6D, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x66, 
+    0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x69, 0x6E, 0x3A, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x28, 0x29, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 
+    0x2E, 0x68, 0x69, 0x64, 0x65, 0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x68, 0x6F, 0x77, 
+    0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x63, 
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 
+    0x74, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x20, 0x2D, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x20, 0x3D, 0x20, 
+    0x61, 0x6D, 0x2E, 0x6C, 0x61, 0x73, 0x74, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x69, 
+    0x6D, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 
+    0x75, 0x61, 0x5F, 0x68, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x6D, 0x69, 0x6E, 0x5F, 
+    0x62, 0x61, 0x72, 0x5F, 0x68, 0x2C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x20, 0x2F, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x74, 
+    0x20, 0x2A, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x78, 0x31, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x32, 0x20, 0x2B, 0x20, 
+    0x28, 0x6E, 0x2D, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x78, 0x31, 0x20, 0x2B, 0x20, 0x62, 0x61, 
+    0x72, 0x5F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x75, 
+    0x61, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x20, 0x2B, 0x20, 0x6C, 0x75, 0x61, 
+    0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x20, 0x2B, 0x20, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 0x20, 0x2F, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x74, 0x20, 
+    0x2A, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x74, 0x6F, 0x70, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x32, 0x29, 0x20, 0x2B, 0x20, 
+    0x6D, 0x69, 0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x6F, 0x70, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 
+    0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x2C, 0x20, 
+    0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x32, 0x29, 0x20, 0x2B, 0x20, 0x6D, 0x69, 0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 
+    0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x6D, 0x20, 
+    0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x28, 0x22, 0x63, 0x6F, 
+    0x75, 0x6E, 0x74, 0x22, 0x29, 0x20, 0x2B, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x5F, 0x62, 0x75, 
+    0x66, 0x66, 0x65, 0x72, 0x5F, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x5F, 0x6D, 0x65, 0x6D, 0x28, 0x29, 0x20, 0x2B, 0x20, 
+    0x61, 0x6D, 0x2E, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5F, 0x70, 0x6F, 0x6F, 0x6C, 0x5F, 0x6D, 0x65, 0x6D, 0x28, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x65, 0x6D, 0x20, 0x3E, 0x20, 0x6D, 
+    0x61, 0x78, 0x5F, 0x6D, 0x65, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x6D, 0x61, 
+    0x78, 0x5F, 0x6D, 0x65, 0x6D, 0x20, 0x2F, 0x20, 0x28, 0x6D, 0x65, 0x6D, 0x20, 0x2A, 0x20, 0x31, 0x2E, 0x35, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x2E, 0x76, 0x65, 0x72, 0x74, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 
+    0x3D, 0x20, 0x31, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x62, 0x61, 0x72, 0x73, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x71, 
+    0x20, 0x3D, 0x20, 0x28, 0x69, 0x2D, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x65, 0x72, 0x69, 0x65, 
+    0x73, 0x20, 0x2B, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x28, 0x71, 0x2D, 0x31, 0x29, 0x20, 0x2A, 0x20, 
+    0x34, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 
+    0x76, 0x20, 0x2B, 0x20, 0x31, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x65, 0x77, 0x31, 0x20, 0x3D, 0x20, 0x6F, 0x6C, 0x64, 0x7B, 
+    0x79, 0x20, 0x3D, 0x20, 0x28, 0x6F, 0x6C, 0x64, 0x2E, 0x79, 0x20, 0x2D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x31, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x20, 0x2B, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x31, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6E, 0x65, 0x77, 0x32, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x31, 0x7B, 0x79, 0x20, 0x3D, 
+    0x20, 0x6E, 0x65, 0x77, 0x31, 0x2E, 0x79, 0x20, 0x2D, 0x20, 0x6D, 0x69, 0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 
+    0x74, 0x73, 0x5B, 0x76, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x31, 
+    0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 
+    0x20, 0x33, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6E, 0x65, 0x77, 0x31, 0x20, 0x3D, 0x20, 0x6F, 0x6C, 0x64, 0x7B, 0x79, 0x20, 0x3D, 0x20, 0x28, 0x6F, 0x6C, 0x64, 0x2E, 
+    0x79, 0x20, 0x2D, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x63, 0x61, 0x6C, 
+    0x65, 0x20, 0x2B, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x65, 0x77, 0x32, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 
+    0x31, 0x7B, 0x79, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x31, 0x2E, 0x79, 0x20, 0x2D, 0x20, 0x6D, 0x69, 0x6E, 0x5F, 0x62, 
+    0x61, 0x72, 0x5F, 0x68, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x33, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 
+    0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 
+    0x72, 0x74, 0x73, 0x5B, 0x76, 0x20, 0x2B, 0x20, 0x32, 0x5D, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x32, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x6D, 0x65, 0x6D, 0x20, 0x3D, 0x20, 0x28, 0x6D, 0x65, 0x6D, 
+    0x20, 0x2A, 0x20, 0x31, 0x2E, 0x35, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x20, 
+    0x3D, 0x20, 0x6D, 0x65, 0x6D, 0x20, 0x2F, 0x20, 0x6D, 0x61, 0x78, 0x5F, 0x6D, 0x65, 0x6D, 0x20, 0x2A, 0x20, 0x62, 0x61, 
+    0x72, 0x5F, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 
+    0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x61, 0x72, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 
+    0x3D, 0x20, 0x7B, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x31, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x32, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x31, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x31, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x32, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x31, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x78, 0x32, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 
+    0x32, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x62, 0x67, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 
+    0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 
+    0x7B, 0x78, 0x31, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x74, 0x6F, 0x70, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x31, 0x2C, 
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x74, 0x6F, 0x70, 0x5F, 0x79, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x20, 0x3D, 0x20, 0x62, 0x67, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x3A, 0x61, 0x64, 
+    0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x78, 0x31, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6C, 0x75, 0x61, 
+    0x5F, 0x79, 0x2C, 0x20, 0x78, 0x31, 0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 
+    0x2C, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 
+    0x79, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x20, 0x3D, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x61, 0x72, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x78, 
+    0x31, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x31, 0x2C, 
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6C, 0x75, 0x61, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x6C, 0x75, 0x61, 
+    0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x5F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x71, 
+    0x75, 0x61, 0x64, 0x73, 0x3A, 0x61, 0x64, 0x64, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x78, 0x31, 0x2C, 0x20, 0x70, 
+    0x72, 0x65, 0x76, 0x5F, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x2B, 0x6D, 0x69, 0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x2C, 
+    0x20, 0x78, 0x31, 0x2C, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 
+    0x20, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x2B, 0x6D, 0x69, 
+    0x6E, 0x5F, 0x62, 0x61, 0x72, 0x5F, 0x68, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5F, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6C, 0x75, 0x61, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6C, 0x75, 
+    0x61, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x5F, 0x6D, 0x65, 0x6D, 0x5F, 0x79, 0x20, 0x3D, 0x20, 0x6D, 0x65, 0x6D, 0x5F, 
+    0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x20, 0x3E, 0x3D, 0x20, 0x6E, 0x75, 
+    0x6D, 0x5F, 0x62, 0x61, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x5F, 0x71, 0x75, 0x61, 0x64, 0x73, 0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x5F, 0x71, 0x75, 0x61, 0x64, 0x28, 0x31, 0x2C, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6E, 0x20, 0x3D, 0x20, 0x6E, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x61, 0x72, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x2E, 0x78, 0x20, 0x3D, 0x20, 0x67, 0x72, 0x61, 
+    0x70, 0x68, 0x5F, 0x78, 0x32, 0x20, 0x2D, 0x20, 0x78, 0x31, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x74, 0x22, 
+    0x2E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 
+    0x74, 0x28, 0x22, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x3A, 0x20, 0x20, 0x20, 0x25, 0x34, 0x64, 0x6D, 0x73, 0x22, 0x2C, 0x20, 
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x5F, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 0x20, 0x2A, 0x20, 0x31, 0x30, 0x30, 0x30, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
+    0x73, 0x22, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x22, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x20, 0x20, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x22, 0x4C, 0x55, 0x41, 0x3A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x25, 0x34, 0x64, 0x6D, 0x73, 0x22, 0x2C, 0x20, 0x6C, 0x75, 0x61, 0x5F, 0x74, 0x20, 0x2A, 0x20, 0x31, 0x30, 
+    0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 
+    0x6F, 0x6E, 0x73, 0x22, 0x6D, 0x65, 0x6D, 0x22, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x28, 0x22, 0x4C, 0x55, 0x41, 0x20, 0x4D, 
+    0x45, 0x4D, 0x3A, 0x20, 0x25, 0x34, 0x64, 0x4D, 0x42, 0x22, 0x2C, 0x20, 0x6D, 0x65, 0x6D, 0x20, 0x2F, 0x20, 0x31, 0x30, 
+    0x32, 0x34, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x70, 0x65, 0x72, 
+    0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x68, 0x69, 0x64, 0x65, 0x5F, 0x70, 0x65, 
+    0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 
+    0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 
+    0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 
+    0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 
+    0x3A, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 
+    0x5F, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 
+    0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x6F, 0x67, 0x67, 
+    0x6C, 0x65, 0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x5F, 0x6E, 0x6F, 
+    0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x68, 
+    0x69, 0x64, 0x65, 0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x73, 
+    0x68, 0x6F, 0x77, 0x5F, 0x70, 0x65, 0x72, 0x66, 0x5F, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data18[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x3D, 0x20, 0x5F, 0x47, 0x2E, 0x64, 0x65, 0x62, 
+    0x75, 0x67, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x63, 0x5F, 0x73, 
+    0x74, 0x61, 0x63, 0x6B, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x74, 0x72, 0x61, 0x63, 0x65, 0x62, 0x61, 0x63, 
+    0x6B, 0x28, 0x6D, 0x73, 0x67, 0x2C, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 0x3A, 0x6D, 0x61, 0x74, 
+    0x63, 0x68, 0x28, 0x22, 0x5E, 0x2E, 0x2A, 0x5F, 0x5F, 0x63, 0x6F, 0x72, 0x6F, 0x75, 0x74, 0x69, 0x6E, 0x65, 0x5F, 0x5F, 
+    0x28, 0x2E, 0x2A, 0x29, 0x24, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2E, 0x74, 0x72, 0x61, 0x63, 0x65, 0x62, 
+    0x61, 0x63, 0x6B, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2C, 0x20, 0x6D, 0x73, 0x67, 0x2C, 0x20, 0x32, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x73, 0x67, 
+    0x20, 0x3D, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2E, 0x74, 0x72, 0x61, 0x63, 0x65, 0x62, 0x61, 0x63, 0x6B, 0x28, 0x6D, 
+    0x73, 0x67, 0x2C, 0x20, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x22, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x5F, 0x63, 0x5F, 0x73, 0x74, 0x61, 
+    0x63, 0x6B, 0x5F, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 0x3A, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x5C, 0x6E, 
+    0x5C, 0x74, 0x25, 0x5B, 0x43, 0x25, 0x5D, 0x3A, 0x5B, 0x5E, 0x5C, 0x6E, 0x5D, 0x2A, 0x22, 0x2C, 0x20, 0x22, 0x22, 0x29, 
+    0x3A, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x5C, 0x6E, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 
+    0x62, 0x61, 0x63, 0x6B, 0x3A, 0x24, 0x22, 0x2C, 0x20, 0x22, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 
+    0x3A, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x5C, 0x74, 0x22, 0x2C, 0x20, 0x22, 0x20, 0x20, 0x20, 0x20, 0x22, 0x29, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x6B, 0x74, 0x6F, 
+    0x70, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 
+    0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6F, 0x73, 0x78, 0x22, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6D, 0x2E, 0x70, 
+    0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6C, 0x69, 0x6E, 0x75, 0x78, 0x22, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x67, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x61, 
+    0x6D, 0x2E, 0x61, 0x70, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x5F, 0x64, 0x69, 0x72, 0x2E, 0x2E, 0x22, 0x6C, 0x6F, 0x67, 
+    0x2E, 0x74, 0x78, 0x74, 0x22, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 
+    0x69, 0x6E, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x22, 0x45, 0x52, 0x52, 0x4F, 
+    0x52, 0x3A, 0x5C, 0x6E, 0x5C, 0x6E, 0x22, 0x2E, 0x2E, 0x6D, 0x73, 0x67, 0x2E, 0x2E, 0x22, 0x5C, 0x6E, 0x5C, 0x6E, 0x22, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6D, 0x2E, 0x73, 0x75, 0x70, 0x70, 0x6F, 
+    0x72, 0x74, 0x5F, 0x65, 0x6D, 0x61, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x78, 0x74, 0x2E, 0x2E, 0x22, 0x5C, 0x6E, 
+    0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6E, 
+    0x73, 0x68, 0x6F, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x74, 
+    0x6F, 0x20, 0x22, 0x2E, 0x2E, 0x61, 0x6D, 0x2E, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x5F, 0x65, 0x6D, 0x61, 0x69, 
+    0x6C, 0x2E, 0x2E, 0x22, 0x2E, 0x5C, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x73, 0x5F, 0x64, 0x65, 0x73, 0x6B, 0x74, 
+    0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x78, 0x74, 0x2E, 0x2E, 0x22, 0x5C, 0x6E, 0x41, 0x20, 0x63, 0x6F, 0x70, 0x79, 
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 
+    0x65, 0x65, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x22, 0x2E, 0x2E, 0x6C, 0x6F, 0x67, 0x66, 
+    0x69, 0x6C, 0x65, 0x2E, 0x2E, 0x22, 0x2E, 0x5C, 0x6E, 0x5C, 0x6E, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x45, 0x53, 0x43, 
+    0x20, 0x74, 0x6F, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x5C, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x5F, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 
+    0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
+    0x6E, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 
+    0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 
+    0x62, 0x69, 0x6E, 0x64, 0x7B, 0x50, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 
+    0x30, 0x2C, 0x20, 0x77, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x68, 0x2C, 0x20, 0x2D, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x31, 0x30, 0x2C, 0x20, 0x68, 0x20, 0x2D, 0x20, 0x31, 
+    0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 
+    0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x74, 0x78, 0x74, 0x2C, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 
+    0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x20, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x20, 
+    0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 
+    0x69, 0x6E, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x77, 0x69, 0x6E, 0x3A, 0x6B, 0x65, 0x79, 0x5F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 
+    0x64, 0x22, 0x65, 0x73, 0x63, 0x61, 0x70, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x6E, 0x3A, 0x63, 
+    0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x73, 
+    0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x66, 0x69, 0x6C, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x20, 0x3D, 0x20, 0x61, 
+    0x6D, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x69, 0x73, 
+    0x5F, 0x64, 0x65, 0x73, 0x6B, 0x74, 0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x20, 0x3D, 0x20, 0x69, 0x6F, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 
+    0x6C, 0x6F, 0x67, 0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x22, 0x77, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x6D, 0x73, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x5C, 0x6E, 
+    0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x3A, 0x63, 0x6C, 0x6F, 
+    0x73, 0x65, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x73, 0x67, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data19[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x69, 0x78, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x69, 0x78, 
+    0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x28, 
+    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x61, 0x73, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x6E, 0x75, 
+    0x6D, 0x62, 0x65, 0x72, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x65, 0x61, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x74, 
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x77, 
+    0x65, 0x65, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 
+    0x72, 0x28, 0x22, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x77, 0x65, 
+    0x65, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x20, 0x74, 0x68, 0x65, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6D, 0x69, 0x73, 
+    0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x61, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x61, 
+    0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x63, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x6B, 0x2C, 0x20, 0x76, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 0x69, 0x6E, 
+    0x61, 0x6C, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x6B, 0x29, 0x20, 0x7E, 0x3D, 0x20, 0x22, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x20, 
+    0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x65, 0x63, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x20, 0x3D, 
+    0x20, 0x6B, 0x3A, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x22, 0x5E, 0x28, 0x2E, 0x2B, 0x29, 0x25, 0x2E, 0x28, 0x2E, 0x2B, 
+    0x29, 0x24, 0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x65, 0x63, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 
+    0x73, 0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x73, 0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x3D, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x6E, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 
+    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x64, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x69, 0x66, 
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x6E, 0x6F, 0x64, 0x65, 
+    0x5B, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x69, 
+    0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x65, 0x63, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 
+    0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x2C, 0x20, 0x63, 0x20, 0x3D, 0x20, 0x76, 0x65, 
+    0x63, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x73, 0x5B, 0x66, 0x69, 0x65, 
+    0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 
+    0x64, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x76, 0x5D, 0x5B, 0x63, 0x5D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x6E, 0x69, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 0x20, 
+    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x2B, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 
+    0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x65, 0x6C, 0x61, 0x70, 0x73, 
+    0x65, 0x64, 0x20, 0x3E, 0x3D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2D, 0x2D, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x65, 0x63, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 
+    0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x2C, 0x20, 0x63, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x73, 0x5B, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x76, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x61, 
+    0x72, 0x67, 0x65, 0x74, 0x5B, 0x76, 0x5D, 0x28, 0x63, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x2F, 
+    0x20, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 
+    0x65, 0x6C, 0x64, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x30, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x28, 0x69, 
+    0x6E, 0x69, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x6D, 
+    0x69, 0x78, 0x28, 0x76, 0x61, 0x6C, 0x30, 0x2C, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x2C, 0x20, 0x65, 0x61, 0x73, 0x65, 0x28, 0x74, 0x29, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x76, 0x65, 0x63, 0x73, 0x5B, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x76, 0x2C, 0x20, 0x63, 0x20, 0x3D, 0x20, 
+    0x76, 0x65, 0x63, 0x73, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x73, 0x5B, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x5D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x76, 0x5D, 0x20, 0x3D, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 
+    0x5B, 0x76, 0x5D, 0x28, 0x63, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5B, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x5D, 0x20, 0x3D, 
+    0x20, 0x76, 0x61, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x0A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x6F, 0x75, 0x74, 
+    0x28, 0x66, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x31, 0x20, 0x2D, 0x20, 0x66, 0x28, 0x31, 0x20, 0x2D, 0x20, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 
+    0x65, 0x61, 0x73, 0x65, 0x2E, 0x69, 0x6E, 0x6F, 0x75, 0x74, 0x28, 0x66, 0x2C, 0x20, 0x67, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x67, 0x20, 0x3D, 0x20, 0x67, 0x20, 0x6F, 0x72, 0x20, 0x66, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3C, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x28, 0x74, 0x29, 0x20, 0x2A, 
+    0x20, 0x30, 0x2E, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x20, 0x2D, 
+    0x20, 0x30, 0x2E, 0x35, 0x20, 0x2A, 0x20, 0x67, 0x28, 0x32, 0x20, 0x2D, 0x20, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x6C, 0x69, 
+    0x6E, 0x65, 0x61, 0x72, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 
+    0x73, 0x65, 0x2E, 0x71, 0x75, 0x61, 0x64, 0x72, 0x61, 0x74, 0x69, 0x63, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x63, 0x75, 0x62, 0x69, 0x63, 
+    0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 
+    0x20, 0x2A, 0x20, 0x74, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 
+    0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x68, 0x79, 0x70, 0x65, 0x72, 0x62, 0x6F, 0x6C, 0x61, 0x28, 0x74, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x35, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x31, 0x20, 0x2F, 0x20, 0x28, 0x31, 0x20, 0x2B, 0x20, 
+    0x73, 0x20, 0x2D, 0x20, 0x74, 0x29, 0x20, 0x2D, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 
+    0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x73, 0x69, 
+    0x6E, 0x65, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x6D, 0x61, 
+    0x74, 0x68, 0x2E, 0x73, 0x69, 0x6E, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x70, 0x69, 0x20, 0x2A, 0x20, 0x28, 0x74, 0x20, 
+    0x2D, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x35, 0x0A, 0x65, 
+    0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 
+    0x2E, 0x77, 0x69, 0x6E, 0x64, 0x75, 0x70, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x73, 0x20, 0x3D, 0x20, 0x31, 0x2E, 0x37, 0x30, 0x31, 0x35, 0x38, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x28, 0x28, 0x73, 0x20, 0x2B, 0x20, 0x31, 0x29, 
+    0x20, 0x2A, 0x20, 0x74, 0x20, 0x2D, 0x20, 0x73, 0x29, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x65, 0x6C, 0x61, 0x73, 0x74, 0x69, 0x63, 0x28, 
+    0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 
+    0x74, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x33, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x20, 0x2F, 0x20, 0x34, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x70, 0x6F, 0x77, 0x28, 0x32, 0x2C, 0x20, 0x2D, 0x31, 
+    0x30, 0x20, 0x2A, 0x20, 0x74, 0x29, 0x20, 0x2A, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x73, 0x69, 0x6E, 0x28, 0x28, 0x74, 
+    0x20, 0x2D, 0x20, 0x73, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x32, 0x20, 0x2A, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x70, 0x69, 
+    0x29, 0x20, 0x2F, 0x20, 0x70, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x62, 0x6F, 0x75, 0x6E, 0x63, 0x65, 0x28, 
+    0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x37, 0x2E, 0x35, 
+    0x36, 0x32, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x32, 0x2E, 
+    0x37, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x20, 0x3C, 0x20, 0x31, 0x20, 0x2F, 0x20, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x73, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x20, 0x3C, 0x20, 0x32, 0x20, 0x2F, 0x20, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x35, 0x20, 0x2F, 0x20, 
+    0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x73, 0x20, 
+    0x2A, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x37, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x74, 0x20, 0x3C, 0x20, 0x32, 0x2E, 0x35, 0x20, 0x2F, 0x20, 0x70, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 
+    0x74, 0x20, 0x2D, 0x20, 0x32, 0x2E, 0x32, 0x35, 0x20, 0x2F, 0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x73, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2A, 
+    0x20, 0x74, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x39, 0x33, 0x37, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x20, 0x2D, 0x20, 0x32, 0x2E, 0x36, 0x32, 0x35, 0x20, 0x2F, 
+    0x20, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 
+    0x20, 0x3D, 0x20, 0x73, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x39, 0x38, 0x34, 
+    0x33, 0x37, 0x35, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x65, 0x2E, 0x63, 0x75, 0x62, 0x69, 0x63, 
+    0x5F, 0x62, 0x65, 0x7A, 0x69, 0x65, 0x72, 0x28, 0x78, 0x31, 0x2C, 0x20, 0x79, 0x31, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 
+    0x79, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x78, 0x20, 0x3D, 0x20, 0x33, 
+    0x20, 0x2A, 0x20, 0x78, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 0x78, 0x20, 0x3D, 
+    0x20, 0x33, 0x20, 0x2A, 0x20, 0x28, 0x78, 0x32, 0x20, 0x2D, 0x20, 0x78, 0x31, 0x29, 0x20, 0x2D, 0x20, 0x63, 0x78, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x78, 0x20, 0x3D, 0x20, 0x31, 0x20, 0x2D, 0x20, 0x63, 
+    0x78, 0x20, 0x2D, 0x20, 0x62, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x79, 0x20, 
+    0x3D, 0x20, 0x33, 0x20, 0x2A, 0x20, 0x79, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x62, 
+    0x79, 0x20, 0x3D, 0x20, 0x33, 0x20, 0x2A, 0x20, 0x28, 0x79, 0x32, 0x20, 0x2D, 0x20, 0x79, 0x31, 0x29, 0x20, 0x2D, 0x20, 
+    0x63, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x20, 
+    0x2D, 0x20, 0x63, 0x79, 0x20, 0x2D, 0x20, 0x62, 0x79, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x43, 0x75, 0x72, 0x76, 0x65, 
+    0x58, 0x28, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x28, 0x28, 0x61, 0x78, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2B, 0x20, 0x62, 0x78, 0x29, 0x20, 0x2A, 0x20, 0x74, 0x20, 0x2B, 
+    0x20, 0x63, 0x78, 0x29, 0x20, 0x2A, 0x20, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x6F, 0x6C, 0x76, 
+    0x65, 0x43, 0x75, 0x72, 0x76, 0x65, 0x58, 0x28, 0x78, 0x2C, 0x20, 0x65, 0x70, 0x73, 0x69, 0x6C, 0x6F, 0x6E, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x30, 0x2C, 0x20, 0x74, 0x31, 
+    0x2C, 0x20, 0x74, 0x32, 0x2C, 0x20, 0x78, 0x32, 0x2C, 0x20, 0x64, 0x32, 0x2C, 0x20, 0x69, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x37, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x43, 0x75, 
+    0x72, 0x76, 0x65, 0x58, 0x28, 0x74, 0x32, 0x29, 0x20, 0x2D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x61, 0x62, 0x73, 0x28, 0x78, 0x32, 0x29, 
+    0x20, 0x3C, 0x20, 0x65, 0x70, 0x73, 0x69, 0x6C, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x32, 0x20, 0x3D, 0x20, 0x28, 0x33, 0x20, 0x2A, 0x20, 
+    0x61, 0x78, 0x20, 0x2A, 0x20, 0x74, 0x32, 0x20, 0x2B, 0x20, 0x32, 0x20, 0x2A, 0x20, 0x62, 0x78, 0x29, 0x20, 0x2A, 0x20, 
+    0x74, 0x32, 0x20, 0x2B, 0x20, 0x63, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x61, 0x62, 0x73, 0x28, 0x64, 0x32, 0x29, 0x20, 0x3C, 0x20, 0x31, 0x65, 
+    0x2D, 0x36, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 
+    0x20, 0x3D, 0x20, 0x74, 0x32, 0x20, 0x2D, 0x20, 0x78, 0x32, 0x20, 0x2F, 0x20, 0x64, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x30, 0x20, 0x3D, 
+    0x20, 0x30, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x31, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3D, 0x20, 0x78, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x32, 0x20, 0x3C, 0x20, 0x74, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x30, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x32, 0x20, 0x3E, 0x20, 0x74, 0x31, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x31, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 
+    0x6C, 0x65, 0x20, 0x74, 0x30, 0x20, 0x3C, 0x20, 0x74, 0x31, 0x20, 0x64, 0x6F, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x78, 0x32, 0x20, 0x3D, 0x20, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x43, 0x75, 0x72, 
+    0x76, 0x65, 0x58, 0x28, 0x74, 0x32, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x69, 0x66, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x61, 0x62, 0x73, 0x28, 0x78, 0x32, 0x20, 0x2D, 0x20, 0x78, 0x29, 0x20, 
+    0x3C, 0x20, 0x65, 0x70, 0x73, 0x69, 0x6C, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x32, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x3E, 0x20, 0x78, 0x32, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x30, 0x20, 0x3D, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x74, 0x31, 0x20, 0x3D, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x32, 0x20, 
+    0x3D, 0x20, 0x28, 0x74, 0x31, 0x20, 0x2D, 0x20, 0x74, 0x30, 0x29, 0x20, 0x2F, 0x20, 0x32, 0x20, 0x2B, 0x20, 0x74, 0x30, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x74, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x32, 0x20, 0x3D, 
+    0x20, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x43, 0x75, 0x72, 0x76, 0x65, 0x58, 0x28, 0x74, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x30, 
+    0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x28, 
+    0x61, 0x79, 0x20, 0x2A, 0x20, 0x74, 0x32, 0x20, 0x2B, 0x20, 0x62, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x74, 0x32, 0x20, 0x2B, 
+    0x20, 0x63, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x74, 0x32, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 
+    0x64, 0x0A, 0};
+
+static const uint8_t data20[] = {
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x20, 0x3D, 0x20, 0x67, 0x65, 0x74, 0x6D, 0x65, 
+    0x74, 0x61, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6D, 
+    0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 
+    0x20, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70, 0x65, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x75, 0x73, 0x65, 0x72, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x74, 0x68, 
+    0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x6D, 0x74, 0x20, 
+    0x3D, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x6D, 0x74, 0x28, 0x76, 0x61, 0x6C, 0x29, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6D, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x74, 0x2E, 0x74, 0x6E, 0x61, 0x6D, 
+    0x65, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x65, 0x6E, 0x64, 0x0A, 0};
+
+static const uint8_t data21[] = {
+    0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x73, 0x65, 0x65, 0x64, 0x28, 0x6F, 0x73, 0x2E, 0x74, 
+    0x69, 0x6D, 0x65, 0x28, 0x29, 0x29, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x30, 0x2E, 0x38, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 
+    0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x38, 0x2C, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 
+    0x28, 0x29, 0x20, 0x2A, 0x20, 0x30, 0x2E, 0x38, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x72, 
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x20, 0x3D, 0x20, 0x33, 0x30, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x69, 
+    0x6E, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x22, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2E, 0x2E, 0x2E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x74, 
+    0x65, 0x72, 0x62, 0x6F, 0x78, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 
+    0x63, 0x61, 0x6C, 0x20, 0x70, 0x70, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x70, 0x6F, 0x73, 0x74, 0x70, 0x72, 0x6F, 0x63, 
+    0x65, 0x73, 0x73, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 
+    0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 
+    0x74, 0x65, 0x28, 0x76, 0x65, 0x63, 0x33, 0x28, 0x2D, 0x32, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x29, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x74, 0x28, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 
+    0x73, 0x2C, 0x20, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x2C, 0x20, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x2C, 0x20, 
+    0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x0A, 0x0A, 0x6C, 0x6F, 0x63, 0x61, 
+    0x6C, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x31, 0x30, 0x30, 0x2C, 0x20, 
+    0x31, 0x30, 0x30, 0x29, 0x0A, 0x0A, 0x72, 0x65, 0x63, 0x74, 0x3A, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 
+    0x6F, 0x73, 0x20, 0x3D, 0x20, 0x72, 0x65, 0x63, 0x74, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x22, 
+    0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 
+    0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x2C, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x2E, 0x78, 0x20, 0x3C, 0x20, 0x2D, 0x77, 0x2F, 0x32, 
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2E, 0x78, 0x20, 0x3C, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 
+    0x70, 0x6F, 0x73, 0x2E, 0x78, 0x20, 0x3E, 0x20, 0x77, 0x2F, 0x32, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x65, 0x65, 
+    0x64, 0x2E, 0x78, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x7B, 0x78, 0x20, 0x3D, 0x20, 0x2D, 
+    0x73, 0x70, 0x65, 0x65, 0x64, 0x2E, 0x78, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x70, 0x6F, 0x73, 0x2E, 0x79, 0x20, 0x3C, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 
+    0x65, 0x65, 0x64, 0x2E, 0x79, 0x20, 0x3C, 0x20, 0x30, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x6F, 0x73, 0x2E, 0x79, 0x20, 0x3E, 
+    0x20, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2E, 0x79, 0x20, 0x3E, 0x20, 0x30, 0x20, 0x74, 
+    0x68, 0x65, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x3D, 0x20, 
+    0x73, 0x70, 0x65, 0x65, 0x64, 0x7B, 0x79, 0x20, 0x3D, 0x20, 0x2D, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2E, 0x79, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x20, 0x3D, 0x20, 0x70, 0x6F, 
+    0x73, 0x20, 0x2B, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x73, 0x70, 0x65, 0x65, 0x64, 0x2C, 0x20, 0x30, 0x29, 0x20, 0x2A, 
+    0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 0x69, 0x6D, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 
+    0x65, 0x63, 0x74, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x22, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x70, 0x6F, 0x73, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+    0x3D, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 
+    0x72, 0x2E, 0x72, 0x20, 0x2B, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 
+    0x20, 0x2A, 0x20, 0x34, 0x20, 0x2D, 0x20, 0x32, 0x29, 0x20, 0x2A, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 
+    0x5F, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x2E, 0x67, 0x20, 0x2B, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x20, 
+    0x2A, 0x20, 0x34, 0x20, 0x2D, 0x20, 0x32, 0x29, 0x20, 0x2A, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 
+    0x74, 0x69, 0x6D, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 
+    0x62, 0x20, 0x2B, 0x20, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x20, 0x2A, 
+    0x20, 0x34, 0x20, 0x2D, 0x20, 0x32, 0x29, 0x20, 0x2A, 0x20, 0x61, 0x6D, 0x2E, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x5F, 0x74, 
+    0x69, 0x6D, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x63, 0x6C, 
+    0x61, 0x6D, 0x70, 0x28, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x63, 0x74, 0x22, 0x72, 0x65, 0x63, 0x74, 0x22, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x70, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x5F, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x0A, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x77, 
+    0x69, 0x6E, 0x2E, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x20, 0x3D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x70, 0x3A, 0x61, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x61, 0x6D, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x77, 0x2C, 0x20, 0x68, 0x20, 0x3D, 0x20, 
+    0x77, 0x69, 0x6E, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x77, 0x69, 0x6E, 
+    0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x5F, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x77, 0x69, 0x6E, 0x2E, 0x70, 0x72, 0x6F, 0x6A, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x6D, 
+    0x61, 0x74, 0x68, 0x2E, 0x6F, 0x72, 0x74, 0x68, 0x6F, 0x28, 0x2D, 0x77, 0x2F, 0x32, 0x2C, 0x20, 0x77, 0x2F, 0x32, 0x2C, 
+    0x20, 0x30, 0x2C, 0x20, 0x68, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x5E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x63, 0x74, 0x2C, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x30, 
+    0x2C, 0x20, 0x34, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x73, 
+    0x63, 0x61, 0x6C, 0x65, 0x28, 0x76, 0x65, 0x63, 0x33, 0x28, 0x32, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x5E, 0x20, 0x61, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x41, 0x6D, 0x75, 0x6C, 0x65, 0x74, 0x20, 
+    0x76, 0x22, 0x2E, 0x2E, 0x61, 0x6D, 0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x2E, 0x22, 0x5C, 0x6E, 0x77, 
+    0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2E, 0x2E, 0x2E, 
+    0x22, 0x2C, 0x20, 0x22, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x20, 0x22, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 
+    0x22, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0};
+
+static const uint8_t data22[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x20, 
+    0x00, 0x00, 0x00, 0x80, 0x08, 0x06, 0x00, 0x00, 0x00, 0xAB, 0xE8, 0xB4, 0xDA, 0x00, 0x00, 0x0A, 0x2F, 0x69, 0x43, 0x43, 
+    0x50, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x00, 0x00, 0x48, 0xC7, 0x9D, 0x96, 0x77, 0x54, 
+    0x54, 0xD7, 0x16, 0x87, 0xCF, 0xBD, 0x77, 0x7A, 0xA1, 0xCD, 0x30, 0xD2, 0x19, 0x7A, 0x93, 0x2E, 0x30, 0x80, 0xF4, 0x2E, 
+    0x20, 0x1D, 0x04, 0x51, 0x18, 0x66, 0x06, 0x18, 0xCA, 0x00, 0xC3, 0x0C, 0x4D, 0x6C, 0x88, 0xA8, 0x40, 0x44, 0x11, 0x11, 
+    0x01, 0x45, 0x90, 0xA0, 0x80, 0x01, 0xA3, 0xA1, 0x48, 0xAC, 0x88, 0x62, 0x21, 0x28, 0xA8, 0x60, 0x0F, 0x48, 0x10, 0x50, 
+    0x62, 0x30, 0x8A, 0xA8, 0xA8, 0x64, 0x46, 0xD6, 0x4A, 0x7C, 0x79, 0x79, 0xEF, 0xE5, 0xE5, 0xF7, 0xC7, 0xBD, 0xDF, 0xDA, 
+    0x67, 0xEF, 0x73, 0xF7, 0xD9, 0x7B, 0x9F, 0xB5, 0x2E, 0x00, 0x24, 0x4F, 0x1F, 0x2E, 0x2F, 0x05, 0x96, 0x02, 0x20, 0x99, 
+    0x27, 0xE0, 0x07, 0x7A, 0x38, 0xD3, 0x57, 0x85, 0x47, 0xD0, 0xB1, 0xFD, 0x00, 0x06, 0x78, 0x80, 0x01, 0xA6, 0x00, 0x30, 
+    0x59, 0xE9, 0xA9, 0xBE, 0x41, 0xEE, 0xC1, 0x40, 0x24, 0x2F, 0x37, 0x17, 0x7A, 0xBA, 0xC8, 0x09, 0xFC, 0x8B, 0xDE, 0x0C, 
+    0x01, 0x48, 0xFC, 0xBE, 0x65, 0xE8, 0xE9, 0x4F, 0xA7, 0x83, 0xFF, 0x4F, 0xD2, 0xAC, 0x54, 0xBE, 0x00, 0x00, 0xC8, 0x5F, 
+    0xC4, 0xE6, 0x6C, 0x4E, 0x3A, 0x4B, 0xC4, 0xF9, 0x22, 0x4E, 0xCA, 0x14, 0xA4, 0x8A, 0xED, 0x33, 0x22, 0xA6, 0xC6, 0x24, 
+    0x8A, 0x19, 0x46, 0x89, 0x99, 0x2F, 0x4A, 0x50, 0xC4, 0x72, 0x62, 0x8E, 0x5B, 0xE4, 0xA5, 0x9F, 0x7D, 0x16, 0xD9, 0x51, 
+    0xCC, 0xEC, 0x64, 0x1E, 0x5B, 0xC4, 0xE2, 0x9C, 0x53, 0xD9, 0xC9, 0x6C, 0x31, 0xF7, 0x88, 0x78, 0x7B, 0x86, 0x90, 0x23, 
+    0x62, 0xC4, 0x47, 0xC4, 0x05, 0x19, 0x5C, 0x4E, 0xA6, 0x88, 0x6F, 0x8B, 0x58, 0x33, 0x49, 0x98, 0xCC, 0x15, 0xF1, 0x5B, 
+    0x71, 0x6C, 0x32, 0x87, 0x99, 0x0E, 0x00, 0x8A, 0x24, 0xB6, 0x0B, 0x38, 0xAC, 0x78, 0x11, 0x9B, 0x88, 0x98, 0xC4, 0x0F, 
+    0x0E, 0x74, 0x11, 0xF1, 0x72, 0x00, 0x70, 0xA4, 0xB8, 0x2F, 0x38, 0xE6, 0x0B, 0x16, 0x70, 0xB2, 0x04, 0xE2, 0x43, 0xB9, 
+    0xA4, 0xA4, 0x66, 0xF3, 0xB9, 0x71, 0xF1, 0x02, 0xBA, 0x2E, 0x4B, 0x8F, 0x6E, 0x6A, 0x6D, 0xCD, 0xA0, 0x7B, 0x72, 0x32, 
+    0x93, 0x38, 0x02, 0x81, 0xA1, 0x3F, 0x93, 0x95, 0xC8, 0xE4, 0xB3, 0xE9, 0x2E, 0x29, 0xC9, 0xA9, 0x4C, 0x5E, 0x36, 0x00, 
+    0x8B, 0x67, 0xFE, 0x2C, 0x19, 0x71, 0x6D, 0xE9, 0xA2, 0x22, 0x5B, 0x9A, 0x5A, 0x5B, 0x5A, 0x1A, 0x9A, 0x19, 0x99, 0x7E, 
+    0x51, 0xA8, 0xFF, 0xBA, 0xF8, 0x37, 0x25, 0xEE, 0xED, 0x22, 0xBD, 0x0A, 0xF8, 0xDC, 0x33, 0x88, 0xD6, 0xF7, 0x87, 0xED, 
+    0xAF, 0xFC, 0x52, 0xEA, 0x00, 0x60, 0xCC, 0x8A, 0x6A, 0xB3, 0xEB, 0x0F, 0x5B, 0xCC, 0x7E, 0x00, 0x3A, 0xB6, 0x02, 0x20, 
+    0x77, 0xFF, 0x0F, 0x9B, 0xE6, 0x21, 0x00, 0x24, 0x45, 0x7D, 0x6B, 0xBF, 0xF1, 0xC5, 0x79, 0x68, 0xE2, 0x79, 0x89, 0x17, 
+    0x08, 0x52, 0x6D, 0x8C, 0x8D, 0x33, 0x33, 0x33, 0x8D, 0xB8, 0x1C, 0x96, 0x91, 0xB8, 0xA0, 0xBF, 0xEB, 0x7F, 0x3A, 0xFC, 
+    0x0D, 0x7D, 0xF1, 0x3D, 0x23, 0xF1, 0x76, 0xBF, 0x97, 0x87, 0xEE, 0xCA, 0x89, 0x65, 0x0A, 0x93, 0x04, 0x74, 0x71, 0xDD, 
+    0x58, 0x29, 0x49, 0x29, 0x42, 0x3E, 0x3D, 0x3D, 0x95, 0xC9, 0xE2, 0xD0, 0x0D, 0xFF, 0x3C, 0xC4, 0xFF, 0x38, 0xF0, 0xAF, 
+    0xF3, 0x58, 0x1A, 0xC8, 0x89, 0xE5, 0xF0, 0x39, 0x3C, 0x51, 0x44, 0xA8, 0x68, 0xCA, 0xB8, 0xBC, 0x38, 0x51, 0xBB, 0x79, 
+    0x6C, 0xAE, 0x80, 0x9B, 0xC2, 0xA3, 0x73, 0x79, 0xFF, 0xA9, 0x89, 0xFF, 0x30, 0xEC, 0x4F, 0x5A, 0x9C, 0x6B, 0x91, 0x28, 
+    0xF5, 0x9F, 0x00, 0x35, 0xCA, 0x08, 0x48, 0xDD, 0xA0, 0x02, 0xE4, 0xE7, 0x3E, 0x80, 0xA2, 0x10, 0x01, 0x12, 0x79, 0x50, 
+    0xDC, 0xF5, 0xDF, 0xFB, 0xE6, 0x83, 0x0F, 0x05, 0xE2, 0x9B, 0x17, 0xA6, 0x3A, 0xB1, 0x38, 0xF7, 0x9F, 0x05, 0xFD, 0xFB, 
+    0xAE, 0x70, 0x89, 0xF8, 0x91, 0xCE, 0x8D, 0xFB, 0x1C, 0xE7, 0x12, 0x18, 0x4C, 0x67, 0x09, 0xF9, 0x19, 0x8B, 0x6B, 0xE2, 
+    0x6B, 0x09, 0xD0, 0x80, 0x00, 0x24, 0x01, 0x15, 0xC8, 0x03, 0x15, 0xA0, 0x01, 0x74, 0x81, 0x21, 0x30, 0x03, 0x56, 0xC0, 
+    0x16, 0x38, 0x02, 0x37, 0xB0, 0x02, 0xF8, 0x81, 0x60, 0x10, 0x0E, 0xD6, 0x02, 0x16, 0x88, 0x07, 0xC9, 0x80, 0x0F, 0x32, 
+    0x41, 0x2E, 0xD8, 0x0C, 0x0A, 0x40, 0x11, 0xD8, 0x05, 0xF6, 0x82, 0x4A, 0x50, 0x03, 0xEA, 0x41, 0x23, 0x68, 0x01, 0x27, 
+    0x40, 0x07, 0x38, 0x0D, 0x2E, 0x80, 0xCB, 0xE0, 0x3A, 0xB8, 0x09, 0xEE, 0x80, 0x07, 0x60, 0x04, 0x8C, 0x83, 0xE7, 0x60, 
+    0x06, 0xBC, 0x01, 0xF3, 0x10, 0x04, 0x61, 0x21, 0x32, 0x44, 0x81, 0xE4, 0x21, 0x55, 0x48, 0x0B, 0x32, 0x80, 0xCC, 0x20, 
+    0x06, 0x64, 0x0F, 0xB9, 0x41, 0x3E, 0x50, 0x20, 0x14, 0x0E, 0x45, 0x43, 0x71, 0x10, 0x0F, 0x12, 0x42, 0xB9, 0xD0, 0x16, 
+    0xA8, 0x08, 0x2A, 0x85, 0x2A, 0xA1, 0x5A, 0xA8, 0x11, 0xFA, 0x16, 0x3A, 0x05, 0x5D, 0x80, 0xAE, 0x42, 0x03, 0xD0, 0x3D, 
+    0x68, 0x14, 0x9A, 0x82, 0x7E, 0x85, 0xDE, 0xC3, 0x08, 0x4C, 0x82, 0xA9, 0xB0, 0x32, 0xAC, 0x0D, 0x1B, 0xC3, 0x0C, 0xD8, 
+    0x09, 0xF6, 0x86, 0x83, 0xE1, 0x35, 0x70, 0x1C, 0x9C, 0x06, 0xE7, 0xC0, 0xF9, 0xF0, 0x4E, 0xB8, 0x02, 0xAE, 0x83, 0x8F, 
+    0xC1, 0xED, 0xF0, 0x05, 0xF8, 0x3A, 0x7C, 0x07, 0x1E, 0x81, 0x9F, 0xC3, 0xB3, 0x08, 0x40, 0x88, 0x08, 0x0D, 0x51, 0x43, 
+    0x0C, 0x11, 0x06, 0xE2, 0x82, 0xF8, 0x21, 0x11, 0x48, 0x2C, 0xC2, 0x47, 0x36, 0x20, 0x85, 0x48, 0x39, 0x52, 0x87, 0xB4, 
+    0x20, 0x5D, 0x48, 0x2F, 0x72, 0x0B, 0x19, 0x41, 0xA6, 0x91, 0x77, 0x28, 0x0C, 0x8A, 0x82, 0xA2, 0xA3, 0x0C, 0x51, 0xB6, 
+    0x28, 0x4F, 0x54, 0x08, 0x8A, 0x85, 0x4A, 0x43, 0x6D, 0x40, 0x15, 0xA3, 0x2A, 0x51, 0x47, 0x51, 0xED, 0xA8, 0x1E, 0xD4, 
+    0x2D, 0xD4, 0x28, 0x6A, 0x06, 0xF5, 0x09, 0x4D, 0x46, 0x2B, 0xA1, 0x0D, 0xD0, 0x36, 0x68, 0x2F, 0xF4, 0x2A, 0x74, 0x1C, 
+    0x3A, 0x13, 0x5D, 0x80, 0x2E, 0x47, 0x37, 0xA0, 0xDB, 0xD0, 0x97, 0xD0, 0x77, 0xD0, 0xE3, 0xE8, 0x37, 0x18, 0x0C, 0x86, 
+    0x86, 0xD1, 0xC1, 0x58, 0x61, 0x3C, 0x31, 0xE1, 0x98, 0x04, 0xCC, 0x3A, 0x4C, 0x31, 0xE6, 0x00, 0xA6, 0x15, 0x73, 0x1E, 
+    0x33, 0x80, 0x19, 0xC3, 0xCC, 0x62, 0xB1, 0x58, 0x79, 0xAC, 0x01, 0xD6, 0x0E, 0xEB, 0x87, 0x65, 0x62, 0x05, 0xD8, 0x02, 
+    0xEC, 0x7E, 0xEC, 0x31, 0xEC, 0x39, 0xEC, 0x20, 0x76, 0x1C, 0xFB, 0x16, 0x47, 0xC4, 0xA9, 0xE2, 0xCC, 0x70, 0xEE, 0xB8, 
+    0x08, 0x1C, 0x0F, 0x97, 0x87, 0x2B, 0xC7, 0x35, 0xE1, 0xCE, 0xE2, 0x06, 0x71, 0x13, 0xB8, 0x79, 0xBC, 0x14, 0x5E, 0x0B, 
+    0x6F, 0x83, 0xF7, 0xC3, 0xB3, 0xF1, 0xD9, 0xF8, 0x12, 0x7C, 0x3D, 0xBE, 0x0B, 0x7F, 0x03, 0x3F, 0x8E, 0x9F, 0x27, 0x48, 
+    0x13, 0x74, 0x08, 0x76, 0x84, 0x60, 0x42, 0x02, 0x61, 0x33, 0xA1, 0x82, 0xD0, 0x42, 0xB8, 0x44, 0x78, 0x48, 0x78, 0x45, 
+    0x24, 0x12, 0xD5, 0x89, 0xD6, 0xC4, 0x00, 0x22, 0x97, 0xB8, 0x89, 0x58, 0x41, 0x3C, 0x4E, 0xBC, 0x42, 0x1C, 0x25, 0xBE, 
+    0x23, 0xC9, 0x90, 0xF4, 0x49, 0x2E, 0xA4, 0x48, 0x92, 0x90, 0xB4, 0x93, 0x74, 0x84, 0x74, 0x9E, 0x74, 0x8F, 0xF4, 0x8A, 
+    0x4C, 0x26, 0x6B, 0x93, 0x1D, 0xC9, 0x11, 0x64, 0x01, 0x79, 0x27, 0xB9, 0x91, 0x7C, 0x91, 0xFC, 0x98, 0xFC, 0x56, 0x82, 
+    0x22, 0x61, 0x24, 0xE1, 0x25, 0xC1, 0x96, 0xD8, 0x28, 0x51, 0x25, 0xD1, 0x2E, 0x31, 0x28, 0xF1, 0x42, 0x12, 0x2F, 0xA9, 
+    0x25, 0xE9, 0x24, 0xB9, 0x56, 0x32, 0x47, 0xB2, 0x5C, 0xF2, 0xA4, 0xE4, 0x0D, 0xC9, 0x69, 0x29, 0xBC, 0x94, 0xB6, 0x94, 
+    0x8B, 0x14, 0x53, 0x6A, 0x83, 0x54, 0x95, 0xD4, 0x29, 0xA9, 0x61, 0xA9, 0x59, 0x69, 0x8A, 0xB4, 0xA9, 0xB4, 0x9F, 0x74, 
+    0xB2, 0x74, 0xB1, 0x74, 0x93, 0xF4, 0x55, 0xE9, 0x49, 0x19, 0xAC, 0x8C, 0xB6, 0x8C, 0x9B, 0x0C, 0x5B, 0x26, 0x5F, 0xE6, 
+    0xB0, 0xCC, 0x45, 0x99, 0x31, 0x0A, 0x42, 0xD1, 0xA0, 0xB8, 0x50, 0x58, 0x94, 0x2D, 0x94, 0x7A, 0xCA, 0x25, 0xCA, 0x38, 
+    0x15, 0x43, 0xD5, 0xA1, 0x7A, 0x51, 0x13, 0xA8, 0x45, 0xD4, 0x6F, 0xA8, 0xFD, 0xD4, 0x19, 0x59, 0x19, 0xD9, 0x65, 0xB2, 
+    0xA1, 0xB2, 0x59, 0xB2, 0x55, 0xB2, 0x67, 0x64, 0x47, 0x68, 0x08, 0x4D, 0x9B, 0xE6, 0x45, 0x4B, 0xA2, 0x95, 0xD0, 0x4E, 
+    0xD0, 0x86, 0x68, 0xEF, 0x97, 0x28, 0x2F, 0x71, 0x5A, 0xC2, 0x59, 0xB2, 0x63, 0x49, 0xCB, 0x92, 0xC1, 0x25, 0x73, 0x72, 
+    0x8A, 0x72, 0x8E, 0x72, 0x1C, 0xB9, 0x42, 0xB9, 0x56, 0xB9, 0x3B, 0x72, 0xEF, 0xE5, 0xE9, 0xF2, 0x6E, 0xF2, 0x89, 0xF2, 
+    0xBB, 0xE5, 0x3B, 0xE4, 0x1F, 0x29, 0xA0, 0x14, 0xF4, 0x15, 0x02, 0x14, 0x32, 0x15, 0x0E, 0x2A, 0x5C, 0x52, 0x98, 0x56, 
+    0xA4, 0x2A, 0xDA, 0x2A, 0xB2, 0x14, 0x0B, 0x15, 0x4F, 0x28, 0xDE, 0x57, 0x82, 0x95, 0xF4, 0x95, 0x02, 0x95, 0xD6, 0x29, 
+    0x1D, 0x56, 0xEA, 0x53, 0x9A, 0x55, 0x56, 0x51, 0xF6, 0x50, 0x4E, 0x55, 0xDE, 0xAF, 0x7C, 0x51, 0x79, 0x5A, 0x85, 0xA6, 
+    0xE2, 0xA8, 0x92, 0xA0, 0x52, 0xA6, 0x72, 0x56, 0x65, 0x4A, 0x95, 0xA2, 0x6A, 0xAF, 0xCA, 0x55, 0x2D, 0x53, 0x3D, 0xA7, 
+    0xFA, 0x8C, 0x2E, 0x4B, 0x77, 0xA2, 0x27, 0xD1, 0x2B, 0xE8, 0x3D, 0xF4, 0x19, 0x35, 0x25, 0x35, 0x4F, 0x35, 0xA1, 0x5A, 
+    0xAD, 0x5A, 0xBF, 0xDA, 0xBC, 0xBA, 0x8E, 0x7A, 0x88, 0x7A, 0x9E, 0x7A, 0xAB, 0xFA, 0x23, 0x0D, 0x82, 0x06, 0x43, 0x23, 
+    0x56, 0xA3, 0x4C, 0xA3, 0x5B, 0x63, 0x46, 0x53, 0x55, 0xD3, 0x57, 0x33, 0x57, 0xB3, 0x59, 0xF3, 0xBE, 0x16, 0x5E, 0x8B, 
+    0xA1, 0x15, 0xAF, 0xB5, 0x4F, 0xAB, 0x57, 0x6B, 0x4E, 0x5B, 0x47, 0x3B, 0x4C, 0x7B, 0x9B, 0x76, 0x87, 0xF6, 0xA4, 0x8E, 
+    0x9C, 0x8E, 0x97, 0x4E, 0x8E, 0x4E, 0xB3, 0xCE, 0x43, 0x5D, 0xB2, 0xAE, 0x83, 0x6E, 0x9A, 0x6E, 0x9D, 0xEE, 0x6D, 0x3D, 
+    0x8C, 0x1E, 0x43, 0x2F, 0x51, 0xEF, 0x80, 0xDE, 0x4D, 0x7D, 0x58, 0xDF, 0x42, 0x3F, 0x5E, 0xBF, 0x4A, 0xFF, 0x86, 0x01, 
+    0x6C, 0x60, 0x69, 0xC0, 0x35, 0x38, 0x60, 0x30, 0xB0, 0x14, 0xBD, 0xD4, 0x7A, 0x29, 0x6F, 0x69, 0xDD, 0xD2, 0x61, 0x43, 
+    0x92, 0xA1, 0x93, 0x61, 0x86, 0x61, 0xB3, 0xE1, 0xA8, 0x11, 0xCD, 0xC8, 0xC7, 0x28, 0xCF, 0xA8, 0xC3, 0xE8, 0x85, 0xB1, 
+    0xA6, 0x71, 0x84, 0xF1, 0x6E, 0xE3, 0x5E, 0xE3, 0x4F, 0x26, 0x16, 0x26, 0x49, 0x26, 0xF5, 0x26, 0x0F, 0x4C, 0x65, 0x4C, 
+    0x57, 0x98, 0xE6, 0x99, 0x76, 0x99, 0xFE, 0x6A, 0xA6, 0x6F, 0xC6, 0x32, 0xAB, 0x32, 0xBB, 0x6D, 0x4E, 0x36, 0x77, 0x37, 
+    0xDF, 0x68, 0xDE, 0x69, 0xFE, 0x72, 0x99, 0xC1, 0x32, 0xCE, 0xB2, 0x83, 0xCB, 0xEE, 0x5A, 0x50, 0x2C, 0x7C, 0x2D, 0xB6, 
+    0x59, 0x74, 0x5B, 0x7C, 0xB4, 0xB4, 0xB2, 0xE4, 0x5B, 0xB6, 0x58, 0x4E, 0x59, 0x69, 0x5A, 0x45, 0x5B, 0x55, 0x5B, 0x0D, 
+    0x33, 0xA8, 0x0C, 0x7F, 0x46, 0x31, 0xE3, 0x8A, 0x35, 0xDA, 0xDA, 0xD9, 0x7A, 0xA3, 0xF5, 0x69, 0xEB, 0x77, 0x36, 0x96, 
+    0x36, 0x02, 0x9B, 0x13, 0x36, 0xBF, 0xD8, 0x1A, 0xDA, 0x26, 0xDA, 0x36, 0xD9, 0x4E, 0x2E, 0xD7, 0x59, 0xCE, 0x59, 0x5E, 
+    0xBF, 0x7C, 0xCC, 0x4E, 0xDD, 0x8E, 0x69, 0x57, 0x6B, 0x37, 0x62, 0x4F, 0xB7, 0x8F, 0xB6, 0x3F, 0x64, 0x3F, 0xE2, 0xA0, 
+    0xE6, 0xC0, 0x74, 0xA8, 0x73, 0x78, 0xE2, 0xA8, 0xE1, 0xC8, 0x76, 0x6C, 0x70, 0x9C, 0x70, 0xD2, 0x73, 0x4A, 0x70, 0x3A, 
+    0xE6, 0xF4, 0xC2, 0xD9, 0xC4, 0x99, 0xEF, 0xDC, 0xE6, 0x3C, 0xE7, 0x62, 0xE3, 0xB2, 0xDE, 0xE5, 0xBC, 0x2B, 0xE2, 0xEA, 
+    0xE1, 0x5A, 0xE8, 0xDA, 0xEF, 0x26, 0xE3, 0x16, 0xE2, 0x56, 0xE9, 0xF6, 0xD8, 0x5D, 0xDD, 0x3D, 0xCE, 0xBD, 0xD9, 0x7D, 
+    0xC6, 0xC3, 0xC2, 0x63, 0x9D, 0xC7, 0x79, 0x4F, 0xB4, 0xA7, 0xB7, 0xE7, 0x6E, 0xCF, 0x61, 0x2F, 0x65, 0x2F, 0x96, 0x57, 
+    0xA3, 0xD7, 0xCC, 0x0A, 0xAB, 0x15, 0xEB, 0x57, 0xF4, 0x78, 0x93, 0xBC, 0x83, 0xBC, 0x2B, 0xBD, 0x9F, 0xF8, 0xE8, 0xFB, 
+    0xF0, 0x7D, 0xBA, 0x7C, 0x61, 0xDF, 0x15, 0xBE, 0x7B, 0x7C, 0x1F, 0xAE, 0xD4, 0x5A, 0xC9, 0x5B, 0xD9, 0xE1, 0x07, 0xFC, 
+    0xBC, 0xFC, 0xF6, 0xF8, 0x3D, 0xF2, 0xD7, 0xF1, 0x4F, 0xF3, 0xFF, 0x3E, 0x00, 0x13, 0xE0, 0x1F, 0x50, 0x15, 0xF0, 0x34, 
+    0xD0, 0x34, 0x30, 0x37, 0xB0, 0x37, 0x88, 0x12, 0x14, 0x15, 0xD4, 0x14, 0xF4, 0x26, 0xD8, 0x39, 0xB8, 0x24, 0xF8, 0x41, 
+    0x88, 0x6E, 0x88, 0x30, 0xA4, 0x3B, 0x54, 0x32, 0x34, 0x32, 0xB4, 0x31, 0x74, 0x2E, 0xCC, 0x35, 0xAC, 0x34, 0x6C, 0x64, 
+    0x95, 0xF1, 0xAA, 0xF5, 0xAB, 0xAE, 0x87, 0x2B, 0x84, 0x73, 0xC3, 0x3B, 0x23, 0xB0, 0x11, 0xA1, 0x11, 0x0D, 0x11, 0xB3, 
+    0xAB, 0xDD, 0x56, 0xEF, 0x5D, 0x3D, 0x1E, 0x69, 0x11, 0x59, 0x10, 0x39, 0xB4, 0x46, 0x67, 0x4D, 0xD6, 0x9A, 0xAB, 0x6B, 
+    0x15, 0xD6, 0x26, 0xAD, 0x3D, 0x13, 0x25, 0x19, 0xC5, 0x8C, 0x3A, 0x19, 0x8D, 0x8E, 0x0E, 0x8B, 0x6E, 0x8A, 0xFE, 0xC0, 
+    0xF4, 0x63, 0xD6, 0x31, 0x67, 0x63, 0xBC, 0x62, 0xAA, 0x63, 0x66, 0x58, 0x2E, 0xAC, 0x7D, 0xAC, 0xE7, 0x6C, 0x47, 0x76, 
+    0x19, 0x7B, 0x8A, 0x63, 0xC7, 0x29, 0xE5, 0x4C, 0xC4, 0xDA, 0xC5, 0x96, 0xC6, 0x4E, 0xC6, 0xD9, 0xC5, 0xED, 0x89, 0x9B, 
+    0x8A, 0x77, 0x88, 0x2F, 0x8F, 0x9F, 0xE6, 0xBA, 0x70, 0x2B, 0xB9, 0x2F, 0x13, 0x3C, 0x13, 0x6A, 0x12, 0xE6, 0x12, 0xFD, 
+    0x12, 0x8F, 0x24, 0x2E, 0x24, 0x85, 0x25, 0xB5, 0x26, 0xE3, 0x92, 0xA3, 0x93, 0x4F, 0xF1, 0x64, 0x78, 0x89, 0xBC, 0x9E, 
+    0x14, 0x95, 0x94, 0xAC, 0x94, 0x81, 0x54, 0x83, 0xD4, 0x82, 0xD4, 0x91, 0x34, 0x9B, 0xB4, 0xBD, 0x69, 0x33, 0x7C, 0x6F, 
+    0x7E, 0x43, 0x3A, 0x94, 0xBE, 0x26, 0xBD, 0x53, 0x40, 0x15, 0xFD, 0x4C, 0xF5, 0x09, 0x75, 0x85, 0x5B, 0x85, 0xA3, 0x19, 
+    0xF6, 0x19, 0x55, 0x19, 0x6F, 0x33, 0x43, 0x33, 0x4F, 0x66, 0x49, 0x67, 0xF1, 0xB2, 0xFA, 0xB2, 0xF5, 0xB3, 0x77, 0x64, 
+    0x4F, 0xE4, 0xB8, 0xE7, 0x7C, 0xBD, 0x0E, 0xB5, 0x8E, 0xB5, 0xAE, 0x3B, 0x57, 0x2D, 0x77, 0x73, 0xEE, 0xE8, 0x7A, 0xA7, 
+    0xF5, 0xB5, 0x1B, 0xA0, 0x0D, 0x31, 0x1B, 0xBA, 0x37, 0x6A, 0x6C, 0xCC, 0xDF, 0x38, 0xBE, 0xC9, 0x63, 0xD3, 0xD1, 0xCD, 
+    0x84, 0xCD, 0x89, 0x9B, 0x7F, 0xC8, 0x33, 0xC9, 0x2B, 0xCD, 0x7B, 0xBD, 0x25, 0x6C, 0x4B, 0x57, 0xBE, 0x72, 0xFE, 0xA6, 
+    0xFC, 0xB1, 0xAD, 0x1E, 0x5B, 0x9B, 0x0B, 0x24, 0x0A, 0xF8, 0x05, 0xC3, 0xDB, 0x6C, 0xB7, 0xD5, 0x6C, 0x47, 0x6D, 0xE7, 
+    0x6E, 0xEF, 0xDF, 0x61, 0xBE, 0x63, 0xFF, 0x8E, 0x4F, 0x85, 0xEC, 0xC2, 0x6B, 0x45, 0x26, 0x45, 0xE5, 0x45, 0x1F, 0x8A, 
+    0x59, 0xC5, 0xD7, 0xBE, 0x32, 0xFD, 0xAA, 0xE2, 0xAB, 0x85, 0x9D, 0xB1, 0x3B, 0xFB, 0x4B, 0x2C, 0x4B, 0x0E, 0xEE, 0xC2, 
+    0xEC, 0xE2, 0xED, 0x1A, 0xDA, 0xED, 0xB0, 0xFB, 0x68, 0xA9, 0x74, 0x69, 0x4E, 0xE9, 0xD8, 0x1E, 0xDF, 0x3D, 0xED, 0x65, 
+    0xF4, 0xB2, 0xC2, 0xB2, 0xD7, 0x7B, 0xA3, 0xF6, 0x5E, 0x2D, 0x5F, 0x56, 0x5E, 0xB3, 0x8F, 0xB0, 0x4F, 0xB8, 0x6F, 0xA4, 
+    0xC2, 0xA7, 0xA2, 0x73, 0xBF, 0xE6, 0xFE, 0x5D, 0xFB, 0x3F, 0x54, 0xC6, 0x57, 0xDE, 0xA9, 0x72, 0xAE, 0x6A, 0xAD, 0x56, 
+    0xAA, 0xDE, 0x51, 0x3D, 0x77, 0x80, 0x7D, 0x60, 0xF0, 0xA0, 0xE3, 0xC1, 0x96, 0x1A, 0xE5, 0x9A, 0xA2, 0x9A, 0xF7, 0x87, 
+    0xB8, 0x87, 0xEE, 0xD6, 0x7A, 0xD4, 0xB6, 0xD7, 0x69, 0xD7, 0x95, 0x1F, 0xC6, 0x1C, 0xCE, 0x38, 0xFC, 0xB4, 0x3E, 0xB4, 
+    0xBE, 0xF7, 0x6B, 0xC6, 0xD7, 0x8D, 0x0D, 0x0A, 0x0D, 0x45, 0x0D, 0x1F, 0x8F, 0xF0, 0x8E, 0x8C, 0x1C, 0x0D, 0x3C, 0xDA, 
+    0xD3, 0x68, 0xD5, 0xD8, 0xD8, 0xA4, 0xD4, 0x54, 0xD2, 0x0C, 0x37, 0x0B, 0x9B, 0xA7, 0x8E, 0x45, 0x1E, 0xBB, 0xF9, 0x8D, 
+    0xEB, 0x37, 0x9D, 0x2D, 0x86, 0x2D, 0xB5, 0xAD, 0xB4, 0xD6, 0xA2, 0xE3, 0xE0, 0xB8, 0xF0, 0xF8, 0xB3, 0x6F, 0xA3, 0xBF, 
+    0x1D, 0x3A, 0xE1, 0x7D, 0xA2, 0xFB, 0x24, 0xE3, 0x64, 0xCB, 0x77, 0x5A, 0xDF, 0x55, 0xB7, 0x51, 0xDA, 0x0A, 0xDB, 0xA1, 
+    0xF6, 0xEC, 0xF6, 0x99, 0x8E, 0xF8, 0x8E, 0x91, 0xCE, 0xF0, 0xCE, 0x81, 0x53, 0x2B, 0x4E, 0x75, 0x77, 0xD9, 0x76, 0xB5, 
+    0x7D, 0x6F, 0xF4, 0xFD, 0x91, 0xD3, 0x6A, 0xA7, 0xAB, 0xCE, 0xC8, 0x9E, 0x29, 0x39, 0x4B, 0x38, 0x9B, 0x7F, 0x76, 0xE1, 
+    0x5C, 0xCE, 0xB9, 0xD9, 0xF3, 0xA9, 0xE7, 0xA7, 0x2F, 0xC4, 0x5D, 0x18, 0xEB, 0x8E, 0xEA, 0x7E, 0x70, 0x71, 0xD5, 0xC5, 
+    0xDB, 0x3D, 0x01, 0x3D, 0xFD, 0x97, 0xBC, 0x2F, 0x5D, 0xB9, 0xEC, 0x7E, 0xF9, 0x62, 0xAF, 0x53, 0xEF, 0xB9, 0x2B, 0x76, 
+    0x57, 0x4E, 0x5F, 0xB5, 0xB9, 0x7A, 0xEA, 0x1A, 0xE3, 0x5A, 0xC7, 0x75, 0xCB, 0xEB, 0xED, 0x7D, 0x16, 0x7D, 0x6D, 0x3F, 
+    0x58, 0xFC, 0xD0, 0xD6, 0x6F, 0xD9, 0xDF, 0x7E, 0xC3, 0xEA, 0x46, 0xE7, 0x4D, 0xEB, 0x9B, 0x5D, 0x03, 0xCB, 0x07, 0xCE, 
+    0x0E, 0x3A, 0x0C, 0x5E, 0xB8, 0xE5, 0x7A, 0xEB, 0xF2, 0x6D, 0xAF, 0xDB, 0xD7, 0xEF, 0xAC, 0xBC, 0x33, 0x30, 0x14, 0x32, 
+    0x74, 0x77, 0x38, 0x72, 0x78, 0xE4, 0x2E, 0xFB, 0xEE, 0xE4, 0xBD, 0xA4, 0x7B, 0x2F, 0xEF, 0x67, 0xDC, 0x9F, 0x7F, 0xB0, 
+    0xE9, 0x21, 0xFA, 0x61, 0xE1, 0x23, 0xA9, 0x47, 0xE5, 0x8F, 0x95, 0x1E, 0xD7, 0xFD, 0xA8, 0xF7, 0x63, 0xEB, 0x88, 0xE5, 
+    0xC8, 0x99, 0x51, 0xD7, 0xD1, 0xBE, 0x27, 0x41, 0x4F, 0x1E, 0x8C, 0xB1, 0xC6, 0x9E, 0xFF, 0x94, 0xFE, 0xD3, 0x87, 0xF1, 
+    0xFC, 0xA7, 0xE4, 0xA7, 0xE5, 0x13, 0xAA, 0x13, 0x8D, 0x93, 0x66, 0x93, 0xA7, 0xA7, 0xDC, 0xA7, 0x6E, 0x3E, 0x5B, 0xFD, 
+    0x6C, 0xFC, 0x79, 0xEA, 0xF3, 0xF9, 0xE9, 0x82, 0x9F, 0xA5, 0x7F, 0xAE, 0x7E, 0xA1, 0xFB, 0xE2, 0xBB, 0x5F, 0x1C, 0x7F, 
+    0xE9, 0x9B, 0x59, 0x35, 0x33, 0xFE, 0x92, 0xFF, 0x72, 0xE1, 0xD7, 0xE2, 0x57, 0xF2, 0xAF, 0x8E, 0xBC, 0x5E, 0xF6, 0xBA, 
+    0x7B, 0xD6, 0x7F, 0xF6, 0xF1, 0x9B, 0xE4, 0x37, 0xF3, 0x73, 0x85, 0x6F, 0xE5, 0xDF, 0x1E, 0x7D, 0xC7, 0x78, 0xD7, 0xFB, 
+    0x3E, 0xEC, 0xFD, 0xC4, 0x7C, 0xE6, 0x07, 0xEC, 0x87, 0x8A, 0x8F, 0x7A, 0x1F, 0xBB, 0x3E, 0x79, 0x7F, 0x7A, 0xB8, 0x90, 
+    0xBC, 0xB0, 0xF0, 0x1B, 0xF7, 0x84, 0xF3, 0xFB, 0xCC, 0x3B, 0xBC, 0x6C, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 0x44, 
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xA0, 0xBD, 0xA7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 
+    0x0B, 0x13, 0x00, 0x00, 0x0B, 0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45, 0x07, 
+    0xE0, 0x06, 0x0C, 0x09, 0x2C, 0x20, 0x12, 0x88, 0x8B, 0xD3, 0x00, 0x00, 0x0F, 0x1D, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 
+    0xED, 0x5D, 0x49, 0x92, 0xED, 0xAA, 0x0E, 0xBC, 0xE5, 0xF0, 0xFE, 0xB7, 0x5C, 0x7F, 0x54, 0x2F, 0xFC, 0x09, 0x40, 0xA9, 
+    0x06, 0x21, 0xEC, 0xCC, 0xC9, 0x6D, 0x0E, 0xA6, 0x15, 0x89, 0x24, 0x40, 0xFC, 0xFC, 0x23, 0xA6, 0xF8, 0xFD, 0xFD, 0xFD, 
+    0x9D, 0xFD, 0xFE, 0xF3, 0xF3, 0xF3, 0x93, 0x99, 0x0F, 0x41, 0xBC, 0x09, 0x37, 0xBB, 0x80, 0xF0, 0x12, 0xB4, 0x95, 0x3C, 
+    0x3D, 0xDF, 0xAE, 0x58, 0x58, 0xB8, 0x08, 0x14, 0x26, 0xA0, 0xD1, 0x0A, 0xFE, 0x1C, 0x34, 0x24, 0x0D, 0x61, 0xEB, 0xEF, 
+    0xB6, 0x0F, 0xA5, 0xDF, 0x91, 0xF1, 0x98, 0x69, 0x65, 0x9A, 0x31, 0xB3, 0x10, 0xC9, 0xAC, 0xEC, 0xBF, 0xDF, 0x66, 0x6D, 
+    0x6A, 0xDB, 0x80, 0xC8, 0xE1, 0x5F, 0xBA, 0xD1, 0x37, 0x5E, 0x32, 0x95, 0xFA, 0x2D, 0x2A, 0xCD, 0x9B, 0x70, 0x69, 0x04, 
+    0xAC, 0x87, 0xBF, 0x0E, 0x43, 0x04, 0x6A, 0xD5, 0x44, 0x95, 0xF2, 0x47, 0xD2, 0x54, 0x03, 0x2A, 0xA4, 0x28, 0x99, 0xCC, 
+    0xF2, 0x7B, 0x8E, 0xA7, 0xB5, 0x0F, 0x35, 0xFD, 0x8B, 0xE6, 0x63, 0x19, 0xB3, 0xDE, 0x04, 0x6E, 0xDB, 0xD5, 0xEB, 0x33, 
+    0xA9, 0xFD, 0x68, 0x7B, 0x46, 0x75, 0xF6, 0xB6, 0xEB, 0xD3, 0x04, 0xA4, 0xE9, 0xC4, 0xD9, 0xC0, 0xB7, 0x82, 0xEC, 0x15, 
+    0xEA, 0x37, 0x0F, 0x7C, 0xE4, 0x4A, 0x88, 0xF4, 0x73, 0x04, 0x49, 0x23, 0xDF, 0x6B, 0xC7, 0x7B, 0xD5, 0x98, 0x3D, 0x49, 
+    0xC8, 0x53, 0x06, 0x52, 0xE7, 0xCC, 0x76, 0x55, 0x31, 0x67, 0x5B, 0xB9, 0x6A, 0x61, 0xF2, 0x01, 0x49, 0xE4, 0x22, 0x4D, 
+    0xF8, 0xD1, 0x6F, 0x3D, 0xD5, 0xF7, 0x49, 0x52, 0x11, 0x2B, 0x53, 0x86, 0xDF, 0x01, 0x31, 0x8B, 0x24, 0x53, 0x6A, 0x85, 
+    0x1A, 0x2E, 0xE5, 0x33, 0x32, 0x5F, 0x46, 0xF5, 0x90, 0x4C, 0x24, 0x44, 0x36, 0x10, 0xD3, 0x70, 0xA5, 0x19, 0xF2, 0x2C, 
+    0xC3, 0x63, 0x7E, 0x21, 0x75, 0x8E, 0x6E, 0x97, 0x94, 0x4F, 0x64, 0x39, 0xCF, 0xBA, 0xCF, 0x4C, 0x62, 0x6B, 0xFF, 0x5D, 
+    0x27, 0x30, 0x6A, 0xEF, 0xDF, 0x23, 0x33, 0xC4, 0x6A, 0x12, 0x22, 0x2B, 0xE1, 0x4C, 0x4D, 0x47, 0xCC, 0xA2, 0x5E, 0x3D, 
+    0x67, 0x84, 0xB4, 0xDB, 0x1F, 0xD0, 0x9A, 0xD9, 0xAD, 0x39, 0x8E, 0x6A, 0x5C, 0x99, 0x26, 0x30, 0x62, 0x92, 0xB6, 0xFD, 
+    0x8A, 0x7C, 0x53, 0xD1, 0x3C, 0xB7, 0x2C, 0x5E, 0xE8, 0x58, 0x44, 0x68, 0x6D, 0xA3, 0x3A, 0x3C, 0xFF, 0xFF, 0xF6, 0x10, 
+    0x83, 0x75, 0x85, 0xB7, 0xAA, 0x73, 0x19, 0x9A, 0xCB, 0xA8, 0x9C, 0x56, 0xFB, 0x93, 0x76, 0x51, 0x46, 0x69, 0x66, 0x65, 
+    0xF5, 0x1C, 0xAC, 0xBD, 0xFA, 0x3C, 0x57, 0x6D, 0x54, 0xCB, 0xF1, 0xF6, 0x0B, 0x42, 0x9E, 0x1A, 0x9F, 0xCB, 0x6E, 0x12, 
+    0x7A, 0x93, 0x99, 0xD3, 0x6B, 0x2F, 0x32, 0x57, 0x2D, 0xAE, 0x8D, 0x51, 0x79, 0xD6, 0x39, 0xAA, 0x36, 0xC1, 0x10, 0x86, 
+    0xF5, 0x08, 0x00, 0x32, 0xB9, 0x3D, 0xF9, 0xEC, 0xD4, 0x28, 0xA2, 0x27, 0xD9, 0x6A, 0x0D, 0x69, 0xE4, 0x27, 0x91, 0x1C, 
+    0xDA, 0x96, 0x31, 0x99, 0x69, 0xBE, 0xD1, 0xED, 0x6B, 0xCD, 0x2E, 0xCB, 0x4E, 0xDA, 0x8E, 0x3A, 0x4B, 0xE5, 0x44, 0xC9, 
+    0x44, 0x2F, 0x1F, 0x6B, 0xBE, 0xED, 0x98, 0xB7, 0xDF, 0xDF, 0xDE, 0x8E, 0xD0, 0xB0, 0x35, 0x4A, 0x2E, 0x52, 0xA5, 0x67, 
+    0x5A, 0x83, 0xC5, 0xF6, 0x8E, 0x22, 0x56, 0x24, 0x4D, 0x84, 0x90, 0x20, 0x42, 0xEF, 0xD9, 0x41, 0x1A, 0xF9, 0x49, 0xA4, 
+    0xFA, 0x23, 0xED, 0x91, 0x16, 0x06, 0x69, 0xE5, 0xB6, 0x94, 0x29, 0x91, 0x50, 0x44, 0x3E, 0xDE, 0x3A, 0x69, 0x88, 0x4C, 
+    0x92, 0x79, 0xC4, 0xA7, 0x65, 0xD1, 0xE0, 0x11, 0xF9, 0xD2, 0x6A, 0x41, 0xE9, 0x07, 0x11, 0x25, 0x72, 0x69, 0xD3, 0x65, 
+    0x69, 0x2B, 0x1E, 0x62, 0x45, 0xCD, 0xA2, 0x9E, 0xFF, 0xC4, 0xAA, 0x25, 0xCE, 0x04, 0xD1, 0xBB, 0x1B, 0xA5, 0xB1, 0xE1, 
+    0x2D, 0x93, 0x0E, 0x25, 0x21, 0xEB, 0x39, 0x20, 0xAB, 0x86, 0x17, 0x41, 0x42, 0x19, 0x44, 0xA6, 0xD9, 0x54, 0xF0, 0x8E, 
+    0x53, 0x84, 0xD5, 0x30, 0x9B, 0xCB, 0x77, 0x84, 0xC0, 0x68, 0x4D, 0x1E, 0x94, 0x5C, 0xA4, 0xDF, 0x11, 0xDF, 0x0D, 0x92, 
+    0xE6, 0x24, 0x12, 0x5B, 0x51, 0xA7, 0x08, 0x73, 0x37, 0xCA, 0xD4, 0xCE, 0x30, 0x91, 0x7B, 0x4E, 0x68, 0x2B, 0x09, 0x45, 
+    0x9A, 0x60, 0x19, 0x66, 0x75, 0xA6, 0xAC, 0x43, 0x64, 0xFA, 0x8F, 0x70, 0x69, 0x0A, 0xA7, 0xDE, 0x05, 0xFB, 0xDA, 0x89, 
+    0x5B, 0xAD, 0x09, 0x42, 0xE4, 0x80, 0x77, 0xC1, 0x3E, 0x8A, 0xAF, 0x4F, 0x36, 0x92, 0x4D, 0x0D, 0x5C, 0xEC, 0x02, 0x82, 
+    0x20, 0x48, 0x40, 0x04, 0x41, 0x10, 0xD5, 0xEC, 0x74, 0x5E, 0xDC, 0x23, 0x08, 0x6A, 0x40, 0x26, 0xC2, 0x38, 0x85, 0x40, 
+    0x48, 0x74, 0x04, 0xB1, 0x07, 0xB7, 0x65, 0xB2, 0xFE, 0xFB, 0x97, 0x73, 0x51, 0xF0, 0xF9, 0xEF, 0x88, 0x43, 0x7B, 0x51, 
+    0x37, 0xCB, 0x47, 0x79, 0x7D, 0x79, 0x67, 0x09, 0x3D, 0xC3, 0x82, 0xF4, 0xDF, 0x2C, 0x1F, 0xED, 0xEE, 0x95, 0xE7, 0x94, 
+    0xB3, 0x24, 0x3F, 0xD6, 0xD3, 0xD2, 0x11, 0xED, 0x3A, 0x55, 0x2E, 0xDA, 0x76, 0xFD, 0x44, 0x0A, 0x99, 0x26, 0x58, 0x94, 
+    0x74, 0x04, 0x1E, 0x3D, 0xED, 0x8C, 0x92, 0x45, 0x04, 0x71, 0x30, 0xA0, 0x14, 0xD6, 0x66, 0xE4, 0x80, 0x24, 0x72, 0xB5, 
+    0x40, 0x2B, 0x4F, 0xE8, 0xE2, 0x13, 0x35, 0xDE, 0x51, 0x75, 0x8E, 0x94, 0xF9, 0xE8, 0x45, 0x75, 0x75, 0xFF, 0x84, 0x9A, 
+    0x60, 0xDE, 0x13, 0xB2, 0x9A, 0x55, 0x29, 0x2A, 0xC6, 0x4A, 0x24, 0xF9, 0xF4, 0x84, 0xEA, 0xED, 0xDA, 0xCE, 0x2C, 0x00, 
+    0x98, 0x26, 0x16, 0x13, 0x12, 0x10, 0x4C, 0x13, 0x34, 0x2C, 0x2A, 0xB6, 0x11, 0x12, 0xC8, 0xAD, 0xA2, 0xCB, 0x40, 0x7B, 
+    0xEB, 0x3D, 0x22, 0x14, 0x49, 0x8A, 0x09, 0xA6, 0x21, 0x0B, 0x24, 0xD4, 0x04, 0x6A, 0x62, 0x69, 0x4E, 0x45, 0x3F, 0xBF, 
+    0x91, 0xEE, 0xFB, 0x64, 0x0A, 0x90, 0xE6, 0x1A, 0x41, 0x55, 0x4D, 0xCA, 0x2A, 0x6C, 0x5A, 0x61, 0xF5, 0xB4, 0xBF, 0xA7, 
+    0xF9, 0x12, 0x7E, 0x73, 0xB8, 0x97, 0x76, 0x76, 0x8A, 0x1C, 0xBA, 0x40, 0x9B, 0xED, 0x03, 0x42, 0xCC, 0xA2, 0x08, 0x3B, 
+    0xBF, 0xA7, 0x82, 0x47, 0x09, 0x75, 0xE4, 0xC0, 0xAE, 0x0E, 0x2A, 0xB5, 0x5A, 0x60, 0xB5, 0x17, 0x56, 0x23, 0xCC, 0x58, 
+    0xE4, 0x92, 0xA4, 0x25, 0x66, 0xB4, 0x37, 0xBE, 0xB9, 0x47, 0x9E, 0xB3, 0xAF, 0xA5, 0x44, 0xCB, 0x97, 0x35, 0x48, 0x5A, 
+    0xC9, 0x93, 0xD0, 0x23, 0x93, 0x4B, 0xA3, 0x29, 0xF4, 0x22, 0xDE, 0xED, 0x9C, 0xD0, 0x52, 0xC8, 0xD8, 0x59, 0x8C, 0x15, 
+    0x6D, 0xBD, 0xA3, 0x82, 0xCD, 0xEF, 0x20, 0x44, 0xD4, 0xF4, 0x91, 0x64, 0x63, 0xB6, 0x91, 0x31, 0x0B, 0x15, 0x2C, 0x45, 
+    0x5E, 0xF0, 0xC8, 0xE1, 0x2C, 0x1F, 0x6F, 0x1C, 0xAD, 0xDD, 0x63, 0x69, 0xBD, 0x4F, 0x77, 0xF4, 0x55, 0x0C, 0x8D, 0x5F, 
+    0x66, 0xB7, 0x2A, 0x2E, 0x45, 0x49, 0x1C, 0xA5, 0xCB, 0xB8, 0x4C, 0x1A, 0xD9, 0xCF, 0xBB, 0x27, 0x86, 0x45, 0xE3, 0xAA, 
+    0x38, 0xA1, 0x57, 0xCB, 0xA2, 0x44, 0x16, 0x5A, 0x8D, 0xCC, 0xDA, 0x07, 0x77, 0xA6, 0x70, 0x23, 0x3E, 0x20, 0x94, 0x41, 
+    0x4F, 0xDC, 0x6D, 0x42, 0x23, 0x1E, 0x56, 0x12, 0xFC, 0x4A, 0x9A, 0x0F, 0x11, 0x67, 0xC6, 0x4A, 0x24, 0x64, 0xD1, 0xB8, 
+    0x2D, 0x61, 0x40, 0x2E, 0x4B, 0xE3, 0xBD, 0x8E, 0xC8, 0xD9, 0xDF, 0x11, 0xF5, 0x73, 0xA6, 0xD6, 0x66, 0x6B, 0x30, 0x9A, 
+    0xC1, 0x68, 0x77, 0x4D, 0x66, 0xBB, 0x28, 0x99, 0x3B, 0x2C, 0xD2, 0xAE, 0x22, 0x22, 0x58, 0x2B, 0x62, 0x59, 0xAF, 0x3A, 
+    0xD8, 0x5A, 0xFD, 0xE0, 0x69, 0x16, 0x19, 0x47, 0xEC, 0x62, 0x69, 0x76, 0x91, 0xBB, 0xBE, 0xB0, 0xEC, 0xCE, 0x89, 0x70, 
+    0x42, 0xCF, 0x6C, 0xFE, 0x91, 0x23, 0x31, 0x2A, 0xD6, 0x4A, 0xA5, 0x9D, 0xAB, 0xD5, 0xAF, 0x2C, 0x68, 0xB4, 0x33, 0xED, 
+    0x43, 0x8A, 0x9A, 0x49, 0xA0, 0x3D, 0xD4, 0x87, 0xD4, 0x29, 0xF2, 0x70, 0xA0, 0xD6, 0x69, 0x8E, 0x94, 0xB5, 0x4A, 0x46, 
+    0x23, 0xE5, 0x28, 0x6A, 0x63, 0xA6, 0xB4, 0xAA, 0xC9, 0x6D, 0x54, 0xF6, 0x0D, 0xF1, 0x5E, 0x30, 0x1E, 0xD0, 0xA1, 0xA0, 
+    0xAF, 0x84, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x3E, 0x07, 0x8F, 0x2F, 0x92, 0x7E, 0x04, 0x82, 
+    0x20, 0x42, 0xC8, 0xC7, 0x74, 0x68, 0xD6, 0x52, 0xA0, 0xE7, 0xF2, 0x5A, 0x2F, 0x6D, 0xC4, 0xF6, 0x68, 0x9B, 0xD6, 0x1A, 
+    0xF3, 0x65, 0x54, 0x1F, 0x24, 0x54, 0x82, 0xF6, 0x9E, 0xD7, 0xAC, 0xCE, 0xA3, 0x13, 0xD1, 0x48, 0x19, 0xE8, 0xF5, 0x14, 
+    0x4D, 0x5B, 0x35, 0xE3, 0x85, 0x8E, 0x59, 0x66, 0x3E, 0xCF, 0xB4, 0xD6, 0x10, 0x19, 0x48, 0x1F, 0xAE, 0x4E, 0x83, 0xC8, 
+    0x74, 0xD4, 0x96, 0xBE, 0x26, 0xFC, 0x8E, 0x75, 0x9B, 0xFD, 0xFA, 0xCB, 0xA8, 0xC5, 0xAC, 0x42, 0xC8, 0xAB, 0x8A, 0xC8, 
+    0xDD, 0xA6, 0xD9, 0xC4, 0x43, 0x27, 0xDD, 0xE8, 0xC0, 0x1E, 0x7A, 0xE0, 0x4F, 0xAA, 0x8F, 0x8A, 0xCD, 0xC1, 0x87, 0xDC, 
+    0xD0, 0x03, 0x99, 0x9E, 0x32, 0xDA, 0x76, 0x48, 0x63, 0x8A, 0xF4, 0x0D, 0x32, 0x5E, 0xD2, 0xC1, 0xC4, 0xD5, 0xF9, 0x58, 
+    0xFB, 0xF5, 0x14, 0xFC, 0x34, 0x40, 0xD2, 0x5A, 0xCD, 0x25, 0x74, 0xDE, 0xA0, 0x0B, 0x7F, 0x97, 0x80, 0xD0, 0x41, 0x95, 
+    0x56, 0x62, 0x0D, 0xA3, 0x6A, 0x84, 0x03, 0x2D, 0x4F, 0x3B, 0x79, 0xAD, 0xF5, 0x39, 0x51, 0x45, 0x46, 0x4F, 0x6F, 0xBF, 
+    0x69, 0x92, 0x5A, 0xE4, 0x63, 0x65, 0x5D, 0x22, 0x4E, 0x8A, 0x47, 0xDD, 0x73, 0x8B, 0x18, 0xEF, 0x1E, 0x39, 0x59, 0x4E, 
+    0xEF, 0x5F, 0x16, 0xE2, 0x88, 0x0E, 0xBA, 0x95, 0x71, 0x89, 0x51, 0x33, 0x58, 0x55, 0x48, 0x68, 0x47, 0x54, 0xBC, 0x13, 
+    0x88, 0xA5, 0xD5, 0x9C, 0x2C, 0x9A, 0xE7, 0xAE, 0x7A, 0x6B, 0x03, 0xB8, 0x8D, 0x6E, 0xF0, 0x47, 0xDD, 0x48, 0xD8, 0x8D, 
+    0x4B, 0xBB, 0x5A, 0x6A, 0x57, 0xDD, 0xAC, 0x4B, 0x8C, 0xAB, 0x3B, 0x5B, 0x32, 0x4F, 0x2B, 0x92, 0x0F, 0x32, 0x31, 0x23, 
+    0xC7, 0x27, 0x6A, 0xDC, 0x67, 0xF9, 0xF4, 0x26, 0xF3, 0x69, 0x5A, 0xD9, 0x4C, 0x43, 0x43, 0xFA, 0x30, 0x2A, 0x52, 0x42, 
+    0x85, 0xFE, 0xBB, 0x56, 0x4C, 0xC2, 0x08, 0x7F, 0x4A, 0xA4, 0xF6, 0x84, 0xDE, 0x55, 0x99, 0xB5, 0x0F, 0xB5, 0xBB, 0xAB, 
+    0xFA, 0x0C, 0x32, 0x34, 0xBE, 0xA8, 0x3E, 0xD2, 0xF8, 0x36, 0xAA, 0x90, 0x50, 0x04, 0x21, 0x22, 0x0B, 0x46, 0xF4, 0xC2, 
+    0xB4, 0xBB, 0xFF, 0xAE, 0x1D, 0x02, 0x56, 0x91, 0x84, 0x56, 0xB7, 0x4B, 0x2B, 0xA0, 0xD9, 0x13, 0xAC, 0xEA, 0x98, 0x7A, 
+    0x77, 0x3C, 0xAB, 0x40, 0x13, 0x1F, 0x3B, 0xC3, 0x24, 0xAF, 0x42, 0x42, 0x57, 0x05, 0x81, 0x8C, 0xEA, 0x80, 0xB7, 0x3A, 
+    0x53, 0xB3, 0xCC, 0xCC, 0xEA, 0x63, 0x9D, 0x69, 0x76, 0x69, 0x9C, 0xC7, 0x12, 0xB9, 0x44, 0xEC, 0xB4, 0x5A, 0xE2, 0x37, 
+    0x9F, 0x40, 0x42, 0x57, 0xA6, 0x86, 0x63, 0x79, 0x2D, 0x41, 0xFB, 0x6A, 0xC5, 0xAA, 0x09, 0xFE, 0xD6, 0x49, 0xCD, 0xFA, 
+    0x62, 0xF2, 0x21, 0xED, 0x98, 0x8E, 0x9C, 0xE1, 0xA8, 0xD3, 0x79, 0x57, 0x5F, 0xEE, 0xD6, 0x7C, 0xEF, 0x36, 0x66, 0xB2, 
+    0xB5, 0x62, 0x23, 0x52, 0x99, 0x45, 0xD1, 0x97, 0x98, 0xD8, 0xBA, 0xE2, 0xF4, 0xD2, 0x20, 0x91, 0xE1, 0x9E, 0xFF, 0x8E, 
+    0x50, 0xB3, 0x5B, 0xA1, 0x9B, 0xB5, 0xDB, 0xA2, 0xE9, 0x64, 0xF8, 0xD7, 0x24, 0xD9, 0x40, 0xFA, 0x59, 0x9B, 0x8F, 0xA7, 
+    0x3E, 0xD6, 0xB1, 0x18, 0xE5, 0x13, 0x15, 0x47, 0xCA, 0x2B, 0x3F, 0x96, 0x31, 0xF7, 0x86, 0x2C, 0x66, 0xB8, 0x17, 0xE2, 
+    0x95, 0x60, 0x2C, 0x23, 0xE2, 0x3F, 0xF2, 0x63, 0x17, 0x10, 0x3B, 0x4D, 0x30, 0xC6, 0x35, 0xFA, 0xC6, 0x38, 0x57, 0x34, 
+    0xFF, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x68, 0x97, 0x13, 0x04, 0xF1, 0x31, 0x5C, 0xEC, 0x02, 0x82, 0x20, 0x76, 0x21, 
+    0xEC, 0x82, 0xDB, 0x0A, 0xC7, 0x62, 0x44, 0x9E, 0xDE, 0x3C, 0xB4, 0xDF, 0x7B, 0x9E, 0x2A, 0xD1, 0x94, 0x45, 0x47, 0x2E, 
+    0x36, 0x76, 0x5F, 0xEE, 0x1B, 0x49, 0x46, 0xD0, 0xC3, 0x8D, 0x48, 0x5C, 0x2B, 0xEB, 0x71, 0x85, 0xEE, 0x41, 0x44, 0x13, 
+    0x93, 0x2D, 0x18, 0xE8, 0xE8, 0x5B, 0xF2, 0x9E, 0xC3, 0x8A, 0x29, 0xAB, 0x81, 0xA2, 0x2C, 0x92, 0x0E, 0x3E, 0xF9, 0xBE, 
+    0xDC, 0x7E, 0xEB, 0x9C, 0x96, 0x4E, 0x6D, 0xA3, 0x01, 0xDC, 0x24, 0x7C, 0xE6, 0x59, 0x9E, 0xAC, 0xF7, 0xE1, 0x49, 0x22, 
+    0xC4, 0x57, 0xE6, 0x93, 0xD6, 0x32, 0xE8, 0xA5, 0x83, 0x09, 0x48, 0x73, 0x52, 0x5A, 0x7B, 0x6F, 0xC5, 0x72, 0xE2, 0x53, 
+    0xF3, 0x42, 0x26, 0x5A, 0x0E, 0xA2, 0x46, 0x7A, 0xD5, 0x56, 0x6D, 0x5A, 0xCB, 0xCA, 0xA2, 0x09, 0xED, 0xDA, 0x12, 0xB3, 
+    0x35, 0x04, 0xAA, 0x26, 0x9F, 0x5E, 0x3F, 0x47, 0xD7, 0x67, 0xD6, 0x7F, 0xC8, 0xEA, 0xBD, 0x3B, 0x24, 0xAB, 0x46, 0x7B, 
+    0xAF, 0xBE, 0x90, 0x3D, 0x23, 0xA9, 0xB6, 0x75, 0xBD, 0x34, 0x8C, 0x87, 0x5E, 0xA6, 0x43, 0xC3, 0xB1, 0xA2, 0xD1, 0x17, 
+    0x25, 0xF5, 0x52, 0xBA, 0x63, 0x26, 0x5D, 0xD7, 0xF8, 0xCB, 0x03, 0x29, 0x17, 0x0D, 0x03, 0x1A, 0xA1, 0xFD, 0x44, 0xC7, 
+    0xD6, 0x19, 0x09, 0x76, 0x44, 0x28, 0x55, 0x4D, 0x3E, 0xC8, 0xFD, 0x28, 0x4F, 0x7D, 0xD0, 0x70, 0xBC, 0x99, 0x9A, 0x42, 
+    0x44, 0x44, 0xC4, 0x51, 0xFB, 0x46, 0xE3, 0x1D, 0x11, 0x01, 0xC2, 0x1B, 0x7F, 0x49, 0x22, 0xD2, 0x4B, 0x2B, 0xC8, 0x68, 
+    0x25, 0x34, 0xA1, 0x54, 0x91, 0x95, 0x47, 0x5B, 0xA7, 0x15, 0x61, 0x56, 0x77, 0x44, 0x08, 0x58, 0x1D, 0x90, 0xAC, 0xBA, 
+    0x7A, 0x2F, 0xC9, 0xD4, 0x09, 0x31, 0x9A, 0x34, 0xC1, 0xC6, 0x34, 0x3E, 0x99, 0xD1, 0xDD, 0x35, 0x74, 0xEE, 0x69, 0xC2, 
+    0xF5, 0x5A, 0xFA, 0x19, 0x89, 0xA4, 0x7A, 0x47, 0xB0, 0x58, 0x35, 0x41, 0x25, 0xDE, 0xE7, 0x67, 0x68, 0xCD, 0xB7, 0xCC, 
+    0x70, 0xB5, 0x11, 0x0B, 0x46, 0xD4, 0xA5, 0xD6, 0x6A, 0xED, 0xF6, 0x82, 0xE7, 0x80, 0x0E, 0x58, 0x35, 0xD9, 0x1B, 0xF6, 
+    0x55, 0xBE, 0x8A, 0xE9, 0x54, 0x2D, 0x20, 0x19, 0x09, 0x48, 0xA1, 0x06, 0x66, 0xE6, 0x43, 0x12, 0xAA, 0x8B, 0x51, 0x38, 
+    0x93, 0x08, 0x53, 0xC3, 0x63, 0x3A, 0xED, 0x0A, 0x48, 0x76, 0x8A, 0xCC, 0x4F, 0x5D, 0x25, 0x16, 0x06, 0x97, 0x3C, 0xF7, 
+    0x33, 0x35, 0x5A, 0x9B, 0xC6, 0x5A, 0x96, 0xF5, 0x91, 0xC0, 0x59, 0x3E, 0xE8, 0xA3, 0x75, 0xA8, 0x89, 0x88, 0x1C, 0x44, 
+    0xB4, 0x94, 0x35, 0xDA, 0x61, 0x91, 0x76, 0x7F, 0xB2, 0xC6, 0x74, 0xE5, 0x78, 0xCD, 0xE4, 0x48, 0x2B, 0x63, 0x88, 0xE6, 
+    0x61, 0xE9, 0x53, 0x8D, 0x5B, 0xC3, 0xB3, 0x0B, 0xB6, 0xFA, 0x20, 0x22, 0x51, 0x54, 0x1B, 0x43, 0xF3, 0x7F, 0x8B, 0xD6, 
+    0xA6, 0x6D, 0x07, 0xEF, 0x1D, 0xB2, 0x8F, 0xE8, 0x03, 0xE2, 0x44, 0x20, 0x0A, 0xCB, 0xE5, 0x57, 0x34, 0x8F, 0x1F, 0x0E, 
+    0x76, 0xCC, 0x3B, 0xDA, 0x55, 0xCB, 0xAB, 0xD6, 0x7F, 0x6F, 0x6B, 0xFF, 0x8A, 0x3E, 0x64, 0xBF, 0x10, 0x04, 0x41, 0x50, 
+    0x03, 0x22, 0xAA, 0xAD, 0xD0, 0xD1, 0xD7, 0x46, 0x08, 0x12, 0xD0, 0x16, 0x3B, 0xD6, 0x1B, 0x2A, 0xC1, 0xF2, 0x5C, 0x4F, 
+    0xC4, 0xED, 0xFA, 0x4A, 0x87, 0xC8, 0xAC, 0x3B, 0x37, 0xA3, 0xDF, 0xA5, 0xFF, 0xF3, 0x94, 0xB7, 0x42, 0xBE, 0x32, 0xE5, 
+    0x67, 0xE5, 0x4B, 0xA5, 0xD1, 0xF7, 0xD5, 0x34, 0xF5, 0xB6, 0xD6, 0x5D, 0xDA, 0xB5, 0x43, 0xCB, 0x84, 0xB6, 0x41, 0xB5, 
+    0x57, 0xEF, 0x3D, 0x8D, 0xD7, 0x94, 0xA5, 0xA9, 0x87, 0x57, 0x50, 0x34, 0x75, 0x9E, 0xD5, 0x4D, 0xDB, 0x77, 0x9E, 0x2D, 
+    0xFF, 0x28, 0x52, 0xF0, 0x6C, 0xE7, 0xAE, 0xF0, 0x87, 0x64, 0x8F, 0x85, 0x34, 0xB9, 0xB4, 0x32, 0x9A, 0x41, 0xD6, 0x68, 
+    0x9D, 0x3C, 0xFD, 0x65, 0x9D, 0xAB, 0xFF, 0x77, 0x2E, 0xCA, 0x42, 0x30, 0x51, 0x2B, 0x46, 0xC6, 0xD1, 0xF4, 0xC8, 0xA0, 
+    0x66, 0x55, 0x8E, 0xD3, 0x47, 0x92, 0x74, 0x84, 0x36, 0xB1, 0x62, 0xD2, 0x78, 0x6E, 0x9A, 0x47, 0x8C, 0x45, 0xF4, 0xA2, 
+    0xEB, 0x25, 0x5E, 0xAD, 0xC6, 0xAA, 0xC9, 0xAB, 0x37, 0xFE, 0x16, 0x0D, 0xCC, 0x22, 0x87, 0xD3, 0x81, 0xFE, 0x8A, 0x2D, 
+    0xFF, 0xE5, 0x9D, 0x19, 0x4B, 0xE4, 0x3B, 0x44, 0x15, 0xD7, 0xF6, 0x63, 0xE4, 0x22, 0x78, 0xEA, 0x18, 0x78, 0x4D, 0xB0, 
+    0x28, 0x32, 0x45, 0xE7, 0x85, 0xE5, 0x50, 0x68, 0xFB, 0xFB, 0x8D, 0x08, 0x8F, 0xD5, 0x2C, 0xF0, 0x9A, 0x0E, 0x99, 0x69, 
+    0xDA, 0x63, 0xF7, 0x3B, 0x4E, 0x03, 0x47, 0x91, 0x82, 0xC5, 0x74, 0xEA, 0xB5, 0x1B, 0x49, 0x33, 0x3B, 0x61, 0x2D, 0x69, 
+    0x2E, 0x16, 0x82, 0xC9, 0x3E, 0x99, 0xED, 0x25, 0x80, 0x5D, 0x26, 0x98, 0xD4, 0x2E, 0x44, 0xC9, 0x40, 0xB5, 0xCC, 0x36, 
+    0x7F, 0x73, 0x48, 0xD6, 0x28, 0x16, 0x9F, 0xDD, 0x79, 0x41, 0xE2, 0x0A, 0x65, 0xA6, 0x19, 0x7D, 0xA3, 0x69, 0x57, 0x54, 
+    0x1A, 0xCD, 0xA4, 0xF4, 0xA6, 0x41, 0x42, 0x25, 0x20, 0x69, 0x90, 0x3E, 0x44, 0xFC, 0x06, 0xCF, 0x32, 0xA5, 0xB8, 0x4E, 
+    0x99, 0x63, 0xF1, 0x36, 0x20, 0x21, 0x5A, 0x7A, 0x77, 0xB7, 0x90, 0x70, 0x3C, 0xA3, 0x85, 0x67, 0x76, 0xFA, 0x3F, 0x3C, 
+    0x24, 0xAB, 0x25, 0x92, 0xE1, 0xCE, 0x34, 0x51, 0xED, 0xDA, 0x51, 0xA7, 0xD3, 0xCC, 0x39, 0x24, 0x2C, 0xEE, 0x17, 0x4D, 
+    0xB0, 0xCA, 0x24, 0x65, 0x31, 0xD7, 0x9E, 0x5A, 0x90, 0x34, 0x9E, 0x77, 0xB4, 0x63, 0x52, 0xB3, 0xEA, 0x6A, 0x82, 0x5D, 
+    0xAF, 0x48, 0xA3, 0xB1, 0x55, 0x33, 0xB4, 0x92, 0x0A, 0xFE, 0x2F, 0x0F, 0x69, 0xA2, 0x5B, 0xB0, 0x24, 0x98, 0xFD, 0x3E, 
+    0x26, 0xED, 0x78, 0x6B, 0x16, 0x17, 0xCD, 0x98, 0xDE, 0x3D, 0xDB, 0xFE, 0x4B, 0xF7, 0xA3, 0xDA, 0x00, 0x57, 0x5F, 0x9B, 
+    0x14, 0xD6, 0x1D, 0x14, 0xEB, 0x04, 0x20, 0xF1, 0xE4, 0xCA, 0xB2, 0x45, 0xA6, 0x33, 0xFD, 0x55, 0x57, 0xAB, 0x25, 0x44, 
+    0x9F, 0xE9, 0x38, 0x81, 0xCC, 0xB4, 0xE1, 0x26, 0xD1, 0x50, 0x96, 0xAB, 0xE2, 0xD4, 0x9C, 0xB0, 0xE2, 0x46, 0x98, 0xE2, 
+    0x84, 0x5F, 0x96, 0x47, 0x3E, 0xCD, 0x2A, 0x72, 0x08, 0xEF, 0xD7, 0xAF, 0x88, 0x07, 0x84, 0xE4, 0xB3, 0x3A, 0x0D, 0xD2, 
+    0xFE, 0x9D, 0xBB, 0x60, 0xAB, 0xD2, 0x44, 0x6F, 0xFD, 0x6A, 0x34, 0xA7, 0xDE, 0x4E, 0x18, 0xFA, 0x48, 0x63, 0xE6, 0x58, 
+    0xAC, 0x90, 0x43, 0x8D, 0x66, 0xB9, 0x62, 0xDB, 0x5B, 0x7B, 0x82, 0x59, 0x7B, 0x10, 0x56, 0x7B, 0xE8, 0x73, 0xD9, 0xF1, 
+    0xF2, 0x13, 0x6D, 0xE4, 0x2F, 0x9A, 0x60, 0x44, 0x7D, 0x9F, 0xCC, 0x1B, 0xDA, 0x39, 0x25, 0x20, 0x86, 0x03, 0x20, 0x08, 
+    0x92, 0xCF, 0xEA, 0xC5, 0xBD, 0xEB, 0xBC, 0xA6, 0x48, 0x10, 0x04, 0x35, 0x6C, 0x82, 0x20, 0x08, 0xE2, 0xA4, 0x55, 0xE5, 
+    0xE9, 0xBD, 0x67, 0x78, 0xD5, 0x7A, 0x2B, 0x7D, 0x3B, 0x3E, 0xA3, 0x3F, 0x47, 0x63, 0x39, 0x1B, 0xDB, 0xAC, 0x9D, 0xC8, 
+    0x4C, 0x19, 0x43, 0xCA, 0x8A, 0xAA, 0x4F, 0x64, 0x59, 0x9E, 0x7A, 0xDC, 0x16, 0xFB, 0x34, 0xE2, 0x66, 0x70, 0xD4, 0x8D, 
+    0x7B, 0xCD, 0x93, 0x29, 0x48, 0x9A, 0x9D, 0xEA, 0xF1, 0xEA, 0x7E, 0x5B, 0x59, 0xEF, 0xF6, 0x4A, 0x43, 0xEF, 0xDF, 0xA3, 
+    0x3F, 0x7B, 0x82, 0x3C, 0x3B, 0xD3, 0x42, 0xBC, 0x07, 0x77, 0x45, 0xF2, 0x91, 0xB6, 0x36, 0xD1, 0x27, 0x87, 0x47, 0x17, 
+    0x20, 0x25, 0x32, 0xAB, 0x10, 0x70, 0x2B, 0x93, 0xD4, 0xBC, 0x90, 0xDE, 0x87, 0x9F, 0x91, 0x4F, 0x6F, 0x81, 0xE8, 0x11, 
+    0x11, 0xA7, 0xEA, 0x3B, 0x71, 0x55, 0x25, 0x1F, 0xE9, 0x2C, 0x8A, 0x45, 0x25, 0x7F, 0x8B, 0x69, 0x63, 0x4D, 0x93, 0x45, 
+    0x72, 0xED, 0x65, 0x4F, 0x49, 0x03, 0x9A, 0xBD, 0x7B, 0x4E, 0xF2, 0xF9, 0x80, 0x06, 0x84, 0xAE, 0x8E, 0x52, 0xBA, 0x88, 
+    0xBB, 0x50, 0xA8, 0x76, 0xF3, 0x5C, 0x71, 0x67, 0x79, 0xF5, 0x6E, 0xE3, 0xF6, 0xC2, 0x49, 0x20, 0x6F, 0x7B, 0x9F, 0x48, 
+    0x3E, 0x19, 0xF5, 0xA6, 0x06, 0x44, 0xB8, 0x08, 0xC8, 0xF2, 0x2A, 0x25, 0xE2, 0x6F, 0xE9, 0x69, 0x2E, 0x88, 0x76, 0xD3, 
+    0x13, 0x3C, 0x6B, 0x6C, 0xE9, 0xA8, 0x0B, 0xA2, 0x3B, 0x4C, 0xB0, 0x15, 0x1A, 0x25, 0x62, 0xA6, 0x8E, 0x08, 0x64, 0x36, 
+    0xEE, 0x27, 0xF9, 0x80, 0x32, 0x09, 0xCD, 0x7A, 0xC2, 0x39, 0xBA, 0x5D, 0xD1, 0x1A, 0x65, 0x54, 0x3E, 0xF7, 0xC8, 0xBC, 
+    0xD1, 0x86, 0x53, 0x98, 0x99, 0x4A, 0xDA, 0x8B, 0x70, 0xBD, 0xCB, 0xB1, 0xB3, 0x7C, 0xA4, 0x3A, 0x21, 0xA4, 0xE8, 0xD1, 
+    0x1A, 0xBC, 0x03, 0xDF, 0xF3, 0x6D, 0x21, 0xB7, 0xF2, 0x23, 0x43, 0xBB, 0xF6, 0xF2, 0x6A, 0xC7, 0x62, 0x34, 0x0E, 0xA7, 
+    0x69, 0x40, 0xDE, 0xCB, 0xB5, 0xD1, 0x65, 0x45, 0x2D, 0x6A, 0xD6, 0x4D, 0x98, 0x9D, 0x7D, 0x78, 0x9F, 0x6C, 0x67, 0x4B, 
+    0xC2, 0x99, 0xAD, 0xFD, 0x68, 0x35, 0x31, 0x0D, 0x99, 0x47, 0x6B, 0x64, 0xA8, 0x76, 0x83, 0x90, 0x50, 0x25, 0x0D, 0xA8, 
+    0x4A, 0xBC, 0x29, 0x8D, 0xC6, 0x11, 0x45, 0x12, 0x96, 0xFB, 0x81, 0x48, 0x3E, 0x52, 0x78, 0x0E, 0x8F, 0xF6, 0x77, 0x9F, 
+    0xEE, 0xF4, 0x5B, 0xED, 0x23, 0xD8, 0xF1, 0xDC, 0x8C, 0x96, 0x7C, 0x90, 0x0B, 0x83, 0x33, 0xDF, 0x97, 0x26, 0x24, 0xEB, 
+    0x4C, 0x2B, 0xAB, 0xA0, 0x01, 0x45, 0x85, 0x17, 0xD1, 0x68, 0xAE, 0xB3, 0xBA, 0x46, 0x95, 0xA5, 0xF5, 0xC5, 0xAD, 0x5E, 
+    0x94, 0xB5, 0x69, 0x46, 0x75, 0x7A, 0xC5, 0xDB, 0xF0, 0xD9, 0x0E, 0xE2, 0xD5, 0xBE, 0x89, 0xD6, 0xF4, 0x9C, 0x85, 0x49, 
+    0xF5, 0xD4, 0xA3, 0xF7, 0x2A, 0xC2, 0xA8, 0x2C, 0xCD, 0x8B, 0x07, 0xDC, 0x05, 0x23, 0x54, 0x26, 0x18, 0x51, 0x8F, 0x4C, 
+    0x67, 0xE7, 0x93, 0x7A, 0xA6, 0x4D, 0x04, 0x79, 0xCF, 0xFC, 0x4D, 0x88, 0x79, 0xC9, 0x5D, 0x30, 0x42, 0x8B, 0x6B, 0xE4, 
+    0xE8, 0x95, 0xEC, 0xBE, 0x59, 0x3C, 0x90, 0xD1, 0xB6, 0xB6, 0xA6, 0xAC, 0x8A, 0x84, 0x30, 0x6B, 0x97, 0x35, 0x7C, 0xED, 
+    0x68, 0x92, 0x3F, 0xB5, 0x87, 0xE7, 0x6F, 0x6D, 0x9F, 0xA1, 0xEA, 0x76, 0xE6, 0x23, 0x78, 0xD4, 0x80, 0x08, 0x95, 0x06, 
+    0x84, 0xC6, 0x3F, 0x5E, 0x71, 0x0E, 0x68, 0xE4, 0xF8, 0xF4, 0x7E, 0x73, 0xB2, 0x89, 0x87, 0xF8, 0x83, 0xD0, 0x5D, 0x08, 
+    0x9E, 0x03, 0x22, 0x4A, 0x6B, 0x40, 0xEC, 0x82, 0x9A, 0x98, 0x3D, 0x65, 0x52, 0xB5, 0xAE, 0xD4, 0x80, 0x08, 0xFA, 0x80, 
+    0x5E, 0xE6, 0x0B, 0xAA, 0xAC, 0xA1, 0x51, 0x03, 0x22, 0xA8, 0x01, 0x11, 0xD4, 0x80, 0x88, 0x73, 0x17, 0x5A, 0xD4, 0xE7, 
+    0xA0, 0x49, 0xE3, 0xF5, 0x6F, 0x44, 0xE7, 0xE3, 0xB9, 0x8E, 0xA0, 0x49, 0xA3, 0xAD, 0xEF, 0x49, 0xF9, 0x44, 0xF4, 0xE1, 
+    0x0A, 0xC2, 0xF3, 0xD4, 0xB9, 0x62, 0x7D, 0x22, 0xC6, 0xD2, 0xAB, 0x2D, 0x5B, 0x0E, 0x46, 0x5A, 0x17, 0x0A, 0x6A, 0x40, 
+    0x04, 0x41, 0xD0, 0x04, 0x23, 0x08, 0x82, 0x04, 0x44, 0x10, 0x04, 0x41, 0x02, 0x22, 0x08, 0xE2, 0xFD, 0xF8, 0xD4, 0x36, 
+    0x7C, 0x74, 0x68, 0x82, 0xA8, 0x1D, 0x1B, 0xEB, 0x65, 0x4B, 0x4F, 0x3E, 0xD6, 0xFA, 0xAC, 0x72, 0x50, 0x66, 0x9C, 0xD4, 
+    0xEE, 0x95, 0xB5, 0x3A, 0x44, 0x06, 0x72, 0x93, 0xFC, 0xCB, 0xCF, 0xF4, 0x7C, 0x8A, 0x80, 0x56, 0xC6, 0x5D, 0xB1, 0x94, 
+    0x93, 0x55, 0x9F, 0xEC, 0x7C, 0x32, 0xC9, 0x25, 0xAA, 0xFC, 0x8C, 0xB6, 0x7F, 0xED, 0x51, 0x42, 0xA8, 0x7F, 0x56, 0xAC, 
+    0xA0, 0x9A, 0xC1, 0xD8, 0x59, 0x96, 0x26, 0x9C, 0x82, 0x37, 0x2C, 0x83, 0xB5, 0x0D, 0xC8, 0x1B, 0xDC, 0xAB, 0xCA, 0xAA, 
+    0xBA, 0x80, 0x58, 0xDE, 0xA3, 0xF7, 0xCA, 0x46, 0x25, 0xD2, 0xCC, 0xAE, 0x93, 0x55, 0xCB, 0x45, 0xBE, 0xBB, 0x57, 0xAA, 
+    0x9D, 0x19, 0x2B, 0xCF, 0xAA, 0xB2, 0xD0, 0xFB, 0x71, 0x2B, 0xDA, 0x67, 0x1D, 0xCC, 0xCC, 0xB2, 0x56, 0x8D, 0x97, 0x26, 
+    0xFE, 0xD0, 0xCA, 0xF1, 0x9E, 0x11, 0xB4, 0xF5, 0x8C, 0x58, 0xB4, 0x06, 0xB4, 0x2A, 0xB4, 0x6B, 0x26, 0xE8, 0x84, 0x26, 
+    0x08, 0x82, 0x04, 0x44, 0x10, 0x04, 0x09, 0x88, 0x20, 0x08, 0x82, 0x04, 0x44, 0x10, 0x04, 0x09, 0x88, 0x20, 0x08, 0x82, 
+    0x04, 0x44, 0x10, 0x04, 0x09, 0x88, 0x20, 0x08, 0x82, 0x20, 0x88, 0x08, 0x54, 0x0F, 0x77, 0xFB, 0x76, 0x30, 0x24, 0x2B, 
+    0x41, 0x24, 0x11, 0xDD, 0xDF, 0xDF, 0xB3, 0x1F, 0xB9, 0x7C, 0x96, 0xAB, 0x3D, 0x34, 0xB9, 0xBA, 0xBE, 0x3F, 0x9E, 0xC6, 
+    0xCC, 0x7E, 0x9F, 0xA5, 0xA5, 0x20, 0xCA, 0xFD, 0x92, 0x79, 0x61, 0x71, 0xC7, 0xE4, 0xA8, 0xD2, 0xDF, 0x19, 0xF7, 0xB3, 
+    0x32, 0xA3, 0x45, 0x22, 0x6D, 0x93, 0xEA, 0x93, 0x59, 0xDF, 0xDB, 0xD2, 0x90, 0xD1, 0x33, 0xBE, 0xA3, 0x86, 0x78, 0x58, 
+    0xBB, 0x02, 0x91, 0xA1, 0x37, 0xA6, 0x35, 0xC2, 0x3E, 0xEB, 0xC3, 0x55, 0x83, 0x2E, 0x09, 0x1B, 0xDA, 0xF6, 0x9D, 0x57, 
+    0x35, 0x34, 0x69, 0xD1, 0xFE, 0x26, 0xFA, 0xE3, 0x9B, 0x41, 0x96, 0x77, 0x85, 0x89, 0xDC, 0x6B, 0x64, 0xC4, 0xC5, 0x55, 
+    0xE4, 0x0D, 0xF5, 0x96, 0x34, 0xA4, 0x07, 0x15, 0xAD, 0xE4, 0xD2, 0x7B, 0x60, 0x70, 0x34, 0x29, 0x56, 0x4C, 0x18, 0x0F, 
+    0xF9, 0xB4, 0xDF, 0xA0, 0x8F, 0x4A, 0x5A, 0xC8, 0x15, 0x6D, 0x7B, 0x05, 0x4D, 0x42, 0x33, 0xA1, 0x47, 0x8F, 0x5A, 0x56, 
+    0xD7, 0x1C, 0xB5, 0x97, 0x62, 0xB5, 0x6D, 0xBB, 0xD1, 0x49, 0xE8, 0x61, 0x52, 0x8D, 0x0D, 0x3A, 0x7B, 0x8A, 0xD8, 0xA2, 
+    0x95, 0x68, 0x54, 0x63, 0xD4, 0x26, 0xF6, 0x90, 0x8B, 0x45, 0x68, 0x51, 0x73, 0x37, 0x33, 0xDA, 0xC0, 0x4A, 0x6D, 0x68, 
+    0x85, 0x86, 0xB8, 0x3A, 0x40, 0xBE, 0x34, 0x77, 0x4E, 0xD2, 0xBC, 0x7A, 0x0B, 0xF7, 0xAA, 0xFA, 0x5F, 0x88, 0x96, 0x90, 
+    0xBD, 0xF2, 0x48, 0xAB, 0x6B, 0xD4, 0xF3, 0xC8, 0xBD, 0x6F, 0x24, 0x81, 0xCF, 0x08, 0xD3, 0xD0, 0xEE, 0xCC, 0xF4, 0xFE, 
+    0x3E, 0xD3, 0xD0, 0x90, 0x34, 0xBD, 0xF2, 0xB2, 0xDB, 0xA4, 0x09, 0x71, 0xB2, 0x43, 0xF3, 0x91, 0x64, 0x4B, 0x3B, 0x77, 
+    0x4E, 0xF4, 0x9F, 0xAD, 0x5E, 0xC8, 0x6E, 0xED, 0x6A, 0x91, 0x65, 0x4F, 0x9F, 0x68, 0xB7, 0x4B, 0x13, 0xEA, 0xD9, 0x1E, 
+    0xC4, 0x41, 0x98, 0xA5, 0xC9, 0x78, 0xFA, 0x57, 0xFB, 0x36, 0x3D, 0x3A, 0x49, 0x67, 0x9A, 0x44, 0x96, 0x5C, 0x48, 0x9A, 
+    0x66, 0xAF, 0x7D, 0x3B, 0xCD, 0x3D, 0x74, 0x33, 0x41, 0xAA, 0x77, 0xE6, 0x7C, 0xBB, 0xAB, 0x92, 0xC3, 0x89, 0xAB, 0xC9, 
+    0x0E, 0x13, 0x68, 0x77, 0x1F, 0xAE, 0xC8, 0x3B, 0xCA, 0x4F, 0xE4, 0xED, 0x17, 0x6D, 0x20, 0xAE, 0xAC, 0x5D, 0x2E, 0x89, 
+    0x9C, 0x4F, 0xD2, 0xB2, 0x4A, 0x9E, 0x84, 0x8E, 0x1E, 0x44, 0xAF, 0x03, 0xB0, 0xDD, 0xFD, 0xDB, 0x49, 0x8C, 0x3D, 0xCD, 
+    0xA8, 0xE7, 0x83, 0x8A, 0x6C, 0x7F, 0x86, 0x39, 0x63, 0x25, 0x87, 0x8C, 0x09, 0x37, 0x32, 0x45, 0x56, 0x98, 0x60, 0x88, 
+    0x2B, 0xC1, 0xE2, 0x6E, 0xA8, 0x8A, 0x7B, 0xD4, 0xE1, 0xBB, 0xB7, 0xBC, 0x23, 0x63, 0xE9, 0x46, 0xB4, 0x45, 0x72, 0x30, 
+    0x22, 0xE6, 0xD5, 0x0E, 0xAD, 0x63, 0xB5, 0x39, 0x1D, 0x7D, 0x6C, 0xA2, 0x82, 0x63, 0xD9, 0x52, 0x7E, 0x15, 0x42, 0x68, 
+    0x37, 0x54, 0xCA, 0x13, 0x50, 0x6F, 0x07, 0x48, 0x12, 0xCA, 0x4C, 0x35, 0x13, 0xE9, 0xE4, 0x6C, 0x5F, 0x80, 0xB4, 0x7B, 
+    0x37, 0xF3, 0xED, 0x48, 0x64, 0xDF, 0x13, 0x20, 0x6D, 0xFB, 0xB4, 0x61, 0x6A, 0x3D, 0x7D, 0x19, 0xF1, 0x2A, 0x86, 0xA4, 
+    0xCD, 0x44, 0xBF, 0x62, 0xA1, 0x6D, 0xF3, 0x69, 0xDA, 0x46, 0x96, 0x29, 0xC6, 0x33, 0x55, 0x06, 0xB5, 0x99, 0xA0, 0x0C, 
+    0x10, 0xC5, 0x4D, 0xB0, 0x37, 0x80, 0xEC, 0x4C, 0x10, 0xF5, 0xC1, 0x70, 0x1C, 0x04, 0x41, 0x90, 0x80, 0x08, 0x82, 0xF8, 
+    0x1E, 0xFE, 0x07, 0xBA, 0x28, 0x46, 0x09, 0x5B, 0x31, 0xB7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 
+    0x42, 0x60, 0x82, 0};
+
+
+am_embedded_file_record am_embedded_files[] = {
+    {"lua/actions.lua", data1, sizeof(data1)-1},
+    {"lua/audio.lua", data2, sizeof(data2)-1},
+    {"lua/buffer.lua", data3, sizeof(data3)-1},
+    {"lua/cameras.lua", data4, sizeof(data4)-1},
+    {"lua/compat.lua", data5, sizeof(data5)-1},
+    {"lua/config.lua", data6, sizeof(data6)-1},
+    {"lua/events.lua", data7, sizeof(data7)-1},
+    {"lua/extra.lua", data8, sizeof(data8)-1},
+    {"lua/particles.lua", data9, sizeof(data9)-1},
+    {"lua/postprocess.lua", data10, sizeof(data10)-1},
+    {"lua/save.lua", data11, sizeof(data11)-1},
+    {"lua/setup.lua", data12, sizeof(data12)-1},
+    {"lua/sfxr.lua", data13, sizeof(data13)-1},
+    {"lua/shaders.lua", data14, sizeof(data14)-1},
+    {"lua/shapes.lua", data15, sizeof(data15)-1},
+    {"lua/text.lua", data16, sizeof(data16)-1},
+    {"lua/time.lua", data17, sizeof(data17)-1},
+    {"lua/traceback.lua", data18, sizeof(data18)-1},
+    {"lua/tweens.lua", data19, sizeof(data19)-1},
+    {"lua/type.lua", data20, sizeof(data20)-1},
+    {"lua/waiting.lua", data21, sizeof(data21)-1},
+    {"lua/default_font.png", data22, sizeof(data22)-1},
+    {NULL, NULL, 0}
+};
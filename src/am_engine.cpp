@@ -39,6 +39,7 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
     am_open_logging_module(L);
     am_open_math_module(L);
     am_open_time_module(L);
+    am_open_profiler_module(L);
     am_open_buffer_module(L);
     am_open_view_module(L);
     am_open_mathv_module(L);
@@ -66,8 +67,13 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
         am_open_blending_module(L);
         am_open_transforms_module(L);
         am_open_renderer_module(L);
+        am_open_batch_module(L);
+        am_open_caching_module(L);
         am_open_audio_module(L);
+        am_open_audio_loader_module(L);
         am_open_sfxr_module(L);
+        am_open_particles_module(L);
+        am_open_quads_module(L);
 #if defined(AM_BACKEND_IOS)
         am_open_ios_module(L);
 #elif defined(AM_BACKEND_ANDROID)
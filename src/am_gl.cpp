@@ -8,6 +8,7 @@
 
 #if defined(AM_BACKEND_SDL)
     #define GL_GLEXT_PROTOTYPES
+    #include "SDL.h"
     #include <SDL_opengl.h>
 #elif defined(AM_BACKEND_EMSCRIPTEN)
     #include <GLES2/gl2.h>
@@ -90,6 +91,30 @@ int am_max_vertex_texture_image_units = 0;
 int am_max_vertex_uniform_vectors = 0;
 int am_frame_draw_calls = 0;
 int am_frame_use_program_calls = 0;
+int am_frame_state_changes = 0;
+int am_frame_uniform_uploads = 0;
+uint64_t am_frame_bytes_uploaded = 0;
+
+bool am_instancing_supported = false;
+bool am_instanced_attributes_supported = true;
+bool am_float_render_targets_supported = false;
+
+#ifndef GL_RGBA32F
+#define GL_RGBA32F 0x8814
+#endif
+
+// GLES 2 requires the internal format to match the format, while
+// desktop GL and GLES 3 need a sized format to store full floats.
+static GLint float_texture_internal_format = GL_RGBA;
+
+// Instancing functions are looked up at runtime, because which ones
+// are available depends on the driver (see init_instancing).
+typedef void (APIENTRY *vertex_attrib_divisor_func)(GLuint index, GLuint divisor);
+typedef void (APIENTRY *draw_arrays_instanced_func)(GLenum mode, GLint first, GLsizei count, GLsizei primcount);
+typedef void (APIENTRY *draw_elements_instanced_func)(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount);
+static vertex_attrib_divisor_func vertex_attrib_divisor = NULL;
+static draw_arrays_instanced_func draw_arrays_instanced = NULL;
+static draw_elements_instanced_func draw_elements_instanced = NULL;
 
 static bool gl_initialized = false;
 
@@ -178,6 +203,95 @@ static void log_gl_prog_footer() {
     fprintf(gl_log_file, "%s\n", "}");
 }
 
+#if defined(AM_BACKEND_SDL)
+// In headless mode there is no SDL video subsystem, so GL functions and
+// extensions are looked up through EGL instead.
+static bool gl_extension_supported(const char *name) {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_conf_headless) return am_headless_extension_supported(name);
+#endif
+    return SDL_GL_ExtensionSupported(name);
+}
+
+static void *gl_get_proc_address(const char *name) {
+#if defined(AM_HEADLESS_SUPPORTED)
+    if (am_conf_headless) return am_headless_get_proc_address(name);
+#endif
+    return SDL_GL_GetProcAddress(name);
+}
+#endif
+
+static void init_instancing() {
+    am_instancing_supported = false;
+#if defined(AM_BACKEND_SDL)
+    const char *version = (const char*)GLFUNC(glGetString)(GL_VERSION);
+    int major = 0;
+    int minor = 0;
+    if (version != NULL) {
+        if (sscanf(version, "OpenGL ES %d.%d", &major, &minor) != 2) {
+            sscanf(version, "%d.%d", &major, &minor);
+        }
+    }
+    const char *suffix = NULL;
+    if (am_conf_d3dangle) {
+        if (major >= 3) {
+            suffix = "";
+        } else if (gl_extension_supported("GL_ANGLE_instanced_arrays")) {
+            suffix = "ANGLE";
+        }
+    } else if (major > 3 || (major == 3 && minor >= 3)) {
+        suffix = "";
+    } else if (gl_extension_supported("GL_ARB_instanced_arrays")
+        && gl_extension_supported("GL_ARB_draw_instanced"))
+    {
+        suffix = "ARB";
+    }
+    if (suffix == NULL) return;
+    char name[64];
+    snprintf(name, sizeof(name), "glVertexAttribDivisor%s", suffix);
+    vertex_attrib_divisor = (vertex_attrib_divisor_func)gl_get_proc_address(name);
+    snprintf(name, sizeof(name), "glDrawArraysInstanced%s", suffix);
+    draw_arrays_instanced = (draw_arrays_instanced_func)gl_get_proc_address(name);
+    snprintf(name, sizeof(name), "glDrawElementsInstanced%s", suffix);
+    draw_elements_instanced = (draw_elements_instanced_func)gl_get_proc_address(name);
+    am_instancing_supported = vertex_attrib_divisor != NULL
+        && draw_arrays_instanced != NULL
+        && draw_elements_instanced != NULL;
+#endif
+}
+
+static void init_float_render_targets() {
+    am_float_render_targets_supported = false;
+#if defined(AM_BACKEND_SDL)
+    const char *version = (const char*)GLFUNC(glGetString)(GL_VERSION);
+    int major = 0;
+    int minor = 0;
+    bool es = false;
+    if (version != NULL) {
+        if (sscanf(version, "OpenGL ES %d.%d", &major, &minor) == 2) {
+            es = true;
+        } else {
+            sscanf(version, "%d.%d", &major, &minor);
+        }
+    }
+    if (am_conf_d3dangle || es) {
+        if (major >= 3 && gl_extension_supported("GL_EXT_color_buffer_float")) {
+            float_texture_internal_format = GL_RGBA32F;
+            am_float_render_targets_supported = true;
+        } else if (gl_extension_supported("GL_OES_texture_float")
+            && (gl_extension_supported("GL_EXT_color_buffer_float")
+                || gl_extension_supported("GL_WEBGL_color_buffer_float")))
+        {
+            float_texture_internal_format = GL_RGBA;
+            am_float_render_targets_supported = true;
+        }
+    } else if (major >= 3 || gl_extension_supported("GL_ARB_texture_float")) {
+        float_texture_internal_format = GL_RGBA32F;
+        am_float_render_targets_supported = true;
+    }
+#endif
+}
+
 void am_init_gl() {
     if (gl_initialized) {
         am_log0("INTERNAL ERROR: %s", "gl already initialized");
@@ -255,6 +369,9 @@ void am_init_gl() {
     am_max_vertex_uniform_vectors = pval;
 #endif
 
+    init_instancing();
+    init_float_render_targets();
+
     // initialize glsl optimizer if using
 #if defined(AM_USE_GLSL_OPTIMIZER)
     init_glslopt();
@@ -354,6 +471,7 @@ static void get_src_error_line(char *errmsg, const char *src, int *line_no, char
 
 void am_set_blend_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_BLEND");
         GLFUNC(glEnable)(GL_BLEND);
@@ -366,6 +484,7 @@ void am_set_blend_enabled(bool enabled) {
 
 void am_set_blend_color(float r, float g, float b, float a) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glBlendColor(%0.2f, %0.2f, %0.2f, %0.2f);", r, g, b, a);
     GLFUNC(glBlendColor)(r, g, b, a);
     check_for_errors
@@ -373,6 +492,7 @@ void am_set_blend_color(float r, float g, float b, float a) {
 
 void am_set_blend_equation(am_blend_equation rgb, am_blend_equation alpha) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_rgb = to_gl_blend_equation(rgb);
     GLenum gl_alpha = to_gl_blend_equation(alpha);
     if (gl_rgb == gl_alpha) {
@@ -387,6 +507,7 @@ void am_set_blend_equation(am_blend_equation rgb, am_blend_equation alpha) {
 
 void am_set_blend_func(am_blend_sfactor src_rgb, am_blend_dfactor dst_rgb, am_blend_sfactor src_alpha, am_blend_dfactor dst_alpha) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_srgb = to_gl_blend_sfactor(src_rgb);
     GLenum gl_drgb = to_gl_blend_dfactor(dst_rgb);
     GLenum gl_salpha = to_gl_blend_sfactor(src_alpha);
@@ -409,6 +530,7 @@ void am_set_blend_func(am_blend_sfactor src_rgb, am_blend_dfactor dst_rgb, am_bl
 
 void am_set_depth_test_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_DEPTH_TEST");
         GLFUNC(glEnable)(GL_DEPTH_TEST);
@@ -421,6 +543,7 @@ void am_set_depth_test_enabled(bool enabled) {
 
 void am_set_depth_func(am_depth_func func) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_f = to_gl_depth_func(func);
     log_gl("glDepthFunc(%s);", gl_depth_func_str(gl_f));
     GLFUNC(glDepthFunc)(gl_f);
@@ -429,6 +552,7 @@ void am_set_depth_func(am_depth_func func) {
 
 void am_set_stencil_test_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_STENCIL_TEST");
         GLFUNC(glEnable)(GL_STENCIL_TEST);
@@ -441,6 +565,7 @@ void am_set_stencil_test_enabled(bool enabled) {
 
 void am_set_stencil_func(am_glint ref, am_gluint mask, am_stencil_func func_front, am_stencil_func func_back) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_face = GL_FRONT;
     GLenum gl_func = to_gl_stencil_func(func_front);
     log_gl("glStencilFuncSeparate(%s, %s, %d, %u);",
@@ -458,6 +583,7 @@ void am_set_stencil_func(am_glint ref, am_gluint mask, am_stencil_func func_fron
 
 void am_set_stencil_op(am_stencil_face_side face, am_stencil_op fail, am_stencil_op zfail, am_stencil_op zpass) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_face = to_gl_stencil_face_side(face);
     GLenum gl_fail = to_gl_stencil_op(fail);
     GLenum gl_zfail = to_gl_stencil_op(zfail);
@@ -473,6 +599,7 @@ void am_set_stencil_op(am_stencil_face_side face, am_stencil_op fail, am_stencil
 
 void am_set_sample_alpha_to_coverage_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_SAMPLE_ALPHA_TO_COVERAGE");
         GLFUNC(glEnable)(GL_SAMPLE_ALPHA_TO_COVERAGE);
@@ -485,6 +612,7 @@ void am_set_sample_alpha_to_coverage_enabled(bool enabled) {
 
 void am_set_sample_coverage_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_SAMPLE_COVERAGE");
         GLFUNC(glEnable)(GL_SAMPLE_COVERAGE);
@@ -497,6 +625,7 @@ void am_set_sample_coverage_enabled(bool enabled) {
 
 void am_set_sample_coverage(float value, bool invert) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glSampleCoverage(%f, %d);", value, (int)invert);
     GLFUNC(glSampleCoverage)(value, invert);
     check_for_errors
@@ -515,6 +644,7 @@ void am_clear_framebuffer(bool clear_color_buf, bool clear_depth_buf, bool clear
 
 void am_set_framebuffer_clear_color(float r, float g, float b, float a) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glClearColor(%0.2f, %0.2f, %0.2f, %0.2f);", r, g, b, a);
     GLFUNC(glClearColor)(r, g, b, a);
     check_for_errors
@@ -522,6 +652,7 @@ void am_set_framebuffer_clear_color(float r, float g, float b, float a) {
 
 void am_set_framebuffer_clear_depth(float depth) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glClearDepthf(%f);", depth);
     GLFUNC(glClearDepthf)(depth);
     check_for_errors
@@ -529,6 +660,7 @@ void am_set_framebuffer_clear_depth(float depth) {
 
 void am_set_framebuffer_clear_stencil_val(am_glint val) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glClearStencil(%d);", val);
     GLFUNC(glClearStencil)(val);
     check_for_errors
@@ -536,6 +668,7 @@ void am_set_framebuffer_clear_stencil_val(am_glint val) {
 
 void am_set_framebuffer_color_mask(bool r, bool g, bool b, bool a) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glColorMask(%d, %d, %d, %d);", (int)r, (int)g, (int)b, (int)a);
     GLFUNC(glColorMask)(r, g, b, a);
     check_for_errors
@@ -543,6 +676,7 @@ void am_set_framebuffer_color_mask(bool r, bool g, bool b, bool a) {
 
 void am_set_framebuffer_depth_mask(bool flag) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glDepthMask(%d);", (int)flag);
     GLFUNC(glDepthMask)(flag);
     check_for_errors
@@ -550,6 +684,7 @@ void am_set_framebuffer_depth_mask(bool flag) {
 
 void am_set_framebuffer_stencil_mask(am_gluint mask) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glStencilMask(%u);", mask);
     GLFUNC(glStencilMask)(mask);
     check_for_errors
@@ -569,6 +704,7 @@ am_buffer_id am_create_buffer_object() {
 
 void am_bind_buffer(am_buffer_target target, am_buffer_id buffer) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_target = to_gl_buffer_target(target);
     log_gl("glBindBuffer(%s, buf[%u]);", gl_buffer_target_str(gl_target), buffer);
     GLFUNC(glBindBuffer)(gl_target, buffer);
@@ -577,6 +713,7 @@ void am_bind_buffer(am_buffer_target target, am_buffer_id buffer) {
 
 void am_set_buffer_data(am_buffer_target target, int size, void *data, am_buffer_usage usage) {
     check_initialized();
+    am_frame_bytes_uploaded += size;
     GLenum gl_target = to_gl_buffer_target(target);
     GLenum gl_usage = to_gl_buffer_usage(usage);
     log_gl_ptr(data, size);
@@ -587,6 +724,7 @@ void am_set_buffer_data(am_buffer_target target, int size, void *data, am_buffer
 
 void am_set_buffer_sub_data(am_buffer_target target, int offset, int size, void *data) {
     check_initialized();
+    am_frame_bytes_uploaded += size;
     GLenum gl_target = to_gl_buffer_target(target);
     log_gl_ptr(data, size);
     log_gl("glBufferSubData(%s, %d, %d, ptr[%p]);", gl_buffer_target_str(gl_target), offset, size, data);
@@ -605,6 +743,7 @@ void am_delete_buffer(am_buffer_id buffer) {
 
 void am_set_depth_range(float near, float far) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glDepthRangef(%f, %f);", near, far);
     GLFUNC(glDepthRangef)(near, far);
     check_for_errors
@@ -612,6 +751,7 @@ void am_set_depth_range(float near, float far) {
 
 void am_set_scissor_test_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_SCISSOR_TEST");
         GLFUNC(glEnable)(GL_SCISSOR_TEST);
@@ -624,6 +764,7 @@ void am_set_scissor_test_enabled(bool enabled) {
 
 void am_set_scissor(int x, int y, int w, int h) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glScissor(%d, %d, %d, %d);", x, y, w, h);
     GLFUNC(glScissor)(x, y, w, h);
     check_for_errors
@@ -631,6 +772,7 @@ void am_set_scissor(int x, int y, int w, int h) {
 
 void am_set_viewport(int x, int y, int w, int h) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glViewport(%d, %d, %d, %d);", x, y, w, h);
     GLFUNC(glViewport)(x, y, w, h);
     check_for_errors
@@ -640,6 +782,7 @@ void am_set_viewport(int x, int y, int w, int h) {
 
 void am_set_front_face_winding(am_face_winding mode) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_mode = to_gl_face_winding(mode);
     log_gl("glFrontFace(%s);", gl_face_winding_str(gl_mode));
     GLFUNC(glFrontFace)(gl_mode);
@@ -648,6 +791,7 @@ void am_set_front_face_winding(am_face_winding mode) {
 
 void am_set_cull_face_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_CULL_FACE");
         GLFUNC(glEnable)(GL_CULL_FACE);
@@ -660,6 +804,7 @@ void am_set_cull_face_enabled(bool enabled) {
 
 void am_set_cull_face_side(am_cull_face_side face) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_face = to_gl_cull_face_side(face);
     log_gl("glCullFace(%s);", gl_face_side_str(gl_face));
     GLFUNC(glCullFace)(gl_face);
@@ -668,6 +813,7 @@ void am_set_cull_face_side(am_cull_face_side face) {
 
 void am_set_line_width(float width) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glLineWidth(%f);", width);
     GLFUNC(glLineWidth)(width);
     check_for_errors
@@ -675,6 +821,7 @@ void am_set_line_width(float width) {
 
 void am_set_polygon_offset_fill_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_POLYGON_OFFSET_FILL");
         GLFUNC(glEnable)(GL_POLYGON_OFFSET_FILL);
@@ -687,6 +834,7 @@ void am_set_polygon_offset_fill_enabled(bool enabled) {
 
 void am_set_polygon_offset(float factor, float units) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glPolygonOffset(%f, %f);", factor, units);
     GLFUNC(glPolygonOffset)(factor, units);
     check_for_errors
@@ -696,6 +844,7 @@ void am_set_polygon_offset(float factor, float units) {
 
 void am_set_dither_enabled(bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnable(%s);", "GL_DITHER");
         GLFUNC(glEnable)(GL_DITHER);
@@ -936,6 +1085,7 @@ int am_attribute_client_type_size(am_attribute_client_type t) {
 
 void am_set_attribute_array_enabled(am_gluint location, bool enabled) {
     check_initialized();
+    am_frame_state_changes++;
     if (enabled) {
         log_gl("glEnableVertexAttribArray(%u);", location);
         GLFUNC(glEnableVertexAttribArray)(location);
@@ -1008,6 +1158,7 @@ void am_get_active_uniform(am_program_id program, am_gluint index,
 
 void am_set_uniform1f(am_gluint location, float value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{GLfloat v = %f;\nglUniform1fv(%u, 1, &v);}", value, location);
     GLFUNC(glUniform1fv)(location, 1, &value);
     check_for_errors
@@ -1015,6 +1166,7 @@ void am_set_uniform1f(am_gluint location, float value) {
 
 void am_set_uniform2f(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {%f, %f};\nglUniform2fv(%u, 1, v);}",
         value[0], value[1], location);
     GLFUNC(glUniform2fv)(location, 1, value);
@@ -1023,6 +1175,7 @@ void am_set_uniform2f(am_gluint location, const float *value) {
 
 void am_set_uniform3f(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {%f, %f, %f};\nglUniform3fv(%u, 1, v);}",
         value[0], value[1], value[2], location);
     GLFUNC(glUniform3fv)(location, 1, value);
@@ -1031,6 +1184,7 @@ void am_set_uniform3f(am_gluint location, const float *value) {
 
 void am_set_uniform4f(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {%f, %f, %f, %f};\nglUniform4fv(%u, 1, v);}",
         value[0], value[1], value[2], value[3], location);
     GLFUNC(glUniform4fv)(location, 1, value);
@@ -1039,6 +1193,7 @@ void am_set_uniform4f(am_gluint location, const float *value) {
 
 void am_set_uniform1i(am_gluint location, am_glint value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{GLint v = %d;\nglUniform1iv(%u, 1, &v);}", value, location);
     GLFUNC(glUniform1iv)(location, 1, &value);
     check_for_errors
@@ -1046,6 +1201,7 @@ void am_set_uniform1i(am_gluint location, am_glint value) {
 
 void am_set_uniform2i(am_gluint location, const am_glint *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLint v[] = {%d, %d};\nglUniform2iv(%u, 1, v);}",
         value[0], value[1], location);
     GLFUNC(glUniform2iv)(location, 1, value);
@@ -1054,6 +1210,7 @@ void am_set_uniform2i(am_gluint location, const am_glint *value) {
 
 void am_set_uniform3i(am_gluint location, const am_glint *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLint v[] = {%d, %d, %d};\nglUniform3iv(%u, 1, v);}",
         value[0], value[1], value[2], location);
     GLFUNC(glUniform3iv)(location, 1, value);
@@ -1062,6 +1219,7 @@ void am_set_uniform3i(am_gluint location, const am_glint *value) {
 
 void am_set_uniform4i(am_gluint location, const am_glint *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLint v[] = {%d, %d, %d, %d};\nglUniform4iv(%u, 1, v);}",
         value[0], value[1], value[2], value[3], location);
     GLFUNC(glUniform4iv)(location, 1, value);
@@ -1070,6 +1228,7 @@ void am_set_uniform4i(am_gluint location, const am_glint *value) {
 
 void am_set_uniform_mat2(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {\n%f, %f, \n%f, %f};\nglUniformMatrix2fv(%u, 1, GL_FALSE, v);}",
         value[0], value[1], value[2], value[3], location);
     GLFUNC(glUniformMatrix2fv)(location, 1, GL_FALSE, value);
@@ -1078,6 +1237,7 @@ void am_set_uniform_mat2(am_gluint location, const float *value) {
 
 void am_set_uniform_mat3(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {\n%f, %f, %f,\n%f, %f, %f,\n%f, %f, %f};\nglUniformMatrix3fv(%u, 1, GL_FALSE, v);}", 
         value[0], value[1], value[2],
         value[3], value[4], value[5],
@@ -1088,6 +1248,7 @@ void am_set_uniform_mat3(am_gluint location, const float *value) {
 
 void am_set_uniform_mat4(am_gluint location, const float *value) {
     check_initialized();
+    am_frame_uniform_uploads++;
     log_gl("{const GLfloat v[] = {\n%f, %f, %f, %f,\n%f, %f, %f, %f,\n%f, %f, %f, %f,\n%f, %f, %f, %f};\nglUniformMatrix4fv(%u, 1, GL_FALSE, v);}",
         value[0], value[1], value[2], value[3],
         value[4], value[5], value[6], value[7],
@@ -1130,6 +1291,7 @@ void am_set_attribute4f(am_gluint location, const float *value) {
 
 void am_set_attribute_pointer(am_gluint location, int size, am_attribute_client_type type, bool normalized, int stride, int offset) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_type = to_gl_attr_client_type(type);
     log_gl("glVertexAttribPointer(%u, %d, %s, %d, %d, (void*)((uintptr_t)%d));", location, size, gl_type_str(gl_type), (int)normalized, stride, offset);
     GLFUNC(glVertexAttribPointer)(location, size, gl_type, normalized, stride, (void*)((uintptr_t)offset));
@@ -1140,6 +1302,7 @@ void am_set_attribute_pointer(am_gluint location, int size, am_attribute_client_
 
 void am_set_active_texture_unit(int texture_unit) {
     check_initialized();
+    am_frame_state_changes++;
     if (texture_unit < am_max_combined_texture_image_units) {
         log_gl("glActiveTexture(GL_TEXTURE0 + %d);", texture_unit);
         GLFUNC(glActiveTexture)(GL_TEXTURE0 + texture_unit);
@@ -1168,6 +1331,7 @@ void am_delete_texture(am_texture_id texture) {
 
 void am_bind_texture(am_texture_bind_target target, am_texture_id texture) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_target = to_gl_texture_bind_target(target);
     log_gl("glBindTexture(%s, tex[%u]);", gl_texture_target_str(gl_target), texture);
     GLFUNC(glBindTexture)(gl_target, texture);
@@ -1221,6 +1385,18 @@ int am_compute_pixel_size(am_texture_format format, am_texture_type type) {
         case AM_TEXTURE_TYPE_USHORT_4_4_4_4:
         case AM_TEXTURE_TYPE_USHORT_5_5_5_1:
             return 2;
+        case AM_TEXTURE_TYPE_FLOAT:
+            switch (format) {
+                case AM_TEXTURE_FORMAT_ALPHA:
+                case AM_TEXTURE_FORMAT_LUMINANCE:
+                    return 4;
+                case AM_TEXTURE_FORMAT_LUMINANCE_ALPHA:
+                    return 8;
+                case AM_TEXTURE_FORMAT_RGB:
+                    return 12;
+                case AM_TEXTURE_FORMAT_RGBA:
+                    return 16;
+            }
     }
     assert(false);
     return 0;
@@ -1228,23 +1404,29 @@ int am_compute_pixel_size(am_texture_format format, am_texture_type type) {
 
 void am_set_texture_image_2d(am_texture_copy_target target, int level, am_texture_format format, int w, int h, am_texture_type type, void *data) {
     check_initialized();
+    if (data != NULL) am_frame_bytes_uploaded += w * h * am_compute_pixel_size(format, type);
     GLenum gl_target = to_gl_texture_copy_target(target);
     GLenum gl_format = to_gl_texture_format(format);
     GLenum gl_type = to_gl_texture_type(type);
     log_gl_ptr(data, w * h * am_compute_pixel_size(format, type));
+    GLint gl_internal_format = gl_format;
+    if (type == AM_TEXTURE_TYPE_FLOAT && format == AM_TEXTURE_FORMAT_RGBA) {
+        gl_internal_format = float_texture_internal_format;
+    }
     log_gl("glTexImage2D(%s, %d, %s, %d, %d, 0, %s, %s, ptr[%p]);",
         gl_texture_target_str(gl_target), level,
-        gl_texture_format_str(gl_format),
+        gl_internal_format == GL_RGBA32F ? "GL_RGBA32F" : gl_texture_format_str(gl_format),
         w, h,
         gl_texture_format_str(gl_format),
         gl_texture_type_str(gl_type),
         data);
-    GLFUNC(glTexImage2D)(gl_target, level, gl_format, w, h, 0, gl_format, gl_type, data);
+    GLFUNC(glTexImage2D)(gl_target, level, gl_internal_format, w, h, 0, gl_format, gl_type, data);
     check_for_errors
 }
 
 void am_set_texture_sub_image_2d(am_texture_copy_target target, int level, int xoffset, int yoffset, int w, int h, am_texture_format format, am_texture_type type, void *data) {
     check_initialized();
+    am_frame_bytes_uploaded += w * h * am_compute_pixel_size(format, type);
     GLenum gl_target = to_gl_texture_copy_target(target);
     GLenum gl_format = to_gl_texture_format(format);
     GLenum gl_type = to_gl_texture_type(type);
@@ -1260,6 +1442,7 @@ void am_set_texture_sub_image_2d(am_texture_copy_target target, int level, int x
 
 void am_set_texture_min_filter(am_texture_bind_target target, am_texture_min_filter filter) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_target = to_gl_texture_bind_target(target);
     GLenum gl_filter = to_gl_texture_min_filter(filter);
     log_gl("glTexParameteri(%s, GL_TEXTURE_MIN_FILTER, %s);",
@@ -1271,6 +1454,7 @@ void am_set_texture_min_filter(am_texture_bind_target target, am_texture_min_fil
 
 void am_set_texture_mag_filter(am_texture_bind_target target, am_texture_mag_filter filter) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_target = to_gl_texture_bind_target(target);
     GLenum gl_filter = to_gl_texture_mag_filter(filter);
     log_gl("glTexParameteri(%s, GL_TEXTURE_MAG_FILTER, %s);",
@@ -1282,6 +1466,7 @@ void am_set_texture_mag_filter(am_texture_bind_target target, am_texture_mag_fil
 
 void am_set_texture_wrap(am_texture_bind_target target, am_texture_wrap s_wrap, am_texture_wrap t_wrap) {
     check_initialized();
+    am_frame_state_changes++;
     GLenum gl_target = to_gl_texture_bind_target(target);
     GLenum gl_swrap = to_gl_texture_wrap(s_wrap);
     GLenum gl_twrap = to_gl_texture_wrap(t_wrap);
@@ -1318,6 +1503,7 @@ void am_delete_renderbuffer(am_renderbuffer_id rb) {
 
 void am_bind_renderbuffer(am_renderbuffer_id rb) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glBindRenderbuffer(GL_RENDERBUFFER, rbuf[%u]);", rb);
     GLFUNC(glBindRenderbuffer)(GL_RENDERBUFFER, rb);
     check_for_errors
@@ -1363,6 +1549,7 @@ void am_delete_framebuffer(am_framebuffer_id fb) {
 
 void am_bind_framebuffer(am_framebuffer_id fb) {
     check_initialized();
+    am_frame_state_changes++;
     log_gl("glBindFramebuffer(GL_FRAMEBUFFER, fbuf[%u]);", fb);
     GLFUNC(glBindFramebuffer)(GL_FRAMEBUFFER, fb);
     check_for_errors
@@ -1419,6 +1606,35 @@ void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type,
     am_frame_draw_calls++;
 }
 
+void am_set_attribute_divisor(am_gluint location, int divisor) {
+    check_initialized();
+    am_frame_state_changes++;
+    log_gl("glVertexAttribDivisor(%u, %d);", location, divisor);
+    vertex_attrib_divisor(location, divisor);
+    check_for_errors
+}
+
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances) {
+    check_initialized();
+    GLenum gl_mode = to_gl_draw_mode(mode);
+    log_gl("glDrawArraysInstanced(%s, %d, %d, %d);",
+        gl_draw_mode_str(gl_mode), first, count, instances);
+    draw_arrays_instanced(gl_mode, first, count, instances);
+    check_for_errors
+    am_frame_draw_calls++;
+}
+
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances) {
+    check_initialized();
+    GLenum gl_mode = to_gl_draw_mode(mode);
+    GLenum gl_type = to_gl_element_index_type(type);
+    log_gl("glDrawElementsInstanced(%s, %d, %s, %d, %d);",
+        gl_draw_mode_str(gl_mode), count, gl_type_str(gl_type), offset, instances);
+    draw_elements_instanced(gl_mode, count, gl_type, (void*)((uintptr_t)offset), instances);
+    check_for_errors
+    am_frame_draw_calls++;
+}
+
 void am_gl_end_framebuffer_render() {
 }
 
@@ -1607,6 +1823,7 @@ static GLenum to_gl_texture_type(am_texture_type t) {
         case AM_TEXTURE_TYPE_USHORT_5_6_5: return GL_UNSIGNED_SHORT_5_6_5;
         case AM_TEXTURE_TYPE_USHORT_4_4_4_4: return GL_UNSIGNED_SHORT_4_4_4_4;
         case AM_TEXTURE_TYPE_USHORT_5_5_5_1: return GL_UNSIGNED_SHORT_5_5_5_1;
+        case AM_TEXTURE_TYPE_FLOAT: return GL_FLOAT;
     }
     return 0;
 }
@@ -1942,6 +2159,7 @@ static const char *gl_texture_type_str(GLenum e) {
         case GL_UNSIGNED_SHORT_4_4_4_4: return "GL_UNSIGNED_SHORT_4_4_4_4";
         case GL_UNSIGNED_SHORT_5_5_5_1: return "GL_UNSIGNED_SHORT_5_5_5_1";
         case GL_UNSIGNED_SHORT_5_6_5: return "GL_UNSIGNED_SHORT_5_6_5";
+        case GL_FLOAT: return "GL_FLOAT";
     }
     return "<UNKNOWN GL CONSTANT>";
 }
@@ -2167,6 +2385,9 @@ static void angle_translate_shader(am_shader_type type,
 void am_reset_gl_frame_stats() {
     am_frame_draw_calls = 0;
     am_frame_use_program_calls = 0;
+    am_frame_state_changes = 0;
+    am_frame_uniform_uploads = 0;
+    am_frame_bytes_uploaded = 0;
 }
 
 bool am_gl_requires_combined_depthstencil() {
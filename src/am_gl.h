@@ -21,6 +21,9 @@ extern int am_max_vertex_texture_image_units;
 extern int am_max_vertex_uniform_vectors;
 extern int am_frame_draw_calls;
 extern int am_frame_use_program_calls;
+extern int am_frame_state_changes;
+extern int am_frame_uniform_uploads;
+extern uint64_t am_frame_bytes_uploaded;
 
 // Per-Fragment Operations
 
@@ -316,6 +319,7 @@ enum am_texture_type {
     AM_TEXTURE_TYPE_USHORT_5_6_5,
     AM_TEXTURE_TYPE_USHORT_4_4_4_4,
     AM_TEXTURE_TYPE_USHORT_5_5_5_1,
+    AM_TEXTURE_TYPE_FLOAT,
 };
 
 enum am_texture_min_filter {
@@ -352,6 +356,11 @@ void am_copy_texture_sub_image_2d(am_texture_copy_target target, int level, int
 
 void am_generate_mipmap(am_texture_bind_target target);
 
+// Float textures (AM_TEXTURE_TYPE_FLOAT) may only be created if
+// am_float_render_targets_supported is true. They are always renderable,
+// though a framebuffer using one should still be checked for completeness.
+extern bool am_float_render_targets_supported;
+
 int am_compute_pixel_size(am_texture_format format, am_texture_type type);
 
 void am_set_texture_image_2d(am_texture_copy_target target, int level, am_texture_format format, int w, int h, am_texture_type type, void *data);
@@ -431,6 +440,19 @@ enum am_element_index_type {
 void am_draw_arrays(am_draw_mode mode, int first, int count);
 void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type, int offset);
 
+// Instanced drawing is only available with GL 3.3, GLES 3 or the
+// ARB/ANGLE instanced arrays extensions. The following functions may
+// only be called if am_instancing_supported is true.
+extern bool am_instancing_supported;
+void am_set_attribute_divisor(am_gluint location, int divisor);
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances);
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances);
+
+// Whether per-instance attributes (am.instanced) can be used at all. If
+// am_instancing_supported is false they're emulated by drawing each
+// instance separately, which needs am_set_attribute4f.
+extern bool am_instanced_attributes_supported;
+
 // Other
 
 void am_gl_end_framebuffer_render();
@@ -0,0 +1,267 @@
+#include "amulet.h"
+
+#ifdef AM_HEADLESS_SUPPORTED
+
+#include "SDL.h"
+
+// The parts of the EGL API we use. These are declared here rather than
+// taken from EGL/egl.h, because libEGL is loaded at runtime.
+
+typedef void *EGLDisplay;
+typedef void *EGLConfig;
+typedef void *EGLContext;
+typedef void *EGLSurface;
+typedef int32_t EGLint;
+typedef unsigned int EGLenum;
+typedef unsigned int EGLBoolean;
+
+#define EGL_NONE                        0x3038
+#define EGL_SUCCESS                     0x3000
+#define EGL_EXTENSIONS                  0x3055
+#define EGL_SURFACE_TYPE                0x3033
+#define EGL_PBUFFER_BIT                 0x0001
+#define EGL_RENDERABLE_TYPE             0x3040
+#define EGL_OPENGL_BIT                  0x0008
+#define EGL_RED_SIZE                    0x3024
+#define EGL_GREEN_SIZE                  0x3023
+#define EGL_BLUE_SIZE                   0x3022
+#define EGL_DEPTH_SIZE                  0x3025
+#define EGL_STENCIL_SIZE                0x3026
+#define EGL_SAMPLE_BUFFERS              0x3032
+#define EGL_SAMPLES                     0x3031
+#define EGL_WIDTH                       0x3057
+#define EGL_HEIGHT                      0x3056
+#define EGL_OPENGL_API                  0x30A2
+#define EGL_PLATFORM_SURFACELESS_MESA   0x31DD
+
+#define AM_GL_EXTENSIONS                0x1F03
+
+#define EGL_NO_DISPLAY ((EGLDisplay)0)
+#define EGL_NO_CONTEXT ((EGLContext)0)
+#define EGL_NO_SURFACE ((EGLSurface)0)
+#define EGL_DEFAULT_DISPLAY ((void*)0)
+
+#define AM_EGLPROCS \
+    AM_EGLPROC(void*, eglGetProcAddress, (const char *name)) \
+    AM_EGLPROC(EGLint, eglGetError, (void)) \
+    AM_EGLPROC(EGLDisplay, eglGetDisplay, (void *native_display)) \
+    AM_EGLPROC(EGLBoolean, eglInitialize, (EGLDisplay dpy, EGLint *major, EGLint *minor)) \
+    AM_EGLPROC(EGLBoolean, eglTerminate, (EGLDisplay dpy)) \
+    AM_EGLPROC(const char*, eglQueryString, (EGLDisplay dpy, EGLint name)) \
+    AM_EGLPROC(EGLBoolean, eglBindAPI, (EGLenum api)) \
+    AM_EGLPROC(EGLBoolean, eglChooseConfig, (EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config)) \
+    AM_EGLPROC(EGLContext, eglCreateContext, (EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list)) \
+    AM_EGLPROC(EGLBoolean, eglDestroyContext, (EGLDisplay dpy, EGLContext ctx)) \
+    AM_EGLPROC(EGLSurface, eglCreatePbufferSurface, (EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list)) \
+    AM_EGLPROC(EGLBoolean, eglDestroySurface, (EGLDisplay dpy, EGLSurface surface)) \
+    AM_EGLPROC(EGLBoolean, eglMakeCurrent, (EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx))
+
+#define AM_EGLPROC(ret, func, params) static ret (*func##_ptr) params = NULL;
+AM_EGLPROCS
+#undef AM_EGLPROC
+
+typedef EGLDisplay (*get_platform_display_func)(EGLenum platform, void *native_display, const EGLint *attrib_list);
+
+static void *egl_lib = NULL;
+static EGLDisplay display = EGL_NO_DISPLAY;
+static EGLConfig config = NULL;
+static EGLContext context = EGL_NO_CONTEXT;
+static EGLSurface surface = EGL_NO_SURFACE;
+static int window_width = 0;
+static int window_height = 0;
+
+// there's only one headless window, so this is just used as its handle
+static int headless_window_handle;
+
+static bool load_egl() {
+    if (egl_lib != NULL) return true;
+    egl_lib = SDL_LoadObject("libEGL.so.1");
+    if (egl_lib == NULL) {
+        am_log0("headless mode requires libEGL: %s", SDL_GetError());
+        return false;
+    }
+#define AM_EGLPROC(ret, func, params) \
+    func##_ptr = (ret (*) params)SDL_LoadFunction(egl_lib, #func); \
+    if (func##_ptr == NULL) { \
+        am_log0("unable to load EGL function %s", #func); \
+        SDL_UnloadObject(egl_lib); \
+        egl_lib = NULL; \
+        return false; \
+    }
+AM_EGLPROCS
+#undef AM_EGLPROC
+    return true;
+}
+
+static bool has_extension(const char *extensions, const char *name) {
+    if (extensions == NULL) return false;
+    size_t len = strlen(name);
+    const char *ext = extensions;
+    while ((ext = strstr(ext, name)) != NULL) {
+        if ((ext == extensions || ext[-1] == ' ') && (ext[len] == ' ' || ext[len] == '\0')) {
+            return true;
+        }
+        ext += len;
+    }
+    return false;
+}
+
+static EGLDisplay get_display() {
+    // Prefer Mesa's surfaceless platform, which doesn't need a
+    // display server. Otherwise use whatever the default is.
+    const char *client_exts = eglQueryString_ptr(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (has_extension(client_exts, "EGL_MESA_platform_surfaceless")) {
+        get_platform_display_func get_platform_display =
+            (get_platform_display_func)eglGetProcAddress_ptr("eglGetPlatformDisplayEXT");
+        if (get_platform_display != NULL) {
+            EGLDisplay dpy = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            if (dpy != EGL_NO_DISPLAY) return dpy;
+        }
+    }
+    return eglGetDisplay_ptr(EGL_DEFAULT_DISPLAY);
+}
+
+static bool choose_config(bool depth_buffer, bool stencil_buffer, int msaa_samples) {
+    EGLint attrs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_DEPTH_SIZE, depth_buffer ? 24 : 0,
+        EGL_STENCIL_SIZE, stencil_buffer ? 8 : 0,
+        EGL_SAMPLE_BUFFERS, msaa_samples > 0 ? 1 : 0,
+        EGL_SAMPLES, msaa_samples,
+        EGL_NONE
+    };
+    EGLint num_configs = 0;
+    if (eglChooseConfig_ptr(display, attrs, &config, 1, &num_configs) && num_configs > 0) {
+        return true;
+    }
+    if (msaa_samples > 0) {
+        am_log0("%s", "msaa not available in headless mode, disabling");
+        return choose_config(depth_buffer, stencil_buffer, 0);
+    }
+    return false;
+}
+
+static bool create_surface(int width, int height) {
+    EGLint attrs[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+    surface = eglCreatePbufferSurface_ptr(display, config, attrs);
+    if (surface == EGL_NO_SURFACE) {
+        am_log0("unable to create %dx%d pbuffer (EGL error 0x%x)", width, height, eglGetError_ptr());
+        return false;
+    }
+    window_width = width;
+    window_height = height;
+    return true;
+}
+
+am_native_window *am_headless_create_window(int width, int height,
+    bool depth_buffer, bool stencil_buffer, int msaa_samples)
+{
+    if (context != EGL_NO_CONTEXT) {
+        am_log0("%s", "sorry, only one window is supported in headless mode");
+        return NULL;
+    }
+    if (!load_egl()) return NULL;
+    display = get_display();
+    if (display == EGL_NO_DISPLAY || !eglInitialize_ptr(display, NULL, NULL)) {
+        am_log0("unable to initialize EGL (error 0x%x)", eglGetError_ptr());
+        display = EGL_NO_DISPLAY;
+        return NULL;
+    }
+    if (!eglBindAPI_ptr(EGL_OPENGL_API)) {
+        am_log0("%s", "EGL implementation doesn't support OpenGL");
+        am_headless_destroy_window();
+        return NULL;
+    }
+    if (!choose_config(depth_buffer, stencil_buffer, msaa_samples)) {
+        am_log0("%s", "no suitable EGL config for headless mode");
+        am_headless_destroy_window();
+        return NULL;
+    }
+    if (width <= 0) width = 1;
+    if (height <= 0) height = 1;
+    if (!create_surface(width, height)) {
+        am_headless_destroy_window();
+        return NULL;
+    }
+    // A compatibility profile context, like the one SDL creates for windows.
+    EGLint ctx_attrs[] = {EGL_NONE};
+    context = eglCreateContext_ptr(display, config, EGL_NO_CONTEXT, ctx_attrs);
+    if (context == EGL_NO_CONTEXT) {
+        am_log0("unable to create EGL context (error 0x%x)", eglGetError_ptr());
+        am_headless_destroy_window();
+        return NULL;
+    }
+    am_headless_make_current();
+    return (am_native_window*)&headless_window_handle;
+}
+
+void am_headless_destroy_window() {
+    if (display != EGL_NO_DISPLAY) {
+        eglMakeCurrent_ptr(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT) eglDestroyContext_ptr(display, context);
+        if (surface != EGL_NO_SURFACE) eglDestroySurface_ptr(display, surface);
+        eglTerminate_ptr(display);
+    }
+    display = EGL_NO_DISPLAY;
+    context = EGL_NO_CONTEXT;
+    surface = EGL_NO_SURFACE;
+    config = NULL;
+}
+
+bool am_headless_window_exists() {
+    return context != EGL_NO_CONTEXT;
+}
+
+void am_headless_get_window_size(int *width, int *height) {
+    *width = window_width;
+    *height = window_height;
+}
+
+bool am_headless_resize_window(int width, int height) {
+    if (width <= 0) width = 1;
+    if (height <= 0) height = 1;
+    if (width == window_width && height == window_height) return true;
+    // pbuffers can't be resized, so replace it
+    EGLSurface old_surface = surface;
+    int old_width = window_width;
+    int old_height = window_height;
+    if (!create_surface(width, height)) {
+        surface = old_surface;
+        window_width = old_width;
+        window_height = old_height;
+        return false;
+    }
+    am_headless_make_current();
+    eglDestroySurface_ptr(display, old_surface);
+    return true;
+}
+
+void am_headless_make_current() {
+    eglMakeCurrent_ptr(display, surface, surface, context);
+}
+
+void *am_headless_get_proc_address(const char *name) {
+    if (eglGetProcAddress_ptr == NULL) return NULL;
+    return eglGetProcAddress_ptr(name);
+}
+
+bool am_headless_extension_supported(const char *name) {
+    typedef const unsigned char *(*get_string_func)(unsigned int);
+    get_string_func get_string = (get_string_func)am_headless_get_proc_address("glGetString");
+    if (get_string == NULL) return false;
+    return has_extension((const char*)get_string(AM_GL_EXTENSIONS), name);
+}
+
+#endif // AM_HEADLESS_SUPPORTED
+
+double am_headless_time_step() {
+    return am_conf_fixed_delta_time > 0.0 ? am_conf_fixed_delta_time : 1.0 / 60.0;
+}
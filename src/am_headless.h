@@ -0,0 +1,27 @@
+// Headless mode renders the window into an offscreen EGL pbuffer instead
+// of a real window, so scenes can be rendered on machines without a
+// display, such as build servers. It's enabled with the -headless command
+// line option or by setting headless = true in conf.lua.
+//
+// Only one window is supported and there is no input or audio. Each frame
+// advances the game by exactly one fixed time step (see
+// am_headless_time_step), however long the frame took to render, so
+// headless runs are repeatable.
+//
+// libEGL is loaded when the window is created, so amulet doesn't depend
+// on it unless headless mode is used.
+
+#if defined(AM_LINUX)
+#define AM_HEADLESS_SUPPORTED
+#endif
+
+am_native_window *am_headless_create_window(int width, int height,
+    bool depth_buffer, bool stencil_buffer, int msaa_samples);
+void am_headless_destroy_window();
+bool am_headless_window_exists();
+void am_headless_get_window_size(int *width, int *height);
+bool am_headless_resize_window(int width, int height);
+void am_headless_make_current();
+void *am_headless_get_proc_address(const char *name);
+bool am_headless_extension_supported(const char *name);
+double am_headless_time_step();
@@ -342,6 +342,43 @@ int luaL_typerror (lua_State *L, int narg, const char *tname) {
 
 #endif 
 
+// Fallbacks for values outside a table's array part (e.g. tables built
+// back to front, whose values end up in the hash part).
+
+static int read_table_numbers_slow(lua_State *L, int idx, int start, int count, lua_Number *out) {
+    int n = 0;
+    while (n < count) {
+        lua_rawgeti(L, idx, start + n);
+        if (lua_type(L, -1) != LUA_TNUMBER) {
+            lua_pop(L, 1);
+            break;
+        }
+        out[n++] = lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+    return n;
+}
+
+static int read_table_userdata_slow(lua_State *L, int idx, int start, int count, const void *mt, void **out) {
+    int n = 0;
+    while (n < count) {
+        lua_rawgeti(L, idx, start + n);
+        if (lua_type(L, -1) != LUA_TUSERDATA || !lua_getmetatable(L, -1)) {
+            lua_pop(L, 1);
+            break;
+        }
+        bool match = lua_topointer(L, -1) == mt;
+        lua_pop(L, 1);
+        if (!match) {
+            lua_pop(L, 1);
+            break;
+        }
+        out[n++] = lua_touserdata(L, -1);
+        lua_pop(L, 1);
+    }
+    return n;
+}
+
 #ifdef AM_LUAJIT
 
 #define AM_AVOID_MSVC_LJ_ERRORS 1
@@ -360,6 +397,33 @@ void lua_unsafe_pushuserdata(lua_State *L, void *v) {
     setudataV(L, L->top-1, ud);
 }
 
+int am_read_table_numbers(lua_State *L, int idx, int start, int count, lua_Number *out) {
+    GCtab *t = (GCtab*)lua_topointer(L, idx);
+    TValue *arr = tvref(t->array);
+    int n = 0;
+    // LuaJIT's array part starts at key 0
+    while (n < count && (uint32_t)(start + n) < t->asize) {
+        TValue *o = &arr[start + n];
+        if (!tvisnumber(o)) return n;
+        out[n++] = numberVnum(o);
+    }
+    return n + read_table_numbers_slow(L, idx, start + n, count - n, out + n);
+}
+
+int am_read_table_userdata(lua_State *L, int idx, int start, int count, const void *mt, void **out) {
+    GCtab *t = (GCtab*)lua_topointer(L, idx);
+    TValue *arr = tvref(t->array);
+    int n = 0;
+    while (n < count && (uint32_t)(start + n) < t->asize) {
+        TValue *o = &arr[start + n];
+        if (!tvisudata(o)) return n;
+        GCudata *ud = udataV(o);
+        if ((const void*)tabref(ud->metatable) != mt) return n;
+        out[n++] = uddata(ud);
+    }
+    return n + read_table_userdata_slow(L, idx, start + n, count - n, mt, out + n);
+}
+
 #else
 // standard lua
 
@@ -383,4 +447,37 @@ void lua_unsafe_pushuserdata(lua_State *L, void *v) {
     lua_unlock(L);
 }
 
+#ifdef AM_LUA53
+#define udata_metatable(o) (uvalue(o)->metatable)
+#define udata_payload(o) ((void*)getudatamem(uvalue(o)))
+#define is_full_userdata(o) ttisfulluserdata(o)
+#else
+#define udata_metatable(o) (rawuvalue(o)->uv.metatable)
+#define udata_payload(o) ((void*)(rawuvalue(o)+1))
+#define is_full_userdata(o) ttisuserdata(o)
+#endif
+
+int am_read_table_numbers(lua_State *L, int idx, int start, int count, lua_Number *out) {
+    Table *t = (Table*)lua_topointer(L, idx);
+    int n = 0;
+    while (n < count && start + n <= (int)t->sizearray) {
+        TValue *o = &t->array[start + n - 1];
+        if (!ttisnumber(o)) return n;
+        out[n++] = nvalue(o);
+    }
+    return n + read_table_numbers_slow(L, idx, start + n, count - n, out + n);
+}
+
+int am_read_table_userdata(lua_State *L, int idx, int start, int count, const void *mt, void **out) {
+    Table *t = (Table*)lua_topointer(L, idx);
+    int n = 0;
+    while (n < count && start + n <= (int)t->sizearray) {
+        TValue *o = &t->array[start + n - 1];
+        if (!is_full_userdata(o)) return n;
+        if ((const void*)udata_metatable(o) != mt) return n;
+        out[n++] = udata_payload(o);
+    }
+    return n + read_table_userdata_slow(L, idx, start + n, count - n, mt, out + n);
+}
+
 #endif
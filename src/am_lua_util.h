@@ -26,6 +26,16 @@ bool am_run_script(lua_State *L, const char *script, int len, const char *name);
 // with lua_newuserdata.
 void lua_unsafe_pushuserdata(lua_State *L, void *v);
 
+// Bulk reads from the table at idx, for copying large tables into
+// buffers. Both read t[start], t[start+1], ... into out until count values
+// have been read or a value of the wrong kind is reached, and return the
+// number of values read. Values in the table's array part are read
+// directly, which is much faster than calling lua_rawgeti for each one.
+// am_read_table_userdata only accepts userdata whose metatable is mt
+// (as returned by lua_topointer) and stores pointers to their data.
+int am_read_table_numbers(lua_State *L, int idx, int start, int count, lua_Number *out);
+int am_read_table_userdata(lua_State *L, int idx, int start, int count, const void *mt, void **out);
+
 int am_require(lua_State *L);
 
 void am_setfenv(lua_State *L, int index);
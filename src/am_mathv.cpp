@@ -2,6 +2,324 @@
 
 #include "amulet.h"
 #include "am_mathv_helper.inc"
+#include "am_mathv_expr.inc"
+
+static void add_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.add((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.add, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void add_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = ADD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = ADD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = ADD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = ADD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = ADD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = ADD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = ADD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
 
 static int add_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
@@ -32,33 +350,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = ADD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -67,33 +360,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = ADD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -102,33 +370,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = ADD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -137,33 +380,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = ADD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -172,33 +390,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = ADD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -207,33 +400,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = ADD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -242,33 +410,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = ADD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -277,33 +420,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = ADD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(add_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.add");
@@ -321,6 +439,323 @@ static int am_mathv_add_into(lua_State *L) {
     return add_impl(L, view);
 }
 
+static void sub_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.sub((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.sub, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void sub_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = SUB_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = SUB_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = SUB_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = SUB_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = SUB_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = SUB_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = SUB_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int sub_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.sub");        uint8_t arg_singleton_scratch[2][16*8];
@@ -350,33 +785,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = SUB_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -385,33 +795,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = SUB_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -420,33 +805,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = SUB_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -455,33 +815,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = SUB_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -490,33 +825,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = SUB_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -525,33 +835,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = SUB_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -560,33 +845,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = SUB_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -595,33 +855,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = SUB_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(sub_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sub");
@@ -639,25 +874,342 @@ static int am_mathv_sub_into(lua_State *L) {
     return sub_impl(L, view);
 }
 
-static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
-    int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
-    if (nargs > 2) return luaL_error(L, "too many arguments for mathv.vec_mul");        uint8_t arg_singleton_scratch[2][16*8];
-    uint8_t *arg_singleton_bufs[2];
-    for (unsigned int i = 0; i < 2; i++) {
-        arg_singleton_bufs[i] = &arg_singleton_scratch[i][0];
-    }
+static void vec_mul_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
     uint8_t *arg_data[2];
     unsigned int arg_stride[2];
-    unsigned int arg_count[2];
-    int arg_type[2];
-    am_buffer_view_type arg_view_type[2];
     unsigned int arg_components[2];
-    am_buffer_view_type output_view_type;
-    unsigned int output_count;
-    unsigned int output_components;
-    unsigned int output_stride;
-    uint8_t *output_data;
-    bool args_are_dense;
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.mul((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.mul, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void vec_mul_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = MUL_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = MUL_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = MUL_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = MUL_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = MUL_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = MUL_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = MUL_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
+    int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
+    if (nargs > 2) return luaL_error(L, "too many arguments for mathv.vec_mul");        uint8_t arg_singleton_scratch[2][16*8];
+    uint8_t *arg_singleton_bufs[2];
+    for (unsigned int i = 0; i < 2; i++) {
+        arg_singleton_bufs[i] = &arg_singleton_scratch[i][0];
+    }
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_count[2];
+    int arg_type[2];
+    am_buffer_view_type arg_view_type[2];
+    unsigned int arg_components[2];
+    am_buffer_view_type output_view_type;
+    unsigned int output_count;
+    unsigned int output_components;
+    unsigned int output_stride;
+    uint8_t *output_data;
+    bool args_are_dense;
     bool output_is_dense;
     component_wise_setup(L, "mathv.vec_mul", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
@@ -668,33 +1220,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = MUL_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -703,33 +1230,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = MUL_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -738,33 +1240,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = MUL_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -773,33 +1250,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = MUL_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -808,33 +1260,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = MUL_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -843,33 +1270,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = MUL_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -878,33 +1280,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = MUL_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -913,33 +1290,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = MUL_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(vec_mul_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.vec_mul");
@@ -957,6 +1309,323 @@ static int am_mathv_vec_mul_into(lua_State *L) {
     return vec_mul_impl(L, view);
 }
 
+static void div_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.div((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.div, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void div_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = DIV_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = DIV_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = DIV_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = DIV_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = DIV_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = DIV_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = DIV_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int div_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.div");        uint8_t arg_singleton_scratch[2][16*8];
@@ -986,33 +1655,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = DIV_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1021,33 +1665,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = DIV_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1056,33 +1675,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = DIV_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1091,33 +1685,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = DIV_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1126,33 +1695,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = DIV_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1161,33 +1705,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = DIV_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1196,33 +1715,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = DIV_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1231,33 +1725,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = DIV_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(div_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.div");
@@ -1275,6 +1744,342 @@ static int am_mathv_div_into(lua_State *L) {
     return div_impl(L, view);
 }
 
+static void mod_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = F32MOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = F32MOD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = F64MOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = F64MOD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = IMOD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = IMOD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = IMOD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = IMOD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = IMOD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = IMOD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int mod_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.mod");        uint8_t arg_singleton_scratch[2][16*8];
@@ -1304,33 +2109,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = F32MOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = F32MOD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1339,33 +2119,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = F64MOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = F64MOD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1374,33 +2129,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = IMOD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1409,33 +2139,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = IMOD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1444,33 +2149,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = IMOD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1479,33 +2159,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = IMOD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1514,33 +2169,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = IMOD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1549,33 +2179,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = IMOD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(mod_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mod");
@@ -1593,6 +2198,90 @@ static int am_mathv_mod_into(lua_State *L) {
     return mod_impl(L, view);
 }
 
+static void pow_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = powf(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = powf(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void pow_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = pow(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = pow(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int pow_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.pow");        uint8_t arg_singleton_scratch[2][16*8];
@@ -1622,33 +2311,8 @@ static int pow_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.pow", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = powf(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = powf(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(pow_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1657,33 +2321,8 @@ static int pow_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.pow", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = pow(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = pow(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(pow_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.pow");
@@ -1701,6 +2340,302 @@ static int am_mathv_pow_into(lua_State *L) {
     return pow_impl(L, view);
 }
 
+static void unm_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = UNM_OP(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = UNM_OP(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = UNM_OP(((int8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = UNM_OP(((uint8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = UNM_OP(((int16_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = UNM_OP(((uint16_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = UNM_OP(((int32_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = UNM_OP(((uint32_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int unm_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     nargs = am_min(nargs, 1);        uint8_t arg_singleton_scratch[1][16*8];
@@ -1729,28 +2664,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = UNM_OP(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -1758,28 +2673,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = UNM_OP(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view)) {
@@ -1787,28 +2682,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = UNM_OP(((int8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view)) {
@@ -1816,28 +2691,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = UNM_OP(((uint8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view)) {
@@ -1845,28 +2700,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = UNM_OP(((int16_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view)) {
@@ -1874,28 +2709,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = UNM_OP(((uint16_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view)) {
@@ -1903,28 +2718,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = UNM_OP(((int32_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view)) {
@@ -1932,28 +2727,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = UNM_OP(((uint32_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(unm_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.unm");
@@ -1971,6 +2746,65 @@ static int am_mathv_unm_into(lua_State *L) {
     return unm_impl(L, view);
 }
 
+static void abs_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.abs((float*)output_data, (float*)arg_data[0], output_count * output_components);
+    } else {
+        am_mathv_f32_strided1(am_mathv_f32.abs, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0]);
+    }
+}
+
+static void abs_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = fabs(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = fabs(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int abs_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.abs");        uint8_t arg_singleton_scratch[1][16*8];
@@ -1999,28 +2833,8 @@ static int abs_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.abs", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = fabsf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = fabsf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(abs_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2028,28 +2842,8 @@ static int abs_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.abs", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = fabs(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = fabs(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(abs_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.abs");
@@ -2067,6 +2861,80 @@ static int am_mathv_abs_into(lua_State *L) {
     return abs_impl(L, view);
 }
 
+static void acos_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = acosf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = acosf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void acos_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = acos(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = acos(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int acos_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.acos");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2095,28 +2963,8 @@ static int acos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.acos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = acosf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = acosf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(acos_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2124,28 +2972,8 @@ static int acos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.acos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = acos(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = acos(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(acos_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.acos");
@@ -2163,6 +2991,80 @@ static int am_mathv_acos_into(lua_State *L) {
     return acos_impl(L, view);
 }
 
+static void asin_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = asinf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = asinf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void asin_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = asin(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = asin(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int asin_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.asin");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2191,57 +3093,17 @@ static int asin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.asin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = asinf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = asinf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(asin_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
-        arg_view_type[0] = AM_VIEW_TYPE_F64;
-        setup_non_view_args(L, "mathv.asin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
-        output_view_type = AM_VIEW_TYPE_F64;
-        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = asin(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = asin(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        arg_view_type[0] = AM_VIEW_TYPE_F64;
+        setup_non_view_args(L, "mathv.asin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
+        output_view_type = AM_VIEW_TYPE_F64;
+        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
+        run_component_wise_loop(asin_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.asin");
@@ -2259,6 +3121,80 @@ static int am_mathv_asin_into(lua_State *L) {
     return asin_impl(L, view);
 }
 
+static void atan_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atanf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = atanf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void atan_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = atan(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int atan_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.atan");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2287,28 +3223,8 @@ static int atan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atanf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = atanf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(atan_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2316,28 +3232,8 @@ static int atan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = atan(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(atan_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.atan");
@@ -2355,6 +3251,90 @@ static int am_mathv_atan_into(lua_State *L) {
     return atan_impl(L, view);
 }
 
+static void atan2_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan2f(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = atan2f(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void atan2_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan2(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = atan2(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int atan2_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.atan2");        uint8_t arg_singleton_scratch[2][16*8];
@@ -2384,33 +3364,8 @@ static int atan2_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan2", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan2f(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = atan2f(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(atan2_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -2419,33 +3374,8 @@ static int atan2_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan2", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan2(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = atan2(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(atan2_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.atan2");
@@ -2463,6 +3393,65 @@ static int am_mathv_atan2_into(lua_State *L) {
     return atan2_impl(L, view);
 }
 
+static void ceil_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.ceil((float*)output_data, (float*)arg_data[0], output_count * output_components);
+    } else {
+        am_mathv_f32_strided1(am_mathv_f32.ceil, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0]);
+    }
+}
+
+static void ceil_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ceil(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = ceil(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int ceil_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.ceil");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2491,28 +3480,8 @@ static int ceil_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.ceil", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ceilf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = ceilf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(ceil_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2520,28 +3489,8 @@ static int ceil_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.ceil", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ceil(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = ceil(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(ceil_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.ceil");
@@ -2559,6 +3508,100 @@ static int am_mathv_ceil_into(lua_State *L) {
     return ceil_impl(L, view);
 }
 
+static void clamp_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[3];
+    unsigned int arg_stride[3];
+    unsigned int arg_components[3];
+    for (unsigned int a = 0; a < 3; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        float *arg3_arr = (float*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_clamp(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
+static void clamp_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[3];
+    unsigned int arg_stride[3];
+    unsigned int arg_components[3];
+    for (unsigned int a = 0; a < 3; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        double *arg3_arr = (double*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_clamp(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
 static int clamp_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 3) return luaL_error(L, "too many arguments for mathv.clamp");        uint8_t arg_singleton_scratch[3][16*8];
@@ -2589,38 +3632,8 @@ static int clamp_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.clamp", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            float *arg3_arr = (float*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_clamp(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_component_wise_loop(clamp_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 3  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -2630,38 +3643,8 @@ static int clamp_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.clamp", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            double *arg3_arr = (double*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_clamp(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_component_wise_loop(clamp_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.clamp");
@@ -2679,6 +3662,65 @@ static int am_mathv_clamp_into(lua_State *L) {
     return clamp_impl(L, view);
 }
 
+static void cos_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.cos((float*)output_data, (float*)arg_data[0], output_count * output_components);
+    } else {
+        am_mathv_f32_strided1(am_mathv_f32.cos, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0]);
+    }
+}
+
+static void cos_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = cos(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = cos(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int cos_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.cos");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2707,28 +3749,8 @@ static int cos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.cos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = cosf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = cosf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(cos_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2736,28 +3758,8 @@ static int cos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.cos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = cos(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = cos(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(cos_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.cos");
@@ -2775,6 +3777,65 @@ static int am_mathv_cos_into(lua_State *L) {
     return cos_impl(L, view);
 }
 
+static void floor_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.floor((float*)output_data, (float*)arg_data[0], output_count * output_components);
+    } else {
+        am_mathv_f32_strided1(am_mathv_f32.floor, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0]);
+    }
+}
+
+static void floor_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = floor(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = floor(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int floor_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.floor");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2803,28 +3864,8 @@ static int floor_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.floor", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = floorf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = floorf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(floor_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2832,28 +3873,8 @@ static int floor_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.floor", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = floor(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = floor(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(floor_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.floor");
@@ -2871,6 +3892,80 @@ static int am_mathv_floor_into(lua_State *L) {
     return floor_impl(L, view);
 }
 
+static void fract_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::fract(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = glm::fract(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void fract_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::fract(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = glm::fract(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int fract_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.fract");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2899,28 +3994,8 @@ static int fract_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.fract", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::fract(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = glm::fract(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(fract_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2928,28 +4003,8 @@ static int fract_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.fract", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::fract(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = glm::fract(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(fract_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.fract");
@@ -2967,6 +4022,80 @@ static int am_mathv_fract_into(lua_State *L) {
     return fract_impl(L, view);
 }
 
+static void log_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = logf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = logf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void log_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = log(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = log(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int log_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.log");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2995,28 +4124,8 @@ static int log_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.log", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = logf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = logf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(log_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3024,28 +4133,8 @@ static int log_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.log", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = log(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = log(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(log_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.log");
@@ -3063,6 +4152,71 @@ static int am_mathv_log_into(lua_State *L) {
     return log_impl(L, view);
 }
 
+static void max_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.max((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.max, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void max_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_max(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int max_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.max");        uint8_t arg_singleton_scratch[2][16*8];
@@ -3092,33 +4246,8 @@ static int max_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.max", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_max(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(max_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3127,33 +4256,8 @@ static int max_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.max", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_max(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(max_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.max");
@@ -3171,6 +4275,71 @@ static int am_mathv_max_into(lua_State *L) {
     return max_impl(L, view);
 }
 
+static void min_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.min((float*)output_data, (float*)arg_data[0], (float*)arg_data[1], output_count * output_components);
+    } else {
+        am_mathv_f32_strided2(am_mathv_f32.min, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0],
+            arg_data[1], arg_stride[1], arg_components[1]);
+    }
+}
+
+static void min_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_min(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int min_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.min");        uint8_t arg_singleton_scratch[2][16*8];
@@ -3200,33 +4369,8 @@ static int min_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.min", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_min(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(min_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3235,33 +4379,8 @@ static int min_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.min", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_min(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(min_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.min");
@@ -3279,6 +4398,100 @@ static int am_mathv_min_into(lua_State *L) {
     return min_impl(L, view);
 }
 
+static void mix_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[3];
+    unsigned int arg_stride[3];
+    unsigned int arg_components[3];
+    for (unsigned int a = 0; a < 3; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        float *arg3_arr = (float*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = glm::mix(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
+static void mix_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[3];
+    unsigned int arg_stride[3];
+    unsigned int arg_components[3];
+    for (unsigned int a = 0; a < 3; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        double *arg3_arr = (double*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = glm::mix(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
 static int mix_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 3) return luaL_error(L, "too many arguments for mathv.mix");        uint8_t arg_singleton_scratch[3][16*8];
@@ -3309,38 +4522,8 @@ static int mix_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mix", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            float *arg3_arr = (float*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = glm::mix(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_component_wise_loop(mix_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 3  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -3350,38 +4533,8 @@ static int mix_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mix", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            double *arg3_arr = (double*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = glm::mix(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_component_wise_loop(mix_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mix");
@@ -3399,6 +4552,80 @@ static int am_mathv_mix_into(lua_State *L) {
     return mix_impl(L, view);
 }
 
+static void sign_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_sign(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_sign(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void sign_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_sign(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_sign(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int sign_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.sign");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3427,28 +4654,8 @@ static int sign_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sign", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_sign(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_sign(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(sign_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3456,28 +4663,8 @@ static int sign_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sign", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_sign(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_sign(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(sign_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sign");
@@ -3495,6 +4682,65 @@ static int am_mathv_sign_into(lua_State *L) {
     return sign_impl(L, view);
 }
 
+static void sin_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        am_mathv_f32.sin((float*)output_data, (float*)arg_data[0], output_count * output_components);
+    } else {
+        am_mathv_f32_strided1(am_mathv_f32.sin, output_count, output_components,
+            output_data, output_stride,
+            arg_data[0], arg_stride[0], arg_components[0]);
+    }
+}
+
+static void sin_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = sin(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = sin(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int sin_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.sin");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3523,28 +4769,8 @@ static int sin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = sinf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = sinf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(sin_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3552,28 +4778,8 @@ static int sin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = sin(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = sin(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(sin_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sin");
@@ -3591,6 +4797,80 @@ static int am_mathv_sin_into(lua_State *L) {
     return sin_impl(L, view);
 }
 
+static void tan_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = tanf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = tanf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void tan_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = tan(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = tan(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int tan_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.tan");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3619,28 +4899,8 @@ static int tan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.tan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = tanf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = tanf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(tan_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3648,43 +4908,359 @@ static int tan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.tan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
+        run_component_wise_loop(tan_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
+        return 1;
+    }
+    return luaL_error(L, "invalid argument types for function mathv.tan");
+}
+
+static int am_mathv_tan(lua_State *L) {
+    return tan_impl(L, NULL);
+}
+
+static int am_mathv_tan_into(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushvalue(L, 1); // return view
+    lua_remove(L, 1);
+    return tan_impl(L, view);
+}
+
+static void lt_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = tan(arg1_arr[i]);
+        }
+    }
+}
+
+static void lt_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
             }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = tan(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
         }
-        return 1;
     }
-    return luaL_error(L, "invalid argument types for function mathv.tan");
-}
-
-static int am_mathv_tan(lua_State *L) {
-    return tan_impl(L, NULL);
-}
-
-static int am_mathv_tan_into(lua_State *L) {
-    am_check_nargs(L, 1);
-    am_buffer_view *view = am_check_buffer_view(L, 1);
-    lua_pushvalue(L, 1); // return view
-    lua_remove(L, 1);
-    return tan_impl(L, view);
 }
 
 static int lt_impl(lua_State *L, am_buffer_view *target) {
@@ -3716,33 +5292,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3751,33 +5302,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -3786,33 +5312,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -3821,33 +5322,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -3856,33 +5332,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -3891,33 +5342,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -3926,33 +5352,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -3961,33 +5362,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lt_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.lt");
@@ -4005,6 +5381,342 @@ static int am_mathv_lt_into(lua_State *L) {
     return lt_impl(L, view);
 }
 
+static void lte_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int lte_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.lte");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4034,33 +5746,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -4069,33 +5756,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4104,33 +5766,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4139,33 +5776,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4174,33 +5786,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4209,33 +5796,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(lte_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4244,83 +5806,369 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        run_component_wise_loop(lte_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
+        return 1;
+    }
+    if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
+        arg_view_type[0] = AM_VIEW_TYPE_I32;
+        arg_view_type[1] = AM_VIEW_TYPE_I32;
+        setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
+        output_view_type = AM_VIEW_TYPE_U8;
+        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
+        run_component_wise_loop(lte_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
+        return 1;
+    }
+    return luaL_error(L, "invalid argument types for function mathv.lte");
+}
+
+static int am_mathv_lte(lua_State *L) {
+    return lte_impl(L, NULL);
+}
+
+static int am_mathv_lte_into(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushvalue(L, 1); // return view
+    lua_remove(L, 1);
+    return lte_impl(L, view);
+}
+
+static void gt_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    }
+}
+
+static void gt_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
             }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
         }
-        return 1;
     }
-    if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
-        arg_view_type[0] = AM_VIEW_TYPE_I32;
-        arg_view_type[1] = AM_VIEW_TYPE_I32;
-        setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
-        output_view_type = AM_VIEW_TYPE_U8;
-        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+}
+
+static void gt_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
             }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
         }
-        return 1;
     }
-    return luaL_error(L, "invalid argument types for function mathv.lte");
-}
-
-static int am_mathv_lte(lua_State *L) {
-    return lte_impl(L, NULL);
 }
 
-static int am_mathv_lte_into(lua_State *L) {
-    am_check_nargs(L, 1);
-    am_buffer_view *view = am_check_buffer_view(L, 1);
-    lua_pushvalue(L, 1); // return view
-    lua_remove(L, 1);
-    return lte_impl(L, view);
+static void gt_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
 }
 
 static int gt_impl(lua_State *L, am_buffer_view *target) {
@@ -4352,33 +6200,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -4387,33 +6210,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4422,33 +6220,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4457,33 +6230,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4492,33 +6240,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4527,33 +6250,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4562,33 +6260,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4597,33 +6270,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gt_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.gt");
@@ -4641,6 +6289,342 @@ static int am_mathv_gt_into(lua_State *L) {
     return gt_impl(L, view);
 }
 
+static void gte_loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_2(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_3(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_4(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_5(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_6(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_7(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop_8(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int gte_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.gte");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4670,33 +6654,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -4705,33 +6664,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_2, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4740,33 +6674,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_3, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4775,33 +6684,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_4, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4810,33 +6694,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_5, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4845,33 +6704,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_6, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4880,33 +6714,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_7, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4915,33 +6724,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(gte_loop_8, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.gte");
@@ -4959,6 +6743,48 @@ static int am_mathv_gte_into(lua_State *L) {
     return gte_impl(L, view);
 }
 
+static void and__loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = AND_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = AND_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int and__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.and_");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4988,33 +6814,8 @@ static int and__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.and_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = AND_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = AND_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(and__loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.and_");
@@ -5032,6 +6833,48 @@ static int am_mathv_and__into(lua_State *L) {
     return and__impl(L, view);
 }
 
+static void or__loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[2];
+    unsigned int arg_stride[2];
+    unsigned int arg_components[2];
+    for (unsigned int a = 0; a < 2; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = OR_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = OR_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int or__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.or_");        uint8_t arg_singleton_scratch[2][16*8];
@@ -5061,33 +6904,8 @@ static int or__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.or_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = OR_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = OR_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_component_wise_loop(or__loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.or_");
@@ -5105,6 +6923,43 @@ static int am_mathv_or__into(lua_State *L) {
     return or__impl(L, view);
 }
 
+static void not__loop_1(component_wise_loop *loop, unsigned int start, unsigned int end) {
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[1];
+    unsigned int arg_stride[1];
+    unsigned int arg_components[1];
+    for (unsigned int a = 0; a < 1; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+    if (loop->dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = NOT_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = NOT_OP(((uint8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int not__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.not_");        uint8_t arg_singleton_scratch[1][16*8];
@@ -5133,28 +6988,8 @@ static int not__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.not_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = NOT_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = NOT_OP(((uint8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_component_wise_loop(not__loop_1, nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,
+            output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.not_");
@@ -8004,6 +9839,8 @@ void am_register_mathv_view_methods(lua_State *L) {
 }
 
 void am_open_mathv_module(lua_State *L) {
+    am_init_mathv_kernels();
+    init_mathv_threads();
     luaL_Reg vfuncs[] = {
         {"range",    am_mathv_range},
         {"random",   am_mathv_random},
@@ -8012,6 +9849,9 @@ void am_open_mathv_module(lua_State *L) {
         {"sum",      am_mathv_sum},
         {"greatest", am_mathv_greatest},
         {"least",    am_mathv_least},
+        {"simd",     am_mathv_simd},
+        {"threads",  am_mathv_threads},
+        {"_compile_expr", am_mathv_compile_expr},
         {"add", am_mathv_add},
         {"sub", am_mathv_sub},
         {"vec_mul", am_mathv_vec_mul},
@@ -8062,4 +9902,5 @@ void am_open_mathv_module(lua_State *L) {
         {NULL, NULL}
     };
     am_open_module(L, "mathv", vfuncs);
+    register_mathv_expr_mt(L);
 }
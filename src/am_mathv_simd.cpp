@@ -0,0 +1,373 @@
+#include "amulet.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AM_MATHV_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AM_MATHV_AVX2
+#include <immintrin.h>
+#elif defined(_MSC_VER)
+#define AM_MATHV_AVX2
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__)
+#define AM_MATHV_NEON
+#include <arm_neon.h>
+#endif
+
+// The build uses -ffast-math, which allows the compiler to reassociate
+// vector arithmetic. AM_MATHV_KEEP hides a value from the optimizer
+// where the order of operations matters.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(AM_MATHV_SSE2)
+#define AM_MATHV_KEEP(v) __asm__("" : "+x"(v))
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(AM_MATHV_NEON)
+#define AM_MATHV_KEEP(v) __asm__("" : "+w"(v))
+#else
+#define AM_MATHV_KEEP(v)
+#endif
+
+#define SIMD_STR(x) SIMD_STR_(x)
+#define SIMD_STR_(x) #x
+
+// Scalar kernels. These have the same semantics as the
+// generic loops generated for the other view types.
+
+#define SCALAR_OP2(name, expr)                                                          \
+static void mathv_f32_##name##_scalar(float *out, const float *x, const float *y, unsigned int n) { \
+    for (unsigned int i = 0; i < n; ++i) {                                              \
+        float a = x[i];                                                                 \
+        float b = y[i];                                                                 \
+        out[i] = expr;                                                                  \
+    }                                                                                   \
+}
+
+#define SCALAR_OP1(name, expr)                                                          \
+static void mathv_f32_##name##_scalar(float *out, const float *x, unsigned int n) {     \
+    for (unsigned int i = 0; i < n; ++i) {                                              \
+        float a = x[i];                                                                 \
+        out[i] = expr;                                                                  \
+    }                                                                                   \
+}
+
+SCALAR_OP2(add, a + b)
+SCALAR_OP2(sub, a - b)
+SCALAR_OP2(mul, a * b)
+SCALAR_OP2(div, a / b)
+SCALAR_OP2(min, am_min(a, b))
+SCALAR_OP2(max, am_max(a, b))
+SCALAR_OP1(abs, fabsf(a))
+SCALAR_OP1(floor, floorf(a))
+SCALAR_OP1(ceil, ceilf(a))
+SCALAR_OP1(sin, sinf(a))
+SCALAR_OP1(cos, cosf(a))
+
+static float mathv_f32_fir_scalar(const float *x, const float *a, const float *b, float t, unsigned int n) {
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < n; ++i) {
+        sum += x[i] * (a[i] + t * (b[i] - a[i]));
+    }
+    return sum;
+}
+
+static am_mathv_f32_kernels mathv_f32_kernels_scalar = {
+    "scalar",
+    mathv_f32_add_scalar,
+    mathv_f32_sub_scalar,
+    mathv_f32_mul_scalar,
+    mathv_f32_div_scalar,
+    mathv_f32_min_scalar,
+    mathv_f32_max_scalar,
+    mathv_f32_abs_scalar,
+    mathv_f32_floor_scalar,
+    mathv_f32_ceil_scalar,
+    mathv_f32_sin_scalar,
+    mathv_f32_cos_scalar,
+    mathv_f32_fir_scalar,
+};
+
+#if defined(AM_MATHV_SSE2)
+
+struct simd_sse2 {
+    typedef __m128 vf;
+    static const int width = 4;
+    static inline vf load(const float *p) { return _mm_loadu_ps(p); }
+    static inline void store(float *p, vf a) { _mm_storeu_ps(p, a); }
+    static inline vf set1(float x) { return _mm_set1_ps(x); }
+    static inline vf add(vf a, vf b) { return _mm_add_ps(a, b); }
+    static inline vf sub(vf a, vf b) { return _mm_sub_ps(a, b); }
+    static inline vf mul(vf a, vf b) { return _mm_mul_ps(a, b); }
+    static inline vf div(vf a, vf b) {
+#if defined(__GNUC__) && !defined(__clang__)
+        // with -ffast-math gcc replaces _mm_div_ps with an approximate
+        // reciprocal, so 2/2 is no longer 1
+        __asm__("divps %1, %0" : "+x"(a) : "x"(b));
+        return a;
+#else
+        return _mm_div_ps(a, b);
+#endif
+    }
+    // a < b ? a : b, like am_min
+    static inline vf min(vf a, vf b) { return _mm_min_ps(a, b); }
+    static inline vf max(vf a, vf b) { return _mm_max_ps(a, b); }
+    static inline vf abs(vf a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static inline vf neg(vf a) { return _mm_xor_ps(_mm_set1_ps(-0.0f), a); }
+    static inline vf cmpeq(vf a, vf b) { return _mm_cmpeq_ps(a, b); }
+    static inline vf cmpge(vf a, vf b) { return _mm_cmpge_ps(a, b); }
+    static inline vf cmplt(vf a, vf b) { return _mm_cmplt_ps(a, b); }
+    static inline vf cmple(vf a, vf b) { return _mm_cmple_ps(a, b); }
+    static inline vf select(vf mask, vf a, vf b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    static inline bool all(vf mask) { return _mm_movemask_ps(mask) == 0xF; }
+    static inline float hsum(vf a) {
+        a = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        a = _mm_add_ss(a, _mm_shuffle_ps(a, a, 1));
+        return _mm_cvtss_f32(a);
+    }
+    static inline vf keep(vf a) { AM_MATHV_KEEP(a); return a; }
+    // SSE2 has no rounding instructions, so truncate and correct.
+    // Values with magnitude 2^23 or more (and nans) are already integral
+    // and the sign of x is kept so that -0.5 becomes -0.0 as with libm.
+    static inline vf trunc_or_x(vf a, vf t) {
+        vf big = _mm_cmpnlt_ps(abs(a), _mm_set1_ps(8388608.0f));
+        t = select(big, a, t);
+        return _mm_or_ps(t, _mm_and_ps(a, _mm_set1_ps(-0.0f)));
+    }
+    static inline vf floor(vf a) {
+        vf t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        t = _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+        return trunc_or_x(a, t);
+    }
+    static inline vf ceil(vf a) {
+        vf t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        t = _mm_add_ps(t, _mm_and_ps(_mm_cmplt_ps(t, a), _mm_set1_ps(1.0f)));
+        return trunc_or_x(a, t);
+    }
+};
+
+#define SIMD simd_sse2
+#define SIMD_NAME sse2
+#define SIMD_ATTR
+#include "am_mathv_simd_kernels.inc"
+#undef SIMD
+#undef SIMD_NAME
+#undef SIMD_ATTR
+
+#endif
+
+#if defined(AM_MATHV_AVX2)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AM_AVX2_ATTR
+#else
+#define AM_AVX2_ATTR __attribute__((target("avx2")))
+#endif
+
+struct simd_avx2 {
+    typedef __m256 vf;
+    static const int width = 8;
+    AM_AVX2_ATTR static inline vf load(const float *p) { return _mm256_loadu_ps(p); }
+    AM_AVX2_ATTR static inline void store(float *p, vf a) { _mm256_storeu_ps(p, a); }
+    AM_AVX2_ATTR static inline vf set1(float x) { return _mm256_set1_ps(x); }
+    AM_AVX2_ATTR static inline vf add(vf a, vf b) { return _mm256_add_ps(a, b); }
+    AM_AVX2_ATTR static inline vf sub(vf a, vf b) { return _mm256_sub_ps(a, b); }
+    AM_AVX2_ATTR static inline vf mul(vf a, vf b) { return _mm256_mul_ps(a, b); }
+    AM_AVX2_ATTR static inline vf div(vf a, vf b) {
+#if defined(__GNUC__) && !defined(__clang__)
+        // see simd_sse2::div
+        vf r;
+        __asm__("vdivps %2, %1, %0" : "=x"(r) : "x"(a), "x"(b));
+        return r;
+#else
+        return _mm256_div_ps(a, b);
+#endif
+    }
+    AM_AVX2_ATTR static inline vf min(vf a, vf b) { return _mm256_min_ps(a, b); }
+    AM_AVX2_ATTR static inline vf max(vf a, vf b) { return _mm256_max_ps(a, b); }
+    AM_AVX2_ATTR static inline vf abs(vf a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    AM_AVX2_ATTR static inline vf neg(vf a) { return _mm256_xor_ps(_mm256_set1_ps(-0.0f), a); }
+    AM_AVX2_ATTR static inline vf cmpeq(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    AM_AVX2_ATTR static inline vf cmpge(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    AM_AVX2_ATTR static inline vf cmplt(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    AM_AVX2_ATTR static inline vf cmple(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    AM_AVX2_ATTR static inline vf select(vf mask, vf a, vf b) { return _mm256_blendv_ps(b, a, mask); }
+    AM_AVX2_ATTR static inline bool all(vf mask) { return _mm256_movemask_ps(mask) == 0xFF; }
+    AM_AVX2_ATTR static inline float hsum(vf a) {
+        __m128 h = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+        h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+        h = _mm_add_ss(h, _mm_shuffle_ps(h, h, 1));
+        return _mm_cvtss_f32(h);
+    }
+    AM_AVX2_ATTR static inline vf keep(vf a) { AM_MATHV_KEEP(a); return a; }
+    AM_AVX2_ATTR static inline vf floor(vf a) { return _mm256_floor_ps(a); }
+    AM_AVX2_ATTR static inline vf ceil(vf a) { return _mm256_ceil_ps(a); }
+};
+
+#define SIMD simd_avx2
+#define SIMD_NAME avx2
+#define SIMD_ATTR AM_AVX2_ATTR
+#include "am_mathv_simd_kernels.inc"
+#undef SIMD
+#undef SIMD_NAME
+#undef SIMD_ATTR
+
+static bool cpu_has_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) return false;
+    __cpuid(regs, 1);
+    // the os must save the ymm registers
+    bool osxsave = (regs[2] & (1 << 27)) != 0;
+    bool avx = (regs[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+#if defined(AM_MATHV_NEON)
+
+struct simd_neon {
+    typedef float32x4_t vf;
+    static const int width = 4;
+    static inline vf load(const float *p) { return vld1q_f32(p); }
+    static inline void store(float *p, vf a) { vst1q_f32(p, a); }
+    static inline vf set1(float x) { return vdupq_n_f32(x); }
+    static inline vf add(vf a, vf b) { return vaddq_f32(a, b); }
+    static inline vf sub(vf a, vf b) { return vsubq_f32(a, b); }
+    static inline vf mul(vf a, vf b) { return vmulq_f32(a, b); }
+    static inline vf div(vf a, vf b) { return vdivq_f32(a, b); }
+    // vminq_f32/vmaxq_f32 propagate nans, which am_min/am_max don't
+    static inline vf min(vf a, vf b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+    static inline vf max(vf a, vf b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+    static inline vf abs(vf a) { return vabsq_f32(a); }
+    static inline vf neg(vf a) { return vnegq_f32(a); }
+    static inline vf cmpeq(vf a, vf b) { return vreinterpretq_f32_u32(vceqq_f32(a, b)); }
+    static inline vf cmpge(vf a, vf b) { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+    static inline vf cmplt(vf a, vf b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+    static inline vf cmple(vf a, vf b) { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+    static inline vf select(vf mask, vf a, vf b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+    static inline bool all(vf mask) { return vminvq_u32(vreinterpretq_u32_f32(mask)) != 0; }
+    static inline float hsum(vf a) { return vaddvq_f32(a); }
+    static inline vf keep(vf a) { AM_MATHV_KEEP(a); return a; }
+    static inline vf floor(vf a) { return vrndmq_f32(a); }
+    static inline vf ceil(vf a) { return vrndpq_f32(a); }
+};
+
+#define SIMD simd_neon
+#define SIMD_NAME neon
+#define SIMD_ATTR
+#include "am_mathv_simd_kernels.inc"
+#undef SIMD
+#undef SIMD_NAME
+#undef SIMD_ATTR
+
+#endif
+
+am_mathv_f32_kernels am_mathv_f32 = mathv_f32_kernels_scalar;
+
+static am_mathv_f32_kernels *best_kernels() {
+#if defined(AM_MATHV_AVX2)
+    if (cpu_has_avx2()) return &mathv_f32_kernels_avx2;
+#endif
+#if defined(AM_MATHV_SSE2)
+    return &mathv_f32_kernels_sse2;
+#elif defined(AM_MATHV_NEON)
+    return &mathv_f32_kernels_neon;
+#else
+    return &mathv_f32_kernels_scalar;
+#endif
+}
+
+void am_init_mathv_kernels() {
+    am_mathv_f32 = *best_kernels();
+}
+
+// number of floats gathered at a time for strided views
+#define BLOCK_SIZE 256
+
+static void gather(float *dst, const uint8_t *src, unsigned int stride,
+    unsigned int src_components, unsigned int components, unsigned int count)
+{
+    if (src_components == 1) {
+        for (unsigned int i = 0; i < count; ++i) {
+            float x = *((const float*)src);
+            for (unsigned int c = 0; c < components; ++c) {
+                *dst++ = x;
+            }
+            src += stride;
+        }
+    } else {
+        for (unsigned int i = 0; i < count; ++i) {
+            memcpy(dst, src, components * sizeof(float));
+            dst += components;
+            src += stride;
+        }
+    }
+}
+
+static void scatter(uint8_t *dst, unsigned int stride, const float *src,
+    unsigned int components, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; ++i) {
+        memcpy(dst, src, components * sizeof(float));
+        src += components;
+        dst += stride;
+    }
+}
+
+void am_mathv_f32_strided1(am_mathv_f32_op1 op, unsigned int count, unsigned int components,
+    uint8_t *out, unsigned int out_stride,
+    const uint8_t *x, unsigned int x_stride, unsigned int x_components)
+{
+    float xbuf[BLOCK_SIZE];
+    float obuf[BLOCK_SIZE];
+    unsigned int block_count = BLOCK_SIZE / components;
+    for (unsigned int i = 0; i < count; i += block_count) {
+        unsigned int m = am_min(block_count, count - i);
+        gather(xbuf, x, x_stride, x_components, components, m);
+        op(obuf, xbuf, m * components);
+        scatter(out, out_stride, obuf, components, m);
+        x += x_stride * m;
+        out += out_stride * m;
+    }
+}
+
+void am_mathv_f32_strided2(am_mathv_f32_op2 op, unsigned int count, unsigned int components,
+    uint8_t *out, unsigned int out_stride,
+    const uint8_t *x, unsigned int x_stride, unsigned int x_components,
+    const uint8_t *y, unsigned int y_stride, unsigned int y_components)
+{
+    float xbuf[BLOCK_SIZE];
+    float ybuf[BLOCK_SIZE];
+    float obuf[BLOCK_SIZE];
+    unsigned int block_count = BLOCK_SIZE / components;
+    for (unsigned int i = 0; i < count; i += block_count) {
+        unsigned int m = am_min(block_count, count - i);
+        gather(xbuf, x, x_stride, x_components, components, m);
+        gather(ybuf, y, y_stride, y_components, components, m);
+        op(obuf, xbuf, ybuf, m * components);
+        scatter(out, out_stride, obuf, components, m);
+        x += x_stride * m;
+        y += y_stride * m;
+        out += out_stride * m;
+    }
+}
+
+int am_mathv_simd(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    if (nargs > 0) {
+        if (lua_toboolean(L, 1)) {
+            am_mathv_f32 = *best_kernels();
+        } else {
+            am_mathv_f32 = mathv_f32_kernels_scalar;
+        }
+    }
+    lua_pushstring(L, am_mathv_f32.isa);
+    return 1;
+}
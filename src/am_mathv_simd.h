@@ -0,0 +1,42 @@
+// Float kernels used by the generated mathv functions.
+// am_mathv_f32 points at the fastest kernels the cpu supports
+// (see am_init_mathv_kernels).
+
+typedef void (*am_mathv_f32_op1)(float *out, const float *x, unsigned int n);
+typedef void (*am_mathv_f32_op2)(float *out, const float *x, const float *y, unsigned int n);
+// Returns the dot product of x with a + t * (b - a). Used by the audio
+// resampler to apply a filter phase interpolated between two others.
+typedef float (*am_mathv_f32_fir_op)(const float *x, const float *a, const float *b, float t, unsigned int n);
+
+struct am_mathv_f32_kernels {
+    const char *isa;
+    am_mathv_f32_op2 add;
+    am_mathv_f32_op2 sub;
+    am_mathv_f32_op2 mul;
+    am_mathv_f32_op2 div;
+    am_mathv_f32_op2 min;
+    am_mathv_f32_op2 max;
+    am_mathv_f32_op1 abs;
+    am_mathv_f32_op1 floor;
+    am_mathv_f32_op1 ceil;
+    am_mathv_f32_op1 sin;
+    am_mathv_f32_op1 cos;
+    am_mathv_f32_fir_op fir;
+};
+
+extern am_mathv_f32_kernels am_mathv_f32;
+
+void am_init_mathv_kernels();
+
+// Apply a kernel to strided data by gathering blocks of elements into
+// contiguous scratch buffers. Arguments with 1 component are broadcast
+// to all the output components and singleton arguments have stride 0.
+void am_mathv_f32_strided1(am_mathv_f32_op1 op, unsigned int count, unsigned int components,
+    uint8_t *out, unsigned int out_stride,
+    const uint8_t *x, unsigned int x_stride, unsigned int x_components);
+void am_mathv_f32_strided2(am_mathv_f32_op2 op, unsigned int count, unsigned int components,
+    uint8_t *out, unsigned int out_stride,
+    const uint8_t *x, unsigned int x_stride, unsigned int x_components,
+    const uint8_t *y, unsigned int y_stride, unsigned int y_components);
+
+int am_mathv_simd(lua_State *L);
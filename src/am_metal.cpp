@@ -65,6 +65,12 @@ int am_max_vertex_texture_image_units;
 int am_max_vertex_uniform_vectors;
 int am_frame_draw_calls;
 int am_frame_use_program_calls;
+int am_frame_state_changes;
+int am_frame_uniform_uploads;
+uint64_t am_frame_bytes_uploaded;
+bool am_instancing_supported = false;
+bool am_instanced_attributes_supported = false;
+bool am_float_render_targets_supported = false;
 
 bool am_metal_use_highdpi = false;
 bool am_metal_window_depth_buffer = false;
@@ -1909,6 +1915,9 @@ int am_compute_pixel_size(am_texture_format format, am_texture_type type) {
         case AM_TEXTURE_TYPE_USHORT_4_4_4_4:
         case AM_TEXTURE_TYPE_USHORT_5_5_5_1:
             return 2;
+        case AM_TEXTURE_TYPE_FLOAT:
+            // not supported (am_float_render_targets_supported is false)
+            return 16;
     }
     assert(false);
     return 0;
@@ -2633,6 +2642,18 @@ void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type,
             indexBufferOffset:offset];
 }
 
+void am_set_attribute_divisor(am_gluint location, int divisor) {
+    // not supported (am_instancing_supported is false)
+}
+
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances) {
+    // not supported (am_instancing_supported is false)
+}
+
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances) {
+    // not supported (am_instancing_supported is false)
+}
+
 void am_gl_end_framebuffer_render() {
     check_initialized();
     if (metal_encoder != nil) {
@@ -2668,6 +2689,9 @@ void am_log_gl(const char *msg) {
 void am_reset_gl_frame_stats() {
     am_frame_draw_calls = 0;
     am_frame_use_program_calls = 0;
+    am_frame_state_changes = 0;
+    am_frame_uniform_uploads = 0;
+    am_frame_bytes_uploaded = 0;
 }
 
 static void get_src_error_line(char *errmsg, const char *src, int *line_no, char **line_str) {
@@ -145,6 +145,8 @@ static bool help_cmd(int *argc, char ***argv) {
         "Options:\n"
         "  -mute              Mute audio\n"
         "  -lang <lang>       Pretend <lang> is the current system language\n"
+        "  -headless          Render offscreen with a fixed time step and no audio\n"
+        "                     or input (Linux only, requires libEGL)\n"
         "\n"
         "Commands:\n"
         "  help [ <command> ] Show help\n"
@@ -288,6 +290,15 @@ static bool d3dangle_opt(int *argc, char ***argv) {
     return true;
 }
 
+static bool headless_opt(int *argc, char ***argv) {
+    #if defined(AM_HEADLESS_SUPPORTED)
+        am_conf_headless = true;
+    #else
+        fprintf(stderr, "Warning: -headless is not supported on this platform.\n");
+    #endif
+    return true;
+}
+
 static option options[] = {
     {"help",        help_cmd, true},
     {"-help",       help_cmd, true},
@@ -302,6 +313,7 @@ static option options[] = {
     {"-gllog",      gllog_opt, false},
     {"-nocloselua", nocloselua_opt, false},
     {"-d3dangle",   d3dangle_opt, false},
+    {"-headless",   headless_opt, false},
 
     {NULL, NULL}
 };
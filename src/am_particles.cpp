@@ -0,0 +1,343 @@
+#include "amulet.h"
+
+#define VERT_FLOATS 7 // x, y, size, r, g, b, a
+
+static inline float rand_var(am_rand *rnd) {
+    return rnd->get_randf() * 2.0f - 1.0f;
+}
+
+void am_particles2d::add_particle(am_rand *rnd) {
+    int i = num_particles++;
+    float ttl = life + rand_var(rnd) * life_var;
+    fields[AM_PARTICLE_TTL][i] = ttl;
+    fields[AM_PARTICLE_X][i] = source_pos.x + rand_var(rnd) * source_pos_var.x;
+    fields[AM_PARTICLE_Y][i] = source_pos.y + rand_var(rnd) * source_pos_var.y;
+    float size = start_size + rand_var(rnd) * start_size_var;
+    fields[AM_PARTICLE_SIZE][i] = size;
+    if (size_changes) {
+        fields[AM_PARTICLE_DSIZE][i] = (end_size + rand_var(rnd) * end_size_var - size) / ttl;
+    } else {
+        fields[AM_PARTICLE_DSIZE][i] = 0.0f;
+    }
+    glm::vec4 color;
+    for (int c = 0; c < 4; c++) {
+        color[c] = start_color[c] + rand_var(rnd) * start_color_var[c];
+        fields[AM_PARTICLE_R + c][i] = color[c];
+    }
+    for (int c = 0; c < 4; c++) {
+        if (color_changes) {
+            fields[AM_PARTICLE_DR + c][i] = (end_color[c] + rand_var(rnd) * end_color_var[c] - color[c]) / ttl;
+        } else {
+            fields[AM_PARTICLE_DR + c][i] = 0.0f;
+        }
+    }
+    float s = speed + rand_var(rnd) * speed_var;
+    float a = angle + rand_var(rnd) * angle_var;
+    fields[AM_PARTICLE_SPEED_X][i] = cosf(a) * s;
+    fields[AM_PARTICLE_SPEED_Y][i] = sinf(a) * s;
+}
+
+void am_particles2d::update(am_rand *rnd, float dt) {
+    int n = num_particles;
+    float *AM_RESTRICT x = fields[AM_PARTICLE_X];
+    float *AM_RESTRICT y = fields[AM_PARTICLE_Y];
+    float *AM_RESTRICT size = fields[AM_PARTICLE_SIZE];
+    float *AM_RESTRICT dsize = fields[AM_PARTICLE_DSIZE];
+    float *AM_RESTRICT r = fields[AM_PARTICLE_R];
+    float *AM_RESTRICT g = fields[AM_PARTICLE_G];
+    float *AM_RESTRICT b = fields[AM_PARTICLE_B];
+    float *AM_RESTRICT a = fields[AM_PARTICLE_A];
+    float *AM_RESTRICT dr = fields[AM_PARTICLE_DR];
+    float *AM_RESTRICT dg = fields[AM_PARTICLE_DG];
+    float *AM_RESTRICT db = fields[AM_PARTICLE_DB];
+    float *AM_RESTRICT da = fields[AM_PARTICLE_DA];
+    float *AM_RESTRICT ttl = fields[AM_PARTICLE_TTL];
+    float *AM_RESTRICT speed_x = fields[AM_PARTICLE_SPEED_X];
+    float *AM_RESTRICT speed_y = fields[AM_PARTICLE_SPEED_Y];
+    float damp_factor = 1.0f - damping * dt;
+    float gravity_dx = gravity.x * dt;
+    float gravity_dy = gravity.y * dt;
+
+    // Update every particle, including the ones that have just died,
+    // so the loop has no branches and can be vectorized. The dead ones
+    // are removed below.
+    for (int i = 0; i < n; i++) {
+        ttl[i] -= dt;
+        x[i] += dt * (speed_x[i] + gravity_dx * 0.5f);
+        y[i] += dt * (speed_y[i] + gravity_dy * 0.5f);
+        speed_x[i] = (speed_x[i] + gravity_dx) * damp_factor;
+        speed_y[i] = (speed_y[i] + gravity_dy) * damp_factor;
+        size[i] += dsize[i] * dt;
+        r[i] += dr[i] * dt;
+        g[i] += dg[i] * dt;
+        b[i] += db[i] * dt;
+        a[i] += da[i] * dt;
+    }
+
+    // Replace each dead particle with the last one. This leaves the
+    // particles in the same order as the old Lua implementation did.
+    int i = 0;
+    while (i < n) {
+        if (ttl[i] >= 0.0f) {
+            i++;
+            continue;
+        }
+        n--;
+        if (i != n) {
+            for (int f = 0; f < AM_NUM_PARTICLE_FIELDS; f++) {
+                fields[f][i] = fields[f][n];
+            }
+        }
+    }
+    num_particles = n;
+
+    // generate new particles
+    if (emission_rate > 0.0f) {
+        double delay = 1.0 / (double)emission_rate;
+        emit_counter += dt;
+        while (num_particles < max_particles && emit_counter >= delay) {
+            add_particle(rnd);
+            emit_counter -= delay;
+        }
+    }
+
+    write_verts();
+}
+
+void am_particles2d::write_verts() {
+    int n = num_particles;
+    if (n == 0) return;
+    float *AM_RESTRICT v = (float*)vert_buffer->data;
+    const float *AM_RESTRICT x = fields[AM_PARTICLE_X];
+    const float *AM_RESTRICT y = fields[AM_PARTICLE_Y];
+    const float *AM_RESTRICT size = fields[AM_PARTICLE_SIZE];
+    const float *AM_RESTRICT r = fields[AM_PARTICLE_R];
+    const float *AM_RESTRICT g = fields[AM_PARTICLE_G];
+    const float *AM_RESTRICT b = fields[AM_PARTICLE_B];
+    const float *AM_RESTRICT a = fields[AM_PARTICLE_A];
+    for (int i = 0; i < n; i++) {
+        // all four corners are the same, the offset attribute
+        // moves them apart
+        for (int k = 0; k < 4; k++) {
+            v[0] = x[i];
+            v[1] = y[i];
+            v[2] = size[i];
+            v[3] = r[i];
+            v[4] = g[i];
+            v[5] = b[i];
+            v[6] = a[i];
+            v += VERT_FLOATS;
+        }
+    }
+    vert_buffer->mark_dirty(0, n * 4 * VERT_FLOATS * (int)sizeof(float));
+}
+
+static int create_particles2d(lua_State *L) {
+    am_check_nargs(L, 3);
+    int max_particles = luaL_checkinteger(L, 1);
+    if (max_particles < 0) {
+        return luaL_error(L, "max_particles must be non-negative");
+    }
+    am_buffer *vert_buffer = am_check_buffer(L, 2);
+    if (vert_buffer->size < max_particles * 4 * VERT_FLOATS * (int)sizeof(float)) {
+        return luaL_error(L, "vertex buffer too small for %d particles", max_particles);
+    }
+    int seed = luaL_checkinteger(L, 3);
+    am_particles2d *sys = am_new_userdata(L, am_particles2d);
+    sys->rnd.init(seed);
+    sys->max_particles = max_particles;
+    sys->num_particles = 0;
+    sys->emit_counter = 0.0;
+    sys->vert_buffer = vert_buffer;
+    sys->vert_buffer_ref = sys->ref(L, 2);
+    sys->data_buffer = am_push_new_buffer_and_init(L, max_particles * AM_NUM_PARTICLE_FIELDS * (int)sizeof(float));
+    sys->data_buffer_ref = sys->ref(L, -1);
+    lua_pop(L, 1); // data buffer
+    for (int f = 0; f < AM_NUM_PARTICLE_FIELDS; f++) {
+        sys->fields[f] = (float*)sys->data_buffer->data + f * max_particles;
+    }
+    sys->source_pos = glm::vec2(0.0f);
+    sys->source_pos_var = glm::vec2(0.0f);
+    sys->start_size = 10.0f;
+    sys->start_size_var = 0.0f;
+    sys->end_size = 0.0f;
+    sys->end_size_var = 0.0f;
+    sys->size_changes = false;
+    sys->angle = 0.0f;
+    sys->angle_var = 0.0f;
+    sys->speed = 100.0f;
+    sys->speed_var = 0.0f;
+    sys->life = 1.0f;
+    sys->life_var = 0.0f;
+    sys->start_color = glm::vec4(1.0f);
+    sys->start_color_var = glm::vec4(0.0f);
+    sys->end_color = glm::vec4(1.0f);
+    sys->end_color_var = glm::vec4(0.0f);
+    sys->color_changes = false;
+    sys->emission_rate = 50.0f;
+    sys->gravity = glm::vec2(0.0f);
+    sys->damping = 0.0f;
+    return 1;
+}
+
+static int update_particles2d(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_particles2d *sys = am_get_userdata(L, am_particles2d, 1);
+    float dt = luaL_checknumber(L, 2);
+    sys->update(&sys->rnd, dt);
+    lua_pushinteger(L, sys->num_particles);
+    return 1;
+}
+
+// removes all the particles and emits n new ones
+static int reset_particles2d(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_particles2d *sys = am_get_userdata(L, am_particles2d, 1);
+    int n = am_min((int)luaL_checkinteger(L, 2), sys->max_particles);
+    sys->num_particles = 0;
+    for (int i = 0; i < n; i++) {
+        sys->add_particle(&sys->rnd);
+    }
+    sys->write_verts();
+    lua_pushinteger(L, sys->num_particles);
+    return 1;
+}
+
+#define FLOAT_SETTING(name)                                                 \
+static void get_##name(lua_State *L, void *obj) {                           \
+    lua_pushnumber(L, ((am_particles2d*)obj)->name);                        \
+}                                                                           \
+static void set_##name(lua_State *L, void *obj) {                           \
+    ((am_particles2d*)obj)->name = luaL_checknumber(L, 3);                  \
+}                                                                           \
+static am_property name##_property = {get_##name, set_##name};
+
+#define VEC_SETTING(name, vecN)                                             \
+static void get_##name(lua_State *L, void *obj) {                           \
+    am_new_userdata(L, am_##vecN)->v = ((am_particles2d*)obj)->name;        \
+}                                                                           \
+static void set_##name(lua_State *L, void *obj) {                           \
+    ((am_particles2d*)obj)->name = am_get_userdata(L, am_##vecN, 3)->v;     \
+}                                                                           \
+static am_property name##_property = {get_##name, set_##name};
+
+VEC_SETTING(source_pos, vec2)
+VEC_SETTING(source_pos_var, vec2)
+FLOAT_SETTING(start_size)
+FLOAT_SETTING(start_size_var)
+FLOAT_SETTING(end_size_var)
+FLOAT_SETTING(angle)
+FLOAT_SETTING(angle_var)
+FLOAT_SETTING(speed)
+FLOAT_SETTING(speed_var)
+FLOAT_SETTING(life)
+FLOAT_SETTING(life_var)
+VEC_SETTING(start_color, vec4)
+VEC_SETTING(start_color_var, vec4)
+VEC_SETTING(end_color_var, vec4)
+FLOAT_SETTING(emission_rate)
+VEC_SETTING(gravity, vec2)
+FLOAT_SETTING(damping)
+
+// end_size and end_color are nil until they're set
+
+static void get_end_size(lua_State *L, void *obj) {
+    am_particles2d *sys = (am_particles2d*)obj;
+    if (sys->size_changes) {
+        lua_pushnumber(L, sys->end_size);
+    } else {
+        lua_pushnil(L);
+    }
+}
+
+static void set_end_size(lua_State *L, void *obj) {
+    am_particles2d *sys = (am_particles2d*)obj;
+    sys->end_size = luaL_checknumber(L, 3);
+    sys->size_changes = true;
+}
+
+static am_property end_size_property = {get_end_size, set_end_size};
+
+static void get_end_color(lua_State *L, void *obj) {
+    am_particles2d *sys = (am_particles2d*)obj;
+    if (sys->color_changes) {
+        am_new_userdata(L, am_vec4)->v = sys->end_color;
+    } else {
+        lua_pushnil(L);
+    }
+}
+
+static void set_end_color(lua_State *L, void *obj) {
+    am_particles2d *sys = (am_particles2d*)obj;
+    sys->end_color = am_get_userdata(L, am_vec4, 3)->v;
+    sys->color_changes = true;
+}
+
+static am_property end_color_property = {get_end_color, set_end_color};
+
+static void get_active_particles(lua_State *L, void *obj) {
+    lua_pushinteger(L, ((am_particles2d*)obj)->num_particles);
+}
+
+static am_property active_particles_property = {get_active_particles, NULL};
+
+static void get_max_particles(lua_State *L, void *obj) {
+    lua_pushinteger(L, ((am_particles2d*)obj)->max_particles);
+}
+
+static am_property max_particles_property = {get_max_particles, NULL};
+
+static void register_particles2d_mt(lua_State *L) {
+    lua_newtable(L);
+    am_set_default_index_func(L);
+    am_set_default_newindex_func(L);
+
+    lua_pushcclosure(L, update_particles2d, 0);
+    lua_setfield(L, -2, "update");
+    lua_pushcclosure(L, reset_particles2d, 0);
+    lua_setfield(L, -2, "reset");
+
+    am_register_property(L, "source_pos", &source_pos_property);
+    am_register_property(L, "source_pos_var", &source_pos_var_property);
+    am_register_property(L, "start_size", &start_size_property);
+    am_register_property(L, "start_size_var", &start_size_var_property);
+    am_register_property(L, "end_size", &end_size_property);
+    am_register_property(L, "end_size_var", &end_size_var_property);
+    am_register_property(L, "angle", &angle_property);
+    am_register_property(L, "angle_var", &angle_var_property);
+    am_register_property(L, "speed", &speed_property);
+    am_register_property(L, "speed_var", &speed_var_property);
+    am_register_property(L, "life", &life_property);
+    am_register_property(L, "life_var", &life_var_property);
+    am_register_property(L, "start_color", &start_color_property);
+    am_register_property(L, "start_color_var", &start_color_var_property);
+    am_register_property(L, "end_color", &end_color_property);
+    am_register_property(L, "end_color_var", &end_color_var_property);
+    am_register_property(L, "emission_rate", &emission_rate_property);
+    am_register_property(L, "gravity", &gravity_property);
+    am_register_property(L, "damping", &damping_property);
+    am_register_property(L, "active_particles", &active_particles_property);
+    am_register_property(L, "max_particles", &max_particles_property);
+
+    am_register_metatable(L, "particles2d_state", MT_am_particles2d, 0);
+}
+
+// The GPU mode of am.particles2d keeps the particle state in float
+// textures, which are updated by rendering to them and then read by
+// the vertex shader that draws the particles.
+static int gpu_particles2d_supported(lua_State *L) {
+    lua_pushboolean(L, am_gl_is_initialized()
+        && am_float_render_targets_supported
+        && am_max_vertex_texture_image_units >= 2);
+    return 1;
+}
+
+void am_open_particles_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_particles2d", create_particles2d},
+        {"_gpu_particles2d_supported", gpu_particles2d_supported},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_particles2d_mt(L);
+}
@@ -0,0 +1,70 @@
+// Simulation state for am.particles2d (see lua/particles.lua, which
+// sets up the scene nodes that draw the particles).
+//
+// Each particle attribute is kept in its own float array so the update
+// loop can be vectorized. The arrays are allocated once for
+// max_particles, so emitting and killing particles never allocates.
+
+enum am_particle_field {
+    AM_PARTICLE_X,
+    AM_PARTICLE_Y,
+    AM_PARTICLE_SIZE,
+    AM_PARTICLE_DSIZE,
+    AM_PARTICLE_R,
+    AM_PARTICLE_G,
+    AM_PARTICLE_B,
+    AM_PARTICLE_A,
+    AM_PARTICLE_DR,
+    AM_PARTICLE_DG,
+    AM_PARTICLE_DB,
+    AM_PARTICLE_DA,
+    AM_PARTICLE_TTL,
+    AM_PARTICLE_SPEED_X,
+    AM_PARTICLE_SPEED_Y,
+    AM_NUM_PARTICLE_FIELDS,
+};
+
+struct am_particles2d : am_nonatomic_userdata {
+    int max_particles;
+    int num_particles;
+    double emit_counter;
+    am_rand rnd; // seeded from am.particles2d's seed setting
+
+    float *fields[AM_NUM_PARTICLE_FIELDS]; // arrays in data_buffer
+    am_buffer *data_buffer;
+    int data_buffer_ref;
+
+    // four vertices per particle, each a vec3 (x, y, size) followed
+    // by a vec4 color
+    am_buffer *vert_buffer;
+    int vert_buffer_ref;
+
+    // settings (sizes are half the sizes given to am.particles2d)
+    glm::vec2 source_pos;
+    glm::vec2 source_pos_var;
+    float start_size;
+    float start_size_var;
+    float end_size;
+    float end_size_var;
+    bool size_changes;
+    float angle;
+    float angle_var;
+    float speed;
+    float speed_var;
+    float life;
+    float life_var;
+    glm::vec4 start_color;
+    glm::vec4 start_color_var;
+    glm::vec4 end_color;
+    glm::vec4 end_color_var;
+    bool color_changes;
+    float emission_rate;
+    glm::vec2 gravity;
+    float damping;
+
+    void add_particle(am_rand *rnd);
+    void update(am_rand *rnd, float dt);
+    void write_verts();
+};
+
+void am_open_particles_module(lua_State *L);
@@ -0,0 +1,317 @@
+#include "amulet.h"
+
+#include <chrono>
+
+#define AM_PROFILER_MAX_DEPTH 64
+#define AM_PROFILER_MAX_TRACE_ZONES 1000000
+
+bool am_profiler_enabled = false;
+
+struct profile_zone {
+    const char *name;
+    double start;
+    double end;
+    int depth;
+};
+
+struct profile_frame {
+    double start;
+    double end;
+    int draw_calls;
+    int program_switches;
+    int state_changes;
+    int uniform_uploads;
+    uint64_t bytes_uploaded;
+};
+
+struct profiled_tag {
+    am_tag tag;
+    char *render_name;
+    char *actions_name;
+};
+
+static std::vector<profile_zone> frame_zones;
+static std::vector<profile_zone> last_frame_zones;
+static profile_frame last_frame;
+static bool have_last_frame = false;
+static double frame_start = -1.0;
+
+// indexes into frame_zones of the currently open zones
+static int open_zones[AM_PROFILER_MAX_DEPTH];
+static int depth = 0;
+
+static std::vector<profiled_tag> profiled_tags;
+
+static bool tracing = false;
+static bool trace_truncated = false;
+static double trace_start = 0.0;
+static std::vector<profile_zone> trace_zones;
+static std::vector<profile_frame> trace_frames;
+
+// am_get_current_time doesn't have a fine enough resolution on all
+// backends for timing zones.
+static double profiler_time() {
+    static std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - t0;
+    return t.count();
+}
+
+void am_profile_begin(const char *name) {
+    if (depth < AM_PROFILER_MAX_DEPTH) {
+        open_zones[depth] = (int)frame_zones.size();
+        profile_zone zone;
+        zone.name = name;
+        zone.start = profiler_time();
+        zone.end = zone.start;
+        zone.depth = depth;
+        frame_zones.push_back(zone);
+    }
+    depth++;
+}
+
+void am_profile_end() {
+    if (depth == 0) return;
+    depth--;
+    if (depth < AM_PROFILER_MAX_DEPTH) {
+        frame_zones[open_zones[depth]].end = profiler_time();
+    }
+}
+
+bool am_profile_begin_node(am_scene_node *node, bool render) {
+    int n = (int)profiled_tags.size();
+    if (n == 0) return false;
+    for (int i = 0; i < node->tags.size; i++) {
+        am_tag tag = node->tags.arr[i];
+        for (int j = 0; j < n; j++) {
+            if (profiled_tags[j].tag == tag) {
+                am_profile_begin(render ? profiled_tags[j].render_name : profiled_tags[j].actions_name);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void am_profiler_begin_frame() {
+    if (!am_profiler_enabled) {
+        frame_start = -1.0;
+        return;
+    }
+    // zones left open by errors in actions
+    while (depth > 0) am_profile_end();
+    double t = profiler_time();
+    if (frame_start >= 0.0) {
+        last_frame.start = frame_start;
+        last_frame.end = t;
+        last_frame.draw_calls = am_frame_draw_calls;
+        last_frame.program_switches = am_frame_use_program_calls;
+        last_frame.state_changes = am_frame_state_changes;
+        last_frame.uniform_uploads = am_frame_uniform_uploads;
+        last_frame.bytes_uploaded = am_frame_bytes_uploaded;
+        have_last_frame = true;
+        if (tracing) {
+            if (trace_zones.size() + frame_zones.size() <= AM_PROFILER_MAX_TRACE_ZONES) {
+                trace_zones.insert(trace_zones.end(), frame_zones.begin(), frame_zones.end());
+                trace_frames.push_back(last_frame);
+            } else {
+                trace_truncated = true;
+            }
+        }
+        last_frame_zones.swap(frame_zones);
+    }
+    frame_zones.clear();
+    frame_start = t;
+}
+
+static int enable_profiler(lua_State *L) {
+    int nargs = lua_gettop(L);
+    bool enabled = nargs == 0 || lua_toboolean(L, 1);
+    if (enabled != am_profiler_enabled) {
+        am_profiler_enabled = enabled;
+        frame_zones.clear();
+        frame_start = -1.0;
+        depth = 0;
+    }
+    return 0;
+}
+
+static int profile_tag(lua_State *L) {
+    am_check_nargs(L, 1);
+    if (lua_type(L, 1) != LUA_TSTRING) {
+        return luaL_error(L, "expecting a string in position 1");
+    }
+    am_tag tag = am_lookup_tag(L, 1);
+    for (unsigned int i = 0; i < profiled_tags.size(); i++) {
+        if (profiled_tags[i].tag == tag) return 0;
+    }
+    const char *name = lua_tostring(L, 1);
+    profiled_tag ptag;
+    ptag.tag = tag;
+    ptag.render_name = am_format("render %s", name);
+    ptag.actions_name = am_format("actions %s", name);
+    profiled_tags.push_back(ptag);
+    return 0;
+}
+
+static void clear_profiled_tags() {
+    // the names aren't freed, because zones that refer to them may
+    // still be in the trace or last frame.
+    profiled_tags.clear();
+}
+
+static void push_frame_stats(lua_State *L, profile_frame *frame) {
+    lua_pushnumber(L, frame->end - frame->start);
+    lua_setfield(L, -2, "time");
+    lua_pushinteger(L, frame->draw_calls);
+    lua_setfield(L, -2, "draw_calls");
+    lua_pushinteger(L, frame->program_switches);
+    lua_setfield(L, -2, "program_switches");
+    lua_pushinteger(L, frame->state_changes);
+    lua_setfield(L, -2, "state_changes");
+    lua_pushinteger(L, frame->uniform_uploads);
+    lua_setfield(L, -2, "uniform_uploads");
+    lua_pushnumber(L, (lua_Number)frame->bytes_uploaded);
+    lua_setfield(L, -2, "bytes_uploaded");
+}
+
+static int last_frame_profile(lua_State *L) {
+    if (!have_last_frame) {
+        lua_pushnil(L);
+        return 1;
+    }
+    lua_newtable(L);
+    push_frame_stats(L, &last_frame);
+    int n = (int)last_frame_zones.size();
+    lua_createtable(L, n, 0);
+    for (int i = 0; i < n; i++) {
+        profile_zone *zone = &last_frame_zones[i];
+        lua_createtable(L, 0, 4);
+        lua_pushstring(L, zone->name);
+        lua_setfield(L, -2, "name");
+        lua_pushnumber(L, zone->start - last_frame.start);
+        lua_setfield(L, -2, "start");
+        lua_pushnumber(L, zone->end - zone->start);
+        lua_setfield(L, -2, "time");
+        lua_pushinteger(L, zone->depth + 1);
+        lua_setfield(L, -2, "depth");
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_setfield(L, -2, "zones");
+    return 1;
+}
+
+static int start_profiler_trace(lua_State *L) {
+    if (!am_profiler_enabled) {
+        enable_profiler(L);
+    }
+    tracing = true;
+    trace_truncated = false;
+    trace_start = profiler_time();
+    trace_zones.clear();
+    trace_frames.clear();
+    return 0;
+}
+
+static void add_json_string(luaL_Buffer *b, const char *str) {
+    luaL_addchar(b, '"');
+    for (const char *c = str; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            luaL_addchar(b, '\\');
+            luaL_addchar(b, *c);
+        } else if ((unsigned char)*c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", (unsigned int)*c);
+            luaL_addstring(b, esc);
+        } else {
+            luaL_addchar(b, *c);
+        }
+    }
+    luaL_addchar(b, '"');
+}
+
+// timestamps in chrome traces are in microseconds
+static double trace_time(double t) {
+    return (t - trace_start) * 1000000.0;
+}
+
+static void add_trace_event(luaL_Buffer *b, const char *name, double start, double end, bool *first) {
+    char tmp[128];
+    luaL_addstring(b, *first ? "\n" : ",\n");
+    *first = false;
+    luaL_addstring(b, "{\"name\":");
+    add_json_string(b, name);
+    snprintf(tmp, sizeof(tmp), ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+        trace_time(start), (end - start) * 1000000.0);
+    luaL_addstring(b, tmp);
+}
+
+// Stops the trace and returns it in the Chrome trace event format
+// (which can be loaded in chrome://tracing or https://ui.perfetto.dev).
+static int stop_profiler_trace(lua_State *L) {
+    tracing = false;
+    luaL_Buffer b;
+    luaL_buffinit(L, &b);
+    luaL_addstring(&b, "{\"displayTimeUnit\":\"ms\",");
+    if (trace_truncated) {
+        luaL_addstring(&b, "\"truncated\":true,");
+    }
+    luaL_addstring(&b, "\"traceEvents\":[");
+    bool first = true;
+    char tmp[256];
+    for (unsigned int i = 0; i < trace_frames.size(); i++) {
+        profile_frame *frame = &trace_frames[i];
+        add_trace_event(&b, "frame", frame->start, frame->end, &first);
+        snprintf(tmp, sizeof(tmp),
+            ",\n{\"name\":\"gl\",\"ph\":\"C\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"args\":{"
+            "\"draw_calls\":%d,\"program_switches\":%d,\"state_changes\":%d,"
+            "\"uniform_uploads\":%d,\"bytes_uploaded\":%llu}}",
+            trace_time(frame->start), frame->draw_calls, frame->program_switches,
+            frame->state_changes, frame->uniform_uploads, (unsigned long long)frame->bytes_uploaded);
+        luaL_addstring(&b, tmp);
+    }
+    for (unsigned int i = 0; i < trace_zones.size(); i++) {
+        profile_zone *zone = &trace_zones[i];
+        add_trace_event(&b, zone->name, zone->start, zone->end, &first);
+    }
+    luaL_addstring(&b, "\n]}\n");
+    luaL_pushresult(&b);
+    trace_zones.clear();
+    trace_frames.clear();
+    return 1;
+}
+
+// The following are used by actions.lua to time the actions of nodes
+// with profiled tags.
+
+static int profiling_nodes(lua_State *L) {
+    lua_pushboolean(L, am_profiler_enabled && profiled_tags.size() > 0);
+    return 1;
+}
+
+static int profile_begin_node(lua_State *L) {
+    am_scene_node *node = am_get_userdata(L, am_scene_node, 1);
+    lua_pushboolean(L, am_profile_begin_node(node, false));
+    return 1;
+}
+
+static int profile_end(lua_State *L) {
+    am_profile_end();
+    return 0;
+}
+
+void am_open_profiler_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"enable_profiler", enable_profiler},
+        {"profile_tag", profile_tag},
+        {"last_frame_profile", last_frame_profile},
+        {"start_profiler_trace", start_profiler_trace},
+        {"stop_profiler_trace", stop_profiler_trace},
+        {"_profiling_nodes", profiling_nodes},
+        {"_profile_begin_node", profile_begin_node},
+        {"_profile_end", profile_end},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    // tags are per lua state
+    clear_profiled_tags();
+}
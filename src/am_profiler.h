@@ -0,0 +1,43 @@
+// Frame profiler.
+//
+// AM_PROFILE_ZONE(name) times the rest of the enclosing block. Zones
+// nest, and the zones and GL counters of the most recent frame can be
+// inspected from Lua with am.last_frame_profile(). While a trace is
+// being captured (am.start_profiler_trace) every zone is also kept so it
+// can be exported in the Chrome trace event format.
+//
+// Scene nodes with a tag registered with am.profile_tag get their own
+// zones when they're rendered and when their actions run.
+//
+// Zone names aren't copied, so they must be string literals (or
+// otherwise live as long as the profiler).
+//
+// When the profiler is disabled a zone costs one flag check.
+
+extern bool am_profiler_enabled;
+
+void am_profile_begin(const char *name);
+void am_profile_end();
+
+// Begins a zone for the node if it has a profiled tag and returns true,
+// otherwise returns false. render is true for rendering zones and false
+// for action zones.
+bool am_profile_begin_node(am_scene_node *node, bool render);
+
+// Called once per frame, before the windows are drawn.
+void am_profiler_begin_frame();
+
+struct am_profile_scope {
+    bool active;
+    am_profile_scope(const char *name) {
+        active = am_profiler_enabled;
+        if (active) am_profile_begin(name);
+    }
+    ~am_profile_scope() {
+        if (active) am_profile_end();
+    }
+};
+
+#define AM_PROFILE_ZONE(name) am_profile_scope AM_CONCAT(am_profile_zone_, __LINE__)(name)
+
+void am_open_profiler_module(lua_State *L);
@@ -1,6 +1,8 @@
 #include "amulet.h"
 
-static bool bind_attribute_array(am_render_state *rstate, am_gluint location,
+uint64_t am_param_value_version = 0;
+
+static bool bind_attribute_array(am_render_state *rstate, am_program_param *param,
     am_buffer_view *view)
 {
     if (!view->can_be_gl_attrib()) {
@@ -11,9 +13,43 @@ static bool bind_attribute_array(am_render_state *rstate, am_gluint location,
         return false;
     }
     buf->update_if_dirty();
-    am_bind_buffer(AM_ARRAY_BUFFER, buf->arraybuf->get_latest_id());
-    am_set_attribute_pointer(location, view->components, view->gl_client_type(), view->is_normalized(), view->stride, view->offset);
-    if (view->size < rstate->max_draw_array_size) {
+    if (view->divisor > 0) {
+        rstate->instanced_attributes = true;
+        int max_instances = view->size > INT_MAX / view->divisor ? INT_MAX : view->size * view->divisor;
+        if (max_instances < rstate->max_draw_instances) {
+            rstate->max_draw_instances = max_instances;
+        }
+        if (!am_instancing_supported) {
+            // the attribute is set separately for each instance
+            // (see am_render_state::draw_instances)
+            param->bound_buffer_id = 0;
+            return true;
+        }
+    }
+    am_buffer_id id = buf->arraybuf->get_latest_id();
+    am_attribute_client_type client_type = view->gl_client_type();
+    bool normalized = view->is_normalized();
+    if (rstate->attributes_program != rstate->active_program
+        || param->bound_buffer_id != id
+        || param->bound_offset != view->offset
+        || param->bound_stride != view->stride
+        || param->bound_components != view->components
+        || param->bound_client_type != client_type
+        || param->bound_normalized != normalized)
+    {
+        am_bind_buffer(AM_ARRAY_BUFFER, id);
+        am_set_attribute_pointer(param->location, view->components, client_type, normalized, view->stride, view->offset);
+        param->bound_buffer_id = id;
+        param->bound_offset = view->offset;
+        param->bound_stride = view->stride;
+        param->bound_components = view->components;
+        param->bound_client_type = client_type;
+        param->bound_normalized = normalized;
+    }
+    if (am_instancing_supported) {
+        rstate->set_attribute_divisor(param->location, view->divisor);
+    }
+    if (view->divisor == 0 && view->size < rstate->max_draw_array_size) {
         rstate->max_draw_array_size = view->size;
     }
     return true;
@@ -53,11 +89,16 @@ static void report_incompatible_param_type(am_render_state *rstate, am_program_p
 
 bool am_program_param::bind(am_render_state *rstate) {
     am_program_param_name_slot *slot = &rstate->param_name_map[name];
+    if (bound_version != 0 && slot->value.version == bound_version) {
+        // uniform value hasn't changed since we last uploaded it
+        return true;
+    }
     bool bound = false;
     switch (type) {
         case AM_PROGRAM_PARAM_UNIFORM_1F:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_1F) {
                 am_set_uniform1f(location, slot->value.value.f);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -67,6 +108,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                 fs[0] = (float)slot->value.value.v2[0];
                 fs[1] = (float)slot->value.value.v2[1];
                 am_set_uniform2f(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -77,6 +119,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                 fs[1] = (float)slot->value.value.v3[1];
                 fs[2] = (float)slot->value.value.v3[2];
                 am_set_uniform3f(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -88,6 +131,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                 fs[2] = (float)slot->value.value.v4[2];
                 fs[3] = (float)slot->value.value.v4[3];
                 am_set_uniform4f(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -98,6 +142,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                     fs[i] = (float)slot->value.value.m2[i];
                 }
                 am_set_uniform_mat2(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -108,6 +153,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                     fs[i] = (float)slot->value.value.m3[i];
                 }
                 am_set_uniform_mat3(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -118,6 +164,7 @@ bool am_program_param::bind(am_render_state *rstate) {
                     fs[i] = (float)slot->value.value.m4[i];
                 }
                 am_set_uniform_mat4(location, fs);
+                bound_version = slot->value.version;
                 bound = true;
             }
             break;
@@ -133,7 +180,7 @@ bool am_program_param::bind(am_render_state *rstate) {
         case AM_PROGRAM_PARAM_ATTRIBUTE_3F:
         case AM_PROGRAM_PARAM_ATTRIBUTE_4F:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) {
-                bound = bind_attribute_array(rstate, location, slot->value.value.arr);
+                bound = bind_attribute_array(rstate, this, slot->value.value.arr);
             }
             break;
     }
@@ -141,6 +188,34 @@ bool am_program_param::bind(am_render_state *rstate) {
     return bound;
 }
 
+bool am_program_param_value::equals(am_program_param_value *other) {
+    if (type != other->type) return false;
+    switch (type) {
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_1F:
+            return value.f == other->value.f;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_2F:
+            return memcmp(value.v2, other->value.v2, sizeof(double) * 2) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_3F:
+            return memcmp(value.v3, other->value.v3, sizeof(double) * 3) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_4F:
+            return memcmp(value.v4, other->value.v4, sizeof(double) * 4) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT2:
+            return memcmp(value.m2, other->value.m2, sizeof(double) * 4) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT3:
+            return memcmp(value.m3, other->value.m3, sizeof(double) * 9) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4:
+            return memcmp(value.m4, other->value.m4, sizeof(double) * 16) == 0;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY:
+            return value.arr == other->value.arr;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D:
+            return value.sampler2d.texture == other->value.sampler2d.texture
+                && value.sampler2d.texture_unit == other->value.sampler2d.texture_unit;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_UNDEFINED:
+            return true;
+    }
+    return false;
+}
+
 am_param_name_id am_lookup_param_name(lua_State *L, int name_idx) {
     am_render_state *g = am_global_render_state;
     name_idx = am_absindex(L, name_idx);
@@ -166,6 +241,7 @@ am_param_name_id am_lookup_param_name(lua_State *L, int name_idx) {
             for (int i = old_capacity; i < g->param_name_map_capacity; i++) {
                 g->param_name_map[i].name = NULL;
                 g->param_name_map[i].value.type = AM_PROGRAM_PARAM_CLIENT_TYPE_UNDEFINED;
+                g->param_name_map[i].value.version = 0;
             }
         }
         g->param_name_map[name_ref].name = lua_tostring(L, name_idx);
@@ -266,6 +342,7 @@ static int create_program(lua_State *L) {
     int num_params = num_attributes + num_uniforms;    
 
     am_program_param *params = (am_program_param*)malloc(sizeof(am_program_param) * num_params);
+    memset(params, 0, sizeof(am_program_param) * num_params); // nothing bound yet
 
     // Generate attribute params
     int i = 0;
@@ -383,14 +460,27 @@ static int create_program(lua_State *L) {
     prog->program_id = program;
     prog->num_params = num_params;
     prog->sets_point_size = (strstr(vertex_shader_src, "gl_PointSize") != NULL);
+    prog->batch_pretransform = false;
     prog->params = params;
     prog->num_vaas = num_attributes;
 
     return 1;
 }
 
+// Used by the built-in shaders, which only use MV to transform
+// the position attribute, so am.sprite_batch can apply MV on the cpu.
+static int allow_batch_pretransform(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_program *prog = am_get_userdata(L, am_program, 1);
+    prog->batch_pretransform = false;
+    return 0;
+}
+
 static int gc_program(lua_State *L) {
     am_program *prog = (am_program*)lua_touserdata(L, 1);
+    if (am_global_render_state->attributes_program == prog) {
+        am_global_render_state->attributes_program = NULL;
+    }
     am_use_program(0);
     am_delete_program(prog->program_id);
     free(prog->params);
@@ -452,6 +542,9 @@ void am_bind_node::render(am_render_state *rstate) {
     am_program_param_value *old_vals = (am_program_param_value*)alloca(sizeof(am_program_param_value) * num_params);
     int texture_units_to_release = 0;
     for (int i = 0; i < num_params; i++) {
+        if (names[i] == rstate->modelview_param_index || names[i] == rstate->projection_param_index) {
+            am_bounds_unbounded(rstate);
+        }
         am_program_param_value *param = &rstate->param_name_map[names[i]].value;
         old_vals[i] = *param;
         *param = values[i];
@@ -661,6 +754,7 @@ static void register_bind_node_mt(lua_State *L) {
 }
 
 void am_read_uniform_node::render(am_render_state *rstate) {
+    am_bounds_unbounded(rstate);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     switch (param->type) {
         case AM_PROGRAM_PARAM_CLIENT_TYPE_1F:
@@ -676,6 +770,7 @@ void am_read_uniform_node::render(am_render_state *rstate) {
         case AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY:
         case AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D:
             value.type = AM_PROGRAM_PARAM_CLIENT_TYPE_UNDEFINED;
+            value.version = 0;
             break;
     }
     render_children(rstate);
@@ -861,6 +956,7 @@ void am_open_program_module(lua_State *L) {
         {"bind", create_bind_node},
         {"use_program", create_program_node},
         {"read_uniform", create_read_uniform_node},
+        {"_allow_batch_pretransform", allow_batch_pretransform},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
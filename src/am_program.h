@@ -33,8 +33,17 @@ struct am_sampler2d_param_value {
     am_texture2d *texture;
 };
 
+// Incremented on every write to a param value (see
+// am_program_param_value::changed).
+extern uint64_t am_param_value_version;
+
 struct am_program_param_value {
     am_program_param_client_type type;
+    // Each distinct value gets a new version, so a program can skip
+    // re-uploading a uniform if the version hasn't changed since it
+    // last uploaded it. Code that modifies a value in place must call
+    // changed() and restore the old version along with the old value.
+    uint64_t version;
     union {
         double f;
         double v2[2];
@@ -48,42 +57,57 @@ struct am_program_param_value {
     } value;
 
     void set_float(double f) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_1F;
         value.f = f;
     }
     void set_vec2(glm::dvec2 v2) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_2F;
         memcpy(&value.v2[0], glm::value_ptr(v2), sizeof(glm::dvec2));
     }
     void set_vec3(glm::dvec3 v3) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_3F;
         memcpy(&value.v3[0], glm::value_ptr(v3), sizeof(glm::dvec3));
     }
     void set_vec4(glm::dvec4 v4) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_4F;
         memcpy(&value.v4[0], glm::value_ptr(v4), sizeof(glm::dvec4));
     }
     void set_mat2(glm::dmat2 m2) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT2;
         memcpy(&value.m2[0], glm::value_ptr(m2), sizeof(glm::dmat2));
     }
     void set_mat3(glm::dmat3 m3) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT3;
         memcpy(&value.m3[0], glm::value_ptr(m3), sizeof(glm::dmat3));
     }
     void set_mat4(glm::dmat4 m4) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
         memcpy(&value.m4[0], glm::value_ptr(m4), sizeof(glm::dmat4));
     }
     void set_arr(am_buffer_view *arr) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY;
         value.arr = arr;
     }
     void set_samp2d(am_texture2d *tex) {
+        changed();
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D;
         value.sampler2d.texture = tex;
         value.sampler2d.texture_unit = -1; // assigned when rendering
     }
+
+    void changed() {
+        version = ++am_param_value_version;
+    }
+
+    bool equals(am_program_param_value *other);
 };
 
 struct am_program_param_name_slot {
@@ -99,6 +123,19 @@ struct am_program_param {
     am_gluint location;
     am_param_name_id name;
 
+    // What was last bound, so unchanged params can be skipped.
+    // For uniforms this is the version of the uploaded value (0 if none).
+    // For attributes it's the arguments of the last attribute pointer call,
+    // which is only still in effect if the program is
+    // am_render_state::attributes_program.
+    uint64_t bound_version;
+    am_buffer_id bound_buffer_id;
+    int bound_offset;
+    int bound_stride;
+    int bound_components;
+    am_attribute_client_type bound_client_type;
+    bool bound_normalized;
+
     bool bind(am_render_state *rstate);
 };
 
@@ -106,6 +143,7 @@ struct am_program : am_nonatomic_userdata {
     am_program_id program_id;
     int num_params;
     bool sets_point_size;
+    bool batch_pretransform; // MV only transforms the position (see am_draw_batch)
     am_program_param *params;
     int num_vaas; // number of vertex attribute arrays
 };
@@ -0,0 +1,298 @@
+#include "amulet.h"
+
+am_quad_batch::am_quad_batch() {
+    capacity = 0;
+    num_quads = 0;
+    quad_size = 0;
+    buffer = NULL;
+    buffer_ref = LUA_NOREF;
+    slot_to_handle.owner = this;
+    handle_to_slot.owner = this;
+    free_handles.owner = this;
+}
+
+int am_quad_batch::add(lua_State *L) {
+    assert(num_quads < capacity);
+    int handle;
+    if (free_handles.size > 0) {
+        handle = free_handles.arr[--free_handles.size];
+    } else {
+        handle = handle_to_slot.size;
+        handle_to_slot.push_back(L, -1);
+    }
+    int slot = num_quads++;
+    if (slot_to_handle.size < num_quads) {
+        slot_to_handle.push_back(L, handle);
+    } else {
+        slot_to_handle.arr[slot] = handle;
+    }
+    handle_to_slot.arr[handle] = slot;
+    // don't leave the values of a removed quad behind
+    memset(buffer->data + slot * quad_size, 0, quad_size);
+    buffer->mark_dirty(slot * quad_size, (slot + 1) * quad_size);
+    return handle;
+}
+
+void am_quad_batch::remove(int handle) {
+    int slot = handle_to_slot.arr[handle];
+    int last = num_quads - 1;
+    if (slot != last) {
+        memcpy(buffer->data + slot * quad_size, buffer->data + last * quad_size, quad_size);
+        buffer->mark_dirty(slot * quad_size, (slot + 1) * quad_size);
+        int moved = slot_to_handle.arr[last];
+        slot_to_handle.arr[slot] = moved;
+        handle_to_slot.arr[moved] = slot;
+    }
+    handle_to_slot.arr[handle] = -1;
+    // there are never more handles than the capacity, so there's
+    // always room in free_handles (see set_quad_buffer)
+    free_handles.arr[free_handles.size++] = handle;
+    num_quads--;
+}
+
+void am_quad_batch::remove_range(int slot, int count) {
+    for (int s = slot; s < slot + count; s++) {
+        int handle = slot_to_handle.arr[s];
+        handle_to_slot.arr[handle] = -1;
+        free_handles.arr[free_handles.size++] = handle;
+    }
+    int tail = num_quads - (slot + count);
+    if (tail > 0) {
+        memmove(buffer->data + slot * quad_size,
+            buffer->data + (slot + count) * quad_size, tail * quad_size);
+        buffer->mark_dirty(slot * quad_size, (slot + tail) * quad_size);
+        for (int s = slot; s < slot + tail; s++) {
+            int handle = slot_to_handle.arr[s + count];
+            slot_to_handle.arr[s] = handle;
+            handle_to_slot.arr[handle] = s;
+        }
+    }
+    num_quads -= count;
+}
+
+void am_quad_batch::clear() {
+    for (int s = 0; s < num_quads; s++) {
+        int handle = slot_to_handle.arr[s];
+        handle_to_slot.arr[handle] = -1;
+        free_handles.arr[free_handles.size++] = handle;
+    }
+    num_quads = 0;
+}
+
+static void set_quad_buffer(lua_State *L, am_quad_batch *batch, int buf_idx, int capacity) {
+    am_buffer *buffer = am_check_buffer(L, buf_idx);
+    if (capacity <= 0 || buffer->size % capacity != 0) {
+        luaL_error(L, "buffer size (%d) is not a multiple of the capacity (%d)", buffer->size, capacity);
+        return;
+    }
+    int quad_size = buffer->size / capacity;
+    if (batch->buffer != NULL) {
+        if (quad_size != batch->quad_size) {
+            luaL_error(L, "quad size changed (from %d to %d bytes)", batch->quad_size, quad_size);
+            return;
+        }
+        if (capacity < batch->num_quads) {
+            luaL_error(L, "capacity too small for %d quads", batch->num_quads);
+            return;
+        }
+        int used = batch->num_quads * quad_size;
+        if (used > 0) {
+            memcpy(am_check_buffer_data(L, buffer), batch->buffer->data, used);
+            buffer->mark_dirty(0, used);
+        }
+        batch->reref(L, batch->buffer_ref, buf_idx);
+    } else {
+        batch->buffer_ref = batch->ref(L, buf_idx);
+    }
+    batch->buffer = buffer;
+    batch->quad_size = quad_size;
+    batch->capacity = capacity;
+    // Make sure removing quads never needs to allocate.
+    batch->free_handles.ensure_capacity(L, capacity);
+    batch->slot_to_handle.ensure_capacity(L, capacity);
+}
+
+static int create_quad_batch(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_quad_batch *batch = am_new_userdata(L, am_quad_batch);
+    set_quad_buffer(L, batch, 1, luaL_checkinteger(L, 2));
+    return 1;
+}
+
+// replaces the buffer with a larger one, copying over the quads
+static int set_buffer(lua_State *L) {
+    am_check_nargs(L, 3);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    set_quad_buffer(L, batch, 2, luaL_checkinteger(L, 3));
+    return 0;
+}
+
+static int check_handle(lua_State *L, am_quad_batch *batch, int idx) {
+    int handle = luaL_checkinteger(L, idx) - 1;
+    if (handle < 0 || handle >= batch->handle_to_slot.size
+        || batch->handle_to_slot.arr[handle] < 0)
+    {
+        luaL_error(L, "invalid quad handle: %d", handle + 1);
+    }
+    return handle;
+}
+
+// returns the new quad's handle and quad number
+static int add_quad(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    if (batch->num_quads >= batch->capacity) {
+        return luaL_error(L, "quad batch is full (capacity %d)", batch->capacity);
+    }
+    int handle = batch->add(L);
+    lua_pushinteger(L, handle + 1);
+    lua_pushinteger(L, batch->num_quads);
+    return 2;
+}
+
+static int remove_quad(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    batch->remove(check_handle(L, batch, 2));
+    return 0;
+}
+
+static int remove_quad_range(lua_State *L) {
+    am_check_nargs(L, 3);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    int q = luaL_checkinteger(L, 2);
+    int count = luaL_checkinteger(L, 3);
+    if (q < 1 || count < 0) {
+        return luaL_error(L, "invalid quad range");
+    }
+    if (q + count - 1 > batch->num_quads) {
+        return luaL_error(L, "cannot remove quad %d, because it doesn't exist", q + count - 1);
+    }
+    batch->remove_range(q - 1, count);
+    return 0;
+}
+
+static int clear_quads(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    batch->clear();
+    return 0;
+}
+
+// returns the quad number (draw order) of a handle
+static int quad_number(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    int handle = check_handle(L, batch, 2);
+    lua_pushinteger(L, batch->handle_to_slot.arr[handle] + 1);
+    return 1;
+}
+
+// returns the handle of a quad number
+static int quad_handle(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    int q = luaL_checkinteger(L, 2);
+    if (q < 1 || q > batch->num_quads) {
+        return luaL_error(L, "quad %d doesn't exist", q);
+    }
+    lua_pushinteger(L, batch->slot_to_handle.arr[q - 1] + 1);
+    return 1;
+}
+
+// Copies the values for every quad from src to dst, where dst is one of
+// the attribute views of the quads and src has 4 values per handle (so
+// the values of handle h start at element (h - 1) * 4 + 1).
+static int set_quads_attr(lua_State *L) {
+    am_check_nargs(L, 3);
+    am_quad_batch *batch = am_get_userdata(L, am_quad_batch, 1);
+    am_buffer_view *dst = am_check_buffer_view(L, 2);
+    am_buffer_view *src = am_check_buffer_view(L, 3);
+    if (dst->buffer != batch->buffer) {
+        return luaL_error(L, "view is not one of the quad attributes");
+    }
+    if (src->type != dst->type || src->components != dst->components) {
+        return luaL_error(L, "view has the wrong element type");
+    }
+    int n = batch->num_quads;
+    if (n == 0) return 0;
+    int max_handle = 0;
+    for (int s = 0; s < n; s++) {
+        max_handle = am_max(max_handle, batch->slot_to_handle.arr[s]);
+    }
+    if (src->size < (max_handle + 1) * 4) {
+        return luaL_error(L, "view too small (size %d, need values for %d handles)", src->size, max_handle + 1);
+    }
+    int elem_size = dst->components * am_view_type_infos[dst->type].size;
+    uint8_t *src_data = am_check_buffer_data(L, src->buffer) + src->offset;
+    uint8_t *dst_data = dst->buffer->data + dst->offset;
+    int src_stride = src->stride;
+    int dst_stride = dst->stride;
+    for (int s = 0; s < n; s++) {
+        int h = batch->slot_to_handle.arr[s];
+        uint8_t *from = src_data + h * 4 * src_stride;
+        uint8_t *to = dst_data + s * 4 * dst_stride;
+        for (int v = 0; v < 4; v++) {
+            memcpy(to + v * dst_stride, from + v * src_stride, elem_size);
+        }
+    }
+    dst->mark_dirty(0, n * 4);
+    return 0;
+}
+
+static void get_num_quads(lua_State *L, void *obj) {
+    lua_pushinteger(L, ((am_quad_batch*)obj)->num_quads);
+}
+
+static am_property num_quads_property = {get_num_quads, NULL};
+
+static void get_capacity(lua_State *L, void *obj) {
+    lua_pushinteger(L, ((am_quad_batch*)obj)->capacity);
+}
+
+static am_property capacity_property = {get_capacity, NULL};
+
+static void get_buffer(lua_State *L, void *obj) {
+    am_quad_batch *batch = (am_quad_batch*)obj;
+    batch->pushref(L, batch->buffer_ref);
+}
+
+static am_property buffer_property = {get_buffer, NULL};
+
+static void register_quad_batch_mt(lua_State *L) {
+    lua_newtable(L);
+    am_set_default_index_func(L);
+    am_set_default_newindex_func(L);
+
+    lua_pushcclosure(L, set_buffer, 0);
+    lua_setfield(L, -2, "set_buffer");
+    lua_pushcclosure(L, add_quad, 0);
+    lua_setfield(L, -2, "add");
+    lua_pushcclosure(L, remove_quad, 0);
+    lua_setfield(L, -2, "remove");
+    lua_pushcclosure(L, remove_quad_range, 0);
+    lua_setfield(L, -2, "remove_range");
+    lua_pushcclosure(L, clear_quads, 0);
+    lua_setfield(L, -2, "clear");
+    lua_pushcclosure(L, quad_number, 0);
+    lua_setfield(L, -2, "quad_number");
+    lua_pushcclosure(L, quad_handle, 0);
+    lua_setfield(L, -2, "handle");
+    lua_pushcclosure(L, set_quads_attr, 0);
+    lua_setfield(L, -2, "set_attr");
+
+    am_register_property(L, "num_quads", &num_quads_property);
+    am_register_property(L, "capacity", &capacity_property);
+    am_register_property(L, "buffer", &buffer_property);
+
+    am_register_metatable(L, "quad_batch_state", MT_am_quad_batch, 0);
+}
+
+void am_open_quads_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_quad_batch", create_quad_batch},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_quad_batch_mt(L);
+}
@@ -0,0 +1,32 @@
+// Quad storage for am.quads and am.quad_batch (see lua/shapes.lua, which
+// creates the views and scene nodes that draw the quads).
+//
+// The quads are kept contiguously at the start of a vertex buffer, four
+// vertices per quad, so they can be drawn with a single draw call. Each
+// quad also has a handle which stays the same when other quads are
+// removed. Handles of removed quads are reused.
+
+struct am_quad_batch : am_nonatomic_userdata {
+    int capacity;
+    int num_quads;
+    int quad_size; // in bytes (4 vertices)
+
+    am_buffer *buffer;
+    int buffer_ref;
+
+    am_lua_array<int> slot_to_handle;
+    am_lua_array<int> handle_to_slot; // -1 for free handles
+    am_lua_array<int> free_handles;
+
+    am_quad_batch();
+
+    // returns the handle of the new quad, which is always added at the end
+    int add(lua_State *L);
+    // moves the last quad into the removed quad's slot
+    void remove(int handle);
+    // removes count quads starting at slot, keeping the others in order
+    void remove_range(int slot, int count);
+    void clear();
+};
+
+void am_open_quads_module(lua_State *L);
@@ -477,6 +477,91 @@ void am_blend_state::bind(am_render_state *rstate, bool force) {
     }
 }
 
+static bool same_viewport(am_viewport_state *a, am_viewport_state *b) {
+    return a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h;
+}
+
+static bool same_scissor_test(am_scissor_test_state *a, am_scissor_test_state *b) {
+    return a->enabled == b->enabled
+        && a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h;
+}
+
+static bool same_color_mask(am_color_mask_state *a, am_color_mask_state *b) {
+    return a->r == b->r && a->g == b->g && a->b == b->b && a->a == b->a;
+}
+
+static bool same_depth_test(am_depth_test_state *a, am_depth_test_state *b) {
+    return a->test_enabled == b->test_enabled
+        && a->mask_enabled == b->mask_enabled
+        && a->func == b->func;
+}
+
+static bool same_stencil_test(am_stencil_test_state *a, am_stencil_test_state *b) {
+    return a->enabled == b->enabled
+        && a->ref == b->ref
+        && a->read_mask == b->read_mask
+        && a->write_mask == b->write_mask
+        && a->func_front == b->func_front
+        && a->op_fail_front == b->op_fail_front
+        && a->op_zfail_front == b->op_zfail_front
+        && a->op_zpass_front == b->op_zpass_front
+        && a->func_back == b->func_back
+        && a->op_fail_back == b->op_fail_back
+        && a->op_zfail_back == b->op_zfail_back
+        && a->op_zpass_back == b->op_zpass_back;
+}
+
+static bool same_cull_face(am_cull_face_state *a, am_cull_face_state *b) {
+    return a->enabled == b->enabled && a->side == b->side;
+}
+
+static bool same_blend(am_blend_state *a, am_blend_state *b) {
+    return a->enabled == b->enabled
+        && a->equation_rgb == b->equation_rgb
+        && a->equation_alpha == b->equation_alpha
+        && a->sfactor_rgb == b->sfactor_rgb
+        && a->dfactor_rgb == b->dfactor_rgb
+        && a->sfactor_alpha == b->sfactor_alpha
+        && a->dfactor_alpha == b->dfactor_alpha
+        && a->constant_r == b->constant_r
+        && a->constant_g == b->constant_g
+        && a->constant_b == b->constant_b
+        && a->constant_a == b->constant_a;
+}
+
+void am_draw_state::capture(am_render_state *rstate) {
+    program = rstate->active_program;
+    viewport_state = rstate->active_viewport_state;
+    scissor_test_state = rstate->active_scissor_test_state;
+    color_mask_state = rstate->active_color_mask_state;
+    depth_test_state = rstate->active_depth_test_state;
+    stencil_test_state = rstate->active_stencil_test_state;
+    cull_face_state = rstate->active_cull_face_state;
+    blend_state = rstate->active_blend_state;
+}
+
+void am_draw_state::install(am_render_state *rstate) {
+    rstate->active_program = program;
+    rstate->active_viewport_state = viewport_state;
+    rstate->active_scissor_test_state = scissor_test_state;
+    rstate->active_color_mask_state = color_mask_state;
+    rstate->active_depth_test_state = depth_test_state;
+    rstate->active_stencil_test_state = stencil_test_state;
+    rstate->active_cull_face_state = cull_face_state;
+    rstate->active_blend_state = blend_state;
+}
+
+bool am_draw_state::matches(am_render_state *rstate) {
+    return program == rstate->active_program
+        && same_viewport(&viewport_state, &rstate->active_viewport_state)
+        && same_scissor_test(&scissor_test_state, &rstate->active_scissor_test_state)
+        && same_color_mask(&color_mask_state, &rstate->active_color_mask_state)
+        && same_depth_test(&depth_test_state, &rstate->active_depth_test_state)
+        && same_stencil_test(&stencil_test_state, &rstate->active_stencil_test_state)
+        && same_cull_face(&cull_face_state, &rstate->active_cull_face_state)
+        && same_blend(&blend_state, &rstate->active_blend_state);
+}
+
 void am_render_state::enable_vaas(int n) {
     if (n > num_enabled_vaas) {
         for (int i = num_enabled_vaas; i < n; i++) {
@@ -569,21 +654,26 @@ static void setup(am_render_state *rstate, am_framebuffer_id fb,
     rstate->param_name_map[rstate->modelview_param_index].value.set_mat4(glm::dmat4(1.0));
 }
 
-void am_render_state::do_render(am_scene_node **roots, int num_roots, am_framebuffer_id fb,
+void am_render_state::do_render(lua_State *L, am_scene_node **roots, int num_roots, am_framebuffer_id fb,
     bool clear, glm::dvec4 clear_color, int stencil_clear_val, int x, int y, int w, int h, int fbw, int fbh,
     glm::dmat4 proj, bool has_depthbuffer)
 {
+    AM_PROFILE_ZONE("render");
+    lua_State *old_L = this->L;
+    this->L = L;
     setup(this, fb, clear, clear_color, stencil_clear_val, x, y, w, h, fbw, fbh, proj, has_depthbuffer);
 
     for (int i = 0; i < num_roots; i++) {
         am_scene_node *root = roots[i];
         if (root == NULL || am_node_hidden(root)) continue;
+        bool zone = am_profiler_enabled && am_profile_begin_node(root, true);
         next_pass = 1;
         do {
             pass = next_pass;
             pass_mask = 1;
             root->render(this);
         } while (next_pass > pass);
+        if (zone) am_profile_end();
     }
 
     // Unbind the current program, because it might be
@@ -594,6 +684,7 @@ void am_render_state::do_render(am_scene_node **roots, int num_roots, am_framebu
     am_gl_end_framebuffer_render();
 
     render_count++;
+    this->L = old_L;
 
     assert(active_program == NULL);
     assert(next_free_texture_unit == 0);
@@ -603,14 +694,20 @@ static bool check_pass(am_render_state *rstate) {
     return (rstate->pass & rstate->pass_mask);
 }
 
-void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_count) {
-    if (draw_array_count == 0) return;
+void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_count, int instances) {
+    if (draw_array_count == 0 || instances == 0) return;
     if (!check_pass(this)) { return; }
     if (active_program == NULL) {
         am_log1("%s", "WARNING: ignoring draw, "
             "because no shader program has been bound");
         return;
     }
+    if (recording != NULL) {
+        recording->record_draw(this, mode, first, draw_array_count, NULL, AM_ELEMENT_TYPE_USHORT, instances);
+    }
+    if (active_batch != NULL && active_batch->add(this, mode, first, draw_array_count, NULL, AM_ELEMENT_TYPE_USHORT, instances)) {
+        return;
+    }
     if (!update_state()) {
         // warning would already have been emitted
         return;
@@ -624,21 +721,27 @@ void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_c
         int count = max_draw_array_size - first;
         if (count > draw_array_count) count = draw_array_count;
         if (count > 0) {
-            am_draw_arrays(mode, first, count);
+            draw_instances(mode, first, count, NULL, AM_ELEMENT_TYPE_USHORT, instances);
         }
     }
 }
 
 void am_render_state::draw_elements(am_draw_mode mode, int first, int count,
-    am_buffer_view *indices_view, am_element_index_type type)
+    am_buffer_view *indices_view, am_element_index_type type, int instances)
 {
-    if (count == 0) return;
+    if (count == 0 || instances == 0) return;
     if (!check_pass(this)) return;
     if (active_program == NULL) {
         am_log1("%s", "WARNING: ignoring draw, "
             "because no shader program has been bound");
         return;
     }
+    if (recording != NULL) {
+        recording->record_draw(this, mode, first, count, indices_view, type, instances);
+    }
+    if (active_batch != NULL && active_batch->add(this, mode, first, count, indices_view, type, instances)) {
+        return;
+    }
     if (!update_state()) {
         // warning would already have been emitted
         return;
@@ -662,11 +765,90 @@ void am_render_state::draw_elements(am_draw_mode mode, int first, int count,
         }
         if (count > 0) {
             am_bind_buffer(AM_ELEMENT_ARRAY_BUFFER, indices_view->buffer->elembuf->get_latest_id());
-            am_draw_elements(mode, count, type, first * indices_view->stride);
+            draw_instances(mode, first * indices_view->stride, count, indices_view, type, instances);
         }
     }
 }
 
+static am_buffer_view *instanced_attribute_view(am_render_state *rstate, am_program_param *param) {
+    switch (param->type) {
+        case AM_PROGRAM_PARAM_ATTRIBUTE_1F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_2F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_3F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_4F: {
+            am_program_param_value *val = &rstate->param_name_map[param->name].value;
+            if (val->type == AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY && val->value.arr->divisor > 0) {
+                return val->value.arr;
+            }
+            return NULL;
+        }
+        default:
+            return NULL;
+    }
+}
+
+// Replace the per-instance attribute arrays with constant values
+// for the given instance.
+static void set_instance_attributes(am_render_state *rstate, int instance) {
+    am_program *prog = rstate->active_program;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        am_buffer_view *view = instanced_attribute_view(rstate, param);
+        if (view == NULL) continue;
+        am_view_type_info *info = &am_view_type_infos[view->type];
+        uint8_t *ptr = view->buffer->data + view->offset + (instance / view->divisor) * view->stride;
+        float v[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+        for (int c = 0; c < view->components; c++) {
+            v[c] = (float)info->num_reader(ptr + c * info->size);
+        }
+        am_set_attribute_array_enabled(param->location, false);
+        am_set_attribute4f(param->location, v);
+    }
+}
+
+// If indices_view is not NULL, first is the byte offset of the first index.
+void am_render_state::draw_instances(am_draw_mode mode, int first, int count,
+    am_buffer_view *indices_view, am_element_index_type type, int instances)
+{
+    if (instances > max_draw_instances) instances = max_draw_instances;
+    if (instances <= 0) return;
+    if (am_instancing_supported && (instances > 1 || instanced_attributes)) {
+        if (indices_view == NULL) {
+            am_draw_arrays_instanced(mode, first, count, instances);
+        } else {
+            am_draw_elements_instanced(mode, count, type, first, instances);
+        }
+        return;
+    }
+    // no instancing support, so draw each instance separately
+    for (int i = 0; i < instances; i++) {
+        if (instanced_attributes) {
+            set_instance_attributes(this, i);
+        }
+        if (indices_view == NULL) {
+            am_draw_arrays(mode, first, count);
+        } else {
+            am_draw_elements(mode, count, type, first);
+        }
+    }
+    if (instanced_attributes) {
+        for (int i = 0; i < active_program->num_params; i++) {
+            am_program_param *param = &active_program->params[i];
+            if (instanced_attribute_view(this, param) != NULL) {
+                am_set_attribute_array_enabled(param->location, true);
+            }
+        }
+    }
+}
+
+void am_render_state::set_attribute_divisor(am_gluint location, int divisor) {
+    if (location < AM_MAX_TRACKED_ATTRIBUTES) {
+        if (attribute_divisors[location] == divisor) return;
+        attribute_divisors[location] = divisor;
+    }
+    am_set_attribute_divisor(location, divisor);
+}
+
 bool am_render_state::validate_active_program(am_draw_mode mode) {
     if (mode == AM_DRAWMODE_POINTS && !active_program->sets_point_size) {
         // The value of gl_PointSize is undefined if it's not set
@@ -698,10 +880,16 @@ void am_render_state::bind_active_program() {
 
 bool am_render_state::bind_active_program_params() {
     max_draw_array_size = INT_MAX;
+    max_draw_instances = INT_MAX;
+    instanced_attributes = false;
     for (int i = 0; i < active_program->num_params; i++) {
         am_program_param *param = &active_program->params[i];
-        if (!param->bind(this)) return false;
+        if (!param->bind(this)) {
+            attributes_program = NULL;
+            return false;
+        }
     }
+    attributes_program = active_program;
     return true;
 }
 
@@ -711,6 +899,11 @@ am_render_state::am_render_state() {
     pass_mask = 1;
 
     max_draw_array_size = 0;
+    max_draw_instances = 0;
+    instanced_attributes = false;
+    for (int i = 0; i < AM_MAX_TRACKED_ATTRIBUTES; i++) {
+        attribute_divisors[i] = 0;
+    }
 
     num_enabled_vaas = 0;
     bound_program_id = 0;
@@ -725,11 +918,21 @@ am_render_state::am_render_state() {
     projection_param_index = -1;
 
     render_count = 0;
+    frame_count = 0;
+
+    draw_batch = NULL;
+    attributes_program = NULL;
+    active_batch = NULL;
+    recording = NULL;
+    L = NULL;
+    cull = NULL;
+    bounds = NULL;
 }
 
 am_draw_node::am_draw_node() {
     first = 0;
     count = INT_MAX;
+    instances = 1;
     mode = AM_DRAWMODE_TRIANGLES;
     type = AM_ELEMENT_TYPE_USHORT;
     indices_view = NULL;
@@ -768,6 +971,22 @@ static void set_draw_node_count(lua_State *L, void *obj) {
 
 static am_property draw_node_count_property = {get_draw_node_count, set_draw_node_count};
 
+static void get_draw_node_instances(lua_State *L, void *obj) {
+    am_draw_node *node = (am_draw_node*)obj;
+    lua_pushinteger(L, node->instances);
+}
+
+static void set_draw_node_instances(lua_State *L, void *obj) {
+    am_draw_node *node = (am_draw_node*)obj;
+    int instances = luaL_checkinteger(L, 3);
+    if (instances < 0) {
+        luaL_error(L, "value must be non-negative (in fact %d)", instances);
+    }
+    node->instances = instances;
+}
+
+static am_property draw_node_instances_property = {get_draw_node_instances, set_draw_node_instances};
+
 static void get_draw_node_primitive(lua_State *L, void *obj) {
     am_draw_node *node = (am_draw_node*)obj;
     am_push_enum(L, am_draw_mode, node->mode);
@@ -847,6 +1066,7 @@ static void register_draw_node_mt(lua_State *L) {
     am_register_property(L, "primitive", &draw_node_primitive_property);
     am_register_property(L, "first", &draw_node_first_property);
     am_register_property(L, "count", &draw_node_count_property);
+    am_register_property(L, "instances", &draw_node_instances_property);
     am_register_property(L, "elements", &draw_node_elements_property);
 
     am_register_metatable(L, "draw_node", MT_am_draw_node, MT_am_scene_node);
@@ -854,9 +1074,17 @@ static void register_draw_node_mt(lua_State *L) {
 
 void am_draw_node::render(am_render_state *rstate) {
     if (indices_view == NULL) {
-        rstate->draw_arrays(mode, first, count);
+        rstate->draw_arrays(mode, first, count, instances);
     } else {
-        rstate->draw_elements(mode, first, count, indices_view, type);
+        rstate->draw_elements(mode, first, count, indices_view, type, instances);
+    }
+    if (rstate->bounds != NULL) {
+        if (instances == 1) {
+            am_bounds_add_draw(rstate);
+        } else {
+            // instances are typically positioned by per-instance attributes
+            am_bounds_unbounded(rstate);
+        }
     }
 }
 
@@ -864,6 +1092,7 @@ static int create_draw_node(lua_State *L) {
     int nargs = am_check_nargs(L, 1);
     int first = 0;
     int count = INT_MAX;
+    int instances = 1;
     am_draw_mode mode = am_get_enum(L, am_draw_mode, 1);
     am_draw_node *node = am_new_userdata(L, am_draw_node);
     node->tags.push_back(L, AM_TAG_DRAW);
@@ -886,13 +1115,24 @@ static int create_draw_node(lua_State *L) {
         }
         nxt_arg++;
     }
+    if (nargs >= nxt_arg) {
+        instances = luaL_checkinteger(L, nxt_arg);
+        if (instances < 0) {
+            return luaL_error(L, "argument %d must be non-negative", nxt_arg);
+        }
+        nxt_arg++;
+    }
     node->first = first;
     node->count = count;
+    node->instances = instances;
     node->mode = mode;
     return 1;
 }
 
 void am_pass_filter_node::render(am_render_state *rstate) {
+    // this has an effect even in passes where the children aren't
+    // rendered, so it can't be culled
+    am_bounds_unbounded(rstate);
     if (rstate->pass & mask) {
         uint32_t old = rstate->pass_mask;
         rstate->pass_mask = rstate->pass;
@@ -936,6 +1176,7 @@ static void init_param_name_map(am_render_state *rstate, lua_State *L) {
     for (int i = 0; i < rstate->param_name_map_capacity; i++) {
         rstate->param_name_map[i].name = NULL;
         rstate->param_name_map[i].value.type = AM_PROGRAM_PARAM_CLIENT_TYPE_UNDEFINED;
+        rstate->param_name_map[i].value.version = 0;
     }
     lua_newtable(L);
     lua_rawseti(L, LUA_REGISTRYINDEX, AM_PARAM_NAME_STRING_TABLE);
@@ -981,6 +1222,9 @@ void am_open_renderer_module(lua_State *L) {
             free(am_global_render_state->param_name_map);
             am_global_render_state->param_name_map = NULL;
         }
+        if (am_global_render_state->draw_batch != NULL) {
+            delete am_global_render_state->draw_batch;
+        }
         delete am_global_render_state;
         am_global_render_state = NULL;
     }
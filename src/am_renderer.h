@@ -2,6 +2,14 @@ struct am_program;
 struct am_program_param;
 struct am_program_param_name_slot;
 struct am_program_param_value;
+struct am_draw_batch;
+struct am_command_list;
+struct am_cull_context;
+struct am_bounds_frame;
+
+// Vertex attribute locations whose divisors are tracked by
+// am_render_state::set_attribute_divisor.
+#define AM_MAX_TRACKED_ATTRIBUTES 32
 
 struct am_viewport_state {
     int                     x;
@@ -156,6 +164,22 @@ struct am_dither_state {
     bool                    enabled;
 };
 
+// The render state that affects a draw, other than program params.
+struct am_draw_state {
+    am_program              *program;
+    am_viewport_state       viewport_state;
+    am_scissor_test_state   scissor_test_state;
+    am_color_mask_state     color_mask_state;
+    am_depth_test_state     depth_test_state;
+    am_stencil_test_state   stencil_test_state;
+    am_cull_face_state      cull_face_state;
+    am_blend_state          blend_state;
+
+    void capture(am_render_state *rstate);
+    void install(am_render_state *rstate);
+    bool matches(am_render_state *rstate);
+};
+
 struct am_render_state {
     uint32_t                pass;
     uint32_t                next_pass;
@@ -177,10 +201,14 @@ struct am_render_state {
     am_blend_state          active_blend_state;
 
     int                     max_draw_array_size;
+    int                     max_draw_instances;
+    bool                    instanced_attributes; // true if any bound attribute array is per-instance
+    int                     attribute_divisors[AM_MAX_TRACKED_ATTRIBUTES];
 
     int                     num_enabled_vaas; // num enabled vertex attribute arrays
     am_program_id           bound_program_id;
     am_program              *active_program;
+    am_program              *attributes_program; // program whose attribute pointers are set (or NULL)
     int                     param_name_map_capacity;
     am_program_param_name_slot *param_name_map;
 
@@ -190,18 +218,29 @@ struct am_render_state {
     int                     projection_param_index;
 
     uint32_t                render_count;
+    uint32_t                frame_count; // incremented once all the windows have been drawn
+
+    am_draw_batch           *draw_batch;
+    am_draw_batch           *active_batch; // non-NULL inside a sprite_batch node
+    am_command_list         *recording; // non-NULL while a cached_group is recording
+    lua_State               *L; // the state that called do_render
+    am_cull_context         *cull; // non-NULL inside an auto_cull node
+    am_bounds_frame         *bounds; // bounds being computed for the current subtree (or NULL)
 
     am_render_state();
 
-    void draw_arrays(am_draw_mode mode, int first, int count);
+    void draw_arrays(am_draw_mode mode, int first, int count, int instances);
     void draw_elements(am_draw_mode mode, int first, int count,
-        am_buffer_view *indices_view, am_element_index_type type);
+        am_buffer_view *indices_view, am_element_index_type type, int instances);
+    void draw_instances(am_draw_mode mode, int first, int count,
+        am_buffer_view *indices_view, am_element_index_type type, int instances);
+    void set_attribute_divisor(am_gluint location, int divisor);
     bool validate_active_program(am_draw_mode mode);
     void bind_active_program();
     bool bind_active_program_params();
     bool update_state();
     void enable_vaas(int n);
-    void do_render(am_scene_node **roots, int num_roots, am_framebuffer_id fb, 
+    void do_render(lua_State *L, am_scene_node **roots, int num_roots, am_framebuffer_id fb,
         bool clear, glm::dvec4 clear_color, int stencil_clear_val,
         int x, int y, int w, int h, int fbw, int fbh, glm::dmat4 proj, bool has_depthbuffer);
 };
@@ -209,6 +248,7 @@ struct am_render_state {
 struct am_draw_node : am_scene_node {
     int first;
     int count;
+    int instances;
     am_draw_mode mode;
     am_element_index_type type;
     am_buffer_view *indices_view;
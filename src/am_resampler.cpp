@@ -0,0 +1,182 @@
+#include "amulet.h"
+
+// Each quality has a filter for each of these bands. Band b has a cutoff
+// of 2^(-b/8) times the source's nyquist frequency, so sources can be
+// read up to 4 times faster than the output rate without aliasing.
+#define AM_RESAMPLE_BANDS 17
+#define AM_RESAMPLE_BANDS_PER_OCTAVE 8
+
+#define AM_RESAMPLE_MAX_TAPS 128
+
+struct resample_filter_spec {
+    int taps;          // number of taps at the full cutoff
+    int phase_bits;    // log2 of the number of phases
+    double rolloff;    // cutoff as a fraction of the nyquist frequency
+    double beta;       // kaiser window parameter
+};
+
+static const resample_filter_spec filter_specs[AM_NUM_RESAMPLE_QUALITIES] = {
+    {0, 0, 0.0, 0.0},       // linear
+    {8, 6, 0.85, 6.0},      // medium
+    {32, 7, 0.94, 9.0},     // high
+};
+
+struct resample_filter {
+    int taps;
+    // taps coefficients for each of the (1 << phase_bits) + 1 phases.
+    // Phase p is for positions p / (1 << phase_bits) of the way between
+    // two source samples.
+    float *coeffs;
+};
+
+static resample_filter filters[AM_NUM_RESAMPLE_QUALITIES][AM_RESAMPLE_BANDS];
+
+bool am_parse_resample_quality(const char *name, am_resample_quality *quality) {
+    if (strcmp(name, "linear") == 0) {
+        *quality = AM_RESAMPLE_LINEAR;
+    } else if (strcmp(name, "medium") == 0) {
+        *quality = AM_RESAMPLE_MEDIUM;
+    } else if (strcmp(name, "high") == 0) {
+        *quality = AM_RESAMPLE_HIGH;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// zeroth order modified bessel function of the first kind
+static double bessel_i0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    double y = x * x * 0.25;
+    for (int k = 1; k < 50; k++) {
+        term *= y / ((double)k * (double)k);
+        sum += term;
+        if (term < sum * 1e-12) break;
+    }
+    return sum;
+}
+
+static void build_filter(resample_filter *filter, const resample_filter_spec *spec, double band_cutoff) {
+    int taps = (int)ceil((double)spec->taps / band_cutoff);
+    taps = am_min((taps + 7) & ~7, AM_RESAMPLE_MAX_TAPS);
+    int half = taps / 2;
+    int num_phases = 1 << spec->phase_bits;
+    double cutoff = spec->rolloff * band_cutoff;
+    double i0_beta = bessel_i0(spec->beta);
+    float *coeffs = (float*)malloc(sizeof(float) * taps * (num_phases + 1));
+    for (int p = 0; p <= num_phases; p++) {
+        double frac = (double)p / (double)num_phases;
+        float *row = coeffs + p * taps;
+        double sum = 0.0;
+        double h[AM_RESAMPLE_MAX_TAPS];
+        for (int k = 0; k < taps; k++) {
+            // tap k is applied to the source sample k - (half - 1) samples
+            // from the one before the position
+            double t = (double)(k - (half - 1)) - frac;
+            double u = t / (double)half;
+            double w = u * u < 1.0 ? bessel_i0(spec->beta * sqrt(1.0 - u * u)) / i0_beta : 0.0;
+            double x = AM_PI * cutoff * t;
+            double sinc = fabs(x) < 1e-9 ? 1.0 : sin(x) / x;
+            h[k] = cutoff * sinc * w;
+            sum += h[k];
+        }
+        // unity gain at dc for every phase
+        for (int k = 0; k < taps; k++) {
+            row[k] = (float)(h[k] / sum);
+        }
+    }
+    filter->taps = taps;
+    filter->coeffs = coeffs;
+}
+
+void am_init_resampler(am_resample_quality quality) {
+    const resample_filter_spec *spec = &filter_specs[quality];
+    if (spec->taps == 0 || filters[quality][0].coeffs != NULL) return;
+    for (int b = 0; b < AM_RESAMPLE_BANDS; b++) {
+        double band_cutoff = pow(2.0, -(double)b / (double)AM_RESAMPLE_BANDS_PER_OCTAVE);
+        build_filter(&filters[quality][b], spec, band_cutoff);
+    }
+}
+
+// Picks the band whose cutoff is closest to the output's nyquist frequency
+// (in source samples) when reading step samples per output sample.
+static int band_for_step(am_resample_pos step) {
+    if (step <= AM_RESAMPLE_ONE) return 0;
+    double octaves = log2(am_resample_pos_to_samples(step));
+    int band = (int)(octaves * AM_RESAMPLE_BANDS_PER_OCTAVE + 0.5);
+    return am_min(band, AM_RESAMPLE_BANDS - 1);
+}
+
+// Returns the fraction of the way from the source sample at pos to the next.
+static inline float pos_frac(am_resample_pos pos) {
+    return (float)(uint32_t)pos * (1.0f / (float)AM_RESAMPLE_ONE);
+}
+
+int am_resample(am_resample_quality quality, const float *src, int len, bool loop,
+    am_resample_pos *pos, am_resample_pos step, int64_t step_delta, float *out, int n)
+{
+    if (len <= 0 || n <= 0) return 0;
+    am_resample_pos end = (am_resample_pos)len << AM_RESAMPLE_FRAC_BITS;
+    am_resample_pos p = *pos;
+    int i = 0;
+    if (quality == AM_RESAMPLE_LINEAR || filters[quality][0].coeffs == NULL) {
+        for (; i < n; i++) {
+            if (p >= end) {
+                if (!loop) break;
+                p %= end;
+            }
+            int idx = (int)(p >> AM_RESAMPLE_FRAC_BITS);
+            float x0 = src[idx];
+            float x1 = idx + 1 < len ? src[idx + 1] : (loop ? src[0] : 0.0f);
+            out[i] = x0 + pos_frac(p) * (x1 - x0);
+            p += step;
+            step += (am_resample_pos)step_delta;
+        }
+    } else {
+        // Use the filter for the fastest speed in this call. The speed
+        // only ramps over a few hundred samples, so using a lower cutoff
+        // than needed for some of them isn't noticeable.
+        am_resample_pos last_step = step + (am_resample_pos)(step_delta * (int64_t)(n - 1));
+        resample_filter *filter = &filters[quality][band_for_step(am_max(step, last_step))];
+        int taps = filter->taps;
+        int half = taps / 2;
+        int phase_bits = filter_specs[quality].phase_bits;
+        am_mathv_f32_fir_op fir = am_mathv_f32.fir;
+        float window[AM_RESAMPLE_MAX_TAPS];
+        for (; i < n; i++) {
+            if (p >= end) {
+                if (!loop) break;
+                p %= end;
+            }
+            int idx = (int)(p >> AM_RESAMPLE_FRAC_BITS);
+            uint32_t frac = (uint32_t)p;
+            const float *row = filter->coeffs + (frac >> (32 - phase_bits)) * taps;
+            float t = pos_frac((am_resample_pos)(uint32_t)(frac << phase_bits));
+            int first = idx - (half - 1);
+            const float *x;
+            if (first >= 0 && first + taps <= len) {
+                x = src + first;
+            } else {
+                // the filter overlaps the start or end of the source
+                for (int k = 0; k < taps; k++) {
+                    int j = first + k;
+                    if (loop) {
+                        j %= len;
+                        if (j < 0) j += len;
+                        window[k] = src[j];
+                    } else {
+                        window[k] = (j >= 0 && j < len) ? src[j] : 0.0f;
+                    }
+                }
+                x = window;
+            }
+            out[i] = fir(x, row, row + taps, t, taps);
+            p += step;
+            step += (am_resample_pos)step_delta;
+        }
+    }
+    if (loop && p >= end) p %= end;
+    *pos = p;
+    return i;
+}
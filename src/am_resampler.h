@@ -0,0 +1,48 @@
+// Sample rate conversion for audio buffers.
+//
+// Used to play tracks and voices at other speeds or sample rates and to
+// convert files to the output sample rate when they're loaded.
+//
+// Positions in the source are 32.32 fixed point numbers of samples, so
+// they don't drift however long a buffer plays. The medium and high
+// qualities use polyphase windowed-sinc filters. When the source is read
+// faster than one sample per output sample the filter's cutoff is lowered
+// to match, which stops high pitched voices from aliasing.
+
+enum am_resample_quality {
+    AM_RESAMPLE_LINEAR,
+    AM_RESAMPLE_MEDIUM,
+    AM_RESAMPLE_HIGH,
+};
+
+#define AM_NUM_RESAMPLE_QUALITIES 3
+
+typedef uint64_t am_resample_pos;
+
+#define AM_RESAMPLE_FRAC_BITS 32
+#define AM_RESAMPLE_ONE ((am_resample_pos)1 << AM_RESAMPLE_FRAC_BITS)
+
+static inline am_resample_pos am_resample_pos_from_samples(double samples) {
+    if (samples <= 0.0) return 0;
+    return (am_resample_pos)(samples * (double)AM_RESAMPLE_ONE + 0.5);
+}
+
+static inline double am_resample_pos_to_samples(am_resample_pos pos) {
+    return (double)pos / (double)AM_RESAMPLE_ONE;
+}
+
+// Returns false if name isn't "linear", "medium" or "high".
+bool am_parse_resample_quality(const char *name, am_resample_quality *quality);
+
+// Builds the filters for a quality, if they haven't already been built.
+// This must be called on the main thread before the quality is used.
+void am_init_resampler(am_resample_quality quality);
+
+// Writes up to n resampled samples of src (which has len samples) to out,
+// starting at *pos. *pos is advanced by step after each output sample and
+// step is advanced by step_delta, so the speed can ramp within a call.
+// If loop is true src repeats, otherwise it's silent outside [0, len) and
+// fewer than n samples are written if the end of src is reached.
+// Returns the number of samples written.
+int am_resample(am_resample_quality quality, const float *src, int len, bool loop,
+    am_resample_pos *pos, am_resample_pos step, int64_t step_delta, float *out, int n);
@@ -37,8 +37,11 @@ typedef enum {
     MT_am_cull_face_node,
     MT_am_cull_sphere_node,
     MT_am_cull_box_node,
+    MT_am_auto_cull_node,
     MT_am_draw_node,
     MT_am_pass_filter_node,
+    MT_am_sprite_batch_node,
+    MT_am_cached_group_node,
     MT_tag_search_result,
 
     MT_am_audio_buffer,
@@ -48,9 +51,11 @@ typedef enum {
     MT_am_highpass_filter_node,
     MT_am_audio_track_node,
     MT_am_audio_stream_node,
+    MT_am_voice_pool_node,
     MT_am_oscillator_node,
     MT_am_spectrum_node,
     MT_am_capture_node,
+    MT_am_audio_loader,
 
     MT_am_buffer_data_allocator,
     MT_am_buffer,
@@ -87,6 +92,12 @@ typedef enum {
 
     MT_am_rand,
 
+    MT_am_mathv_expr,
+
+    MT_am_particles2d,
+
+    MT_am_quad_batch,
+
     MT_am_iap_product,
 
     MT_am_webview,
@@ -18,10 +18,17 @@ am_tag AM_TAG_DEPTH_TEST;
 am_tag AM_TAG_STENCIL_TEST;
 am_tag AM_TAG_CULL_SPHERE;
 am_tag AM_TAG_CULL_BOX;
+am_tag AM_TAG_AUTO_CULL;
 am_tag AM_TAG_READ_UNIFORM;
+am_tag AM_TAG_SPRITE_BATCH;
+am_tag AM_TAG_CACHED_GROUP;
+
+uint32_t am_scene_generation = 1;
 
 static am_tag lookup_tag(lua_State *L, int name_idx);
+static void remove_parent(am_scene_node *child, am_scene_node *parent);
 static am_scene_node *find_tag(am_scene_node *node, am_tag tag, am_scene_node **parent);
+static am_scene_node *lookup_tagged_node(am_scene_node *node, am_tag tag, am_scene_node **parent);
 
 am_scene_node::am_scene_node() {
     children.owner = this;
@@ -30,15 +37,81 @@ am_scene_node::am_scene_node() {
     flags = 0;
     actions_ref = LUA_NOREF;
     action_seq = 0;
+    subtree_gen = am_scene_generation;
+    structure_gen = am_scene_generation;
+    parents = NULL;
+    num_parents = 0;
+    parents_capacity = 0;
+    bounds = NULL;
+}
+
+// Change tracking
+
+void am_node_changed(am_scene_node *node) {
+    // If the node already has the current generation then so do all
+    // its ancestors (a parent's generation is never less than its
+    // children's). This also stops us looping on cycles.
+    if (node->subtree_gen == am_scene_generation) return;
+    node->subtree_gen = am_scene_generation;
+    for (int i = 0; i < node->num_parents; i++) {
+        am_node_changed(node->parents[i]);
+    }
+}
+
+void am_node_structure_changed(am_scene_node *node) {
+    if (node->structure_gen == am_scene_generation) return;
+    node->structure_gen = am_scene_generation;
+    node->subtree_gen = am_scene_generation;
+    for (int i = 0; i < node->num_parents; i++) {
+        am_node_structure_changed(node->parents[i]);
+    }
+}
+
+uint32_t am_begin_scene_generation() {
+    return am_scene_generation++;
+}
+
+void am_node_child_added(am_scene_node *parent, am_scene_node *child) {
+    if (child->num_parents >= child->parents_capacity) {
+        child->parents_capacity = child->parents_capacity == 0 ? 1 : child->parents_capacity * 2;
+        child->parents = (am_scene_node**)realloc(child->parents,
+            sizeof(am_scene_node*) * child->parents_capacity);
+    }
+    child->parents[child->num_parents++] = parent;
+    am_node_structure_changed(parent);
+}
+
+static void remove_parent(am_scene_node *child, am_scene_node *parent) {
+    for (int i = 0; i < child->num_parents; i++) {
+        if (child->parents[i] == parent) {
+            child->parents[i] = child->parents[child->num_parents - 1];
+            child->num_parents--;
+            return;
+        }
+    }
+}
+
+void am_node_child_removed(am_scene_node *parent, am_scene_node *child) {
+    remove_parent(child, parent);
+    am_node_structure_changed(parent);
 }
 
 void am_scene_node::render_children(am_render_state *rstate) {
-    if (recursion_limit < 0) return;
+    if (recursion_limit < 0) {
+        am_bounds_unbounded(rstate);
+        return;
+    }
     recursion_limit--;
     for (int i = 0; i < children.size; i++) {
         am_scene_node *child = children.arr[i].child;
         if (!am_node_hidden(child)) {
-            child->render(rstate);
+            bool zone = am_profiler_enabled && am_profile_begin_node(child, true);
+            if (rstate->cull != NULL) {
+                am_render_culled(rstate, child);
+            } else {
+                child->render(rstate);
+            }
+            if (zone) am_profile_end();
         }
     }
     recursion_limit++;
@@ -53,9 +126,39 @@ int am_scene_node_index(lua_State *L) {
 }
 
 int am_scene_node_newindex(lua_State *L) {
+    am_node_changed((am_scene_node*)lua_touserdata(L, 1));
     return am_default_newindex_func(L);
 }
 
+static void unlink_children(am_scene_node *node) {
+    // The children may be being collected in the same cycle, in which
+    // case their parent lists would already have been freed.
+    for (int i = 0; i < node->children.size; i++) {
+        am_scene_node *child = node->children.arr[i].child;
+        if (child->parents != NULL) remove_parent(child, node);
+    }
+}
+
+static void free_parents(am_scene_node *node) {
+    if (node->parents != NULL) {
+        free(node->parents);
+        node->parents = NULL;
+    }
+    node->num_parents = 0;
+    node->parents_capacity = 0;
+}
+
+int am_scene_node_gc(lua_State *L) {
+    am_scene_node *node = (am_scene_node*)lua_touserdata(L, 1);
+    unlink_children(node);
+    free_parents(node);
+    if (node->bounds != NULL) {
+        free(node->bounds);
+        node->bounds = NULL;
+    }
+    return 0;
+}
+
 static int append_child(lua_State *L) {
     am_check_nargs(L, 2);
     am_scene_node *parent = am_get_userdata(L, am_scene_node, 1);
@@ -64,6 +167,7 @@ static int append_child(lua_State *L) {
     child_slot.child = child;
     child_slot.ref = parent->ref(L, 2); // ref from parent to child
     parent->children.push_back(L, child_slot);
+    am_node_child_added(parent, child);
     lua_pushvalue(L, 1); // for chaining
     return 1;
 }
@@ -76,6 +180,7 @@ static int prepend_child(lua_State *L) {
     child_slot.child = child;
     child_slot.ref = parent->ref(L, 2); // ref from parent to child
     parent->children.push_front(L, child_slot);
+    am_node_child_added(parent, child);
     lua_pushvalue(L, 1); // for chaining
     return 1;
 }
@@ -86,7 +191,7 @@ static int remove(lua_State *L) {
     am_scene_node *child;
     if (lua_type(L, 2) == LUA_TSTRING) {
         am_tag tag = lookup_tag(L, 2);
-        child = find_tag(parent, tag, &parent);
+        child = lookup_tagged_node(parent, tag, &parent);
         if (child == NULL || parent == NULL) {
             goto end;
         }
@@ -97,6 +202,7 @@ static int remove(lua_State *L) {
         if (parent->children.arr[i].child == child) {
             parent->unref(L, parent->children.arr[i].ref);
             parent->children.remove(i);
+            am_node_child_removed(parent, child);
             break;
         }
     }
@@ -112,7 +218,7 @@ static int replace(lua_State *L) {
     am_scene_node *new_child;
     if (lua_type(L, 2) == LUA_TSTRING) {
         am_tag tag = lookup_tag(L, 2);
-        old_child = find_tag(parent, tag, &parent);
+        old_child = lookup_tagged_node(parent, tag, &parent);
         if (old_child == NULL || parent == NULL) {
             goto end;
         }
@@ -128,6 +234,8 @@ static int replace(lua_State *L) {
             slot.child = new_child;
             slot.ref = parent->ref(L, 3);
             parent->children.insert(L, i, slot);
+            am_node_child_removed(parent, old_child);
+            am_node_child_added(parent, new_child);
             break;
         }
     }
@@ -140,8 +248,10 @@ static int remove_all(lua_State *L) {
     am_check_nargs(L, 1);
     am_scene_node *parent = am_get_userdata(L, am_scene_node, 1);
     for (int i = parent->children.size-1; i >= 0; i--) {
+        am_scene_node *child = parent->children.arr[i].child;
         parent->unref(L, parent->children.arr[i].ref);
         parent->children.remove(i);
+        am_node_child_removed(parent, child);
     }
     assert(parent->children.size == 0);
     lua_pushvalue(L, 1); // for chaining
@@ -165,6 +275,7 @@ static int create_group_node(lua_State *L) {
             child_slot.child = child;
             child_slot.ref = node->ref(L, -1); // ref from node to child
             node->children.push_back(L, child_slot);
+            am_node_child_added(node, child);
             lua_pop(L, 1); // child
             i++;
         } while (true);
@@ -175,6 +286,7 @@ static int create_group_node(lua_State *L) {
             child_slot.child = child;
             child_slot.ref = node->ref(L, i+1); // ref from node to child
             node->children.push_back(L, child_slot);
+            am_node_child_added(node, child);
         }
     }
     return 1;
@@ -196,6 +308,7 @@ static void add_chain_children(lua_State *L, am_scene_node *parent) {
             child_slot.child = child;
             child_slot.ref = parent->ref(L, -1); // ref from parent to child
             parent->children.push_back(L, child_slot);
+            am_node_child_added(parent, child);
             lua_pop(L, 1); // child
             i++;
         } while (true);
@@ -205,6 +318,7 @@ static void add_chain_children(lua_State *L, am_scene_node *parent) {
         child_slot.child = child;
         child_slot.ref = parent->ref(L, 2); // ref from parent to child
         parent->children.push_back(L, child_slot);
+        am_node_child_added(parent, child);
     }
 }
 
@@ -290,6 +404,9 @@ static int chain(lua_State *L) {
 // Wrap nodes
 
 void am_wrap_node::render(am_render_state *rstate) {
+    // this renders different things depending on where it's
+    // reached from, so it can't have one set of bounds
+    am_bounds_unbounded(rstate);
     if (inside) {
         inside = false;
         render_children(rstate);
@@ -312,6 +429,7 @@ static int create_wrap_node(lua_State *L) {
     node->wrapped = am_get_userdata(L, am_scene_node, 1);
     node->wrapped_ref = node->ref(L, 1);
     node->inside = false;
+    am_node_child_added(node, node->wrapped);
 
     chain_leaves(L, node->wrapped);
     unmark_all(node->wrapped);
@@ -319,8 +437,16 @@ static int create_wrap_node(lua_State *L) {
     return 1;
 }
 
+static int gc_wrap_node(lua_State *L) {
+    am_wrap_node *node = (am_wrap_node*)lua_touserdata(L, 1);
+    if (node->wrapped->parents != NULL) remove_parent(node->wrapped, node);
+    return am_scene_node_gc(L);
+}
+
 static void register_wrap_node_mt(lua_State *L) {
     lua_newtable(L);
+    lua_pushcclosure(L, gc_wrap_node, 0);
+    lua_setfield(L, -2, "__gc");
     am_register_metatable(L, "wrap_node", MT_am_wrap_node, MT_am_scene_node);
 }
 
@@ -382,6 +508,10 @@ static am_tag lookup_tag(lua_State *L, int name_idx) {
     }
 }
 
+am_tag am_lookup_tag(lua_State *L, int name_idx) {
+    return lookup_tag(L, name_idx);
+}
+
 static int tag(lua_State *L) {
     am_check_nargs(L, 2);
     am_scene_node *node = am_get_userdata(L, am_scene_node, 1);
@@ -389,6 +519,7 @@ static int tag(lua_State *L) {
         return luaL_error(L, "expecting a string in position 2");
     }
     node->tags.push_back(L, lookup_tag(L, 2));
+    am_node_structure_changed(node);
     lua_pushvalue(L, 1);
     return 1;
 }
@@ -401,6 +532,7 @@ static int untag(lua_State *L) {
     }
     am_tag tag = lookup_tag(L, 2);
     node->tags.remove_all(tag);
+    am_node_structure_changed(node);
     lua_pushvalue(L, 1);
     return 1;
 }
@@ -434,6 +566,157 @@ static am_scene_node *find_tag(am_scene_node *node, am_tag tag, am_scene_node **
     return found;
 }
 
+// Tag index.
+//
+// Searching a subtree for a tag is a depth first walk over the whole
+// subtree, which gets expensive when done every frame on a big scene.
+// For subtrees whose structure isn't changing we keep an index of all
+// the tagged nodes (in the order the walk would find them), so
+// lookups become a binary search. The index for a root is only built the
+// second time it's searched without an intervening structural change,
+// so trees that are modified every frame don't pay to rebuild it.
+
+struct am_tag_index_entry {
+    am_tag tag;
+    bool nested; // an ancestor (on the path it was found) has the same tag
+    int seq;
+    am_scene_node *node;
+    am_scene_node *parent;
+};
+
+struct am_tag_index {
+    am_scene_node *root;
+    uint32_t gen;
+    bool built;
+    am_tag_index_entry *entries;
+    int size;
+    int capacity;
+};
+
+#define AM_MAX_TAG_INDEXES 8
+
+static am_tag_index tag_indexes[AM_MAX_TAG_INDEXES];
+static int next_tag_index = 0;
+
+// number of nodes with each tag on the current path during indexing
+static int *tag_nesting = NULL;
+static int tag_nesting_capacity = 0;
+
+static void index_tags(am_scene_node *node, am_scene_node *parent, am_tag_index *index) {
+    if (am_node_marked(node)) return;
+    am_mark_node(node);
+    for (int i = 0; i < node->tags.size; i++) {
+        am_tag tag = node->tags.arr[i];
+        bool dup = false;
+        for (int j = 0; j < i; j++) {
+            if (node->tags.arr[j] == tag) {
+                dup = true;
+                break;
+            }
+        }
+        if (dup) continue;
+        if (index->size >= index->capacity) {
+            index->capacity = index->capacity == 0 ? 32 : index->capacity * 2;
+            index->entries = (am_tag_index_entry*)realloc(index->entries,
+                sizeof(am_tag_index_entry) * index->capacity);
+        }
+        am_tag_index_entry *entry = &index->entries[index->size];
+        entry->tag = tag;
+        entry->nested = tag_nesting[tag] > 0;
+        entry->seq = index->size;
+        entry->node = node;
+        entry->parent = parent;
+        index->size++;
+    }
+    for (int i = 0; i < node->tags.size; i++) {
+        tag_nesting[node->tags.arr[i]]++;
+    }
+    for (int i = 0; i < node->children.size; i++) {
+        index_tags(node->children.arr[i].child, node, index);
+    }
+    for (int i = 0; i < node->tags.size; i++) {
+        tag_nesting[node->tags.arr[i]]--;
+    }
+    am_unmark_node(node);
+}
+
+static int compare_tag_index_entries(const void *a, const void *b) {
+    const am_tag_index_entry *e1 = (const am_tag_index_entry*)a;
+    const am_tag_index_entry *e2 = (const am_tag_index_entry*)b;
+    if (e1->tag != e2->tag) return (int)e1->tag - (int)e2->tag;
+    return e1->seq - e2->seq;
+}
+
+static void build_tag_index(am_tag_index *index) {
+    if (tag_nesting_capacity < next_tag) {
+        tag_nesting = (int*)realloc(tag_nesting, sizeof(int) * next_tag);
+        memset(tag_nesting + tag_nesting_capacity, 0,
+            sizeof(int) * (next_tag - tag_nesting_capacity));
+        tag_nesting_capacity = next_tag;
+    }
+    index->gen = am_begin_scene_generation();
+    index->size = 0;
+    index_tags(index->root, NULL, index);
+    qsort(index->entries, index->size, sizeof(am_tag_index_entry), compare_tag_index_entries);
+    index->built = true;
+}
+
+// Returns NULL if there's no up-to-date index for root, in which
+// case the caller should search the tree.
+static am_tag_index *get_tag_index(am_scene_node *root) {
+    for (int i = 0; i < AM_MAX_TAG_INDEXES; i++) {
+        am_tag_index *index = &tag_indexes[i];
+        if (index->root == root) {
+            if (am_structure_changed_since(root, index->gen)) {
+                index->built = false;
+                index->gen = am_begin_scene_generation();
+                return NULL;
+            }
+            if (!index->built) {
+                build_tag_index(index);
+            }
+            return index;
+        }
+    }
+    am_tag_index *index = &tag_indexes[next_tag_index];
+    next_tag_index = (next_tag_index + 1) % AM_MAX_TAG_INDEXES;
+    index->root = root;
+    index->built = false;
+    index->gen = am_begin_scene_generation();
+    return NULL;
+}
+
+static am_tag_index_entry *find_tag_index_entries(am_tag_index *index, am_tag tag, int *count) {
+    int lo = 0;
+    int hi = index->size;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (index->entries[mid].tag < tag) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    int n = 0;
+    while (lo + n < index->size && index->entries[lo + n].tag == tag) {
+        n++;
+    }
+    *count = n;
+    return &index->entries[lo];
+}
+
+static am_scene_node *lookup_tagged_node(am_scene_node *node, am_tag tag, am_scene_node **parent) {
+    am_tag_index *index = get_tag_index(node);
+    if (index == NULL) {
+        return find_tag(node, tag, parent);
+    }
+    int count;
+    am_tag_index_entry *entries = find_tag_index_entries(index, tag, &count);
+    if (count == 0) return NULL;
+    *parent = entries[0].parent;
+    return entries[0].node;
+}
+
 static int search_tag(lua_State *L) {
     am_check_nargs(L, 2);
     am_scene_node *node = am_get_userdata(L, am_scene_node, 1);
@@ -442,7 +725,7 @@ static int search_tag(lua_State *L) {
     }
     am_tag tag = lookup_tag(L, 2);
     am_scene_node *parent;
-    am_scene_node *found = find_tag(node, tag, &parent);
+    am_scene_node *found = lookup_tagged_node(node, tag, &parent);
     if (found == NULL) {
         lua_pushnil(L);
         lua_pushnil(L);
@@ -489,8 +772,22 @@ static int search_all_tags(lua_State *L) {
     lua_newtable(L);
     am_push_metatable(L, MT_tag_search_result);
     lua_setmetatable(L, -2);
+    int t = am_absindex(L, -1);
     int i = 1;
-    find_all_tags(L, node, tag, &i, am_absindex(L, -1), recurse);
+    am_tag_index *index = get_tag_index(node);
+    if (index == NULL) {
+        find_all_tags(L, node, tag, &i, t, recurse);
+    } else {
+        int count;
+        am_tag_index_entry *entries = find_tag_index_entries(index, tag, &count);
+        for (int j = 0; j < count; j++) {
+            if (recurse || !entries[j].nested) {
+                entries[j].node->push(L);
+                lua_rawseti(L, t, i);
+                i++;
+            }
+        }
+    }
     return 1;
 }
 
@@ -567,9 +864,21 @@ static void init_default_tags(lua_State *L) {
     AM_TAG_CULL_BOX = lookup_tag(L, -1);
     lua_pop(L, 1);
 
+    lua_pushstring(L, "auto_cull");
+    AM_TAG_AUTO_CULL = lookup_tag(L, -1);
+    lua_pop(L, 1);
+
     lua_pushstring(L, "read_uniform");
     AM_TAG_READ_UNIFORM = lookup_tag(L, -1);
     lua_pop(L, 1);
+
+    lua_pushstring(L, "sprite_batch");
+    AM_TAG_SPRITE_BATCH = lookup_tag(L, -1);
+    lua_pop(L, 1);
+
+    lua_pushstring(L, "cached_group");
+    AM_TAG_CACHED_GROUP = lookup_tag(L, -1);
+    lua_pop(L, 1);
 }
 
 // Other stuff
@@ -666,6 +975,7 @@ static void set_actions(lua_State *L, void *obj) {
     } else {
         node->reref(L, node->actions_ref, 3);
     }
+    am_node_structure_changed(node);
 }
 
 static am_property actions_property = {get_actions, set_actions};
@@ -679,6 +989,8 @@ static void register_scene_node_mt(lua_State *L) {
     lua_setfield(L, -2, "__newindex");
     lua_pushcclosure(L, chain, 0);
     lua_setfield(L, -2, "__pow");
+    lua_pushcclosure(L, am_scene_node_gc, 0);
+    lua_setfield(L, -2, "__gc");
 
     lua_pushcclosure(L, child_pairs, 0);
     lua_setfield(L, -2, "child_pairs");
@@ -701,6 +1013,8 @@ static void register_scene_node_mt(lua_State *L) {
     lua_setfield(L, -2, "replace");
     lua_pushcclosure(L, remove_all, 0);
     lua_setfield(L, -2, "remove_all");
+    lua_pushcclosure(L, am_compile_scene_node, 0);
+    lua_setfield(L, -2, "compile");
 
     lua_pushcclosure(L, search_tag, 0);
     lua_setfield(L, -2, "__call");
@@ -7,10 +7,12 @@
 #define am_unmark_node(node)        node->flags &= ~AM_NODE_FLAG_MARK
 #define am_node_hidden(node)        (node->flags & AM_NODE_FLAG_HIDDEN)
 #define am_set_node_hidden(node, hidden) \
-    {if (hidden) (node)->flags |= AM_NODE_FLAG_HIDDEN; else (node)->flags &= ~AM_NODE_FLAG_HIDDEN; }
+    {if (hidden) (node)->flags |= AM_NODE_FLAG_HIDDEN; else (node)->flags &= ~AM_NODE_FLAG_HIDDEN; \
+     am_node_changed(node); }
 #define am_node_paused(node)        (node->flags & AM_NODE_FLAG_PAUSED)
 #define am_set_node_paused(node, paused) \
-    {if (paused) (node)->flags |= AM_NODE_FLAG_PAUSED; else (node)->flags &= ~AM_NODE_FLAG_PAUSED; }
+    {if (paused) (node)->flags |= AM_NODE_FLAG_PAUSED; else (node)->flags &= ~AM_NODE_FLAG_PAUSED; \
+     am_node_structure_changed(node); }
 
 struct am_scene_node;
 
@@ -20,6 +22,7 @@ struct am_node_child {
 };
 
 struct am_render_state;
+struct am_node_bounds;
 
 #define AM_MAX_TAG UINT16_MAX
 typedef uint16_t am_tag;
@@ -42,7 +45,10 @@ extern am_tag AM_TAG_DEPTH_TEST;
 extern am_tag AM_TAG_STENCIL_TEST;
 extern am_tag AM_TAG_CULL_SPHERE;
 extern am_tag AM_TAG_CULL_BOX;
+extern am_tag AM_TAG_AUTO_CULL;
 extern am_tag AM_TAG_READ_UNIFORM;
+extern am_tag AM_TAG_SPRITE_BATCH;
+extern am_tag AM_TAG_CACHED_GROUP;
 
 struct am_scene_node : am_nonatomic_userdata {
     am_lua_array<am_node_child> children;
@@ -52,6 +58,23 @@ struct am_scene_node : am_nonatomic_userdata {
     int actions_ref;
     unsigned int action_seq; // used to avoid duplicating action in lua action list
 
+    // Generation of the most recent change to this node or any of
+    // its descendants (see am_node_changed below).
+    uint32_t subtree_gen;
+    // Same, but only counting structural changes (children, tags,
+    // paused flag and actions).
+    uint32_t structure_gen;
+    // Nodes that have this node as a child (one entry per child slot).
+    // These are not references, the entries are removed when the
+    // parent is collected.
+    am_scene_node **parents;
+    int num_parents;
+    int parents_capacity;
+
+    // Cached bounds for am.auto_cull (NULL until the node is rendered
+    // under an auto_cull node).
+    am_node_bounds *bounds;
+
     am_scene_node();
     virtual void render(am_render_state *rstate);
     void render_children(am_render_state *rstate);
@@ -64,7 +87,35 @@ struct am_wrap_node : am_scene_node {
     virtual void render(am_render_state *rstate);
 };
 
+// Change tracking.
+//
+// Every change to a node (children added or removed, fields set, tags,
+// hidden/paused flags) stamps the node and all its ancestors with the
+// current generation. Code that caches something derived from a subtree
+// calls am_begin_scene_generation() when it builds the cache and keeps
+// the result. The cache is still valid as long as
+// am_subtree_changed_since(node, gen) is false.
+//
+// Caches that only depend on the shape of the tree (e.g. which nodes have
+// actions or tags) can use am_structure_changed_since instead, so
+// they aren't invalidated by things like transform updates.
+extern uint32_t am_scene_generation;
+void am_node_changed(am_scene_node *node);
+void am_node_structure_changed(am_scene_node *node);
+uint32_t am_begin_scene_generation();
+#define am_subtree_changed_since(node, gen) ((node)->subtree_gen > (gen))
+#define am_structure_changed_since(node, gen) ((node)->structure_gen > (gen))
+
+// Call these after adding/removing a child slot, so parent links
+// and change tracking stay up to date.
+void am_node_child_added(am_scene_node *parent, am_scene_node *child);
+void am_node_child_removed(am_scene_node *parent, am_scene_node *child);
+
+// Returns the tag with the given name, registering it if it's new.
+am_tag am_lookup_tag(lua_State *L, int name_idx);
+
 int am_scene_node_index(lua_State *L);
 int am_scene_node_newindex(lua_State *L);
+int am_scene_node_gc(lua_State *L);
 
 void am_open_scene_module(lua_State *L);
@@ -0,0 +1,82 @@
+#include "amulet.h"
+
+#if defined(AM_HAVE_THREADS)
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+struct am_stream_decoder {
+    std::thread thread;
+    // held while a stream is being decoded, so a stream can't be
+    // destroyed out from under the decoder
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<am_audio_stream_node*> streams;
+};
+
+// Never freed, for the same reason as the thread pool.
+static am_stream_decoder *decoder = NULL;
+
+// How often the decoder checks whether the streams need topping up.
+static std::chrono::milliseconds poll_interval() {
+    int ms = (int)(am_conf_audio_stream_latency * 1000.0 / 4.0);
+    return std::chrono::milliseconds(am_clamp(ms, 1, 50));
+}
+
+static void decoder_main(am_stream_decoder *d) {
+    std::unique_lock<std::mutex> lock(d->mutex);
+    while (true) {
+        // one chunk per stream per pass, so one stream can't hold up
+        // the others
+        bool busy = false;
+        for (unsigned int i = 0; i < d->streams.size(); i++) {
+            if (d->streams[i]->decode_ahead()) busy = true;
+        }
+        if (busy) {
+            // give the lua thread a chance to add or remove streams
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+        } else if (d->streams.empty()) {
+            d->cond.wait(lock);
+        } else {
+            d->cond.wait_for(lock, poll_interval());
+        }
+    }
+}
+
+void am_add_decoder_stream(am_audio_stream_node *stream) {
+    if (decoder == NULL) {
+        decoder = new am_stream_decoder();
+        decoder->thread = std::thread(decoder_main, decoder);
+    }
+    {
+        std::lock_guard<std::mutex> lock(decoder->mutex);
+        decoder->streams.push_back(stream);
+    }
+    decoder->cond.notify_one();
+}
+
+void am_remove_decoder_stream(am_audio_stream_node *stream) {
+    if (decoder == NULL) return;
+    std::lock_guard<std::mutex> lock(decoder->mutex);
+    std::vector<am_audio_stream_node*> *streams = &decoder->streams;
+    for (unsigned int i = 0; i < streams->size(); i++) {
+        if ((*streams)[i] == stream) {
+            streams->erase(streams->begin() + i);
+            break;
+        }
+    }
+}
+
+#else
+
+void am_add_decoder_stream(am_audio_stream_node *stream) {
+}
+
+void am_remove_decoder_stream(am_audio_stream_node *stream) {
+}
+
+#endif
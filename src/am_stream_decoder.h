@@ -0,0 +1,10 @@
+// Audio streams are decoded ahead of playback on a background thread,
+// so decoding never happens in the audio callback. Each stream node
+// has a ring buffer that the decoder thread keeps topped up (see
+// am_audio_stream_node::decode_ahead). The thread is started when the
+// first stream is added. On platforms without threads streams are
+// decoded in the audio callback instead.
+
+// Lua thread. A stream must be removed before it's destroyed.
+void am_add_decoder_stream(am_audio_stream_node *stream);
+void am_remove_decoder_stream(am_audio_stream_node *stream);
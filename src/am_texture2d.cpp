@@ -38,6 +38,20 @@ static int create_texture2d(lua_State *L) {
             if (height <= 0) {
                 return luaL_error(L, "height must be positive");
             }
+            if (nargs > 2 && !lua_isnil(L, 3)) {
+                // the packed 16 bit types can't be used with RGBA textures
+                const char *type_str = luaL_checkstring(L, 3);
+                if (strcmp(type_str, "ubyte") == 0) {
+                    type = AM_TEXTURE_TYPE_UBYTE;
+                } else if (strcmp(type_str, "float") == 0) {
+                    type = AM_TEXTURE_TYPE_FLOAT;
+                } else {
+                    return luaL_error(L, "texture type must be \"ubyte\" or \"float\" (in fact \"%s\")", type_str);
+                }
+                if (type == AM_TEXTURE_TYPE_FLOAT && !am_float_render_targets_supported) {
+                    return luaL_error(L, "float textures are not supported on this device");
+                }
+            }
             break;
         case LUA_TSTRING: {
             char *errmsg;
@@ -346,6 +360,7 @@ void am_open_texture2d_module(lua_State *L) {
         {"565",             AM_TEXTURE_TYPE_USHORT_5_6_5},
         {"4444",            AM_TEXTURE_TYPE_USHORT_4_4_4_4},
         {"5551",            AM_TEXTURE_TYPE_USHORT_5_5_5_1},
+        {"float",           AM_TEXTURE_TYPE_FLOAT},
         {NULL, 0}
     };
     am_register_enum(L, ENUM_am_texture_type, texture_type_enum);
@@ -0,0 +1,171 @@
+#include "amulet.h"
+
+#if defined(AM_HAVE_THREADS)
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#endif
+
+#if defined(AM_HAVE_THREADS)
+
+struct am_thread_pool {
+    // set by any thread, read by the thread running am_parallel_for
+    std::atomic<int> requested_threads;
+
+    // held by the thread running am_parallel_for, which is the only
+    // thread that touches threads
+    std::mutex job_mutex;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable work_cond;
+    std::condition_variable done_cond;
+    unsigned int generation;
+    int active;
+    bool quit;
+
+    void (*fn)(void*, int);
+    void *data;
+    int n;
+    std::atomic<int> next;
+};
+
+// Never freed, because std::thread objects that are still running
+// can't be destroyed at exit. Created by whichever thread uses it
+// first, which may be an audio loader thread.
+static am_thread_pool *pool = NULL;
+static std::once_flag pool_once;
+
+static void create_pool() {
+    pool = new am_thread_pool();
+    pool->requested_threads = am_default_worker_thread_count();
+    pool->generation = 0;
+    pool->active = 0;
+    pool->quit = false;
+    pool->fn = NULL;
+    pool->data = NULL;
+    pool->n = 0;
+    pool->next = 0;
+}
+
+static am_thread_pool *get_pool() {
+    std::call_once(pool_once, create_pool);
+    return pool;
+}
+
+static void run_tasks(am_thread_pool *p) {
+    int i;
+    while ((i = p->next.fetch_add(1)) < p->n) {
+        p->fn(p->data, i);
+    }
+}
+
+// seen is the generation when the thread was started, so a job posted
+// before the thread gets going isn't missed.
+static void worker_main(am_thread_pool *p, unsigned int seen) {
+    std::unique_lock<std::mutex> lock(p->mutex);
+    while (true) {
+        while (!p->quit && p->generation == seen) {
+            p->work_cond.wait(lock);
+        }
+        if (p->quit) return;
+        seen = p->generation;
+        lock.unlock();
+        run_tasks(p);
+        lock.lock();
+        p->active--;
+        if (p->active == 0) {
+            p->done_cond.notify_one();
+        }
+    }
+}
+
+static void stop_threads(am_thread_pool *p) {
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->quit = true;
+    }
+    p->work_cond.notify_all();
+    for (unsigned int i = 0; i < p->threads.size(); i++) {
+        p->threads[i].join();
+    }
+    p->threads.clear();
+    p->quit = false;
+}
+
+static void start_threads(am_thread_pool *p, int num_threads) {
+    for (int i = 0; i < num_threads; i++) {
+        p->threads.push_back(std::thread(worker_main, p, p->generation));
+    }
+}
+
+void am_parallel_for(int n, void (*fn)(void *data, int i), void *data) {
+    am_thread_pool *p = get_pool();
+    if (n <= 1 || p->requested_threads == 0 || !p->job_mutex.try_lock()) {
+        for (int i = 0; i < n; i++) {
+            fn(data, i);
+        }
+        return;
+    }
+    // the count may have changed since it was checked above
+    int num_threads = p->requested_threads;
+    if ((int)p->threads.size() != num_threads) {
+        stop_threads(p);
+        start_threads(p, num_threads);
+    }
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->fn = fn;
+        p->data = data;
+        p->n = n;
+        p->next = 0;
+        p->active = (int)p->threads.size();
+        p->generation++;
+    }
+    p->work_cond.notify_all();
+    run_tasks(p);
+    {
+        std::unique_lock<std::mutex> lock(p->mutex);
+        while (p->active > 0) {
+            p->done_cond.wait(lock);
+        }
+    }
+    p->job_mutex.unlock();
+}
+
+void am_set_worker_thread_count(int n) {
+    am_thread_pool *p = get_pool();
+    // the threads are (re)started by the next am_parallel_for
+    p->requested_threads = am_clamp(n, 0, AM_MAX_WORKER_THREADS);
+}
+
+int am_get_worker_thread_count() {
+    return get_pool()->requested_threads;
+}
+
+int am_default_worker_thread_count() {
+    int cpus = (int)std::thread::hardware_concurrency();
+    return am_clamp(cpus - 1, 0, AM_MAX_WORKER_THREADS);
+}
+
+#else
+
+void am_parallel_for(int n, void (*fn)(void *data, int i), void *data) {
+    for (int i = 0; i < n; i++) {
+        fn(data, i);
+    }
+}
+
+void am_set_worker_thread_count(int n) {
+}
+
+int am_get_worker_thread_count() {
+    return 0;
+}
+
+int am_default_worker_thread_count() {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,24 @@
+#if !defined(AM_BACKEND_EMSCRIPTEN)
+#define AM_HAVE_THREADS
+#endif
+
+// A pool of worker threads for splitting up work that doesn't
+// touch the Lua state. The threads are started the first time they're
+// needed. On platforms without threads there are no workers and
+// everything runs on the calling thread.
+
+// Calls fn(data, i) for each i in [0, n), spread across the worker
+// threads and the calling thread, and returns once all the calls have
+// finished. The order of the calls is unspecified. If the pool is
+// already in use by another thread then all the calls are made on the
+// calling thread.
+void am_parallel_for(int n, void (*fn)(void *data, int i), void *data);
+
+// Number of worker threads, not counting the calling thread.
+void am_set_worker_thread_count(int n);
+int am_get_worker_thread_count();
+
+// One less than the number of cpus (capped at AM_MAX_WORKER_THREADS).
+int am_default_worker_thread_count();
+
+#define AM_MAX_WORKER_THREADS 16
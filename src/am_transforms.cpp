@@ -8,6 +8,15 @@ static void log_ignored_transform(am_render_state *rstate, am_param_name_id name
         slot->name);
 }
 
+// Cached bounds are in the space of the modelview matrix and are culled
+// against the projection matrix the auto_cull node was rendered with, so
+// they don't hold if a descendant changes the projection.
+static void check_projection_transform(am_render_state *rstate, am_param_name_id name) {
+    if (name == rstate->projection_param_index) {
+        am_bounds_unbounded(rstate);
+    }
+}
+
 static void maybe_insert_default_mv(lua_State *L) {
     if ((lua_gettop(L) >= 1 && lua_type(L, 1) != LUA_TSTRING) || lua_gettop(L) == 0) {
         lua_pushstring(L, am_conf_default_modelview_matrix_name);
@@ -18,13 +27,17 @@ static void maybe_insert_default_mv(lua_State *L) {
 /* Translate */
 
 void am_translate_node::render(am_render_state *rstate) {
+    check_projection_transform(rstate, name);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+        uint64_t old_version = param->version;
         glm::dvec4 old_column = (*m)[3];
         (*m)[3] = (*m)[0] * v[0] + (*m)[1] * v[1] + (*m)[2] * v[2] + (*m)[3];
+        param->changed();
         render_children(rstate);
         (*m)[3] = old_column;
+        param->version = old_version;
     } else {
         log_ignored_transform(rstate, name, "translate");
         render_children(rstate);
@@ -144,13 +157,17 @@ static void register_translate_node_mt(lua_State *L) {
 /* Scale */
 
 void am_scale_node::render(am_render_state *rstate) {
+    check_projection_transform(rstate, name);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+        uint64_t old_version = param->version;
         glm::dmat4 old = *m;
         *m = glm::scale(*m, v);
+        param->changed();
         render_children(rstate);
         *m = old;
+        param->version = old_version;
     } else {
         log_ignored_transform(rstate, name, "scale");
         render_children(rstate);
@@ -271,13 +288,17 @@ static void register_scale_node_mt(lua_State *L) {
 /* Rotate */
 
 void am_rotate_node::render(am_render_state *rstate) {
+    check_projection_transform(rstate, name);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+        uint64_t old_version = param->version;
         glm::dmat4 old = *m;
         *m *= glm::mat4_cast(rotation);
+        param->changed();
         render_children(rstate);
         *m = old;
+        param->version = old_version;
     } else {
         log_ignored_transform(rstate, name, "rotate");
         render_children(rstate);
@@ -364,13 +385,17 @@ static void register_rotate_node_mt(lua_State *L) {
 /* Transform */
 
 void am_transform_node::render(am_render_state *rstate) {
+    check_projection_transform(rstate, name);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+        uint64_t old_version = param->version;
         glm::dmat4 old = *m;
         *m = (*m) * mat;
+        param->changed();
         render_children(rstate);
         *m = old;
+        param->version = old_version;
     } else {
         log_ignored_transform(rstate, name, "transform");
         render_children(rstate);
@@ -414,10 +439,12 @@ static void register_transform_node_mt(lua_State *L) {
 /* Lookat */
 
 void am_lookat_node::render(am_render_state *rstate) {
+    am_bounds_unbounded(rstate);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     am_program_param_value old_val = *param;
     param->type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
     memcpy(&param->value.m4[0], glm::value_ptr(glm::lookAt(eye, center, up)), 16 * sizeof(double));
+    param->changed();
     render_children(rstate);
     *param = old_val;
 }
@@ -490,9 +517,11 @@ static void register_lookat_node_mt(lua_State *L) {
 /* Billboard */
 
 void am_billboard_node::render(am_render_state *rstate) {
+    am_bounds_unbounded(rstate);
     am_program_param_value *param = &rstate->param_name_map[name].value;
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+        uint64_t old_version = param->version;
         glm::dmat4 old = *m;
         double s = 1.0;
         if (preserve_uniform_scaling) {
@@ -507,8 +536,10 @@ void am_billboard_node::render(am_render_state *rstate) {
         (*m)[2][0] = 0.0;
         (*m)[2][1] = 0.0;
         (*m)[2][2] = s;
+        param->changed();
         render_children(rstate);
         *m = old;
+        param->version = old_version;
     } else {
         log_ignored_transform(rstate, name, "billboard");
         render_children(rstate);
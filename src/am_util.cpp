@@ -84,6 +84,19 @@ static wchar_t *to_wstr(const char *str) {
 }
 #endif
 
+bool am_rename_file(const char *from, const char *to) {
+#ifdef AM_WINDOWS
+    wchar_t *from16 = to_wstr(from);
+    wchar_t *to16 = to_wstr(to);
+    int r = _wrename(from16, to16);
+    free(from16);
+    free(to16);
+    return r == 0;
+#else
+    return rename(from, to) == 0;
+#endif
+}
+
 extern "C" {
 // handles utf8 filenames on windows
 FILE *am_fopen(const char *path, const char *mode) {
@@ -73,6 +73,8 @@ void am_replchr(char *str, char c0, char c);
 char *am_replace_strings(char *source, char** replacements);
 
 void am_delete_file(const char *file);
+// fails if to already exists on windows
+bool am_rename_file(const char *from, const char *to);
 void am_make_dir(const char* dir);
 void am_delete_empty_dir(const char* dir);
 
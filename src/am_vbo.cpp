@@ -8,8 +8,10 @@ static int vbo_gc(lua_State *L) {
 
 void am_vbo::init(am_buffer_target t) {
     target = t;
+    update_count = 0;
     for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
         slots[i].id = 0;
+        slots[i].last_update = 0;
         slots[i].last_update_frame = -1;
         slots[i].last_update_start = -1;
         slots[i].last_update_end = -1;
@@ -17,11 +19,14 @@ void am_vbo::init(am_buffer_target t) {
 }
 
 void am_vbo::delete_vbo_slots() {
+    // attribute pointers may refer to the deleted buffers
+    am_global_render_state->attributes_program = NULL;
     for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
         if (slots[i].id != 0) {
             am_bind_buffer(target, 0);
             am_delete_buffer(slots[i].id);
             slots[i].id = 0;
+            slots[i].last_update = 0;
             slots[i].last_update_frame = -1;
             slots[i].last_update_start = -1;
             slots[i].last_update_end = -1;
@@ -33,7 +38,7 @@ static am_vbo_slot *get_latest_slot(am_vbo *vbo) {
     am_vbo_slot *latest = NULL;
     for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
         am_vbo_slot *s = &vbo->slots[i];
-        if (s->id > 0 && (latest == NULL || s->last_update_frame > latest->last_update_frame)) {
+        if (s->id > 0 && (latest == NULL || s->last_update > latest->last_update)) {
             latest = s;
         }
     }
@@ -44,7 +49,7 @@ static am_vbo_slot *get_earliest_slot(am_vbo *vbo) {
     am_vbo_slot *earliest = NULL;
     for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
         am_vbo_slot *s = &vbo->slots[i];
-        if (s->id > 0 && (earliest == NULL || s->last_update_frame < earliest->last_update_frame)) {
+        if (s->id > 0 && (earliest == NULL || s->last_update < earliest->last_update)) {
             earliest = s;
         }
     }
@@ -62,75 +67,89 @@ static am_vbo_slot *get_free_slot(am_vbo *vbo) {
     return NULL;
 }
 
-static void create_slot(am_vbo *vbo, am_vbo_slot *slot, am_buffer *buf) {
-    uint32_t curr_frame = am_global_render_state->render_count;
+static void create_slot(am_vbo *vbo, am_vbo_slot *slot, am_buffer *buf, int changed_start, int changed_end) {
     slot->id = am_create_buffer_object();
-    slot->last_update_frame = curr_frame;
-    slot->last_update_start = 0;
-    slot->last_update_end = buf->size;
+    slot->last_update = ++vbo->update_count;
+    slot->last_update_frame = am_global_render_state->frame_count;
+    slot->last_update_start = changed_start;
+    slot->last_update_end = changed_end;
     am_bind_buffer(vbo->target, slot->id);
-    am_set_buffer_data(vbo->target, buf->size, &buf->data[0], AM_BUFFER_USAGE_STATIC_DRAW);
+    am_set_buffer_data(vbo->target, buf->size, &buf->data[0], buf->usage);
+}
+
+static void upload_range(am_vbo *vbo, am_buffer *buf, int start, int end) {
+    if (start == 0 && end == buf->size && buf->usage != AM_BUFFER_USAGE_STATIC_DRAW) {
+        // Re-specifying the whole buffer orphans the old storage, so
+        // the driver doesn't need to wait for the gpu to finish with it.
+        am_set_buffer_data(vbo->target, buf->size, &buf->data[0], buf->usage);
+    } else {
+        am_set_buffer_sub_data(vbo->target, start, end - start, buf->data + start);
+    }
 }
 
 static void update_slot(am_vbo *vbo, am_vbo_slot *slot, am_buffer *buf, int start, int end) {
     am_bind_buffer(vbo->target, slot->id);
-    am_set_buffer_sub_data(vbo->target, start, end - start, buf->data + start);
-    uint32_t curr_frame = am_global_render_state->render_count;
-    slot->last_update_frame = curr_frame;
-    slot->last_update_start = start;
-    slot->last_update_end = end;
+    if (start == buf->dirty_start && end == buf->dirty_end && buf->num_dirty_ranges > 1) {
+        // the slot only needs the changes made since the last update,
+        // so upload each changed range instead of everything in between.
+        for (int i = 0; i < buf->num_dirty_ranges; i++) {
+            upload_range(vbo, buf, buf->dirty_ranges[i].start, buf->dirty_ranges[i].end);
+        }
+    } else {
+        upload_range(vbo, buf, start, end);
+    }
+    slot->last_update = ++vbo->update_count;
+    slot->last_update_frame = am_global_render_state->frame_count;
+    slot->last_update_start = buf->dirty_start;
+    slot->last_update_end = buf->dirty_end;
 }
 
 static void compute_update_start_end(am_vbo *vbo, uint32_t since, int *start, int *end) {
     // when updating vbo slot sub-data, we need to make sure we also include ranges in
     // vbo slots that were updated since the vbo slot we're currently using.
+    // Slots are reused in the order they were last updated, so each update
+    // since then is the last update of one of the other slots.
     for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
         am_vbo_slot *s = &vbo->slots[i];
-        if (s->id > 0 && s->last_update_frame > since) {
+        if (s->id > 0 && s->last_update > since) {
             *start = am_min(*start, s->last_update_start);
             *end = am_max(*end, s->last_update_end);
         }
     }
 }
 
+static int num_slots(am_buffer *buf) {
+    return buf->usage == AM_BUFFER_USAGE_STREAM_DRAW ? AM_MAX_VBO_SLOTS : 1;
+}
+
 void am_vbo::create_slot_if_missing(am_buffer *buf) {
     if (slots[0].id == 0) {
-        create_slot(this, &slots[0], buf);
+        create_slot(this, &slots[0], buf, 0, buf->size);
     }
 }
 
 void am_vbo::update_dirty(am_buffer *buf) {
-    uint32_t curr_frame = am_global_render_state->render_count;
-    // sanity check: there shouldn't be any slots for the current frame
-    for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
-        if (slots[i].last_update_frame == curr_frame) {
-            am_log0("INTERNAL ERROR: vbo slot %d already updated this frame (%d)!", i, curr_frame);
-            return;
-        }
-    }
+    uint32_t curr_frame = am_global_render_state->frame_count;
     am_vbo_slot *earliest = get_earliest_slot(this);
     if (earliest == NULL) {
-        create_slot(this, &slots[0], buf);
+        create_slot(this, &slots[0], buf, 0, buf->size);
+        return;
+    }
+    am_vbo_slot *new_slot = NULL;
+    if (curr_frame - earliest->last_update_frame < (uint32_t)num_slots(buf)) {
+        // too soon to re-use the earliest vbo, so create a new one if
+        // we haven't used all the slots yet.
+        new_slot = get_free_slot(this);
+    }
+    if (new_slot != NULL) {
+        create_slot(this, new_slot, buf, buf->dirty_start, buf->dirty_end);
     } else {
-        if (curr_frame - earliest->last_update_frame < AM_MAX_VBO_SLOTS) {
-            // too soon to re-use the earliest vbo, so create a new one
-            am_vbo_slot *new_slot = get_free_slot(this);
-            if (new_slot == NULL) {
-                am_log0("INTERNAL ERROR: couldn't find free vbo slot! (%d %d)", curr_frame, earliest->last_update_frame);
-                for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
-                    am_log0("slot %d: %d (%d)", i, slots[i].last_update_frame, slots[i].id);
-                }
-                return;
-            }
-            create_slot(this, new_slot, buf);
-        } else {
-            // it's been long enough since this vbo was updated that we
-            // can re-use it.
-            int start = buf->dirty_start;
-            int end = buf->dirty_end;
-            compute_update_start_end(this, earliest->last_update_frame, &start, &end);
-            update_slot(this, earliest, buf, start, end);
-        }
+        // it's been long enough since this vbo was updated that we
+        // can re-use it.
+        int start = buf->dirty_start;
+        int end = buf->dirty_end;
+        compute_update_start_end(this, earliest->last_update, &start, &end);
+        update_slot(this, earliest, buf, start, end);
     }
 }
 
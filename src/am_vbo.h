@@ -1,10 +1,21 @@
-#define AM_MAX_VBO_SLOTS 1 // set to 1 for now because it needs more testing
+// Number of slots used by buffers with "stream" usage. Other buffers
+// use a single slot.
+#define AM_MAX_VBO_SLOTS 3
 
 // Each am_vbo may contain several slots (actual gpu vbos) which we
-// cycle between to avoid contension on vbos between frames.
+// cycle between to avoid contension on vbos between frames. A slot is
+// only rewritten once AM_MAX_VBO_SLOTS frames have passed since its last
+// update (GLES2 and WebGL have no fences to tell us when the gpu is done
+// with it). If a stream buffer changes more often than that, for example
+// when it's drawn to a framebuffer and then changed and drawn again in
+// the same frame, the earliest slot is rewritten anyway and the driver
+// has to synchronize.
 struct am_vbo_slot {
     am_buffer_id id;
-    uint32_t last_update_frame;
+    uint32_t last_update;       // value of am_vbo::update_count at the update
+    uint32_t last_update_frame; // value of am_render_state::frame_count
+    // The range of the buffer that changed in the last update.
+    // Slots updated after this one need to copy this range too.
     int last_update_start;
     int last_update_end;
 };
@@ -12,6 +23,7 @@ struct am_vbo_slot {
 struct am_vbo {
     am_vbo_slot slots[AM_MAX_VBO_SLOTS];
     am_buffer_target target;
+    uint32_t update_count; // orders the slots' updates
 
     void init(am_buffer_target t);
     void delete_vbo_slots();
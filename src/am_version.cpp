@@ -0,0 +1 @@
+const char *am_version = "DEV 2026-16-10 20:29";
@@ -256,6 +256,39 @@ void am_buffer_view::update_max_elem_if_required() {
     }
 }
 
+// Computes the bounding box of a float view with 2 or 3 components
+// (z is taken to be 0 for 2 components). Returns false for other views.
+// The box is empty (min > max) if the view has no elements.
+bool am_buffer_view::update_bounds_if_required() {
+    if (type != AM_VIEW_TYPE_F32 || components < 2 || components > 3 || buffer->data == NULL) {
+        return false;
+    }
+    // buffer->version is only incremented when the buffer is uploaded,
+    // so also recompute if there are pending changes.
+    if (last_bounds_version < buffer->version || buffer->dirty_start < buffer->dirty_end) {
+        glm::vec3 min = glm::vec3(FLT_MAX);
+        glm::vec3 max = glm::vec3(-FLT_MAX);
+        uint8_t *ptr = buffer->data + offset;
+        for (int i = 0; i < size; i++) {
+            float *v = (float*)ptr;
+            for (int c = 0; c < components; c++) {
+                if (v[c] < min[c]) min[c] = v[c];
+                if (v[c] > max[c]) max[c] = v[c];
+            }
+            ptr += stride;
+        }
+        if (components == 2 && size > 0) {
+            min.z = 0.0f;
+            max.z = 0.0f;
+        }
+        bounds_min = min;
+        bounds_max = max;
+        last_bounds_version = buffer->version;
+        buffer->used_for_bounds = true;
+    }
+    return true;
+}
+
 am_buffer_view* am_check_buffer_view(lua_State *L, int idx) {
     am_buffer_view *view = am_get_userdata(L, am_buffer_view, idx);
     am_check_buffer_data(L, view->buffer);
@@ -279,6 +312,7 @@ am_buffer_view* am_new_buffer_view(lua_State *L, am_buffer_view_type type, int c
     view->size = 0;
     view->max_elem = 0;
     view->last_max_elem_version = 0;
+    view->last_bounds_version = 0;
     return view;
 }
 
@@ -366,9 +400,12 @@ am_buffer_view::am_buffer_view() {
     offset = 0;
     stride = 0;
     size = 0;
+    divisor = 0;
 
     max_elem = 0;
     last_max_elem_version = 0;
+
+    last_bounds_version = 0;
 }
 
 bool am_buffer_view::is_normalized() {
@@ -471,11 +508,39 @@ static int view_slice(lua_State *L) {
     slice->offset = view->offset + (start-1) * view->stride;
     slice->stride = view->stride * stride_multiplier;
     slice->size = size;
+    slice->divisor = view->divisor;
     slice->max_elem = view->max_elem;
     slice->last_max_elem_version = view->last_max_elem_version;
     return 1;
 }
 
+static int create_instanced_view(lua_State *L) {
+    int nargs = am_check_nargs(L, 1);
+    if (!am_instanced_attributes_supported) {
+        return luaL_error(L, "per-instance attributes are not supported by this graphics backend");
+    }
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    int divisor = 1;
+    if (nargs > 1) {
+        divisor = luaL_checkinteger(L, 2);
+        if (divisor < 1) {
+            return luaL_error(L, "divisor must be positive (in fact %d)", divisor);
+        }
+    }
+    am_buffer_view *inst = am_new_buffer_view(L, view->type, view->components);
+    inst->buffer = view->buffer;
+    view->pushref(L, view->buffer_ref);
+    inst->buffer_ref = inst->ref(L, -1);
+    lua_pop(L, 1); // pop buffer
+    inst->offset = view->offset;
+    inst->stride = view->stride;
+    inst->size = view->size;
+    inst->divisor = divisor;
+    inst->max_elem = view->max_elem;
+    inst->last_max_elem_version = view->last_max_elem_version;
+    return 1;
+}
+
 static void get_view_buffer(lua_State *L, void *obj) {
     am_buffer_view *view = (am_buffer_view*)obj;
     view->pushref(L, view->buffer_ref);
@@ -529,6 +594,7 @@ static int create_component_slice(lua_State *L, am_buffer_view *view, int start,
     slice->offset = view->offset + start * comp_sz;
     slice->stride = view->stride;
     slice->size = view->size;
+    slice->divisor = view->divisor;
     slice->max_elem = view->max_elem;
     slice->last_max_elem_version = view->last_max_elem_version;
     return 1;
@@ -591,6 +657,17 @@ static int view_swizzle_index(lua_State *L, am_buffer_view *view) {
     return am_default_index_func(L);
 }
 
+// number of table values read at a time when setting a view from a table
+#define AM_VIEW_TABLE_CHUNK 256
+
+static const void *vec_mt(lua_State *L, int metatable_id) {
+    // the metatable is kept alive by the registry
+    am_push_metatable(L, metatable_id);
+    const void *mt = lua_topointer(L, -1);
+    lua_pop(L, 1);
+    return mt;
+}
+
 #define TNAME F32
 #define CTYPE float
 #define FROM_LUA_NUM(x) ((float)(x))
@@ -675,6 +752,19 @@ static int view_swizzle_index(lua_State *L, am_buffer_view *view) {
 #define READ_NUM(x) read_num_i16n(x)
 #include "am_view_template.inc"
 
+// Returns the view's offset and stride in bytes, its number of elements
+// and the number of components in each element. Used by the LuaJIT
+// version of view:set in buffer.lua.
+static int view_layout(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushinteger(L, view->offset);
+    lua_pushinteger(L, view->stride);
+    lua_pushinteger(L, view->size);
+    lua_pushinteger(L, view->components);
+    return 4;
+}
+
 static void register_view_mt(lua_State *L) {
     lua_newtable(L);
 
@@ -770,6 +860,13 @@ void am_open_view_module(lua_State *L) {
     };
     am_register_enum(L, ENUM_am_buffer_view_type_lua, view_type_lua_enum);
 
+    luaL_Reg funcs[] = {
+        {"instanced", create_instanced_view},
+        {"_view_layout", view_layout},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+
     register_view_mt(L);
     register_F32_view_mt(L);
     register_F64_view_mt(L);
@@ -96,10 +96,16 @@ struct am_buffer_view : am_nonatomic_userdata {
     int                 offset; // in bytes
     int                 stride; // in bytes
     int                 size;   // number of elements
+    int                 divisor; // > 0 for per-instance attributes (see am.instanced)
 
     uint32_t            max_elem;
     uint32_t            last_max_elem_version;
 
+    // bounding box of the elements (see update_bounds_if_required)
+    glm::vec3           bounds_min;
+    glm::vec3           bounds_max;
+    uint32_t            last_bounds_version;
+
     am_buffer_view();
 
     bool is_normalized();
@@ -107,6 +113,7 @@ struct am_buffer_view : am_nonatomic_userdata {
     am_attribute_client_type gl_client_type();
 
     void update_max_elem_if_required();
+    bool update_bounds_if_required();
 
     void mark_dirty(int start, int end) {
         int start_bytes = offset + start * stride;
@@ -9,6 +9,8 @@ static void compute_viewport(am_window *win);
 
 static bool update_size(am_window *win);
 
+static void render_window(lua_State *L, am_window *win);
+
 static int create_window(lua_State *L) {
     am_check_nargs(L, 1);
     if (!lua_istable(L, 1)) return luaL_error(L, "expecting a table in position 1");
@@ -290,6 +292,30 @@ void am_handle_window_close(am_native_window *nwin) {
     }
 }
 
+// Renders the window's scene and returns the pixels as a new image
+// buffer. The back buffer's contents are undefined after a swap, so the
+// scene is drawn again rather than reading what was last presented.
+static int read_back_window(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_window *win = am_get_userdata(L, am_window, 1);
+    if (win->needs_closing || win->native_win == NULL) {
+        return luaL_error(L, "window is closed");
+    }
+    update_size(win);
+    int w = am_max(1, win->pixel_width);
+    int h = am_max(1, win->pixel_height);
+    render_window(L, win);
+    am_image_buffer *img = am_new_userdata(L, am_image_buffer);
+    img->width = w;
+    img->height = h;
+    img->format = AM_PIXEL_FORMAT_RGBA8;
+    img->buffer = am_push_new_buffer_and_init(L, w * h * 4);
+    img->buffer_ref = img->ref(L, -1);
+    lua_pop(L, 1); // pop buffer
+    am_read_pixels(0, 0, w, h, (void*)img->buffer->data);
+    return 1;
+}
+
 static int close_window(lua_State *L) {
 #if defined(AM_BACKEND_EMSCRIPTEN)
     // ignore window close in HTML5 apps
@@ -438,27 +464,31 @@ static void compute_viewport(am_window *win) {
     }
 }
 
-static void draw_windows() {
+static void render_window(lua_State *L, am_window *win) {
+    am_native_window_bind_framebuffer(win->native_win);
+    am_render_state *rstate = am_global_render_state;
+    am_scene_node* roots[2];
+    int num_roots = 1;
+    roots[0] = win->scene;
+    if (win->overlay != NULL) {
+        roots[1] = win->overlay;
+        num_roots = 2;
+    }
+    rstate->do_render(L, &roots[0], num_roots, 0, true, win->clear_color, win->stencil_clear_value,
+        win->viewport_x, win->viewport_y, win->viewport_width, win->viewport_height,
+        win->pixel_width, win->pixel_height,
+        win->projection, win->has_depth_buffer);
+}
+
+static void draw_windows(lua_State *L) {
     for (unsigned int i = 0; i < windows.size(); i++) {
         am_window *win = windows[i];
         if (!win->needs_closing) {
-            am_native_window_bind_framebuffer(win->native_win);
-            am_render_state *rstate = am_global_render_state;
-            am_scene_node* roots[2];
-            int num_roots = 1;
-            roots[0] = win->scene;
-            if (win->overlay != NULL) {
-                roots[1] = win->overlay;
-                num_roots = 2;
-            }
             double t0 = 0.0;
             if (am_record_perf_timings) {
                 t0 = am_get_current_time();
             }
-            rstate->do_render(&roots[0], num_roots, 0, true, win->clear_color, win->stencil_clear_value,
-                win->viewport_x, win->viewport_y, win->viewport_width, win->viewport_height,
-                win->pixel_width, win->pixel_height,
-                win->projection, win->has_depth_buffer);
+            render_window(L, win);
             if (am_record_perf_timings) {
                 am_last_frame_draw_time = am_get_current_time() - t0;
             }
@@ -471,8 +501,10 @@ bool am_update_windows(lua_State *L) {
     static unsigned int frame = 0;
     if (!close_windows(L)) return false;
     resize_windows();
+    am_profiler_begin_frame();
     am_reset_gl_frame_stats();
-    draw_windows();
+    draw_windows(L);
+    am_global_render_state->frame_count++;
     frame++;
     if (am_conf_log_gl_calls && am_conf_log_gl_frames > 0) {
         char *msg = am_format("SDL_GL_SwapWindow(win);\n\n // ===================== END FRAME %d ==========================\n\n", frame);
@@ -764,6 +796,8 @@ static void register_window_mt(lua_State *L) {
 
     lua_pushcclosure(L, close_window, 0);
     lua_setfield(L, -2, "close");
+    lua_pushcclosure(L, read_back_window, 0);
+    lua_setfield(L, -2, "read_back");
 
     am_register_metatable(L, "window", MT_am_window, 0);
 }
@@ -92,7 +92,9 @@
 
 #include <new>
 #include <climits>
+#include <cfloat>
 #include <vector>
+#include <atomic>
 
 #include "c99.h"
 
@@ -129,6 +131,8 @@ extern "C" {
 #include "am_embedded.h"
 #include "am_userdata.h"
 #include "am_backend.h"
+#include "am_headless.h"
+#include "am_resampler.h"
 #include "am_config.h"
 #include "am_options.h"
 #include "am_reserved_refs.h"
@@ -137,17 +141,24 @@ extern "C" {
 #include "am_math.h"
 #include "am_buffer.h"
 #include "am_mathv.h"
+#include "am_mathv_simd.h"
+#include "am_thread_pool.h"
 #include "am_view.h"
 #include "am_image.h"
 #include "am_texture2d.h"
 #include "am_vbo.h"
 #include "am_audio.h"
+#include "am_stream_decoder.h"
+#include "am_audio_loader.h"
 #include "am_action.h"
 #include "am_scene.h"
+#include "am_profiler.h"
 #include "am_framebuffer.h"
 #include "am_window.h"
 #include "am_renderer.h"
 #include "am_program.h"
+#include "am_batch.h"
+#include "am_caching.h"
 #include "am_transforms.h"
 #include "am_depthbuffer.h"
 #include "am_stencilbuffer.h"
@@ -162,6 +173,8 @@ extern "C" {
 #include "am_export.h"
 #include "am_rand.h"
 #include "am_sfxr.h"
+#include "am_particles.h"
+#include "am_quads.h"
 #include "am_glob.h"
 #include "am_i18n.h"
 #include "am_net.h"
@@ -0,0 +1,4 @@
+-- test_stream.lua checks this is used instead of the default (0.5)
+audio_stream_latency = 0.25
+-- test_audio_cache.lua checks the cache is written and read back
+audio_cache = true
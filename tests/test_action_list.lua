@@ -0,0 +1,61 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+local
+function named(name)
+    local node = am.group()
+    node:action(function()
+        io.write(name.." ")
+    end)
+    return node
+end
+
+local a = named("a")
+local b = named("b")
+local c = named("c")
+local b1 = named("b1")
+local b2 = named("b2")
+local c1 = am.group()
+local c2 = named("c2")
+local shared = named("shared")
+b:append(b1)
+b:append(b2)
+c:append(c1)
+c1:append(c2)
+b2:append(shared)
+c2:append(shared)
+
+local scene = am.group()
+scene:append(a)
+scene:append(b)
+scene:append(c)
+win.scene = scene
+
+local frame = 1
+scene:action(function()
+    print()
+    print("frame "..frame)
+    if frame == 2 then
+        b:append(named("b3"))
+    elseif frame == 3 then
+        scene:remove(a)
+    elseif frame == 4 then
+        scene:remove(c)
+        scene:prepend(c)
+    elseif frame == 5 then
+        b.paused = true
+    elseif frame == 6 then
+        b.paused = false
+    elseif frame == 7 then
+        c1:action(function()
+            io.write("c1 ")
+        end)
+    elseif frame == 8 then
+        shared:append(named("shared1"))
+    elseif frame == 9 then
+        scene:append(a)
+        c2:remove(shared)
+    elseif frame == 10 then
+        win:close()
+    end
+    frame = frame + 1
+end)
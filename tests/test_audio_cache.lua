@@ -0,0 +1,73 @@
+-- audio_cache is enabled in conf.lua
+local cache_dir = am.app_data_dir.."audio_cache/"
+local file = "../examples/land.ogg"
+
+local function clear_cache()
+    for _, f in ipairs(am.glob{cache_dir.."*"}) do
+        os.remove(f)
+    end
+end
+
+local function same_samples(buf1, buf2)
+    if buf1.channels ~= buf2.channels or buf1.samples_per_channel ~= buf2.samples_per_channel then
+        return false
+    end
+    local v1 = buf1.buffer:view("float")
+    local v2 = buf2.buffer:view("float")
+    for i = 1, #v1 do
+        if v1[i] ~= v2[i] then
+            return false
+        end
+    end
+    return true
+end
+
+local function u32(x)
+    local bytes = {}
+    for i = 1, 4 do
+        bytes[i] = x % 256
+        x = math.floor(x / 256)
+    end
+    return string.char(unpack(bytes))
+end
+
+-- writes a cache file with the given header version and 4 mono samples of 1.0
+local function write_cache_file(path, version)
+    local f = io.open(path, "wb")
+    f:write(u32(0x4d43504d), u32(version), u32(1), u32(44100), u32(4))
+    f:write(string.rep(u32(0x3f800000), 4))
+    f:close()
+end
+
+local function read_version(path)
+    local f = io.open(path, "rb")
+    local header = f:read(8)
+    f:close()
+    local b1, b2, b3, b4 = header:byte(5, 8)
+    return b1 + b2 * 256 + b3 * 65536 + b4 * 16777216
+end
+
+clear_cache()
+
+-- the first load decodes the file and writes the cache
+local decoded = am.load_audio(file)
+local files = am.glob{cache_dir.."*"}
+print(#files, files[1]:match("%.pcm$") ~= nil, read_version(files[1]))
+local path = files[1]
+
+-- the second load reads the cache back
+print(same_samples(am.load_audio(file), decoded))
+local buffers = am.load_audio_async{file}:wait()
+print(same_samples(buffers[file], decoded))
+
+-- samples really come from the cache file
+write_cache_file(path, 2)
+local cached = am.load_audio(file)
+print(cached.channels, cached.samples_per_channel, cached.buffer:view("float")[1])
+
+-- a file written by another version is ignored and replaced
+write_cache_file(path, 1)
+print(same_samples(am.load_audio(file), decoded), read_version(path))
+print(#am.glob{cache_dir.."*"})
+
+clear_cache()
@@ -0,0 +1,53 @@
+local win = am.window{width = 16, height = 16}
+
+local mixer = am.audio_node()
+local buf = am.load_audio("../examples/land.ogg")
+
+-- the nodes are only referenced by this weak table and the audio graph
+local nodes = setmetatable({}, {__mode = "v"})
+
+local
+function count_nodes()
+    collectgarbage()
+    collectgarbage()
+    local n = 0
+    for _, node in pairs(nodes) do
+        n = n + 1
+    end
+    return n
+end
+
+local frame = 0
+win.scene = am.group():action(function()
+    am.schedule_audio(mixer)
+    frame = frame + 1
+    if frame == 1 then
+        for i = 1, 3 do
+            local osc = am.oscillator(220 * i)
+            nodes["osc"..i] = osc
+            mixer:add(osc)
+        end
+    elseif frame == 2 then
+        mixer:remove(nodes.osc1)
+        mixer:remove(nodes.osc2)
+        local track = am.track(buf, true)
+        nodes.track = track
+        mixer:add(track)
+    elseif frame == 3 then
+        -- removed and added back in the same frame
+        mixer:remove(nodes.osc3)
+        mixer:add(nodes.osc3)
+    elseif frame == 5 then
+        mixer:remove_all()
+    end
+    local n = count_nodes()
+    local names = {}
+    for name in pairs(nodes) do
+        table.insert(names, name)
+    end
+    table.sort(names)
+    print(frame, n, table.concat(names, " "))
+    if frame == 10 then
+        win:close()
+    end
+end)
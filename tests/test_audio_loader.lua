@@ -0,0 +1,69 @@
+local files = {"../examples/bounce.ogg", "../examples/land.ogg", "../examples/drums.ogg"}
+
+local function same_samples(buf1, buf2)
+    if buf1.channels ~= buf2.channels or buf1.sample_rate ~= buf2.sample_rate
+        or buf1.samples_per_channel ~= buf2.samples_per_channel
+    then
+        return false
+    end
+    local v1 = buf1.buffer:view("float")
+    local v2 = buf2.buffer:view("float")
+    for i = 1, #v1 do
+        if v1[i] ~= v2[i] then
+            return false
+        end
+    end
+    return true
+end
+
+-- wait blocks outside a coroutine
+local all_files = {}
+for i, file in ipairs(files) do
+    all_files[i] = file
+end
+table.insert(all_files, "missing.ogg")
+local loader = am.load_audio_async(all_files)
+local buffers, errors = loader:wait()
+print(loader.done, loader.progress)
+print(buffers == loader.buffers, errors == loader.errors)
+for _, file in ipairs(files) do
+    print(file, same_samples(buffers[file], am.load_audio(file)))
+end
+print(buffers["missing.ogg"], errors["missing.ogg"] ~= nil)
+
+-- wait yields inside a coroutine
+local loader2 = am.load_audio_async{files[1]}
+local co = coroutine.create(function()
+    local buffers2 = loader2:wait()
+    return buffers2[files[1]]
+end)
+local ok, buf
+repeat
+    ok, buf = coroutine.resume(co)
+until coroutine.status(co) == "dead"
+print(ok, same_samples(buf, buffers[files[1]]))
+
+local loader3 = am.load_audio_async{}
+print(loader3.done, loader3.progress, next(loader3.buffers))
+
+print(pcall(am.load_audio_async, {1}))
+
+-- loading while large mathv calls use the worker threads. conf.lua
+-- enables the audio cache, so clear it to make the loader decode.
+for _, f in ipairs(am.glob{am.app_data_dir.."audio_cache/*"}) do
+    os.remove(f)
+end
+local _, threshold = mathv.threads()
+local x = mathv.random("float", 200000, -100, 100)
+local loader4 = am.load_audio_async(files)
+local n = 0
+repeat
+    mathv.threads(n % 2 == 0 and 4 or 2, 0)
+    mathv.clamp(mathv.sin(x), -0.5, 0.5)
+    n = n + 1
+until loader4.done
+mathv.threads(mathv.threads(), threshold)
+local buffers4 = loader4:wait()
+for _, file in ipairs(files) do
+    print(file, same_samples(buffers4[file], buffers[file]))
+end
@@ -213,6 +213,68 @@ printvec(viewubn4[1]*255)
 printvec(viewubn4[2]*255)
 printvec(viewubn4[3]*255)
 
+print("set from large tables")
+do
+    local n = 600
+    local nums = {}
+    local back = {}
+    local vecs = {}
+    local mats = {}
+    for i = 1, n do
+        nums[i] = i
+        vecs[i] = vec2(i, -i)
+        mats[i] = mat3(i)
+    end
+    -- filled back to front, so mostly in the hash part
+    for i = n, 1, -1 do
+        back[i] = i * 2
+    end
+    local floats = am.float_array(n + 10)
+    floats:set(nums)
+    print(floats[1], floats[256], floats[257], floats[n], floats[n + 1])
+    floats:set(back, 5)
+    print(floats[4], floats[5], floats[n + 4], floats[n + 5])
+    local v2 = am.vec2_array(n)
+    v2:set(nums)
+    print(v2[1], v2[128], v2[129], v2[n / 2], v2[n / 2 + 1])
+    v2:set(vecs)
+    print(v2[1], v2[257], v2[n])
+    vecs[300] = nil
+    v2:set(vec2(0))
+    v2:set(vecs, 1, 400)
+    print(v2[299], v2[300])
+    vecs[300] = vec3(1)
+    local _, err = pcall(function()
+        v2:set(vecs)
+    end)
+    print(err:gsub("^.*%: ", "").."")
+    local m3 = am.buffer(n * 36):view("mat3")
+    m3:set(mats)
+    print(m3[n][3][3])
+    _, err = pcall(function()
+        nums[300] = "x"
+        floats:set(nums)
+    end)
+    print(err:gsub("^.*%: ", "").."")
+    _, err = pcall(function()
+        v2:set(nums)
+    end)
+    print(err:gsub("^.*%: ", "").."")
+    _, err = pcall(function()
+        nums[300] = 300
+        nums[n + 1] = n + 1
+        am.buffer(n * 12):view("vec3"):set(nums)
+    end)
+    print(err:gsub("^.*%: ", "").."")
+    -- only whole elements are written before an error
+    local v3 = am.vec3_array(2)
+    _, err = pcall(function()
+        v3:set{1, 2, 3, 4, 5, "x"}
+    end)
+    print(err:gsub("^.*%: ", "").."")
+    print(v3[1], v3[2])
+end
+
 print("buffer_pool")
 do
     local view = mathv.array("float", {1, 2, 3})
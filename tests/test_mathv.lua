@@ -221,3 +221,110 @@ do
     print(mathv.greatest(mathv.array("float", 0)))
     print(mathv.least(mathv.array("float", 0)))
 end
+
+print("simd kernels")
+do
+    print_view(mathv.add(mathv.array("float", {1, 2}), mathv.array("vec2", {vec2(10, 20), vec2(30, 40)})))
+    local arr = mathv.array("vec3", {vec3(1.5, -1.5, 0.25), vec3(-2.5, 2.5, 7), vec3(3.75, -0.25, -7)})
+    print_view(mathv.floor(arr.x))
+    print_view(mathv.ceil(arr.yz))
+    print_view(mathv.max(arr.xy, 0))
+    print_view(mathv.min(arr, arr.z))
+    -- odd sizes exercise the tail of each kernel
+    local x = mathv.range("float", 37, -20, 20)
+    local y = mathv.range("float", 37, 1, 5)
+    local res = (x + y) * y - x / y
+    local ok = true
+    for i = 1, #x do
+        local expected = (x[i] + y[i]) * y[i] - x[i] / y[i]
+        if math.abs(res[i] - expected) > 1e-4 then
+            ok = false
+        end
+    end
+    print(ok)
+    local angles = mathv.range("float", 1001, -10000, 10000)
+    local s = mathv.sin(angles)
+    local c = mathv.cos(angles)
+    ok = true
+    for i = 1, #angles do
+        if math.abs(s[i] - math.sin(angles[i])) > 1e-5 or math.abs(c[i] - math.cos(angles[i])) > 1e-5 then
+            ok = false
+        end
+    end
+    print(ok)
+    local isa = mathv.simd()
+    print(mathv.simd(false))
+    local s2 = mathv.sin(angles)
+    print(mathv.sum(mathv.eq(s, s2, 1e-6)) == #angles)
+    print(mathv.simd(true) == isa)
+end
+
+print("threads")
+do
+    local _, threshold = mathv.threads()
+    local x = mathv.random("float", 100000, -100, 100)
+    local y = mathv.random("float", 100000, 1, 100).buffer:view("vec2")
+    local function run()
+        return {mathv.sin(x), (x.buffer:view("vec2") + y) * y, mathv.clamp(x, -10, 10)}
+    end
+    mathv.threads(1, 1000000000)
+    local a = run()
+    -- force the work to be split into chunks
+    mathv.threads(4, 0)
+    local b = run()
+    local ok = true
+    for i = 1, #a do
+        for j = 1, #a[i] do
+            if a[i][j] ~= b[i][j] then
+                ok = false
+            end
+        end
+    end
+    print(ok)
+    -- overlapping views are processed in order
+    local v = mathv.range("float", 100000, 0, 1)
+    v:slice(2):add(v:slice(1, #v - 1), 1)
+    print(v[1], v[2], v[100000])
+    v = mathv.range("float", 100000, 0, 100000 - 1)
+    v:add(v, 1)
+    print(v[1], v[100000])
+    print(select(2, mathv.threads(mathv.threads(), threshold)) == threshold)
+    print(pcall(mathv.threads, 0))
+end
+
+print("expr")
+do
+    local a = mathv.array("float", {1, 2, 3})
+    local b = mathv.array("float", {4, 5, 6})
+    local f = mathv.expr(function(a, b, c) return a * b + c end)
+    print_view(f(a, b, 1))
+    print_view(f(a, b, a))
+    local p = mathv.array("vec2", {vec2(1, 2), vec2(3, 4), vec2(5, 6)})
+    print_view(f(p, a, vec2(10, 20)))
+    print_view(f(mathv.array("double", {1, 2, 3}), b, 0.5))
+    local g = mathv.expr(function(x) return (x - 2):abs():clamp(0, 0.5):mix(x:floor(), 0.5) + x:lt(2) end)
+    print_view(g(mathv.array("float", {0.25, 1.75, 3.5})))
+    -- shared subexpressions are only computed once
+    local sq = mathv.expr(function(x) local t = x + 1 return t * t end)
+    print_view(sq(a))
+    -- into
+    local vel = mathv.array("vec2", {vec2(10, 20), vec2(30, 40), vec2(50, 60)})
+    local step = mathv.expr(function(pos, vel, dt) return pos + vel * dt end)
+    print(step:into(p, p, vel, 0.5) == p)
+    print_view(p)
+    -- larger views, strided views and non-float views
+    local n = 1000
+    local x = mathv.random("float", n, -10, 10)
+    local arr = am.struct_array(n, {"y", "vec2", "i", "ushort"})
+    arr.y:set(mathv.random("float", n * 2, -10, 10).buffer:view("vec2"))
+    arr.i:set(mathv.range("ushort", n, 0, n - 1))
+    local h = mathv.expr(function(x, y, i) return (x * y):sin() + y:max(x) / 2 - i end)
+    local res = h(x, arr.y, arr.i)
+    local expected = mathv.sin(x * arr.y) + mathv.max(arr.y, x) / 2 - mathv.cast("float", arr.i)
+    print(mathv.sum(mathv.eq(res.x, expected.x, 1e-4)) == n and mathv.sum(mathv.eq(res.y, expected.y, 1e-4)) == n)
+    print(pcall(mathv.expr, function(a) return 1 end))
+    print(pcall(f, a, b))
+    print(pcall(f, 1, 2, 3))
+    print(pcall(f, p, mathv.array("vec3", 3), 1))
+    print(pcall(step.into, step, mathv.array("ubyte", 3), p, vel, 1))
+end
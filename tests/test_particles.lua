@@ -0,0 +1,74 @@
+-- The particle system is given a seed, so the particles are the same
+-- every run.
+local win = am.window{}
+
+local settings = {
+    max_particles = 40,
+    start_particles = 5,
+    emission_rate = 30,
+    life = 1,
+    life_var = 0.5,
+    source_pos = vec2(10, -20),
+    source_pos_var = vec2(5),
+    angle = math.rad(90),
+    angle_var = math.rad(45),
+    speed = 100,
+    speed_var = 20,
+    start_size = 4,
+    end_size = 2,
+    gravity = vec2(0, -50),
+    damping = 0.5,
+    warmup_time = 0.5,
+    seed = 1,
+}
+
+local
+function centers(node)
+    local verts = node"bind".vert
+    local t = {}
+    for i = 1, node.active_particles do
+        -- the center of the particle's quad
+        t[i] = (verts[i * 4 - 3] + verts[i * 4 - 2] + verts[i * 4 - 1] + verts[i * 4]) / 4
+    end
+    return t
+end
+
+local
+function same_particles(node1, node2)
+    local c1, c2 = centers(node1), centers(node2)
+    if #c1 ~= #c2 then
+        return false
+    end
+    for i = 1, #c1 do
+        if c1[i] ~= c2[i] then
+            return false
+        end
+    end
+    return true
+end
+
+local node = am.particles2d(settings)
+assert(not node.gpu)
+print("active particles: "..node.active_particles)
+for i, c in ipairs(centers(node)) do
+    print(string.format("%2d: %8.3f %8.3f", i, c.x, c.y))
+end
+local verts = node"bind".vert
+for i = node.active_particles * 4 + 1, #verts do
+    assert(verts[i] == vec3(0))
+end
+
+-- each system has its own generator, so the same seed gives the same
+-- particles however many other systems have been updated
+print(same_particles(node, am.particles2d(settings)))
+settings.seed = 2
+print(same_particles(node, am.particles2d(settings)))
+
+-- without a seed, math.randomseed makes the particles repeatable
+settings.seed = nil
+math.randomseed(7)
+local node1 = am.particles2d(settings)
+math.randomseed(7)
+print(same_particles(node1, am.particles2d(settings)))
+
+win:close()
@@ -0,0 +1,37 @@
+local win = am.window{}
+
+am.enable_profiler()
+am.profile_tag("player")
+
+local player = am.translate(0, 0):tag("player") ^ am.rect(-8, -8, 8, 8, vec4(1, 0, 0, 1))
+player:action(function() end)
+win.scene = am.group{player, am.rect(-2, -2, 2, 2)}
+
+print(am.last_frame_profile())
+print(am.stop_profiler_trace())
+
+am.start_profiler_trace()
+local frame = 0
+win.scene:action(function()
+    frame = frame + 1
+    if frame < 3 then return end
+    local p = am.last_frame_profile()
+    print("draw_calls", p.draw_calls)
+    print("program_switches", p.program_switches)
+    print("state_changes", p.state_changes > 0)
+    print("uniform_uploads", p.uniform_uploads > 0)
+    print("time", p.time > 0)
+    for _, zone in ipairs(p.zones) do
+        if zone.name ~= "audio sync" and zone.name ~= "buffer upload" then
+            print(string.rep("  ", zone.depth - 1)..zone.name, zone.time >= 0 and zone.start >= 0)
+        end
+    end
+    local trace = am.stop_profiler_trace()
+    print(trace:match('^{"displayTimeUnit":"ms","traceEvents":%[') ~= nil)
+    local _, num_frames = trace:gsub('"name":"frame"', "")
+    local _, num_player = trace:gsub('"name":"render player"', "")
+    print(num_frames, num_player == num_frames)
+    am.enable_profiler(false)
+    win:close()
+    print("ok")
+end)
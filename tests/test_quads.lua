@@ -0,0 +1,78 @@
+local
+function quad_xs(node)
+    local verts = node.vert
+    local xs = {}
+    for q = 1, node.num_quads do
+        xs[q] = verts[(q - 1) * 4 + 1].x
+    end
+    return table.concat(xs, " ")
+end
+
+local
+function print_error(f, ...)
+    local ok, err = pcall(f, ...)
+    print(ok, (err:gsub("^.-:%d+: ", "")))
+end
+
+local
+function quad_verts(x)
+    return {vec2(x, 1), vec2(x, 0), vec2(x + 1, 0), vec2(x + 1, 1)}
+end
+
+-- am.quads keeps quads in order
+local quads = am.quads(2, {"vert", "vec2", "color", "vec4"})
+for i = 1, 5 do
+    print(quads:add_quad{vert = quad_verts(i * 10), color = vec4(i / 10)})
+end
+print(quads.num_quads, quads"draw".count, quad_xs(quads))
+quads:remove_quad(2)
+print(quads.num_quads, quads"draw".count, quad_xs(quads))
+quads:remove_quad(2, 2)
+print(quads.num_quads, quad_xs(quads))
+print(quads.color[5])
+quads:quad_vert(4, quad_verts(70))
+print(quads.num_quads, quad_xs(quads))
+print_error(quads.remove_quad, quads, 4, 2)
+quads:remove_quad(3, 2)
+print(quads.num_quads, quad_xs(quads))
+quads:clear()
+print(quads.num_quads, quads"draw".count)
+
+-- am.quad_batch gives each quad a stable handle
+local batch = am.quad_batch(4, {"vert", "vec2", "color", "vec4"})
+local handles = {}
+for i = 1, 6 do
+    handles[i] = batch:add_quad{vert = quad_verts(i * 10), color = vec4(i / 10)}
+end
+print(table.concat(handles, " "), batch.num_quads, batch.capacity)
+print(quad_xs(batch))
+batch:remove_quad(handles[2])
+print(quad_xs(batch), batch:quad_number(handles[6]))
+batch:quad_vert(handles[6], quad_verts(66))
+batch:set_quad(handles[3], {vert = quad_verts(33)})
+print(quad_xs(batch))
+print_error(batch.remove_quad, batch, handles[2])
+-- removed handles are reused
+local h = batch:add_quad{vert = quad_verts(99)}
+print(h, quad_xs(batch))
+-- new quads don't keep the values of removed quads
+local h2 = batch:add_quad()
+print(h2, batch.vert[batch:quad_number(h2) * 4], batch.color[batch:quad_number(h2) * 4])
+batch:remove_quad(h2)
+
+-- bulk updates are indexed by handle
+local colors = am.vec4_array(6 * 4)
+for i = 1, 6 do
+    for v = 1, 4 do
+        colors[(i - 1) * 4 + v] = vec4(i, v, 0, 1)
+    end
+end
+batch:set_quads{color = colors}
+for q = 1, batch.num_quads do
+    local c = batch.color[(q - 1) * 4 + 3]
+    print(q, batch.vert[(q - 1) * 4 + 1].x, c.x, c.y)
+end
+print_error(batch.set_quads, batch, {color = am.vec4_array(8)})
+print_error(batch.set_quads, batch, {color = am.vec3_array(24)})
+batch:clear()
+print(batch.num_quads, batch"draw".count)
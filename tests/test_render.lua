@@ -1,5 +1,9 @@
 win = am.window{}
 
+assert(am.texture2d(2, 2, "ubyte").width == 2)
+assert(not pcall(am.texture2d, 2, 2, "565"))
+assert(not pcall(am.texture2d, 2, 2, "4444"))
+
 ib1 = am.image_buffer(1)
 v1 = ib1.buffer:view"ubyte"
 tx1 = am.texture2d(ib1)
@@ -69,5 +73,335 @@ assert(v1[2] == 64)
 assert(v1[3] == 64)
 assert(v1[4] == 64 + 255 - 128)
 
+fb1:clear()
+fb1:render(am.sprite_batch() ^ {
+    am.translate(10, 0) ^ am.sprite("CCC\nCCC", vec4(255, 0, 0, 255) / 255),
+    am.translate(-1, 0) ^ am.sprite("CCC\nCCC", vec4(128, 128, 128, 128) / 255),
+    am.sprite("C\n", vec4(128, 128, 128, 128) / 255),
+})
+fb1:read_back()
+assert(v1[1] == 0)
+assert(v1[2] == 96)
+assert(v1[3] == 96)
+
+local cached = am.sprite("CCC\nCCC", vec4(128, 128, 128, 128) / 255):compile()
+assert(cached.num_commands == nil)
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(cached.num_commands == 1)
+assert(v1[1] == 0)
+assert(v1[2] == 64)
+assert(v1[3] == 64)
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(v1[1] == 0)
+assert(v1[2] == 64)
+assert(v1[3] == 64)
+fb1:clear()
+fb1:render(am.translate(10, 0) ^ cached)
+fb1:read_back()
+assert(v1[2] == 0)
+cached:invalidate()
+assert(cached.num_commands == nil)
+
+local rect = am.rect(-2, -2, 2, 2, vec4(0, 1, 0, 1))
+cached = am.cached_group(rect)
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(v1[2] == 255)
+rect.color = vec4(1, 0, 0, 1)
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(v1[1] == 255)
+assert(v1[2] == 0)
+
+-- a recorded list keeps the views it draws with alive until it's re-recorded
+local weak = setmetatable({}, {__mode = "v"})
+weak.verts = am.rect_verts_2d(-2, -2, 2, 2)
+local cached_bind = am.bind{vert = weak.verts, color = vec4(0, 1, 0, 1)}
+cached = am.cached_group(am.use_program(am.shaders.color2d) ^ cached_bind ^ am.draw("triangles", am.rect_indices()))
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(v1[2] == 255)
+cached_bind.vert = am.rect_verts_2d(10, 10, 12, 12)
+collectgarbage()
+collectgarbage()
+assert(weak.verts ~= nil)
+fb1:clear()
+fb1:render(cached)
+fb1:read_back()
+assert(v1[2] == 0)
+collectgarbage()
+collectgarbage()
+assert(weak.verts == nil)
+
+local far_rect = am.rect(10, -2, 12, 2, vec4(1, 0, 0, 1))
+local mover = am.translate(10, 0) ^ am.rect(-2, -2, 2, 2, vec4(0, 0, 1, 1))
+local culled = am.auto_cull() ^ {
+    am.rect(-2, -2, 2, 2, vec4(0, 1, 0, 1)),
+    far_rect,
+    mover,
+}
+fb1:clear()
+fb1:render(culled)
+fb1:read_back()
+assert(v1[1] == 0)
+assert(v1[2] == 255)
+assert(v1[3] == 0)
+fb1:clear()
+fb1:render(culled)
+fb1:read_back()
+assert(v1[2] == 255)
+far_rect.x1 = -2
+far_rect.x2 = 2
+fb1:clear()
+fb1:render(culled)
+fb1:read_back()
+assert(v1[1] == 255)
+assert(v1[2] == 0)
+mover.position2d = vec2(0, 0)
+fb1:clear()
+fb1:render(culled)
+fb1:read_back()
+assert(v1[1] == 0)
+assert(v1[3] == 255)
+-- moving the projection brings a far away rect into view
+local proj_culled = am.auto_cull() ^ am.group{
+    am.translate("P", -11, 0) ^ am.rect(10, -2, 12, 2, vec4(1, 0, 1, 1)),
+}
+for i = 1, 2 do
+    fb1:clear()
+    fb1:render(proj_culled)
+    fb1:read_back()
+    assert(v1[1] == 255 and v1[3] == 255)
+end
+
+local stream_rect = am.rect(-2, -2, 2, 2, vec4(1, 1, 0, 1))
+stream_rect.verts.buffer.usage = "stream"
+local function check_stream_rect(covered)
+    fb1:clear()
+    fb1:render(stream_rect)
+    fb1:read_back()
+    if covered then
+        assert(v1[1] == 255 and v1[2] == 255)
+    else
+        assert(v1[1] == 0 and v1[2] == 0)
+    end
+end
+-- partial updates in the same frame. The first few go to new vbo slots,
+-- then the earliest slot is rewritten even though it was used this frame.
+check_stream_rect(true)
+stream_rect.x1 = 1
+check_stream_rect(false)
+stream_rect.x1 = -2
+check_stream_rect(true)
+stream_rect.y1 = 1
+check_stream_rect(false)
+stream_rect.y1 = -2
+check_stream_rect(true)
+stream_rect.x2 = -1
+check_stream_rect(false)
+stream_rect.x2 = 2
+check_stream_rect(true)
+stream_rect.y2 = -1
+check_stream_rect(false)
+stream_rect.y2 = 2
+check_stream_rect(true)
+check_stream_rect(true)
+
+-- sparse updates to a large buffer are uploaded as separate ranges
+local sparse_verts = am.buffer(2000 * 8):view("vec2")
+local sparse_rect = am.use_program(am.shaders.color2d)
+    ^am.bind{vert = sparse_verts, color = vec4(0, 1, 1, 1)}
+    ^am.draw("triangles", am.ushort_elem_array{1, 2, 3, 1, 3, 4, 1997, 1998, 1999, 1997, 1999, 2000})
+local function check_sparse_rect(covered)
+    fb1:clear()
+    fb1:render(sparse_rect)
+    fb1:read_back()
+    if covered then
+        assert(v1[2] == 255 and v1[3] == 255)
+    else
+        assert(v1[2] == 0 and v1[3] == 0)
+    end
+end
+check_sparse_rect(false)
+sparse_verts:set({vec2(-2, 2), vec2(-2, -2), vec2(2, -2), vec2(2, 2)}, 1997)
+check_sparse_rect(true)
+sparse_verts:set({vec2(0), vec2(0), vec2(0), vec2(0)}, 1997)
+sparse_verts:set({vec2(-2, 2), vec2(-2, -2), vec2(2, -2), vec2(2, 2)}, 1)
+check_sparse_rect(true)
+sparse_verts:set({vec2(0), vec2(0), vec2(0), vec2(0)}, 1)
+sparse_verts[1000] = vec2(5)
+check_sparse_rect(false)
+
+-- instanced drawing
+local inst_prog = am.program([[
+    precision highp float;
+    attribute vec2 vert;
+    attribute vec2 offset;
+    attribute vec4 color;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = color;
+        gl_Position = P * MV * vec4(vert + offset, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+local inst_draw = am.draw("triangles", am.rect_indices(), 1, 6, 1)
+local inst_node = am.use_program(inst_prog)
+    ^am.blend"add"
+    ^am.bind{
+        vert = am.rect_verts_2d(-2, -2, 2, 2),
+        offset = am.instanced(am.vec2_array{vec2(10, 0), vec2(0, 0), vec2(0, 0)}),
+        color = am.instanced(am.vec4_array{vec4(0, 0, 1, 1), vec4(1, 0, 0, 1), vec4(0, 1, 0, 1)}),
+    }
+    ^inst_draw
+local function check_instances(r, g, b)
+    fb1:clear()
+    fb1:render(inst_node)
+    fb1:read_back()
+    assert(v1[1] == r and v1[2] == g and v1[3] == b)
+end
+check_instances(0, 0, 0)
+inst_draw.instances = 2
+check_instances(255, 0, 0)
+inst_draw.instances = 3
+check_instances(255, 255, 0)
+-- limited by the number of per-instance values
+inst_draw.instances = 10
+check_instances(255, 255, 0)
+inst_draw.instances = 0
+check_instances(0, 0, 0)
+-- a batch drawn after instances uses per-vertex attributes again
+inst_draw.instances = 3
+fb1:clear()
+fb1:render(am.group{
+    inst_node,
+    am.sprite_batch()
+        ^ am.use_program(inst_prog)
+        ^ am.bind{
+            vert = am.rect_verts_2d(-2, -2, 2, 2),
+            offset = am.vec2_array{vec2(0), vec2(0), vec2(0), vec2(0)},
+            color = am.vec4_array{vec4(1, 0, 0, 1), vec4(0, 0, 1, 1), vec4(0, 0, 1, 1), vec4(0, 0, 1, 1)},
+        }
+        ^ am.draw("triangles", am.rect_indices()),
+})
+fb1:read_back()
+assert(v1[1] < 255 and v1[2] == 0 and v1[3] > 0)
+
+-- gpu particles (simulated on the cpu if float render targets aren't supported)
+local gpu_particles = am.particles2d{
+    gpu = true,
+    max_particles = 4,
+    start_particles = 4,
+    emission_rate = 0,
+    speed = 0,
+    life = 10,
+    start_size = 4,
+    start_color = vec4(1, 0, 0, 1),
+}
+assert(gpu_particles.gpu == am._gpu_particles2d_supported())
+fb1:clear()
+fb1:render(gpu_particles)
+fb1:read_back()
+assert(v1[1] == 255 and v1[2] == 0 and v1[3] == 0)
+gpu_particles.source_pos = vec2(10, 0)
+gpu_particles:reset()
+fb1:clear()
+fb1:render(gpu_particles)
+fb1:read_back()
+assert(v1[1] == 0)
+
+-- the seed setting picks the particles in both modes, whatever state
+-- math.random is in
+local function render_seeded_particles(seed)
+    local ib = am.image_buffer(16)
+    local fb = am.framebuffer(am.texture2d(ib))
+    fb.projection = math.ortho(-8, 8, -8, 8)
+    fb:render(am.particles2d{
+        gpu = true,
+        seed = seed,
+        max_particles = 8,
+        start_particles = 8,
+        emission_rate = 0,
+        speed = 0,
+        life = 10,
+        start_size = 2,
+        source_pos_var = vec2(8),
+        start_color = vec4(0.5, 0.5, 0.5, 1),
+        start_color_var = vec4(0.5, 0.5, 0.5, 0),
+    })
+    fb:read_back()
+    return ib.buffer:view("ubyte")
+end
+local function same_pixels(p1, p2)
+    for i = 1, #p1 do
+        if p1[i] ~= p2[i] then
+            return false
+        end
+    end
+    return true
+end
+local seeded1 = render_seeded_particles(3)
+math.random()
+local seeded2 = render_seeded_particles(3)
+local seeded3 = render_seeded_particles(4)
+assert(same_pixels(seeded1, seeded2))
+assert(not same_pixels(seeded1, seeded3))
+
+-- custom programs may use MV for more than the position, so a batch
+-- must keep each draw's MV for them
+local mv_prog = am.program([[
+    precision highp float;
+    attribute vec2 vert;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = vec4(MV[3].x / 8.0 + 0.5, 0.0, 0.0, 1.0);
+        gl_Position = P * MV * vec4(vert, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+local function render_mv_quads(batch)
+    local ib = am.image_buffer(16)
+    local fb = am.framebuffer(am.texture2d(ib))
+    fb.projection = math.ortho(-8, 8, -8, 8)
+    local quad = am.bind{vert = am.rect_verts_2d(-2, -2, 2, 2)}
+        ^ am.draw("triangles", am.rect_indices())
+    local quads = am.use_program(mv_prog) ^ {
+        am.translate(-4, 0) ^ quad,
+        am.translate(4, 0) ^ quad,
+    }
+    fb:render(batch and am.sprite_batch() ^ quads or quads)
+    fb:read_back()
+    return ib.buffer:view("ubyte")
+end
+assert(same_pixels(render_mv_quads(true), render_mv_quads(false)))
+
+win.scene = am.rect(win.left, win.bottom, 0, win.top, vec4(0, 1, 0, 1))
+local win_img = win:read_back()
+assert(win_img.width == win.pixel_width and win_img.height == win.pixel_height)
+local win_pixels = win_img.buffer:view("ubyte4")
+assert(win_pixels[1] == vec4(0, 255, 0, 255))
+assert(win_pixels[win_img.width] == vec4(0, 0, 0, 255))
+
 win:close()
 print"ok"
@@ -0,0 +1,49 @@
+-- land_22050.ogg and land_88200.ogg are ../examples/land.ogg with the
+-- sample rate in the header changed, so they decode to the same samples
+-- as land.ogg but are resampled when loaded.
+local src = am.load_audio("../examples/land.ogg")
+local n = src.samples_per_channel
+
+-- conf.lua enables the audio cache, which would skip the resampler
+local function clear_cache()
+    for _, f in ipairs(am.glob{am.app_data_dir.."audio_cache/*"}) do
+        os.remove(f)
+    end
+end
+
+local function load(file)
+    clear_cache()
+    local buf = am.load_audio(file)
+    return buf, buf.buffer:view("float")
+end
+
+local function max_diff(v1, v2)
+    local d = 0
+    for i = 1, #v1 do
+        d = math.max(d, math.abs(v1[i] - v2[i]))
+    end
+    return d
+end
+
+local function print_samples(view, indices)
+    local vals = {}
+    for i, j in ipairs(indices) do
+        vals[i] = string.format("%.4f", view[j])
+    end
+    print(table.concat(vals, " "))
+end
+
+local up, upv = load("land_22050.ogg")
+print(up.sample_rate, up.channels, up.samples_per_channel == n * 2)
+print_samples(upv, {1, 2, 1001, 1002, 5001, 5002, #upv})
+
+local down, downv = load("land_88200.ogg")
+print(down.sample_rate, down.channels, down.samples_per_channel == math.floor(n / 2))
+print_samples(downv, {1, 2, 501, 502, 1201, 1202, #downv})
+
+-- the simd filter kernel gives the same results as the scalar one
+mathv.simd(false)
+local _, upv2 = load("land_22050.ogg")
+local _, downv2 = load("land_88200.ogg")
+mathv.simd(true)
+print(max_diff(upv, upv2) < 1e-5, max_diff(downv, downv2) < 1e-5)
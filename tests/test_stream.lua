@@ -0,0 +1,7 @@
+local data = am.load_buffer("../examples/drums.ogg")
+local stream = am.stream(data, true)
+print(stream.underruns)
+-- audio_stream_latency is set to 0.25 in conf.lua
+print(stream.capacity, stream.capacity == 0.25 * 44100)
+
+print(pcall(am.stream, am.load_buffer("../examples/ball.png")))
@@ -106,3 +106,52 @@ print(cycle"nodeB""nodeC".f3.f)
 print("")
 print(cycle"nodeA""nodeB".B.xy.t)
 print(cycle"nodeC".C.rrr.y)
+
+-- repeated searches of an unchanged tree use the tag index,
+-- so check the results still track changes to the tree.
+print("---")
+local function names(nodes)
+    local t = {}
+    for i, n in ipairs(nodes) do
+        t[i] = n.name
+    end
+    return table.concat(t, ",")
+end
+local function named(name, tag)
+    local n = am.group():tag(tag)
+    n.name = name
+    return n
+end
+local x1, x2, x3 = named("x1", "x"), named("x2", "x"), named("x3", "x")
+local root = am.group{
+    x1:append(x2:append(named("y1", "y"))),
+    named("y2", "y"),
+    x3,
+}
+for i = 1, 3 do
+    print(names(root:all"x").." "..names(root:all("x", true)).." "..names(root:all"y"))
+end
+local child, parent = root"y"
+print(child.name.." "..parent.name)
+x2:untag"x"
+print(names(root:all("x", true)))
+print(names(root:all("x", true)))
+x1:untag"x"
+x3:append(named("x4", "x"))
+print(names(root:all"x").." "..names(root:all("x", true)))
+print(names(root:all"x").." "..names(root:all("x", true)))
+print(root"x".name)
+root:remove("x")
+print(root"x")
+print(root"x")
+root:append(named("x5", "x"))
+print(root"x".name)
+print(root"x".name)
+root:replace("x", named("x6", "x"))
+print(root"x".name)
+print(root"x".name)
+root:all"y".name = "yy"
+print(names(root:all"y"))
+print(names(root:all"y"))
+print(root"z")
+print(root"z")
@@ -0,0 +1,118 @@
+-- Setting float views from tables of numbers. On LuaJIT most of these go
+-- through the FFI loops in lua/buffer.lua (run the tests with
+-- LUAVM=luajit to cover them), so each result is checked against
+-- setting the same values one element at a time.
+
+local types = {"float", "vec2", "vec3", "vec4"}
+local zeros = {0, vec2(0), vec3(0), vec4(0)}
+
+local function new_view(components, size, offset, stride)
+    local view = am.buffer(offset + size * stride):view(types[components], offset, stride)
+    view:set(zeros[components] - 1)
+    return view
+end
+
+-- sets one element at a time, like view:set(values) should
+local function set_slowly(view, values, components)
+    for i = 1, #view do
+        local k = (i - 1) * components
+        if values[k + 1] == nil then
+            break
+        end
+        if components == 1 then
+            view[i] = values[k + 1]
+        elseif components == 2 then
+            view[i] = vec2(values[k + 1], values[k + 2])
+        elseif components == 3 then
+            view[i] = vec3(values[k + 1], values[k + 2], values[k + 3])
+        else
+            view[i] = vec4(values[k + 1], values[k + 2], values[k + 3], values[k + 4])
+        end
+    end
+end
+
+local function same(v1, v2)
+    for i = 1, #v1 do
+        if v1[i] ~= v2[i] then
+            return false
+        end
+    end
+    return true
+end
+
+local function range(n)
+    local t = {}
+    for i = 1, n do
+        t[i] = i * 0.5
+    end
+    return t
+end
+
+-- sets a view of size elements from a table of count elements
+local function check(name, size, count, offset, stride)
+    local results = {}
+    for components = 1, 4 do
+        local s = stride or components * 4
+        local view1 = new_view(components, size, offset or 0, s)
+        local view2 = new_view(components, size, offset or 0, s)
+        local values = range(count * components)
+        view1:set(values)
+        set_slowly(view2, values, components)
+        table.insert(results, same(view1, view2) and "ok" or "FAIL")
+    end
+    print(name, table.concat(results, " "))
+end
+
+check("exact", 5, 5)
+check("short", 5, 3)
+check("long", 3, 10)
+check("empty", 3, 0)
+check("offset", 4, 4, 8)
+check("strided", 4, 4, 0, 20)
+
+-- values in the hash part
+local t = {}
+for i = 12, 1, -1 do
+    t[i] = i
+end
+local view1 = new_view(3, 4, 0, 12)
+local view2 = new_view(3, 4, 0, 12)
+view1:set(t)
+set_slowly(view2, t, 3)
+print("hash", same(view1, view2))
+
+-- only whole elements are set before an error
+for components, type in ipairs(types) do
+    local view = new_view(components, 8, 0, components * 4)
+    local ok, err = pcall(view.set, view, {1, 2, 3, 4, 5, 6, 7, true})
+    print(type, ok, err, view[1], view[2])
+end
+
+-- a table that ends part way through an element
+local view = new_view(3, 4, 0, 12)
+print(pcall(view.set, view, {1, 2, 3, 4}))
+
+-- extra arguments go to the native set
+view = am.buffer(16):view("float")
+view:set({1, 2}, 3)
+print(view[1], view[2], view[3], view[4])
+
+-- the buffer is marked dirty, so the new vertices are drawn
+local win = am.window{}
+local ib = am.image_buffer(1)
+local pixels = ib.buffer:view("ubyte")
+local fb = am.framebuffer(am.texture2d(ib))
+local verts = am.buffer(48):view("vec2")
+verts:set{-2, -2, 2, -2, 2, 2, -2, -2, 2, 2, -2, 2}
+local scene = am.use_program(am.shaders.color2d)
+    ^ am.bind{vert = verts, color = vec4(0, 1, 0, 1)}
+    ^ am.draw("triangles")
+fb:render(scene)
+fb:read_back()
+print(pixels[2])
+verts:set{10, 10, 12, 10, 12, 12, 10, 10, 12, 12, 10, 12}
+fb:clear()
+fb:render(scene)
+fb:read_back()
+print(pixels[2])
+win:close()
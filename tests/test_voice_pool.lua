@@ -0,0 +1,32 @@
+local buf = am.load_audio("../examples/land.ogg")
+
+print(pcall(am.voice_pool, 0))
+
+local pool = am.voice_pool(2)
+print(pool.num_voices, pool.num_playing)
+local a = pool:play(buf)
+local b = pool:play(buf, {priority = 1})
+print(a, b, pool.num_playing)
+
+-- all voices are busy with sounds of higher priority
+print(pool:play(buf, {priority = -1}), pool.num_playing)
+
+-- an equal priority steals the voice playing a
+local c = pool:play(buf, {volume = 0.5, pitch = 2})
+print(c, pool.num_playing)
+pool:stop(a)
+print(pool.num_playing)
+
+-- a higher priority steals the voice with the lowest priority (c)
+local d = pool:play(buf, {priority = 2, loop = true})
+print(d, pool.num_playing)
+pool:stop(c)
+print(pool.num_playing)
+
+pool:stop(b)
+print(pool.num_playing)
+local e = pool:play(buf)
+print(e, pool.num_playing)
+pool:stop_all()
+print(pool.num_playing)
+print(pool:play(buf, {priority = -1}), pool.num_playing)
@@ -0,0 +1,263 @@
+/* This is a generated file. DO NOT EDIT! */
+
+static const uint16_t recff_idmap[] = {
+0,
+0x0100,
+0x0200,
+0x0300,
+0,
+0,
+0x0400,
+0x0500,
+0x0600,
+0x0700,
+0,
+0,
+0x0800,
+0x0900,
+0x0a00,
+0,
+0x0b00,
+0x0c00,
+0x0d00,
+0,
+0x0e00,
+0x0f00,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0x1000,
+0x1100+(IRFPM_FLOOR),
+0x1100+(IRFPM_CEIL),
+0x1200+(IRFPM_SQRT),
+0x1200+(IRFPM_LOG10),
+0x1200+(IRFPM_EXP),
+0x1200+(IRFPM_SIN),
+0x1200+(IRFPM_COS),
+0x1200+(IRFPM_TAN),
+0x1300+(FF_math_asin),
+0x1300+(FF_math_acos),
+0x1300+(FF_math_atan),
+0x1400+(IRCALL_sinh),
+0x1400+(IRCALL_cosh),
+0x1400+(IRCALL_tanh),
+0,
+0x1500,
+0x1600,
+0x1600,
+0x1700,
+0x1800,
+0x1900,
+0,
+0x1a00,
+0x1b00+(IR_MIN),
+0x1b00+(IR_MAX),
+0x1c00,
+0,
+0x1d00+(IR_TOBIT),
+0x1d00+(IR_BNOT),
+0x1d00+(IR_BSWAP),
+0x1e00+(IR_BSHL),
+0x1e00+(IR_BSHR),
+0x1e00+(IR_BSAR),
+0x1e00+(IR_BROL),
+0x1e00+(IR_BROR),
+0x1f00+(IR_BAND),
+0x1f00+(IR_BOR),
+0x1f00+(IR_BXOR),
+0,
+0x2000,
+0x2100+(0),
+0,
+0x2100+(1),
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0x2200,
+0,
+0x2300,
+0x2400,
+0,
+0,
+0,
+0,
+0x2500+(0),
+0x2600+(0),
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0x2500+(GCROOT_IO_OUTPUT),
+0x2600+(GCROOT_IO_OUTPUT),
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0x2700+(0),
+0x2700+(1),
+0x2800+(MM_eq),
+0x2800+(MM_len),
+0x2800+(MM_lt),
+0x2800+(MM_le),
+0x2800+(MM_concat),
+0x2900,
+0x2800+(MM_add),
+0x2800+(MM_sub),
+0x2800+(MM_mul),
+0x2800+(MM_div),
+0x2800+(MM_mod),
+0x2800+(MM_pow),
+0x2800+(MM_unm),
+0,
+0,
+0,
+0x2a00+(1),
+0x2a00+(0),
+0,
+0,
+0,
+0,
+0x2b00,
+0x2b00,
+0x2c00,
+0x2d00,
+0x2e00+(FF_ffi_sizeof),
+0x2e00+(FF_ffi_alignof),
+0x2e00+(FF_ffi_offsetof),
+0x2f00,
+0x3000,
+0x3100,
+0x3200,
+0x3300,
+0,
+0x3400
+};
+
+static const RecordFunc recff_func[] = {
+recff_nyi,
+recff_c,
+recff_assert,
+recff_type,
+recff_ipairs_aux,
+recff_ipairs,
+recff_getmetatable,
+recff_setmetatable,
+recff_rawget,
+recff_rawset,
+recff_rawequal,
+recff_select,
+recff_tonumber,
+recff_tostring,
+recff_pcall,
+recff_xpcall,
+recff_math_abs,
+recff_math_round,
+recff_math_unary,
+recff_math_atrig,
+recff_math_htrig,
+recff_math_modf,
+recff_math_degrad,
+recff_math_log,
+recff_math_atan2,
+recff_math_pow,
+recff_math_ldexp,
+recff_math_minmax,
+recff_math_random,
+recff_bit_unary,
+recff_bit_shift,
+recff_bit_nary,
+recff_string_len,
+recff_string_range,
+recff_table_getn,
+recff_table_insert,
+recff_table_remove,
+recff_io_write,
+recff_io_flush,
+recff_cdata_index,
+recff_cdata_arith,
+recff_cdata_call,
+recff_clib_index,
+recff_ffi_new,
+recff_ffi_typeof,
+recff_ffi_istype,
+recff_ffi_xof,
+recff_ffi_errno,
+recff_ffi_string,
+recff_ffi_copy,
+recff_ffi_fill,
+recff_ffi_abi,
+recff_ffi_gc
+};
+
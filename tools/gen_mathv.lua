@@ -61,6 +61,7 @@ local func_defs = {
             {
                 cname = "ADD_OP",
                 ret_type = "f32",
+                simd = "add",
                 args = {
                     {name = "x", type = "f32"},
                     {name = "y", type = "f32"},
@@ -132,6 +133,7 @@ local func_defs = {
             {
                 cname = "SUB_OP",
                 ret_type = "f32",
+                simd = "sub",
                 args = {
                     {name = "x", type = "f32"},
                     {name = "y", type = "f32"},
@@ -202,6 +204,7 @@ local func_defs = {
             {
                 cname = "MUL_OP",
                 ret_type = "f32",
+                simd = "mul",
                 args = {
                     {name = "x", type = "f32"},
                     {name = "y", type = "f32"},
@@ -273,6 +276,7 @@ local func_defs = {
             {
                 cname = "DIV_OP",
                 ret_type = "f32",
+                simd = "div",
                 args = {
                     {name = "x", type = "f32"},
                     {name = "y", type = "f32"},
@@ -504,6 +508,7 @@ local func_defs = {
             {
                 cname = "fabsf",
                 ret_type = "f32",
+                simd = "abs",
                 args = {
                     {name = "val", type = "f32"}
                 },
@@ -606,6 +611,7 @@ local func_defs = {
             {
                 cname = "ceilf",
                 ret_type = "f32",
+                simd = "ceil",
                 args = {
                     {name = "val", type = "f32"}
                 },
@@ -650,6 +656,7 @@ local func_defs = {
             {
                 cname = "cosf",
                 ret_type = "f32",
+                simd = "cos",
                 args = {
                     {name = "angle", type = "f32"}
                 },
@@ -670,6 +677,7 @@ local func_defs = {
             {
                 cname = "floorf",
                 ret_type = "f32",
+                simd = "floor",
                 args = {
                     {name = "val", type = "f32"}
                 },
@@ -730,6 +738,7 @@ local func_defs = {
             {
                 cname = "am_max",
                 ret_type = "f32",
+                simd = "max",
                 args = {
                     {name = "a", type = "f32"},
                     {name = "b", type = "f32"},
@@ -752,6 +761,7 @@ local func_defs = {
             {
                 cname = "am_min",
                 ret_type = "f32",
+                simd = "min",
                 args = {
                     {name = "a", type = "f32"},
                     {name = "b", type = "f32"},
@@ -818,6 +828,7 @@ local func_defs = {
             {
                 cname = "sinf",
                 ret_type = "f32",
+                simd = "sin",
                 args = {
                     {name = "angle", type = "f32"}
                 },
@@ -2343,6 +2354,7 @@ local gen_funcs
 local gen_func
 local gen_component_wise_func_impl
 local gen_component_wise_func_variant
+local gen_component_wise_loop_func
 local gen_component_wise_inner_loop
 local gen_element_wise_func_impl
 local gen_element_wise_func_variant
@@ -2421,16 +2433,19 @@ function gen_component_wise_func_impl(f, func)
             arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
             &output_count, &output_components, &args_are_dense);
     ]]
+    for v, variant in ipairs(func.variants) do
+        gen_component_wise_loop_func(f, func, variant, v)
+    end
     ind(f, 0, func_decl)
     ind(f, 1, prelude)
-    for _, variant in ipairs(func.variants) do
-        gen_component_wise_func_variant(f, func, variant)
+    for v, variant in ipairs(func.variants) do
+        gen_component_wise_func_variant(f, func, variant, v)
     end
     ind(f, 1, return_sig_error)
     ind(f, 0, "}\n\n")
 end
 
-function gen_component_wise_func_variant(f, func, variant)
+function gen_component_wise_func_variant(f, func, variant, v)
     local args = variant.args
     local nargs = #args
     local ret_view_type = view_type_info[variant.ret_type].enumval
@@ -2442,12 +2457,19 @@ function gen_component_wise_func_variant(f, func, variant)
     end
 
     ind(f, 1, "if ("..sig_test..") {\n")
-    gen_component_wise_inner_loop(f, func, variant)
+    gen_component_wise_inner_loop(f, func, variant, v)
     ind(f, 2, "return 1;\n")
     ind(f, 1, "}\n")
 end
 
-function gen_component_wise_inner_loop(f, func, variant)
+local
+function component_wise_loop_func_name(func, v)
+    return func.name.."_loop_"..v
+end
+
+-- generates a function that runs the loop for a range of elements,
+-- so large views can be split across threads (see run_component_wise_loop)
+function gen_component_wise_loop_func(f, func, variant, v)
     local ret_ctype = view_type_info[variant.ret_type].ctype
     local component_size = "sizeof("..ret_ctype..")"
     local setup_dense_arg_arrays = ""
@@ -2472,8 +2494,27 @@ function gen_component_wise_inner_loop(f, func, variant)
             nondense_call_args = nondense_call_args..", "
         end
     end
-    local loop = [[
-    if (output_is_dense && args_are_dense) {
+    local loop
+    if variant.simd then
+        -- use the vectorized kernels in am_mathv_simd.cpp
+        local kernel = "am_mathv_f32."..variant.simd
+        local dense_kernel_args = ""
+        local strided_kernel_args = ""
+        for a, arg in ipairs(variant.args) do
+            dense_kernel_args = dense_kernel_args.."(float*)arg_data["..(a-1).."], "
+            strided_kernel_args = strided_kernel_args..",\n            arg_data["..(a-1).."], arg_stride["..(a-1).."], arg_components["..(a-1).."]"
+        end
+        loop = [[
+    if (loop->dense) {
+        ]]..kernel..[[((float*)output_data, ]]..dense_kernel_args..[[output_count * output_components);
+    } else {
+        am_mathv_f32_strided]]..#variant.args..[[(]]..kernel..[[, output_count, output_components,
+            output_data, output_stride]]..strided_kernel_args..[[);
+    }
+    ]]
+    else
+    loop = [[
+    if (loop->dense) {
         ]]..ret_ctype..[[ *out_arr = (]]..ret_ctype..[[*)output_data;
         ]]..setup_dense_arg_arrays..[[
 
@@ -2494,14 +2535,37 @@ function gen_component_wise_inner_loop(f, func, variant)
         }
     }
     ]]
+    end
+
+    local nargs = #variant.args
+    ind(f, 0, "static void "..component_wise_loop_func_name(func, v).."(component_wise_loop *loop, unsigned int start, unsigned int end) {\n")
+    ind(f, 1, [[
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    uint8_t *output_data = loop->output_data + start * output_stride;
+    uint8_t *arg_data[]]..nargs..[[];
+    unsigned int arg_stride[]]..nargs..[[];
+    unsigned int arg_components[]]..nargs..[[];
+    for (unsigned int a = 0; a < ]]..nargs..[[; a++) {
+        arg_stride[a] = loop->arg_stride[a];
+        arg_components[a] = loop->arg_components[a];
+        arg_data[a] = loop->arg_data[a] + start * arg_stride[a];
+    }
+]])
+    ind(f, 1, loop)
+    ind(f, 0, "}\n\n")
+end
 
+function gen_component_wise_inner_loop(f, func, variant, v)
     for i, arg in ipairs(variant.args) do
         ind(f, 2, "arg_view_type["..(i-1).."] = "..view_type_info[arg.type].enumval..";")
     end
     ind(f, 2, "setup_non_view_args(L, \"mathv."..func.name.."\", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);")
     ind(f, 2, "output_view_type = "..view_type_info[variant.ret_type].enumval..";")
     ind(f, 2, "create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);")
-    ind(f, 2, loop)
+    ind(f, 2, "run_component_wise_loop("..component_wise_loop_func_name(func, v)..", nargs, arg_type, arg_view_type, arg_data, arg_stride, arg_components,\n"..
+        "    output_view_type, output_count, output_components, output_stride, output_data, output_is_dense && args_are_dense);\n")
 end
 
 function gen_element_wise_func_impl(f, func)
@@ -2607,6 +2671,8 @@ local
 function gen_open_module_func(f)
     f:write([[
 void am_open_mathv_module(lua_State *L) {
+    am_init_mathv_kernels();
+    init_mathv_threads();
     luaL_Reg vfuncs[] = {
         {"range",    am_mathv_range},
         {"random",   am_mathv_random},
@@ -2615,6 +2681,9 @@ void am_open_mathv_module(lua_State *L) {
         {"sum",      am_mathv_sum},
         {"greatest", am_mathv_greatest},
         {"least",    am_mathv_least},
+        {"simd",     am_mathv_simd},
+        {"threads",  am_mathv_threads},
+        {"_compile_expr", am_mathv_compile_expr},
 ]])
     for _, func in ipairs(func_defs) do
         f:write("        {\""..func.name.."\", am_mathv_"..func.name.."},\n")
@@ -2623,6 +2692,7 @@ void am_open_mathv_module(lua_State *L) {
         {NULL, NULL}
     };
     am_open_module(L, "mathv", vfuncs);
+    register_mathv_expr_mt(L);
 }
 ]])
 end
@@ -2672,6 +2742,7 @@ function gen_cpp_file()
 
 #include "amulet.h"
 #include "am_mathv_helper.inc"
+#include "am_mathv_expr.inc"
 
 ]])
     gen_funcs(f)